@@ -1,7 +1,10 @@
 #include <vector>
 #include <algorithm>
+#include <climits>
 #include <iostream>
 
+#include "../common/simd_compress.h"
+
 using namespace std;
 
 // Brute Force Approach: Combine, sort, and remove duplicates
@@ -82,6 +85,296 @@ public:
     }
 };
 
+// Sorted-set engine for posting-list style inputs: every operation takes
+// sorted vectors (duplicates allowed) and returns a sorted, duplicate-free
+// result. Auto entry points pick the kernel from the size ratio: when one
+// side is at least SKEW times longer, the short side drives and the long side
+// is skipped by galloping (exponential then binary search) instead of being
+// compared element by element; otherwise the inputs are merged linearly, with
+// an AVX2 bitonic merge network for union.
+class SortedSetOps {
+public:
+    static constexpr size_t SKEW = 32;
+
+    // Time Complexity: O(n + m) (galloping: O(n + m) with the long side copied
+    // in bulk; SIMD: O((n + m) / 8) network steps)
+    // Space Complexity: O(n + m) for the result
+    static vector<int> unite(const vector<int>& a, const vector<int>& b) {
+        if (skewed(a, b)) return a.size() < b.size() ? uniteGalloping(a, b) : uniteGalloping(b, a);
+#if defined(__AVX2__)
+        return uniteSimd(a, b);
+#else
+        return uniteLinear(a, b);
+#endif
+    }
+
+    // Time Complexity: O(min * log(max / min)) skewed, O(n + m) otherwise
+    // Space Complexity: O(min(n, m)) for the result
+    static vector<int> intersect(const vector<int>& a, const vector<int>& b) {
+        const vector<int>& small = a.size() < b.size() ? a : b;
+        const vector<int>& large = a.size() < b.size() ? b : a;
+        vector<int> out(small.size());
+        Writer w(out.data());
+        if (skewed(a, b)) {
+            const int* pos = large.data();
+            const int* end = large.data() + large.size();
+            for (int x : small) {
+                pos = gallop(pos, end, x);
+                if (pos == end) break;
+                if (*pos == x) w.push(x);
+            }
+        } else {
+            size_t i = 0, j = 0;
+            while (i < a.size() && j < b.size()) {
+                if (a[i] < b[j]) i++;
+                else if (b[j] < a[i]) j++;
+                else {
+                    w.push(a[i]);
+                    i++;
+                    j++;
+                }
+            }
+        }
+        out.resize(w.size());
+        return out;
+    }
+
+    // Elements of a that are not in b.
+    // Time Complexity: O(n log(m / n)) when b is much longer, O(n + m log(n / m))
+    // when a is, O(n + m) otherwise
+    // Space Complexity: O(n) for the result
+    static vector<int> subtract(const vector<int>& a, const vector<int>& b) {
+        vector<int> out(a.size());
+        Writer w(out.data());
+        const int* ai = a.data();
+        const int* aEnd = a.data() + a.size();
+        const int* bi = b.data();
+        const int* bEnd = b.data() + b.size();
+        if (b.size() >= SKEW * a.size()) {
+            for (; ai < aEnd; ai++) {
+                bi = gallop(bi, bEnd, *ai);
+                if (bi == bEnd || *bi != *ai) w.push(*ai);
+            }
+        } else if (a.size() >= SKEW * b.size()) {
+            // Copy the runs of a between consecutive elements of b.
+            for (; bi < bEnd; bi++) {
+                const int* cut = gallop(ai, aEnd, *bi);
+                w.pushRange(ai, cut);
+                ai = cut;
+                while (ai < aEnd && *ai == *bi) ai++;
+            }
+            w.pushRange(ai, aEnd);
+        } else {
+            while (ai < aEnd) {
+                if (bi == bEnd || *ai < *bi) w.push(*ai++);
+                else if (*bi < *ai) bi++;
+                else ai++;
+            }
+        }
+        out.resize(w.size());
+        return out;
+    }
+
+    // Union of any number of lists through a loser tree: each output element
+    // costs one replay of log2(k) comparisons from the leaf that supplied it.
+    // Time Complexity: O(N log k), N = total length
+    // Space Complexity: O(k) besides the result
+    static vector<int> uniteAll(const vector<vector<int>>& lists) {
+        size_t total = 0;
+        for (auto& l : lists) total += l.size();
+        vector<int> out(total);
+        Writer w(out.data());
+        LoserTree tree(lists);
+        while (!tree.empty()) w.push(tree.pop());
+        out.resize(w.size());
+        return out;
+    }
+
+    static vector<int> uniteLinear(const vector<int>& a, const vector<int>& b) {
+        vector<int> out(a.size() + b.size());
+        Writer w(out.data());
+        size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size()) w.push(a[i] <= b[j] ? a[i++] : b[j++]);
+        w.pushRange(a.data() + i, a.data() + a.size());
+        w.pushRange(b.data() + j, b.data() + b.size());
+        out.resize(w.size());
+        return out;
+    }
+
+    // small drives; the stretches of large between its elements are copied.
+    static vector<int> uniteGalloping(const vector<int>& small, const vector<int>& large) {
+        vector<int> out(small.size() + large.size());
+        Writer w(out.data());
+        const int* pos = large.data();
+        const int* end = large.data() + large.size();
+        for (int x : small) {
+            const int* cut = gallop(pos, end, x);
+            w.pushRange(pos, cut);
+            w.push(x);
+            pos = cut;
+        }
+        w.pushRange(pos, end);
+        out.resize(w.size());
+        return out;
+    }
+
+#if defined(__AVX2__)
+    // Merges eight elements per step: the two sorted registers go through a
+    // bitonic network, the low half is emitted and the high half waits for
+    // the next block from whichever input has the smaller head. Emitted
+    // lanes equal to their predecessor are dropped with compressStore8.
+    static vector<int> uniteSimd(const vector<int>& a, const vector<int>& b) {
+        if (a.size() < 8 || b.size() < 8) return uniteLinear(a, b);
+        vector<int> out(a.size() + b.size() + 8); // compressStore8 may write 8 lanes
+        const int* pa = a.data();
+        const int* aEnd = pa + a.size();
+        const int* pb = b.data();
+        const int* bEnd = pb + b.size();
+        int* w = out.data();
+        int last = a[0] < b[0] ? a[0] ^ 1 : b[0] ^ 1; // differs from the first output
+
+        __m256i lo = _mm256_loadu_si256((const __m256i*)pa);
+        __m256i hi = _mm256_loadu_si256((const __m256i*)pb);
+        pa += 8;
+        pb += 8;
+        const __m256i shiftIdx = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+        for (;;) {
+            mergeNetwork(lo, hi);
+            __m256i prev = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(lo, shiftIdx), _mm256_set1_epi32(last), 1);
+            w += compressStore8(w, lo, ~laneMask8(_mm256_cmpeq_epi32(lo, prev)) & 0xFF);
+            last = _mm256_extract_epi32(lo, 7);
+            // The next block must come from the input with the smaller head;
+            // once that input has fewer than 8 left, the rest is scalar.
+            bool takeA = pb == bEnd || (pa < aEnd && *pa <= *pb);
+            if ((takeA ? aEnd - pa : bEnd - pb) < 8) break;
+            const int*& src = takeA ? pa : pb;
+            lo = _mm256_loadu_si256((const __m256i*)src);
+            src += 8;
+        }
+
+        // hi holds the 8 largest merged so far; finish the tails in scalar.
+        int pending[8];
+        _mm256_storeu_si256((__m256i*)pending, hi);
+        Writer tail(w, last);
+        int k = 0;
+        while (k < 8 || pa < aEnd || pb < bEnd) {
+            int best = INT_MAX, from = -1;
+            if (k < 8) best = pending[k], from = 0;
+            if (pa < aEnd && (from < 0 || *pa < best)) best = *pa, from = 1;
+            if (pb < bEnd && (from < 0 || *pb < best)) best = *pb, from = 2;
+            if (from == 0) k++;
+            else if (from == 1) pa++;
+            else pb++;
+            tail.push(best);
+        }
+        out.resize(tail.end() - out.data());
+        return out;
+    }
+#endif
+
+private:
+    static bool skewed(const vector<int>& a, const vector<int>& b) {
+        size_t lo = min(a.size(), b.size()), hi = max(a.size(), b.size());
+        return lo > 0 && hi / SKEW >= lo;
+    }
+
+    // First position in [first, last) not less than x, probing 1, 2, 4, ...
+    // slots ahead before a binary search over the last doubling.
+    static const int* gallop(const int* first, const int* last, int x) {
+        size_t n = last - first, step = 1, lo = 0;
+        while (step <= n && first[step - 1] < x) {
+            lo = step;
+            step <<= 1;
+        }
+        return lower_bound(first + lo, first + min(step, n), x);
+    }
+
+    // Appends to a raw buffer, dropping an element equal to the previous one.
+    class Writer {
+        int* begin;
+        int* w;
+        bool any;
+        int last = 0;
+
+    public:
+        explicit Writer(int* out) : begin(out), w(out), any(false) {}
+        Writer(int* out, int previous) : begin(out), w(out), any(true), last(previous) {}
+
+        void push(int x) {
+            if (any && x == last) return;
+            *w++ = last = x;
+            any = true;
+        }
+        void pushRange(const int* first, const int* end) {
+            for (; first < end; first++) push(*first);
+        }
+        size_t size() const { return w - begin; }
+        int* end() const { return w; }
+    };
+
+    // Tournament tree over k cursors: node i (1 <= i < k) keeps the loser of
+    // the match played there and node 0 the overall winner. Leaves sit at
+    // k..2k-1, so any k works, not only powers of two.
+    class LoserTree {
+        const vector<vector<int>>& lists;
+        vector<size_t> cursor;
+        vector<int> node;
+        int k;
+
+        long long key(int leaf) const {
+            return cursor[leaf] < lists[leaf].size() ? lists[leaf][cursor[leaf]] : LLONG_MAX;
+        }
+
+    public:
+        explicit LoserTree(const vector<vector<int>>& l) : lists(l), cursor(l.size(), 0), k((int)l.size()) {
+            node.assign(max(k, 1), 0);
+            if (k == 0) return;
+            vector<int> winner(2 * k);
+            for (int i = 0; i < k; i++) winner[k + i] = i;
+            for (int i = k - 1; i >= 1; i--) {
+                int x = winner[2 * i], y = winner[2 * i + 1];
+                bool xWins = key(x) <= key(y);
+                winner[i] = xWins ? x : y;
+                node[i] = xWins ? y : x;
+            }
+            node[0] = k == 1 ? 0 : winner[1];
+        }
+
+        bool empty() const { return k == 0 || key(node[0]) == LLONG_MAX; }
+
+        int pop() {
+            int leaf = node[0];
+            int value = lists[leaf][cursor[leaf]++];
+            int win = leaf;
+            for (int i = (leaf + k) / 2; i >= 1; i /= 2) {
+                if (key(node[i]) < key(win)) swap(node[i], win);
+            }
+            node[0] = win;
+            return value;
+        }
+    };
+
+#if defined(__AVX2__)
+    // lo, hi sorted ascending -> lo gets the 8 smallest, hi the 8 largest.
+    static void mergeNetwork(__m256i& lo, __m256i& hi) {
+        hi = _mm256_permutevar8x32_epi32(hi, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        __m256i l = _mm256_min_epi32(lo, hi), h = _mm256_max_epi32(lo, hi);
+        lo = bitonicClean(l);
+        hi = bitonicClean(h);
+    }
+
+    // Sorts a bitonic register with compare-exchanges at distance 4, 2, 1.
+    static __m256i bitonicClean(__m256i v) {
+        __m256i p = _mm256_permute2x128_si256(v, v, 1);
+        v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xF0);
+        p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+        v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xCC);
+        p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xAA);
+    }
+#endif
+};
+
 // Main function to handle input and output
 int main() {
     int n, m;
@@ -103,5 +396,15 @@ int main() {
         cout << num << " ";
     }
     cout << endl;
+
+    // The same union through the engine, plus its companions
+    for (int num : SortedSetOps::unite(nums1, nums2)) cout << num << " ";
+    cout << endl;
+    for (int num : SortedSetOps::intersect(nums1, nums2)) cout << num << " ";
+    cout << endl;
+    for (int num : SortedSetOps::subtract(nums1, nums2)) cout << num << " ";
+    cout << endl;
+    for (int num : SortedSetOps::uniteAll({nums1, nums2, {1, 2, 3}})) cout << num << " ";
+    cout << endl;
     return 0;
 }
\ No newline at end of file
@@ -1,6 +1,16 @@
 #include <vector>
 #include <unordered_map>
 #include <iostream>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "../common/parallel.h"
+#include "../common/fast_io.h"
 
 using namespace std;
 
@@ -36,16 +46,148 @@ public:
     }
 };
 
+// XOR of data[0..n): four independent 256-bit accumulators hide the
+// latency of vpxor, 32 ints per iteration.
+// Time Complexity: O(n)
+// Space Complexity: O(1)
+inline int xorReduce(const int* data, size_t n) {
+    size_t i = 0;
+    int result = 0;
+#if defined(__AVX2__)
+    __m256i acc[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+    for (; i + 32 <= n; i += 32) {
+        for (int r = 0; r < 4; r++) {
+            acc[r] = _mm256_xor_si256(acc[r], _mm256_loadu_si256((const __m256i*)(data + i + 8 * r)));
+        }
+    }
+    __m256i v = _mm256_xor_si256(_mm256_xor_si256(acc[0], acc[1]), _mm256_xor_si256(acc[2], acc[3]));
+    __m128i h = _mm_xor_si128(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    h = _mm_xor_si128(h, _mm_shuffle_epi32(h, _MM_SHUFFLE(1, 0, 3, 2)));
+    h = _mm_xor_si128(h, _mm_shuffle_epi32(h, _MM_SHUFFLE(2, 3, 0, 1)));
+    result = _mm_cvtsi128_si32(h);
+#endif
+    for (; i < n; i++) result ^= data[i];
+    return result;
+}
+
+// Bit-sliced counters for "every value appears k times except one". Plane j
+// holds bit j of the count of every bit position at once (bit i of the plane
+// belongs to bit i of the input), so adding one input is a ripple of half
+// adders over the planes, and counts that reach k are cleared by matching
+// the planes against k's bits. With AVX2 each of the 8 lanes keeps its own
+// set of planes over a different element stream. Returns, for each of the
+// 32 bit positions, how many inputs had that bit set, modulo k.
+// Time Complexity: O(n log k / 8)
+// Space Complexity: O(log k)
+inline array<uint32_t, 32> bitCountsModK(const int* data, size_t n, uint32_t k) {
+    int planes = 32 - __builtin_clz(k); // enough bits to hold k itself
+    array<uint32_t, 32> counts{};
+    auto addLaneCounts = [&](const uint32_t* plane, int stride, int lanes) {
+        for (int lane = 0; lane < lanes; lane++) {
+            for (int bit = 0; bit < 32; bit++) {
+                uint32_t c = 0;
+                for (int j = 0; j < planes; j++) c |= (plane[j * stride + lane] >> bit & 1u) << j;
+                counts[bit] = (uint32_t)(((uint64_t)counts[bit] + c) % k);
+            }
+        }
+    };
+
+    size_t i = 0;
+#if defined(__AVX2__)
+    __m256i vplane[32];
+    for (int j = 0; j < planes; j++) vplane[j] = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi32(-1);
+    for (; i + 8 <= n; i += 8) {
+        __m256i carry = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i full = ones;
+        for (int j = 0; j < planes; j++) {
+            __m256i t = _mm256_and_si256(vplane[j], carry);
+            vplane[j] = _mm256_xor_si256(vplane[j], carry);
+            carry = t;
+            full = _mm256_and_si256(full, k >> j & 1 ? vplane[j] : _mm256_xor_si256(vplane[j], ones));
+        }
+        for (int j = 0; j < planes; j++) vplane[j] = _mm256_andnot_si256(full, vplane[j]);
+    }
+    alignas(32) uint32_t lanes[32 * 8];
+    for (int j = 0; j < planes; j++) _mm256_store_si256((__m256i*)(lanes + 8 * j), vplane[j]);
+    addLaneCounts(lanes, 8, 8);
+#endif
+    uint32_t plane[32] = {};
+    for (; i < n; i++) {
+        uint32_t carry = (uint32_t)data[i], full = ~0u;
+        for (int j = 0; j < planes; j++) {
+            uint32_t t = plane[j] & carry;
+            plane[j] ^= carry;
+            carry = t;
+            full &= k >> j & 1 ? plane[j] : ~plane[j];
+        }
+        for (int j = 0; j < planes; j++) plane[j] &= ~full;
+    }
+    addLaneCounts(plane, 1, 1);
+    return counts;
+}
+
+// Chunked and vectorized variants for very long inputs.
+class ParallelSolution {
+public:
+    static constexpr size_t PARALLEL_THRESHOLD = 1 << 20;
+
+    // Time Complexity: O(n / threads)
+    // Space Complexity: O(threads)
+    int singleNumber(const vector<int>& nums, int threads = 0) {
+        threads = nums.size() < PARALLEL_THRESHOLD ? 1 : resolveThreads(threads);
+        vector<int> partial(threads, 0);
+        parallelChunks((long long)nums.size(), threads, [&](long long begin, long long end, int t) {
+            partial[t] = xorReduce(nums.data() + begin, end - begin);
+        });
+        int result = 0;
+        for (int x : partial) result ^= x;
+        return result;
+    }
+
+    // Every element appears k times except one, which appears a number of
+    // times that is not a multiple of k (usually once). k >= 2; for k = 2
+    // prefer singleNumber() above.
+    // Time Complexity: O(n log k / (8 * threads))
+    // Space Complexity: O(threads)
+    int singleNumberK(const vector<int>& nums, int k, int threads = 0) {
+        if (k < 2) throw invalid_argument("singleNumberK: k must be at least 2");
+        threads = nums.size() < PARALLEL_THRESHOLD ? 1 : resolveThreads(threads);
+        vector<array<uint32_t, 32>> partial(threads, array<uint32_t, 32>{});
+        parallelChunks((long long)nums.size(), threads, [&](long long begin, long long end, int t) {
+            partial[t] = bitCountsModK(nums.data() + begin, end - begin, (uint32_t)k);
+        });
+        uint32_t result = 0;
+        for (int bit = 0; bit < 32; bit++) {
+            uint64_t count = 0;
+            for (auto& p : partial) count += p[bit];
+            if (count % k) result |= 1u << bit;
+        }
+        return (int)result;
+    }
+};
+
 // Main function to handle input and output
 int main() {
     int n;
-    cin >> n;
-    vector<int> nums(n);
-    for (int i = 0; i < n; ++i) {
-        cin >> nums[i];
+    vector<int> nums;
+    try {
+        FastInput in;
+        in >> n;
+        if (n < 0) throw runtime_error("array length must be non-negative");
+        nums.resize(n);
+        in.read(nums.data(), n);
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
     }
 
     OptimalSolution opt;
     cout << opt.singleNumber(nums) << endl;
+
+    ParallelSolution par;
+    cout << par.singleNumber(nums) << endl;
+    vector<int> triples = {5, -3, 5, 9, -3, 5, -3};
+    cout << par.singleNumberK(triples, 3) << endl; // 9
     return 0;
 }
\ No newline at end of file
@@ -1,7 +1,11 @@
 #include <vector>
-#include <unordered_map>
+#include <algorithm>
 #include <iostream>
 
+#include "../common/flat_hash_map.h"
+#include "../common/fast_io.h"
+#include "../common/subarray_window.h"
+
 using namespace std;
 
 // Brute Force Approach: Check all possible subarrays
@@ -29,7 +33,7 @@ public:
 class OptimalSolution {
 public:
     int longestSubarrayWithSumK(vector<int>& nums, int k) {
-        unordered_map<long long, int> prefixSum; // Map to store prefix sum and earliest index
+        FlatHashMap<long long, int> prefixSum(nums.size() + 1); // Map to store prefix sum and earliest index
         long long sum = 0; // Current prefix sum
         int maxLength = 0;
         prefixSum[0] = -1; // Initialize for subarray starting at index 0
@@ -37,29 +41,46 @@ public:
         for (int i = 0; i < nums.size(); ++i) {
             sum += nums[i];
             // If (sum - k) exists, a subarray with sum k is found
-            if (prefixSum.find(sum - k) != prefixSum.end()) {
-                maxLength = max(maxLength, i - prefixSum[sum - k]);
+            if (const int* first = prefixSum.find(sum - k)) {
+                maxLength = max(maxLength, i - *first);
             }
             // Store the earliest index for this sum to maximize subarray length
-            if (prefixSum.find(sum) == prefixSum.end()) {
-                prefixSum[sum] = i;
-            }
+            prefixSum.tryEmplace(sum, i);
         }
         return maxLength;
     }
 };
 
+// Adaptive Approach: sliding window for non-negative input (detected while
+// scanning, or given as a hint), prefix-sum hashing otherwise
+class AdaptiveSolution {
+public:
+    int longestSubarrayWithSumK(vector<int>& nums, int k, SignHint hint = SignHint::Detect) {
+        bool nonNegative = hint == SignHint::NonNegative ||
+                           (hint == SignHint::Detect && !hasNegative(nums.data(), nums.size()));
+        if (nonNegative) return longestSubarrayNonNegative(nums, k);
+        OptimalSolution opt;
+        return opt.longestSubarrayWithSumK(nums, k);
+    }
+};
+
 // Main function to handle input and output
 int main() {
     int n, k;
-    cin >> n;
-    vector<int> nums(n);
-    for (int i = 0; i < n; ++i) {
-        cin >> nums[i];
+    vector<int> nums;
+    try {
+        FastInput in;
+        in >> n;
+        if (n < 0) throw runtime_error("array length must be non-negative");
+        nums.resize(n);
+        in.read(nums.data(), n);
+        in >> k;
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
     }
-    cin >> k;
 
-    OptimalSolution opt;
-    cout << opt.longestSubarrayWithSumK(nums, k) << endl;
+    AdaptiveSolution solver;
+    cout << solver.longestSubarrayWithSumK(nums, k) << endl;
     return 0;
 }
\ No newline at end of file
@@ -48,6 +48,143 @@ public:
     }
 };
 
+// Non-owning row-major matrix: element (r, c) is data[r * stride + c].
+struct MatrixView {
+    const int* data;
+    size_t rows, cols, stride;
+
+    const int& at(size_t r, size_t c) const { return data[r * stride + c]; }
+};
+
+// Lazy spiral order: yields references into the view one element at a time,
+// nothing is copied. The state is the current ring's bounds, which of its
+// four sides is being walked and the position on that side; sides are the
+// same as in OptimalSolution, so single rows and columns come out once.
+// Time Complexity: O(1) amortized per step
+// Space Complexity: O(1)
+class SpiralIterator {
+    MatrixView m;
+    long top = 0, bottom = -1, left = 0, right = -1;
+    int side = 0; // 0 top row ->, 1 right column v, 2 bottom row <-, 3 left column ^
+    long pos = 0;
+    size_t remaining = 0;
+
+    void nextSide() {
+        if (++side == 4) {
+            side = 0;
+            top++;
+            bottom--;
+            left++;
+            right--;
+        }
+    }
+
+    // Moves pos to the first element of the current side, skipping sides
+    // that are empty in this ring.
+    void enterSide() {
+        for (;;) {
+            if (side == 0) { pos = left; return; }
+            if (side == 1 && top + 1 <= bottom) { pos = top + 1; return; }
+            if (side == 2 && top < bottom && right - 1 >= left) { pos = right - 1; return; }
+            if (side == 3 && left < right && bottom - 1 >= top + 1) { pos = bottom - 1; return; }
+            nextSide();
+        }
+    }
+
+public:
+    using iterator_category = forward_iterator_tag;
+    using value_type = int;
+    using difference_type = ptrdiff_t;
+    using pointer = const int*;
+    using reference = const int&;
+
+    SpiralIterator() : m{nullptr, 0, 0, 0} {} // end
+    explicit SpiralIterator(MatrixView view)
+        : m(view), bottom((long)view.rows - 1), right((long)view.cols - 1), remaining(view.rows * view.cols) {
+        if (remaining) enterSide();
+    }
+
+    const int& operator*() const {
+        switch (side) {
+            case 0: return m.at(top, pos);
+            case 1: return m.at(pos, right);
+            case 2: return m.at(bottom, pos);
+            default: return m.at(pos, left);
+        }
+    }
+
+    SpiralIterator& operator++() {
+        if (--remaining == 0) return *this;
+        bool done = side == 0 ? ++pos > right : side == 1 ? ++pos > bottom : side == 2 ? --pos < left : --pos <= top;
+        if (done) {
+            nextSide();
+            enterSide();
+        }
+        return *this;
+    }
+
+    SpiralIterator operator++(int) {
+        SpiralIterator before = *this;
+        ++*this;
+        return before;
+    }
+
+    bool operator!=(const SpiralIterator& o) const { return remaining != o.remaining; }
+    bool operator==(const SpiralIterator& o) const { return remaining == o.remaining; }
+};
+
+struct SpiralRange {
+    MatrixView view;
+    SpiralIterator begin() const { return SpiralIterator(view); }
+    SpiralIterator end() const { return SpiralIterator(); }
+};
+
+// Blocked spiral walk: calls emit(value) in spiral order. Rows are already
+// sequential; the columns are what hurt, since each step lands on a new
+// cache line. Rings are therefore taken RING_BLOCK at a time: the right and
+// left strips of the whole group (RING_BLOCK columns each, one cache line
+// per row) are read once, row by row, into column-major buffers, and every
+// ring of the group then walks its two columns from those buffers.
+// Time Complexity: O(rows * cols)
+// Space Complexity: O(RING_BLOCK * rows)
+static constexpr long RING_BLOCK = 16; // one 64-byte line of ints
+
+template <class Emit>
+void spiralForEachBlocked(MatrixView m, Emit emit) {
+    long top = 0, bottom = (long)m.rows - 1, left = 0, right = (long)m.cols - 1;
+    vector<int> rightStrip, leftStrip;
+    while (top <= bottom && left <= right) {
+        long rings = min({RING_BLOCK, (bottom - top) / 2 + 1, (right - left) / 2 + 1});
+        long height = bottom - top + 1;
+        rightStrip.resize(rings * height);
+        leftStrip.resize(rings * height);
+        for (long r = top; r <= bottom; r++) {
+            const int* row = &m.at(r, 0);
+            for (long k = 0; k < rings; k++) {
+                rightStrip[k * height + (r - top)] = row[right - k];
+                leftStrip[k * height + (r - top)] = row[left + k];
+            }
+        }
+        for (long k = 0; k < rings; k++) {
+            long t = top + k, b = bottom - k, l = left + k, rt = right - k;
+            const int* rightCol = rightStrip.data() + k * height; // row i at [i - top]
+            const int* leftCol = leftStrip.data() + k * height;
+            for (long j = l; j <= rt; j++) emit(m.at(t, j));
+            for (long i = t + 1; i <= b; i++) emit(rightCol[i - top]);
+            if (t < b) {
+                for (long j = rt - 1; j >= l; j--) emit(m.at(b, j));
+            }
+            if (l < rt) {
+                for (long i = b - 1; i > t; i--) emit(leftCol[i - top]);
+            }
+        }
+        top += rings;
+        bottom -= rings;
+        left += rings;
+        right -= rings;
+    }
+}
+
 int main() {
     int m, n;
     cin >> m >> n;
@@ -60,5 +197,14 @@ int main() {
     vector<int> res = opt.spiralOrder(matrix);
     for (int x : res) cout << x << " ";
     cout << endl;
+
+    // Same order without materializing it, over a flat copy of the input
+    vector<int> flat;
+    for (auto& row : matrix) flat.insert(flat.end(), row.begin(), row.end());
+    MatrixView view{flat.data(), (size_t)m, (size_t)n, (size_t)n};
+    for (int x : SpiralRange{view}) cout << x << " ";
+    cout << endl;
+    spiralForEachBlocked(view, [](int x) { cout << x << " "; });
+    cout << endl;
     return 0;
 }
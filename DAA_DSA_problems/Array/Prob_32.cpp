@@ -45,6 +45,59 @@ public:
     }
 };
 
+// Persistent set of disjoint closed intervals for merge-on-insert workloads.
+// A balanced tree keyed by start holds the merged intervals; insert(l, r)
+// finds the neighbour that could reach l, absorbs every interval starting
+// at or before r and stores the union. Intervals that touch at an endpoint
+// merge, as in OptimalSolution. Every stored interval is erased at most once,
+// so insert is amortized O(log n).
+class IntervalSet {
+    map<int64_t, int64_t> byStart; // start -> end, disjoint, non-touching
+
+public:
+    using Interval = pair<int64_t, int64_t>;
+
+    // Time Complexity: O(log n) amortized
+    // Space Complexity: O(1) amortized
+    void insert(int64_t l, int64_t r) {
+        if (l > r) swap(l, r);
+        auto it = byStart.upper_bound(l);
+        if (it != byStart.begin() && prev(it)->second >= l) --it;
+        while (it != byStart.end() && it->first <= r) {
+            l = min(l, it->first);
+            r = max(r, it->second);
+            it = byStart.erase(it);
+        }
+        byStart.emplace_hint(it, l, r);
+    }
+
+    // Time Complexity: O(log n)
+    bool contains(int64_t x) const {
+        auto it = byStart.upper_bound(x);
+        return it != byStart.begin() && prev(it)->second >= x;
+    }
+
+    // Whether any stored interval intersects [l, r].
+    // Time Complexity: O(log n)
+    bool overlaps(int64_t l, int64_t r) const {
+        auto it = byStart.upper_bound(r);
+        return it != byStart.begin() && prev(it)->second >= l;
+    }
+
+    // Stored intervals that intersect [l, r], in order.
+    // Time Complexity: O(log n + k)
+    vector<Interval> overlapping(int64_t l, int64_t r) const {
+        vector<Interval> out;
+        auto it = byStart.upper_bound(l);
+        if (it != byStart.begin() && prev(it)->second >= l) --it;
+        for (; it != byStart.end() && it->first <= r; ++it) out.push_back(*it);
+        return out;
+    }
+
+    size_t size() const { return byStart.size(); }
+    vector<Interval> intervals() const { return vector<Interval>(byStart.begin(), byStart.end()); }
+};
+
 int main() {
     int n;
     cin >> n;
@@ -57,5 +110,12 @@ int main() {
     for (auto &v : ans)
         cout << "[" << v[0] << "," << v[1] << "] ";
     cout << endl;
+
+    // The same merge, one booking at a time
+    IntervalSet bookings;
+    for (auto &v : intervals) bookings.insert(v[0], v[1]);
+    for (auto [l, r] : bookings.intervals())
+        cout << "[" << l << "," << r << "] ";
+    cout << endl;
     return 0;
 }
@@ -1,4 +1,9 @@
 #include <bits/stdc++.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "../common/parallel.h"
+#include "../common/fast_io.h"
 using namespace std;
 
 // Brute Force: Count frequency using a map
@@ -38,14 +43,114 @@ public:
     }
 };
 
+// Sum and sum of squares of data[0..n) modulo 2^64 (values are in 1..n, so
+// non-negative). Wrapping is deliberate: the caller only needs the
+// differences from the expected sums, which are small enough to come back
+// exactly out of the low 64 bits, so nothing wider than 64 bits is kept.
+// AVX2 widens 8 ints to two registers of 64-bit lanes per step and squares
+// them with vpmuludq.
+// Time Complexity: O(n)
+// Space Complexity: O(1)
+inline pair<uint64_t, uint64_t> sumAndSquares(const int* data, size_t n) {
+    uint64_t sum = 0, squares = 0;
+    size_t i = 0;
+#if defined(__AVX2__)
+    __m256i s = _mm256_setzero_si256(), q = _mm256_setzero_si256();
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i lo = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v));
+        __m256i hi = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1));
+        s = _mm256_add_epi64(s, _mm256_add_epi64(lo, hi));
+        q = _mm256_add_epi64(q, _mm256_add_epi64(_mm256_mul_epu32(lo, lo), _mm256_mul_epu32(hi, hi)));
+    }
+    alignas(32) uint64_t lanes[8];
+    _mm256_store_si256((__m256i*)lanes, s);
+    _mm256_store_si256((__m256i*)(lanes + 4), q);
+    sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    squares = lanes[4] + lanes[5] + lanes[6] + lanes[7];
+#endif
+    for (; i < n; i++) {
+        uint64_t x = (uint32_t)data[i];
+        sum += x;
+        squares += x * x;
+    }
+    return {sum, squares};
+}
+
+// Streaming: one pass, O(1) memory, 64-bit arithmetic throughout.
+// With A repeated and B missing, sum - n(n+1)/2 = A - B and
+// squares - n(n+1)(2n+1)/6 = A^2 - B^2; both fit in 64 bits, so computing
+// everything modulo 2^64 recovers them exactly even when the sums themselves
+// (about n^3 / 3 for the squares) do not fit. Chunks are summed in parallel
+// above PARALLEL_THRESHOLD. Only the two sums are checked: invalid_argument
+// is thrown when they match no pair A != B in 1..n, but other malformed
+// inputs can match one (1 2 3 4 8 6 7 8 9 1 gives [2, 8]), so untrusted
+// input needs its own check, e.g. a presence bitmap, at O(n) bits.
+// Time Complexity: O(n / threads)
+// Space Complexity: O(threads)
+class StreamingSolution {
+public:
+    static constexpr size_t PARALLEL_THRESHOLD = 1 << 20;
+
+    vector<int> findErrorNums(const vector<int>& nums, int threads = 0) {
+        uint64_t n = nums.size();
+        threads = n < PARALLEL_THRESHOLD ? 1 : resolveThreads(threads);
+        vector<pair<uint64_t, uint64_t>> partial(threads, {0, 0});
+        parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+            partial[t] = sumAndSquares(nums.data() + begin, end - begin);
+        });
+        uint64_t sum = 0, squares = 0;
+        for (auto [s, q] : partial) {
+            sum += s;
+            squares += q;
+        }
+        // n(n+1)/2 and n(n+1)(2n+1)/6 mod 2^64, dividing before multiplying
+        uint64_t a = n, b = n + 1, c = 2 * n + 1;
+        (a % 2 == 0 ? a : b) /= 2;
+        uint64_t expectedSum = a * b;
+        a = n, b = n + 1;
+        (a % 2 == 0 ? a : b) /= 2;
+        if (a % 3 == 0) a /= 3;
+        else if (b % 3 == 0) b /= 3;
+        else c /= 3;
+        uint64_t expectedSquares = a * b * c;
+
+        int64_t diff = (int64_t)(sum - expectedSum);         // A - B
+        int64_t diffSq = (int64_t)(squares - expectedSquares); // A^2 - B^2
+        if (diff == 0 || diffSq % diff != 0 || (diffSq / diff + diff) % 2 != 0) {
+            throw invalid_argument("findErrorNums: input is not 1..n with one value repeated");
+        }
+        int64_t sumAB = diffSq / diff; // A + B
+        int64_t A = (sumAB + diff) / 2, B = sumAB - A;
+        if (A < 1 || B < 1 || A > (int64_t)n || B > (int64_t)n) {
+            throw invalid_argument("findErrorNums: input is not 1..n with one value repeated");
+        }
+        return {(int)A, (int)B};
+    }
+};
+
 int main() {
     int n;
-    cin >> n;
-    vector<int> nums(n);
-    for (int i = 0; i < n; ++i) cin >> nums[i];
+    vector<int> nums;
+    try {
+        FastInput in;
+        in >> n;
+        if (n < 0) throw runtime_error("array length must be non-negative");
+        nums.resize(n);
+        in.read(nums.data(), n);
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
 
     OptimalSolution opt;
     vector<int> res = opt.findErrorNums(nums);
     cout << "[" << res[0] << "," << res[1] << "]" << endl;
+
+    if (n >= 2) {
+        StreamingSolution streaming;
+        res = streaming.findErrorNums(nums);
+        cout << "[" << res[0] << "," << res[1] << "]" << endl;
+    }
     return 0;
 }
@@ -1,7 +1,78 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include <chrono>
+#include <string>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+#include "../common/parallel.h"
 using namespace std;
 
+#if defined(__AVX512F__)
+// Full-mask forms of _mm512_min/max_epi32: the unmasked intrinsics pass
+// _mm512_undefined_epi32() as the merge source, which GCC 12 reports as
+// maybe-uninitialized once they are inlined. Both compile to one vpminsd /
+// vpmaxsd.
+inline __m512i min16(__m512i a, __m512i b) { return _mm512_mask_min_epi32(a, 0xFFFF, a, b); }
+inline __m512i max16(__m512i a, __m512i b) { return _mm512_mask_max_epi32(a, 0xFFFF, a, b); }
+#endif
+
+// Min and max of data[0..n), n >= 1, in one pass. Runs 16 lanes at a time
+// with AVX-512, 8 with AVX2 (two accumulators each, to hide the min/max
+// latency), then folds the lanes and finishes the tail in scalar code.
+// Time Complexity: O(n / lanes)
+// Space Complexity: O(1)
+inline pair<int, int> simdMinMax(const int* data, size_t n) {
+    int lo = data[0], hi = data[0];
+    size_t i = 0;
+#if defined(__AVX512F__)
+    if (n >= 32) {
+        __m512i mn0 = _mm512_loadu_si512(data), mx0 = mn0;
+        __m512i mn1 = _mm512_loadu_si512(data + 16), mx1 = mn1;
+        for (i = 32; i + 32 <= n; i += 32) {
+            __m512i a = _mm512_loadu_si512(data + i);
+            __m512i b = _mm512_loadu_si512(data + i + 16);
+            mn0 = min16(mn0, a);
+            mx0 = max16(mx0, a);
+            mn1 = min16(mn1, b);
+            mx1 = max16(mx1, b);
+        }
+        alignas(64) int lanesMin[16], lanesMax[16];
+        _mm512_store_si512(lanesMin, min16(mn0, mn1));
+        _mm512_store_si512(lanesMax, max16(mx0, mx1));
+        lo = *min_element(lanesMin, lanesMin + 16);
+        hi = *max_element(lanesMax, lanesMax + 16);
+    }
+#elif defined(__AVX2__)
+    if (n >= 16) {
+        const __m256i* v = reinterpret_cast<const __m256i*>(data);
+        __m256i mn0 = _mm256_loadu_si256(v), mx0 = mn0;
+        __m256i mn1 = _mm256_loadu_si256(v + 1), mx1 = mn1;
+        for (i = 16; i + 16 <= n; i += 16) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8));
+            mn0 = _mm256_min_epi32(mn0, a);
+            mx0 = _mm256_max_epi32(mx0, a);
+            mn1 = _mm256_min_epi32(mn1, b);
+            mx1 = _mm256_max_epi32(mx1, b);
+        }
+        alignas(32) int lanesMin[8], lanesMax[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanesMin), _mm256_min_epi32(mn0, mn1));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanesMax), _mm256_max_epi32(mx0, mx1));
+        lo = *min_element(lanesMin, lanesMin + 8);
+        hi = *max_element(lanesMax, lanesMax + 8);
+    }
+#endif
+    for (; i < n; i++) {
+        lo = min(lo, data[i]);
+        hi = max(hi, data[i]);
+    }
+    return {lo, hi};
+}
+
 class Solution {
 public:
     // ---------- Brute Force: Iterative ----------
@@ -23,9 +94,61 @@ public:
         // Recursive case: get max of first n-1 elements
         return max(arr[n - 1], recursiveMax(arr, n - 1));
     }
+
+    // ---------- Divide and Conquer without recursion ----------
+    // The same pairwise tournament the recursive split builds, evaluated
+    // bottom-up: each round keeps the larger of every adjacent pair, so the
+    // tree has log n levels but no call stack at all.
+    // Time Complexity: O(n)
+    // Space Complexity: O(n / 2) for the first round's winners
+    int divideAndConquerMax(const vector<int>& arr) {
+        size_t n = arr.size();
+        if (n == 1) return arr[0];
+        vector<int> round((n + 1) / 2);
+        for (size_t i = 0; i < n / 2; i++) round[i] = max(arr[2 * i], arr[2 * i + 1]);
+        if (n % 2) round.back() = arr[n - 1];
+        for (size_t len = round.size(); len > 1; len = (len + 1) / 2) {
+            for (size_t i = 0; i < len / 2; i++) round[i] = max(round[2 * i], round[2 * i + 1]);
+            if (len % 2) round[len / 2] = round[len - 1];
+        }
+        return round[0];
+    }
+
+    // ---------- Vectorized ----------
+    // Time Complexity: O(n / lanes)
+    // Space Complexity: O(1)
+    int simdMax(const vector<int>& arr) { return simdMinMax(arr.data(), arr.size()).second; }
+
+    // ---------- Parallel + Vectorized ----------
+    // Arrays above PARALLEL_THRESHOLD are cut into one contiguous chunk per
+    // thread, each reduced with simdMinMax, and the per-thread results are
+    // combined at the end. Smaller arrays are not worth the thread start-up.
+    // Time Complexity: O(n / (lanes * threads))
+    // Space Complexity: O(threads)
+    static constexpr size_t PARALLEL_THRESHOLD = 1 << 20;
+
+    pair<int, int> parallelMinMax(const vector<int>& arr, int threads = 0) {
+        size_t n = arr.size();
+        threads = resolveThreads(threads);
+        if (n < PARALLEL_THRESHOLD || threads == 1) return simdMinMax(arr.data(), n);
+        vector<pair<int, int>> partial(threads, {arr[0], arr[0]});
+        parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+            partial[t] = simdMinMax(arr.data() + begin, (size_t)(end - begin));
+        });
+        pair<int, int> result = partial[0];
+        for (auto& [lo, hi] : partial) {
+            result.first = min(result.first, lo);
+            result.second = max(result.second, hi);
+        }
+        return result;
+    }
+
+    int parallelMax(const vector<int>& arr, int threads = 0) { return parallelMinMax(arr, threads).second; }
 };
 
-int main() {
+// Pass "bench" to also time brute force against the parallel SIMD
+// min/max on 2^24 values.
+int main(int argc, char** argv) {
     Solution sol;
 
     // Example 1
@@ -37,6 +160,24 @@ int main() {
     vector<int> arr2 = {8, 10, 5, 7, 9};
     cout << "Brute Force Max (arr2): " << sol.bruteForceMax(arr2) << endl;
     cout << "Recursive Max (arr2): " << sol.recursiveMax(arr2, arr2.size()) << endl;
+    cout << "Divide and Conquer Max (arr2): " << sol.divideAndConquerMax(arr2) << endl;
+    cout << "SIMD Max (arr2): " << sol.simdMax(arr2) << endl;
+    cout << "Parallel Max (arr2): " << sol.parallelMax(arr2) << endl;
+
+    if (argc < 2 || string(argv[1]) != "bench") return 0;
+
+    // Large column: far too deep for recursiveMax.
+    vector<int> big(1 << 24);
+    for (size_t i = 0; i < big.size(); i++) big[i] = (int)((i * 2654435761u) % 1000000007u) - 500000000;
+    auto start = chrono::steady_clock::now();
+    int expected = sol.bruteForceMax(big);
+    double msBrute = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    pair<int, int> stats = sol.parallelMinMax(big);
+    double msFast = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "n = " << big.size() << ": brute max " << expected << " in " << msBrute << " ms; "
+         << "parallel SIMD min/max " << stats.first << "/" << stats.second << " in " << msFast << " ms"
+         << (stats.second == expected && sol.divideAndConquerMax(big) == expected ? "" : " (MISMATCH)") << endl;
 
     return 0;
 }
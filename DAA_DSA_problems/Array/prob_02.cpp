@@ -2,8 +2,97 @@
 #include <vector>
 #include <algorithm>
 #include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "../common/parallel.h"
 using namespace std;
 
+// The K largest distinct values of data[0..n), in descending order (fewer if
+// there are fewer distinct values), without touching the input.
+// Every SIMD lane keeps its own K best values as K registers sorted high to
+// low; a new vector is pushed down through them with a max/min exchange per
+// register, and a value equal to one already kept is dropped. Once the lanes
+// are warm almost every vector is below all K thresholds, which a single
+// compare-and-test rejects. The 8 * K lane values are merged at the end.
+// INT_MIN doubles as the empty-slot marker, so real INT_MINs are tracked by
+// a separate flag. Smallest = true returns the K smallest instead, by running
+// on ~x, which reverses the order of int exactly.
+// Time Complexity: O(n / 8) after warm-up, O(n * K / 8) worst case
+// Space Complexity: O(K)
+template <int K, bool Smallest = false>
+vector<int> topKDistinct(const int* data, size_t n) {
+    static_assert(K >= 1 && K <= 16, "K registers per lane");
+    vector<int> candidates;
+    bool sawMin = false;
+    size_t i = 0;
+#ifdef __AVX2__
+    const __m256i sentinel = _mm256_set1_epi32(INT_MIN);
+    const __m256i flip = _mm256_set1_epi32(Smallest ? -1 : 0);
+    __m256i best[K];
+    for (int j = 0; j < K; j++) best[j] = sentinel;
+    __m256i mins = _mm256_setzero_si256();
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), flip);
+        mins = _mm256_or_si256(mins, _mm256_cmpeq_epi32(x, sentinel));
+        if (_mm256_testz_si256(_mm256_cmpgt_epi32(x, best[K - 1]), _mm256_set1_epi32(-1))) continue;
+        for (int j = 0; j < K; j++) {
+            __m256i dup = _mm256_cmpeq_epi32(x, best[j]);
+            __m256i lower = _mm256_min_epi32(x, best[j]);
+            best[j] = _mm256_max_epi32(x, best[j]);
+            x = _mm256_blendv_epi8(lower, sentinel, dup);
+        }
+    }
+    sawMin = !_mm256_testz_si256(mins, mins);
+    alignas(32) int lanes[8];
+    for (int j = 0; j < K; j++) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), best[j]);
+        candidates.insert(candidates.end(), lanes, lanes + 8);
+    }
+#endif
+    int scalarBest[K];
+    for (int j = 0; j < K; j++) scalarBest[j] = INT_MIN;
+    for (; i < n; i++) {
+        int x = Smallest ? ~data[i] : data[i];
+        if (x == INT_MIN) sawMin = true;
+        if (x <= scalarBest[K - 1]) continue;
+        for (int j = 0; j < K && x != INT_MIN; j++) {
+            if (x == scalarBest[j]) break;
+            if (x > scalarBest[j]) swap(x, scalarBest[j]);
+        }
+    }
+    candidates.insert(candidates.end(), scalarBest, scalarBest + K);
+
+    sort(candidates.begin(), candidates.end(), greater<int>());
+    candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+    if (!candidates.empty() && candidates.back() == INT_MIN && !sawMin) candidates.pop_back();
+    if ((int)candidates.size() > K) candidates.resize(K);
+    if (Smallest) {
+        for (int& x : candidates) x = ~x;
+    }
+    return candidates;
+}
+
+// topKDistinct over one contiguous chunk per thread, merged at the end.
+// Time Complexity: O(n / (8 * threads)) after warm-up
+// Space Complexity: O(K * threads)
+template <int K, bool Smallest = false>
+vector<int> parallelTopKDistinct(const int* data, size_t n, int threads = 0) {
+    threads = resolveThreads(threads);
+    if (n < ((size_t)1 << 20) || threads == 1) return topKDistinct<K, Smallest>(data, n);
+    vector<vector<int>> partial(threads);
+    parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+        partial[t] = topKDistinct<K, Smallest>(data + begin, (size_t)(end - begin));
+    });
+    vector<int> merged;
+    for (auto& p : partial) merged.insert(merged.end(), p.begin(), p.end());
+    return topKDistinct<K, Smallest>(merged.data(), merged.size());
+}
+
 class Solution {
 public:
     // ---------- Brute Force: Sort ----------
@@ -61,9 +150,36 @@ public:
 
         return {secondSmallest, secondLargest};
     }
+
+    // ---------- Vectorized, non-mutating ----------
+    // Two top-2 kernels (largest and smallest distinct), same answer as
+    // optimal. Empty slots mean "no second value", reported as -1.
+    // Time Complexity: O(n / 8)
+    // Space Complexity: O(1)
+    pair<int, int> optimalSimd(const vector<int>& arr) {
+        if (arr.size() < 2) return {-1, -1};
+        return secondOf(topKDistinct<2, true>(arr.data(), arr.size()),
+                        topKDistinct<2>(arr.data(), arr.size()));
+    }
+
+    // ---------- Parallel + Vectorized ----------
+    // Time Complexity: O(n / (8 * threads))
+    // Space Complexity: O(threads)
+    pair<int, int> optimalParallel(const vector<int>& arr, int threads = 0) {
+        if (arr.size() < 2) return {-1, -1};
+        return secondOf(parallelTopKDistinct<2, true>(arr.data(), arr.size(), threads),
+                        parallelTopKDistinct<2>(arr.data(), arr.size(), threads));
+    }
+
+private:
+    static pair<int, int> secondOf(const vector<int>& smallest, const vector<int>& largest) {
+        return {smallest.size() > 1 ? smallest[1] : -1, largest.size() > 1 ? largest[1] : -1};
+    }
 };
 
-int main() {
+// Pass "bench" to also time the scalar and parallel SIMD top-k on
+// 2^24 values.
+int main(int argc, char** argv) {
     Solution sol;
 
     vector<int> arr = {1, 2, 4, 7, 7, 5};
@@ -76,5 +192,26 @@ int main() {
     cout << "Optimal -> Second Smallest: " << optimalAns.first
          << ", Second Largest: " << optimalAns.second << endl;
 
+    auto simdAns = sol.optimalSimd(arr);
+    cout << "SIMD -> Second Smallest: " << simdAns.first
+         << ", Second Largest: " << simdAns.second << endl;
+
+    if (argc < 2 || string(argv[1]) != "bench") return 0;
+
+    // Larger k on a big column, compared with a scalar single traversal.
+    vector<int> big(1 << 24);
+    for (size_t i = 0; i < big.size(); i++) big[i] = (int)((i * 2654435761u) % 1000003u);
+    auto start = chrono::steady_clock::now();
+    auto scalarAns = sol.optimal(big);
+    double msScalar = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    auto parallelAns = sol.optimalParallel(big);
+    double msParallel = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "n = " << big.size() << ": optimal " << msScalar << " ms, parallel SIMD " << msParallel << " ms"
+         << (scalarAns == parallelAns ? "" : " (MISMATCH)") << endl;
+    cout << "Top 8 largest:";
+    for (int x : parallelTopKDistinct<8>(big.data(), big.size())) cout << " " << x;
+    cout << endl;
+
     return 0;
 }
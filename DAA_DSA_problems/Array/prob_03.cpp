@@ -1,6 +1,15 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <chrono>
+#include <string>
+#include <functional>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "../common/parallel.h"
 using namespace std;
 
 // Brute Force Approach: O(n^2) time complexity
@@ -38,7 +47,121 @@ bool isSortedSTL(const vector<int>& arr) {
     return is_sorted(arr.begin(), arr.end());
 }
 
-int main() {
+// Orders for the vectorized checks. inOrder(a, b) says whether b may follow
+// a; the AVX2 hook returns all-ones lanes where it may not.
+struct Ascending {
+    static bool inOrder(int a, int b) { return a <= b; }
+#ifdef __AVX2__
+    static __m256i violations(__m256i a, __m256i b) { return _mm256_cmpgt_epi32(a, b); }
+#endif
+};
+struct Descending {
+    static bool inOrder(int a, int b) { return a >= b; }
+#ifdef __AVX2__
+    static __m256i violations(__m256i a, __m256i b) { return _mm256_cmpgt_epi32(b, a); }
+#endif
+};
+struct StrictlyAscending {
+    static bool inOrder(int a, int b) { return a < b; }
+#ifdef __AVX2__
+    static __m256i violations(__m256i a, __m256i b) {
+        return _mm256_or_si256(_mm256_cmpgt_epi32(a, b), _mm256_cmpeq_epi32(a, b));
+    }
+#endif
+};
+struct StrictlyDescending {
+    static bool inOrder(int a, int b) { return a > b; }
+#ifdef __AVX2__
+    static __m256i violations(__m256i a, __m256i b) {
+        return _mm256_or_si256(_mm256_cmpgt_epi32(b, a), _mm256_cmpeq_epi32(a, b));
+    }
+#endif
+};
+
+// Checks every adjacent pair data[i], data[i + 1] with i in [begin, end)
+// (end <= n - 1). Each vector is compared with the same vector shifted by
+// one lane (an overlapping load at i + 1); violations are ORed over a block
+// of 64 pairs and tested once per block, so the loop branches only at block
+// granularity and stops at the first bad block.
+// Time Complexity: O(n / 8), stopping at the first unsorted block
+// Space Complexity: O(1)
+template <class Order>
+bool pairsInOrder(const int* data, size_t begin, size_t end) {
+    size_t i = begin;
+#ifdef __AVX2__
+    for (; i + 64 <= end; i += 64) {
+        __m256i bad = _mm256_setzero_si256();
+        for (size_t j = i; j < i + 64; j += 8) {
+            __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + j));
+            __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + j + 1));
+            bad = _mm256_or_si256(bad, Order::violations(cur, next));
+        }
+        if (!_mm256_testz_si256(bad, bad)) return false;
+    }
+#endif
+    for (; i < end; i++) {
+        if (!Order::inOrder(data[i], data[i + 1])) return false;
+    }
+    return true;
+}
+
+// SIMD check with a compile-time order (Ascending by default).
+template <class Order = Ascending>
+bool isSortedSimd(const vector<int>& arr) {
+    return arr.size() < 2 || pairsInOrder<Order>(arr.data(), 0, arr.size() - 1);
+}
+
+struct IdentityKey {
+    template <class T>
+    const T& operator()(const T& x) const { return x; }
+};
+
+// Any element type, any comparator (comp(a, b) true when a must come
+// before b, as for std::sort), with an optional key projection. The
+// branch-free inner block lets the compiler vectorize simple comparators;
+// the early exit is per block of 64 pairs.
+// Time Complexity: O(n)
+// Space Complexity: O(1)
+template <class T, class Compare = less<>, class Key = IdentityKey>
+bool isSortedBy(const vector<T>& arr, Compare comp = {}, Key key = {}) {
+    size_t n = arr.size(), i = 0;
+    for (; i + 64 < n; i += 64) {
+        bool bad = false;
+        for (size_t j = i; j < i + 64; j++) bad |= comp(key(arr[j + 1]), key(arr[j]));
+        if (bad) return false;
+    }
+    for (; i + 1 < n; i++) {
+        if (comp(key(arr[i + 1]), key(arr[i]))) return false;
+    }
+    return true;
+}
+
+// Parallel SIMD check for very large inputs: one contiguous range of pairs
+// per thread, each walked in slices of 64K pairs; a shared flag lets every
+// thread stop soon after any of them finds a violation.
+// Time Complexity: O(n / (8 * threads))
+// Space Complexity: O(1)
+template <class Order = Ascending>
+bool isSortedParallel(const vector<int>& arr, int threads = 0) {
+    size_t n = arr.size();
+    if (n < 2) return true;
+    threads = resolveThreads(threads);
+    if (n < ((size_t)1 << 20) || threads == 1) return isSortedSimd<Order>(arr);
+    atomic<bool> unsorted{false};
+    parallelChunks((long long)(n - 1), threads, [&](long long begin, long long end, int) {
+        const size_t slice = 1 << 16;
+        for (size_t i = begin; i < (size_t)end && !unsorted.load(memory_order_relaxed); i += slice) {
+            if (!pairsInOrder<Order>(arr.data(), i, min((size_t)end, i + slice))) {
+                unsorted.store(true, memory_order_relaxed);
+            }
+        }
+    });
+    return !unsorted.load();
+}
+
+// Pass "bench" to also time isSortedOptimal against isSortedParallel
+// on 2^24 values.
+int main(int argc, char** argv) {
     // Test case from example
     vector<int> arr1 = {1, 2, 3, 4, 5};
     
@@ -55,7 +178,32 @@ int main() {
     cout << "\nTest Case 2: {1,2,2,3,4}" << endl;
     cout << "Brute Force: " << (isSortedBruteForce(arr2) ? "True" : "False") << endl;
     cout << "Optimal: " << (isSortedOptimal(arr2) ? "True" : "False") << endl;
-    
+    cout << "SIMD: " << (isSortedSimd(arr2) ? "True" : "False") << endl;
+    cout << "SIMD strictly ascending: " << (isSortedSimd<StrictlyAscending>(arr2) ? "True" : "False") << endl;
+
+    cout << "\nTest Case 3: {5,4,3,2,1}" << endl;
+    cout << "SIMD: " << (isSortedSimd(arr3) ? "True" : "False") << endl;
+    cout << "SIMD descending: " << (isSortedSimd<Descending>(arr3) ? "True" : "False") << endl;
+    cout << "Comparator greater<>: " << (isSortedBy(arr3, greater<>()) ? "True" : "False") << endl;
+
+    cout << "\nTest Case 4: {1,3,2,4,5}" << endl;
+    cout << "SIMD: " << (isSortedSimd(arr4) ? "True" : "False") << endl;
+    cout << "Key |x - 2|: "
+         << (isSortedBy(arr4, less<>(), [](int x) { return abs(x - 2); }) ? "True" : "False") << endl;
+
+    if (argc < 2 || string(argv[1]) != "bench") return 0;
+
+    // Large sorted batch, as validated before binary searching it.
+    vector<int> big(1 << 24);
+    for (size_t i = 0; i < big.size(); i++) big[i] = (int)(i / 3);
+    auto start = chrono::steady_clock::now();
+    bool scalar = isSortedOptimal(big);
+    double msScalar = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    bool parallel = isSortedParallel(big);
+    double msParallel = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "\nn = " << big.size() << ": optimal " << msScalar << " ms, parallel SIMD " << msParallel << " ms"
+         << (scalar == parallel ? "" : " (MISMATCH)") << endl;
    
     return 0;
 }
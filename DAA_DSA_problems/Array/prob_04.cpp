@@ -1,5 +1,18 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <type_traits>
+#include <vector>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+#include "../common/simd_compress.h"
+using namespace std;
+
 //Brute Force approach
-int removeDuplicates(int arr[], int n) {
+int removeDuplicatesBruteForce(int arr[], int n) {
   set < int > set;
   for (int i = 0; i < n; i++) {
     set.insert(arr[i]);
@@ -25,4 +38,113 @@ int removeDuplicates(int arr[], int n)
     }
   }
   return i + 1;
-}
\ No newline at end of file
+}
+
+//SIMD approach (stream compaction)
+
+// Same result as the two-pointer version for any sorted range of a trivially
+// copyable type: the unique values are packed to the front in order and their
+// count is returned. For 4- and 8-byte integers each vector is compared with
+// itself shifted by one lane (the previous vector's last element fills lane
+// 0) and the lanes that differ are compressed to the write position, with
+// vpcompressd/q on AVX-512 and compressStore8 (common/simd_compress.h) on
+// AVX2. The AVX-512 permutes and compares use their full-mask forms: the
+// unmasked intrinsics merge into _mm512_undefined_epi32(), which GCC 12
+// reports as maybe-uninitialized. The shifted vector is built from registers, not reloaded, because
+// the write position may already have overwritten the input behind the read
+// position.
+// Other types fall back to the scalar two-pointer loop.
+// Time Complexity: O(n / lanes)
+// Space Complexity: O(1)
+namespace dedup_detail {
+template <class T>
+size_t scalarUnique(T* data, size_t n, size_t w, size_t i) {
+  for (; i < n; i++) {
+    if (!(data[i] == data[w - 1])) data[w++] = data[i];
+  }
+  return w;
+}
+} // namespace dedup_detail
+
+template <class T>
+size_t removeDuplicatesSimd(T* data, size_t n) {
+  static_assert(std::is_trivially_copyable<T>::value, "elements are moved as raw lanes");
+  if (n < 2) return n;
+  size_t w = 1, i = 1;
+  constexpr bool lanes32 = std::is_integral<T>::value && sizeof(T) == 4;
+  constexpr bool lanes64 = std::is_integral<T>::value && sizeof(T) == 8;
+#if defined(__AVX512F__)
+  if constexpr (lanes32 || lanes64) {
+    constexpr size_t L = 64 / sizeof(T);
+    const __m512i rot = lanes32
+        ? _mm512_set_epi32(14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15)
+        : _mm512_set_epi64(6, 5, 4, 3, 2, 1, 0, 7);
+    __m512i last = lanes32 ? _mm512_set1_epi32((int32_t)data[0]) : _mm512_set1_epi64((int64_t)data[0]);
+    for (; i + L <= n; i += L) {
+      __m512i cur = _mm512_loadu_si512(data + i);
+      if constexpr (lanes32) {
+        __m512i prev = _mm512_mask_mov_epi32(_mm512_maskz_permutexvar_epi32(0xFFFF, rot, cur), 1, last);
+        __mmask16 keep = _mm512_mask_cmpneq_epi32_mask(0xFFFF, cur, prev);
+        last = _mm512_maskz_permutexvar_epi32(0xFFFF, _mm512_set1_epi32(15), cur);
+        _mm512_mask_compressstoreu_epi32(data + w, keep, cur);
+        w += __builtin_popcount(keep);
+      } else {
+        __m512i prev = _mm512_mask_mov_epi64(_mm512_maskz_permutexvar_epi64(0xFF, rot, cur), 1, last);
+        __mmask8 keep = _mm512_mask_cmpneq_epi64_mask(0xFF, cur, prev);
+        last = _mm512_maskz_permutexvar_epi64(0xFF, _mm512_set1_epi64(7), cur);
+        _mm512_mask_compressstoreu_epi64(data + w, keep, cur);
+        w += __builtin_popcount(keep);
+      }
+    }
+  }
+#elif defined(__AVX2__)
+  if constexpr (lanes32) {
+    const __m256i rot = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    __m256i last = _mm256_set1_epi32((int32_t)data[0]);
+    for (; i + 8 <= n; i += 8) {
+      __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+      __m256i prev = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(cur, rot), last, 1);
+      unsigned keep = ~laneMask8(_mm256_cmpeq_epi32(cur, prev)) & 0xFF;
+      last = _mm256_permutevar8x32_epi32(cur, _mm256_set1_epi32(7));
+      // May store all 8 lanes: w + 8 <= i + 8 <= n, and the lanes past the
+      // survivors are rewritten later or lie beyond the returned count.
+      w += compressStore8(data + w, cur, keep);
+    }
+  }
+#endif
+  (void)lanes32;
+  (void)lanes64;
+  return dedup_detail::scalarUnique(data, n, w, i);
+}
+
+int removeDuplicatesSimd(int arr[], int n) {
+  return (int)removeDuplicatesSimd(arr, (size_t)n);
+}
+
+#ifndef DAA_NO_MAIN
+int main() {
+  int arr[] = {1, 1, 2, 2, 2, 3, 3};
+  int n = sizeof(arr) / sizeof(arr[0]);
+
+  vector<int> a(arr, arr + n);
+  int k = removeDuplicatesBruteForce(a.data(), n);
+  cout << "Brute Force: " << k << " ->";
+  for (int i = 0; i < k; i++) cout << " " << a[i];
+  cout << endl;
+
+  a.assign(arr, arr + n);
+  k = removeDuplicates(a.data(), n);
+  cout << "Optimal: " << k << " ->";
+  for (int i = 0; i < k; i++) cout << " " << a[i];
+  cout << endl;
+
+  // Long enough for the vector loop, and 64-bit lanes as well
+  vector<int> big;
+  for (int v = 0; v < 40; v++) big.insert(big.end(), v % 3 + 1, v);
+  vector<int64_t> wide(big.begin(), big.end());
+  int kBig = removeDuplicatesSimd(big.data(), (int)big.size());
+  size_t kWide = removeDuplicatesSimd(wide.data(), wide.size());
+  cout << "SIMD: " << kBig << " (int64: " << kWide << "), last " << big[kBig - 1] << endl;
+  return 0;
+}
+#endif
@@ -1,8 +1,12 @@
 #include <bits/stdc++.h>
+#include <unistd.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
 // Brute Force Approach
-int missingNumber(vector<int>&a, int N) {
+int missingNumberBruteForce(vector<int>&a, int N) {
 
     // Outer loop that runs from 1 to N:
     for (int i = 1; i <= N; i++) {
@@ -33,7 +37,7 @@ int missingNumber(vector<int>&a, int N) {
 }
 
 // Optimal Approach (O(n))
-int missingNumber(vector<int>&a, int N) {
+int missingNumberSum(vector<int>&a, int N) {
 
     //Summation of first N numbers:
     int sum = (N * (N + 1)) / 2;
@@ -62,3 +66,229 @@ int missingNumber(vector<int>&a, int N) {
     return (xor1 ^ xor2); // the missing number
 }
 
+
+//Streaming approach (64-bit, vectorized, any number of missing values)
+
+// Sources of a stream of ints that is never materialized: read(buf, cap)
+// fills up to cap values and returns how many (0 at the end); rewind()
+// starts over, which only the multi-pass missingNumbersStreamed needs.
+// FdIntSource reads native-endian int32 records from a file or socket.
+class FdIntSource {
+    int fd;
+
+public:
+    explicit FdIntSource(int fileDescriptor) : fd(fileDescriptor) {}
+
+    // Returns as soon as at least one whole record has arrived and the
+    // bytes read end on a record boundary, so a socket is never waited on
+    // for a full buffer.
+    size_t read(int* buf, size_t cap) {
+        char* out = reinterpret_cast<char*>(buf);
+        size_t have = 0, bytes = cap * sizeof(int);
+        while (have < bytes && (have == 0 || have % sizeof(int) != 0)) {
+            ssize_t got = ::read(fd, out + have, bytes - have);
+            if (got < 0 && errno == EINTR) continue;
+            if (got < 0) throw runtime_error("read error on input stream");
+            if (got == 0) {
+                if (have % sizeof(int) != 0) throw runtime_error("truncated record in input stream");
+                break;
+            }
+            have += (size_t)got;
+        }
+        return have / sizeof(int);
+    }
+
+    void rewind() {
+        if (lseek(fd, 0, SEEK_SET) < 0) throw runtime_error("input stream cannot be rewound");
+    }
+};
+
+// The same interface over memory, for callers that already have the data.
+class ArrayIntSource {
+    const int* data;
+    size_t size, pos = 0;
+
+public:
+    ArrayIntSource(const int* d, size_t n) : data(d), size(n) {}
+    explicit ArrayIntSource(const vector<int>& v) : data(v.data()), size(v.size()) {}
+
+    size_t read(int* buf, size_t cap) {
+        size_t n = min(cap, size - pos);
+        copy(data + pos, data + pos + n, buf);
+        pos += n;
+        return n;
+    }
+
+    void rewind() { pos = 0; }
+};
+
+// 64-bit sum and 32-bit XOR of p[0..n). Lanes are widened to 64 bits before
+// adding, so the sum cannot wrap for any realistic stream length.
+// Time Complexity: O(n / 8)
+// Space Complexity: O(1)
+inline void accumulateSumXor(const int* p, size_t n, uint64_t& sum, uint32_t& xr) {
+    size_t i = 0;
+#ifdef __AVX2__
+    __m256i s0 = _mm256_setzero_si256(), s1 = _mm256_setzero_si256(), x = _mm256_setzero_si256();
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        x = _mm256_xor_si256(x, v);
+        s0 = _mm256_add_epi64(s0, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)));
+        s1 = _mm256_add_epi64(s1, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) uint64_t sums[4];
+    alignas(32) uint32_t xors[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_add_epi64(s0, s1));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(xors), x);
+    for (int l = 0; l < 4; l++) sum += sums[l];
+    for (int l = 0; l < 8; l++) xr ^= xors[l];
+#endif
+    for (; i < n; i++) {
+        sum += (uint32_t)p[i];
+        xr ^= (uint32_t)p[i];
+    }
+}
+
+// XOR of 1..N.
+inline uint32_t xorUpTo(long long N) {
+    switch (N % 4) {
+    case 0: return (uint32_t)N;
+    case 1: return 1;
+    case 2: return (uint32_t)(N + 1);
+    default: return 0;
+    }
+}
+
+// One missing value from a stream holding 1..N (N < 2^31) with exactly one
+// value absent, read in chunks. The sum gives the answer; the XOR is an
+// independent check that the stream really has that shape.
+// Time Complexity: O(N / 8)
+// Space Complexity: O(chunk)
+template <class Source>
+long long missingNumberStreamed(Source& src, long long N) {
+    vector<int> buf(1 << 16);
+    uint64_t sum = 0;
+    uint32_t xr = 0;
+    for (size_t got; (got = src.read(buf.data(), buf.size())) > 0;) accumulateSumXor(buf.data(), got, sum, xr);
+    long long missing = (long long)((uint64_t)N * (uint64_t)(N + 1) / 2 - sum);
+    if (missing < 1 || missing > N || (xorUpTo(N) ^ xr) != (uint32_t)missing) {
+        throw invalid_argument("stream is not 1..N with exactly one value missing");
+    }
+    return missing;
+}
+
+int missingNumberSimd(vector<int>&a, int N) {
+    ArrayIntSource src(a.data(), (size_t)N - 1);
+    return (int)missingNumberStreamed(src, N);
+}
+
+// Every value of 1..N (N < 2^31) absent from a stream of distinct values,
+// by bucketing. Each pass splits the unresolved value ranges into buckets of
+// a power-of-two width and keeps, per bucket, the count, the sum and the sum
+// of squares of the values seen (mod 2^64, where the differences to the
+// expected totals are exact). A bucket short by one value gives it by the
+// sum; short by two, by solving a + b = p, a^2 + b^2 = q; short by all of
+// its width, it is missing entirely. Buckets short by more are re-split in
+// the next pass over the rewound stream, so sparse gaps (the usual case)
+// finish in one pass and dense ones in O(log N / log buckets) passes.
+// bucketsPerPass trades memory for passes; expect it to be at least a few
+// times the number of missing values.
+// Time Complexity: O(N) per pass
+// Space Complexity: O(bucketsPerPass + chunk)
+template <class Source>
+vector<long long> missingNumbersStreamed(Source& src, long long N, size_t bucketsPerPass = 1 << 16) {
+    struct Range { long long lo, hi; int shift; size_t firstBucket; };
+    struct Stats { uint64_t count = 0, s1 = 0, s2 = 0; };
+    auto sumTo = [](uint64_t n) { return (uint64_t)((unsigned __int128)n * (n + 1) / 2); };
+    auto sqSumTo = [](uint64_t n) { return (uint64_t)((unsigned __int128)n * (n + 1) * (2 * n + 1) / 6); };
+
+    vector<long long> missing;
+    vector<pair<long long, long long>> pending;
+    if (N >= 1) pending.push_back({1, N});
+    vector<int> buf(1 << 16);
+    bool firstPass = true;
+    while (!pending.empty()) {
+        if (!firstPass) src.rewind();
+        firstPass = false;
+        // Lay out this pass's buckets.
+        size_t perRange = max<size_t>(2, bucketsPerPass / pending.size());
+        vector<Range> ranges;
+        size_t buckets = 0;
+        for (auto [lo, hi] : pending) {
+            int shift = 0;
+            while (((hi - lo) >> shift) + 1 > (long long)perRange) shift++;
+            ranges.push_back({lo, hi, shift, buckets});
+            buckets += (size_t)(((hi - lo) >> shift) + 1);
+        }
+        vector<Stats> stats(buckets);
+        vector<long long> starts;
+        for (auto& r : ranges) starts.push_back(r.lo);
+
+        for (size_t got; (got = src.read(buf.data(), buf.size())) > 0;) {
+            for (size_t i = 0; i < got; i++) {
+                long long v = buf[i];
+                if (v < 1 || v > N) throw invalid_argument("value outside 1..N in stream");
+                size_t r = ranges.size() == 1 ? 0 : (size_t)(upper_bound(starts.begin(), starts.end(), v) - starts.begin()) - 1;
+                if (r >= ranges.size() || v > ranges[r].hi || v < ranges[r].lo) continue;
+                Stats& s = stats[ranges[r].firstBucket + (size_t)((v - ranges[r].lo) >> ranges[r].shift)];
+                s.count++;
+                s.s1 += (uint64_t)v;
+                s.s2 += (uint64_t)v * (uint64_t)v;
+            }
+        }
+
+        pending.clear();
+        for (auto& r : ranges) {
+            size_t count = (size_t)(((r.hi - r.lo) >> r.shift) + 1);
+            for (size_t b = 0; b < count; b++) {
+                long long lo = r.lo + ((long long)b << r.shift);
+                long long hi = min(r.hi, lo + (1LL << r.shift) - 1);
+                const Stats& s = stats[r.firstBucket + b];
+                uint64_t width = (uint64_t)(hi - lo + 1);
+                if (s.count > width) throw invalid_argument("duplicate values in stream");
+                uint64_t short_ = width - s.count;
+                if (short_ == 0) continue;
+                if (short_ == width) {
+                    for (long long v = lo; v <= hi; v++) missing.push_back(v);
+                    continue;
+                }
+                uint64_t p = sumTo(hi) - sumTo(lo - 1) - s.s1;
+                uint64_t q = sqSumTo(hi) - sqSumTo(lo - 1) - s.s2;
+                if (short_ == 1) {
+                    missing.push_back((long long)p);
+                } else if (short_ == 2) {
+                    // (a - b)^2 = 2q - p^2
+                    long long d2 = (long long)(2 * q - p * p);
+                    long long d = (long long)sqrtl((long double)d2);
+                    while (d * d > d2) d--;
+                    while ((d + 1) * (d + 1) <= d2) d++;
+                    missing.push_back(((long long)p - d) / 2);
+                    missing.push_back(((long long)p + d) / 2);
+                } else {
+                    pending.push_back({lo, hi});
+                }
+            }
+        }
+    }
+    sort(missing.begin(), missing.end());
+    return missing;
+}
+
+#ifndef DAA_NO_MAIN
+int main() {
+    int N = 5;
+    vector<int> a = {1, 2, 4, 5};
+    cout << "Brute Force: " << missingNumberBruteForce(a, N) << endl;
+    cout << "Sum: " << missingNumberSum(a, N) << endl;
+    cout << "XOR: " << missingNumber(a, N) << endl;
+    cout << "Streamed: " << missingNumberSimd(a, N) << endl;
+
+    // 3, 7, 8 and 9 absent from 1..10; 4 buckets per pass forces a second pass
+    vector<int> some = {10, 1, 5, 2, 6, 4};
+    ArrayIntSource src(some);
+    cout << "Streamed, all missing:";
+    for (long long v : missingNumbersStreamed(src, 10, 4)) cout << " " << v;
+    cout << endl;
+    return 0;
+}
+#endif
@@ -1,7 +1,80 @@
 #include <iostream>
 #include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <string>
+#include "../common/parallel.h"
 
 using namespace std;
+
+// Runs of ones in a bit-packed bitmap: bit i is bit (i % 64) of word i / 64,
+// and bits past nbits in the last word are ignored.
+// Summary of a span of bits, enough to combine neighbouring spans: the run
+// of ones touching its start, the run touching its end, and the longest run
+// anywhere inside. full means every bit is set.
+struct RunSummary {
+  uint64_t bits = 0, prefix = 0, suffix = 0, best = 0;
+  bool full = true;
+};
+
+// Summary of a followed immediately by b.
+inline RunSummary combineRuns(const RunSummary &a, const RunSummary &b) {
+  RunSummary r;
+  r.bits = a.bits + b.bits;
+  r.prefix = a.full ? a.bits + b.prefix : a.prefix;
+  r.suffix = b.full ? b.bits + a.suffix : b.suffix;
+  r.best = max({a.best, b.best, a.suffix + b.prefix});
+  r.full = a.full && b.full;
+  return r;
+}
+
+// Longest run of ones inside one word, hopping from run to run with ctz, so
+// the cost is the number of runs rather than the number of bits.
+inline int longestRunInWord(uint64_t w) {
+  int best = 0;
+  while (w) {
+    w >>= __builtin_ctzll(w);
+    if (~w == 0) return 64; // only when w was all ones to begin with
+    int len = __builtin_ctzll(~w);
+    best = max(best, len);
+    w = len == 64 ? 0 : w >> len;
+  }
+  return best;
+}
+
+// Summary of words [first, last) of a bitmap with nbits valid bits. All-ones
+// and all-zero words cost one compare each; a mixed word contributes its
+// low run (ctz of ~w) to the current run, its high run (clz of ~w) starts
+// the next one, and only then is its interior searched.
+// Time Complexity: O(words + runs in mixed words)
+// Space Complexity: O(1)
+inline RunSummary summarizeRuns(const uint64_t *words, size_t first, size_t last, uint64_t nbits) {
+  RunSummary r;
+  uint64_t cur = 0;
+  bool seenZero = false;
+  for (size_t i = first; i < last; i++) {
+    int valid = (i + 1) * 64 <= nbits ? 64 : (int)(nbits - i * 64);
+    uint64_t live = valid == 64 ? ~0ULL : (1ULL << valid) - 1;
+    uint64_t w = words[i] & live, zeros = ~w & live;
+    r.bits += valid;
+    if (zeros == 0) {
+      cur += valid;
+      continue;
+    }
+    int low = __builtin_ctzll(zeros);
+    if (!seenZero) r.prefix = cur + low;
+    seenZero = true;
+    r.best = max({r.best, cur + low, (uint64_t)longestRunInWord(w)});
+    cur = (uint64_t)(__builtin_clzll(zeros) - (64 - valid));
+  }
+  r.full = !seenZero;
+  if (r.full) r.prefix = cur;
+  r.suffix = cur;
+  r.best = max(r.best, cur);
+  return r;
+}
+
 class Solution {
   public:
     int findMaxConsecutiveOnes(vector < int > & nums) {
@@ -18,12 +91,59 @@ class Solution {
       }
       return maxi;
     }
+
+    // Longest run of ones in a bit-packed bitmap of nbits bits.
+    // Time Complexity: O(nbits / 64)
+    // Space Complexity: O(1)
+    uint64_t findMaxConsecutiveOnesBits(const uint64_t *words, uint64_t nbits) {
+      return summarizeRuns(words, 0, (size_t)((nbits + 63) / 64), nbits).best;
+    }
+
+    // Parallel version: one contiguous range of words per thread, each
+    // summarized on its own and folded left to right with combineRuns.
+    // Time Complexity: O(nbits / (64 * threads))
+    // Space Complexity: O(threads)
+    uint64_t findMaxConsecutiveOnesParallel(const uint64_t *words, uint64_t nbits, int threads = 0) {
+      size_t nwords = (size_t)((nbits + 63) / 64);
+      threads = resolveThreads(threads);
+      if (nwords < ((size_t)1 << 16)) threads = 1;
+      vector<RunSummary> parts(threads);
+      parallelChunks((long long)nwords, threads, [&](long long begin, long long end, int t) {
+        parts[t] = summarizeRuns(words, (size_t)begin, (size_t)end, nbits);
+      });
+      RunSummary total;
+      for (auto &p : parts) total = combineRuns(total, p);
+      return total.best;
+    }
+
+    // Packs a 0/1 vector into the bitmap layout above.
+    static vector<uint64_t> packBits(const vector<int> &nums) {
+      vector<uint64_t> words((nums.size() + 63) / 64, 0);
+      for (size_t i = 0; i < nums.size(); i++) {
+        if (nums[i] == 1) words[i / 64] |= 1ULL << (i % 64);
+      }
+      return words;
+    }
 };
 
-int main() {
+// Pass "bench" to also run both bitmap scans over 2^30 bits.
+int main(int argc, char** argv) {
   vector < int > nums = { 1, 1, 0, 1, 1, 1 };
   Solution obj;
   int ans = obj.findMaxConsecutiveOnes(nums);
   cout << "The maximum  consecutive 1's are " << ans <<endl;
+
+  vector<uint64_t> bits = Solution::packBits(nums);
+  cout << "Bit-packed: " << obj.findMaxConsecutiveOnesBits(bits.data(), nums.size()) << endl;
+
+  // An availability map with one long free stretch; 2^14 bits by default,
+  // 2^30 bits (128 MB) with "bench".
+  bool bench = argc >= 2 && string(argv[1]) == "bench";
+  uint64_t nbits = bench ? 1ULL << 30 : 1ULL << 14;
+  vector<uint64_t> big(nbits / 64);
+  for (size_t i = 0; i < big.size(); i++) big[i] = (i * 0x9E3779B97F4A7C15ULL) | (1ULL << (i % 64));
+  for (size_t i = 100; i < 103; i++) big[i] = ~0ULL;
+  cout << "Parallel over 2^" << (bench ? 30 : 14) << " bits: " << obj.findMaxConsecutiveOnesParallel(big.data(), nbits)
+       << " (serial " << obj.findMaxConsecutiveOnesBits(big.data(), nbits) << ")" << endl;
   return 0;
 }
\ No newline at end of file
@@ -1,7 +1,52 @@
 #include <iostream>
 #include <vector>
+#include <cstdint>
+#include <optional>
+#include "../common/parallel.h"
 using namespace std;
 
+// Boyer-Moore state as a mergeable summary. After a pass over a sequence,
+// count is how many more times candidate was paired with itself than
+// cancelled; merging two summaries is one more round of cancellation
+// between their survivors. merge is not associative: which candidate
+// survives can depend on the grouping. Every summary still stands for its
+// shard with pairs of distinct values cancelled, though, and a majority
+// cannot be cancelled away, so folding shards in any grouping (threads,
+// other machines: the state is two plain integers; the empty summary is
+// the identity) ends on the majority whenever one exists. Otherwise the
+// candidate is arbitrary, so it must always be verified by a second count.
+struct MajorityVote {
+    int candidate = 0;
+    long long count = 0;
+
+    void add(int num) {
+        if (count == 0) candidate = num;
+        count += (num == candidate) ? 1 : -1;
+    }
+
+    static MajorityVote merge(const MajorityVote &a, const MajorityVote &b) {
+        if (a.count == 0) return b;
+        if (b.count == 0) return a;
+        if (a.candidate == b.candidate) return {a.candidate, a.count + b.count};
+        if (a.count >= b.count) return {a.candidate, a.count - b.count};
+        return {b.candidate, b.count - a.count};
+    }
+};
+
+inline MajorityVote summarizeVotes(const int *data, size_t n) {
+    MajorityVote v;
+    for (size_t i = 0; i < n; i++) v.add(data[i]);
+    return v;
+}
+
+// Occurrences of value in data[0..n); a branch-free loop the compiler
+// vectorizes. Counts from separate shards simply add up.
+inline long long countOccurrences(const int *data, size_t n, int value) {
+    long long c = 0;
+    for (size_t i = 0; i < n; i++) c += data[i] == value;
+    return c;
+}
+
 class Solution {
 public:
     int majorityElement(vector<int>& nums) {
@@ -18,6 +63,33 @@ public:
         
         return candidate;
     }
+
+    // Parallel Boyer-Moore: each thread summarizes its chunk into a
+    // MajorityVote, the summaries are merged, and a second parallel pass
+    // counts the winner. Returns nothing when no element is a majority.
+    // Time Complexity: O(n / threads)
+    // Space Complexity: O(threads)
+    optional<int> majorityElementParallel(const vector<int>& nums, int threads = 0) {
+        size_t n = nums.size();
+        threads = resolveThreads(threads);
+        if (n < ((size_t)1 << 18)) threads = 1;
+        vector<MajorityVote> parts(threads);
+        parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+            parts[t] = summarizeVotes(nums.data() + begin, (size_t)(end - begin));
+        });
+        MajorityVote total;
+        for (auto &p : parts) total = MajorityVote::merge(total, p);
+        if (total.count == 0) return nullopt;
+
+        vector<long long> counts(threads, 0);
+        parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+            counts[t] = countOccurrences(nums.data() + begin, (size_t)(end - begin), total.candidate);
+        });
+        long long occurrences = 0;
+        for (long long c : counts) occurrences += c;
+        if (2 * occurrences <= (long long)n) return nullopt;
+        return total.candidate;
+    }
 };
 
 int main() {
@@ -25,5 +97,17 @@ int main() {
 
     Solution obj;
     cout << obj.majorityElement(nums) << endl;  
+
+    // Shards summarized separately (as on different machines), then merged.
+    vector<int> shardA = {7, 0, 0, 1}, shardB = {7, 7, 2, 7, 7};
+    MajorityVote merged = MajorityVote::merge(summarizeVotes(shardA.data(), shardA.size()),
+                                              summarizeVotes(shardB.data(), shardB.size()));
+    cout << "Merged shards: " << merged.candidate << endl;
+
+    optional<int> verified = obj.majorityElementParallel(nums);
+    cout << "Parallel (verified): " << (verified ? to_string(*verified) : "none") << endl;
+    vector<int> noMajority = {1, 2, 3, 1, 2, 3};
+    verified = obj.majorityElementParallel(noMajority);
+    cout << "Parallel (verified): " << (verified ? to_string(*verified) : "none") << endl;
     return 0;
 }
@@ -1,7 +1,87 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <climits>
+#include "../common/parallel.h"
 using namespace std;
 
+// Everything needed to combine the maximum subarray sums of two adjacent
+// segments: the segment total, the best sum of a non-empty prefix, of a
+// non-empty suffix, and of any non-empty subarray. combine is associative,
+// and EMPTY (with -infinity sums) is its identity.
+struct SubarraySummary {
+    static constexpr long long NEG = LLONG_MIN / 4; // -infinity that survives + and max
+
+    long long total = 0, prefix = NEG, suffix = NEG, best = NEG;
+
+    static SubarraySummary of(long long x) { return {x, x, x, x}; }
+
+    static SubarraySummary combine(const SubarraySummary& a, const SubarraySummary& b) {
+        return {a.total + b.total,
+                max(a.prefix, a.total + b.prefix),
+                max(b.suffix, b.total + a.suffix),
+                max({a.best, b.best, a.suffix + b.prefix})};
+    }
+};
+
+// Summary of data[0..n) in one pass: Kadane for best, running maxima of the
+// prefix sums for prefix, and total minus the smallest proper prefix sum for
+// suffix.
+// Time Complexity: O(n)
+// Space Complexity: O(1)
+inline SubarraySummary summarizeSubarrays(const int* data, size_t n) {
+    SubarraySummary s;
+    long long run = SubarraySummary::NEG, sum = 0, minProperPrefix = 0;
+    for (size_t i = 0; i < n; i++) {
+        run = max<long long>(data[i], run + data[i]);
+        s.best = max(s.best, run);
+        if (i > 0) minProperPrefix = min(minProperPrefix, sum);
+        sum += data[i];
+        s.prefix = max(s.prefix, sum);
+    }
+    s.total = sum;
+    if (n > 0) s.suffix = sum - minProperPrefix;
+    return s;
+}
+
+// Maximum subarray sums under point updates: a bottom-up segment tree of
+// SubarraySummary over the array (padded to a power of two with EMPTY
+// leaves). An update recombines the log n summaries above one leaf; the
+// whole-array answer is the root, and any window [l, r] is a combination of
+// O(log n) nodes folded left and right in order.
+// Time Complexity: O(n) build, O(log n) update and window query, O(1) whole
+// Space Complexity: O(n)
+class MaxSubarrayTree {
+    size_t size = 1;
+    vector<SubarraySummary> tree;
+
+public:
+    explicit MaxSubarrayTree(const vector<int>& nums) {
+        while (size < nums.size()) size <<= 1;
+        tree.assign(2 * size, SubarraySummary());
+        for (size_t i = 0; i < nums.size(); i++) tree[size + i] = SubarraySummary::of(nums[i]);
+        for (size_t i = size - 1; i >= 1; i--) tree[i] = SubarraySummary::combine(tree[2 * i], tree[2 * i + 1]);
+    }
+
+    void update(size_t i, int value) {
+        size_t at = size + i;
+        tree[at] = SubarraySummary::of(value);
+        for (at >>= 1; at >= 1; at >>= 1) tree[at] = SubarraySummary::combine(tree[2 * at], tree[2 * at + 1]);
+    }
+
+    long long maxSubArray() const { return tree[1].best; }
+
+    // Best non-empty subarray inside nums[l..r] (inclusive).
+    long long maxSubArray(size_t l, size_t r) const {
+        SubarraySummary left, right;
+        for (size_t lo = l + size, hi = r + size + 1; lo < hi; lo >>= 1, hi >>= 1) {
+            if (lo & 1) left = SubarraySummary::combine(left, tree[lo++]);
+            if (hi & 1) right = SubarraySummary::combine(tree[--hi], right);
+        }
+        return SubarraySummary::combine(left, right).best;
+    }
+};
+
 class Solution {
 public:
     int maxSubArray(vector<int>& nums) {
@@ -17,6 +97,21 @@ public:
         }
         return maxSum;
     }
+
+    // Parallel Kadane: one summary per thread chunk, combined in order.
+    // Time Complexity: O(n / threads)
+    // Space Complexity: O(threads)
+    long long maxSubArrayParallel(const vector<int>& nums, int threads = 0) {
+        threads = resolveThreads(threads);
+        if (nums.size() < ((size_t)1 << 18)) threads = 1;
+        vector<SubarraySummary> parts(threads);
+        parallelChunks((long long)nums.size(), threads, [&](long long begin, long long end, int t) {
+            parts[t] = summarizeSubarrays(nums.data() + begin, (size_t)(end - begin));
+        });
+        SubarraySummary total;
+        for (auto& p : parts) total = SubarraySummary::combine(total, p);
+        return total.best;
+    }
 };
 
 int main() {
@@ -24,5 +119,13 @@ int main() {
 
     Solution obj;
     cout << obj.maxSubArray(nums) << endl;  
+    cout << obj.maxSubArrayParallel(nums) << endl;
+
+    // Ticks: point updates re-query in O(log n) instead of rescanning.
+    MaxSubarrayTree tree(nums);
+    tree.update(3, -20);
+    cout << "After nums[3] = -20: " << tree.maxSubArray() << endl;
+    tree.update(5, 9);
+    cout << "After nums[5] = 9: " << tree.maxSubArray() << ", window [3, 5]: " << tree.maxSubArray(3, 5) << endl;
     return 0;
 }
@@ -2,7 +2,7 @@
 using namespace std;
 
 // Brute Force Approach
-int maxProfit(vector<int> &arr) {
+int maxProfitBruteForce(vector<int> &arr) {
     int maxPro = 0;
     int n = arr.size();
 
@@ -31,3 +31,102 @@ int maxProfit(vector<int> &arr) {
     return maxPro;
 }
 
+
+// Online Approach (O(1) per tick)
+// Keeps only the running minimum and the best profit so far, so a price
+// stream never has to be stored.
+class OnlineProfitTracker {
+    int minPrice = INT_MAX;
+    long long best = 0;
+
+public:
+    void push(int price) {
+        minPrice = min(minPrice, price);
+        best = max(best, (long long)price - minPrice);
+    }
+
+    long long bestProfit() const { return best; }
+};
+
+// Range queries (O(log n) per query)
+// Best profit of one buy and a later sell, both inside prices[l..r]. Each
+// segment-tree node keeps (lowest price, highest price, best profit) of its
+// range; two adjacent ranges combine as
+//   best = max(left.best, right.best, right.max - left.min),
+// i.e. buy in the left part and sell in the right. A query folds O(log n)
+// nodes in order. Ticks can be appended: a new leaf updates its log n
+// ancestors, and the tree doubles (one O(n) rebuild) when it is full.
+// Time Complexity: O(n) build, O(log n) per query, O(log n) amortized append
+// Space Complexity: O(n)
+class RangeProfitIndex {
+    struct Node {
+        long long lo = LLONG_MAX, hi = LLONG_MIN, best = 0;
+    };
+
+    static Node combine(const Node &a, const Node &b) {
+        Node r;
+        r.lo = min(a.lo, b.lo);
+        r.hi = max(a.hi, b.hi);
+        r.best = max(a.best, b.best);
+        if (a.lo != LLONG_MAX && b.hi != LLONG_MIN) r.best = max(r.best, b.hi - a.lo);
+        return r;
+    }
+
+    size_t count = 0, size = 1;
+    vector<Node> tree;
+
+    void rebuild(size_t capacity) {
+        vector<Node> leaves(tree.begin() + size, tree.begin() + size + count);
+        size = capacity;
+        tree.assign(2 * size, Node());
+        copy(leaves.begin(), leaves.end(), tree.begin() + size);
+        for (size_t i = size - 1; i >= 1; i--) tree[i] = combine(tree[2 * i], tree[2 * i + 1]);
+    }
+
+public:
+    explicit RangeProfitIndex(const vector<int> &prices = {}) {
+        while (size < prices.size()) size <<= 1;
+        tree.assign(2 * size, Node());
+        count = prices.size();
+        for (size_t i = 0; i < count; i++) tree[size + i] = {prices[i], prices[i], 0};
+        for (size_t i = size - 1; i >= 1; i--) tree[i] = combine(tree[2 * i], tree[2 * i + 1]);
+    }
+
+    void append(int price) {
+        if (count == size) rebuild(2 * size);
+        size_t at = size + count++;
+        tree[at] = {price, price, 0};
+        for (at >>= 1; at >= 1; at >>= 1) tree[at] = combine(tree[2 * at], tree[2 * at + 1]);
+    }
+
+    size_t length() const { return count; }
+
+    // Best profit within prices[l..r] (inclusive); 0 if no trade gains.
+    long long query(size_t l, size_t r) const {
+        Node left, right;
+        for (size_t lo = l + size, hi = r + size + 1; lo < hi; lo >>= 1, hi >>= 1) {
+            if (lo & 1) left = combine(left, tree[lo++]);
+            if (hi & 1) right = combine(tree[--hi], right);
+        }
+        return combine(left, right).best;
+    }
+};
+
+#ifndef DAA_NO_MAIN
+int main() {
+    vector<int> prices = {7, 1, 5, 3, 6, 4};
+
+    cout << "Brute Force Output: " << maxProfitBruteForce(prices) << endl;
+    cout << "Optimal Output: " << maxProfit(prices) << endl;
+
+    OnlineProfitTracker tracker;
+    for (int p : prices) tracker.push(p);
+    cout << "Online Output: " << tracker.bestProfit() << endl;
+
+    RangeProfitIndex index(prices);
+    index.append(8);
+    cout << "Range [0, 6] Output: " << index.query(0, 6) << endl;
+    cout << "Range [2, 5] Output: " << index.query(2, 5) << endl;
+    return 0;
+}
+#endif
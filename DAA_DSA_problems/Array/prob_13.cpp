@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../common/parallel.h"
 using namespace std;
 
 // Brute Force Approach
@@ -37,6 +38,71 @@ vector<int> leadersOptimal(vector<int>& nums) {
     return leaders;
 }
 
+// Parallel Approach (O(n / threads))
+// Works for any ordered element type (int, float, double; NaNs are not
+// ordered and must not appear). Passes over one contiguous chunk per thread:
+// 1. the maximum of every chunk;
+// 2. an exclusive suffix scan of those maxima, giving each chunk the
+//    maximum of everything to its right (none for the last chunk);
+// 3. each chunk counts its leaders scanning right to left from that bound;
+//    an exclusive prefix sum of the counts gives every chunk its output slot;
+// 4. each chunk scans again and writes its leaders from the back of its
+//    slot to the front, so the output is already in left-to-right order.
+// The output is sized once; there is no push_back growth and no reverse.
+// Time Complexity: O(n / threads + threads)
+// Space Complexity: O(threads) besides the output
+template <class T>
+vector<T> leadersParallel(const vector<T>& nums, int threads = 0) {
+    size_t n = nums.size();
+    if (n == 0) return {};
+    threads = resolveThreads(threads);
+    if (n < ((size_t)1 << 18)) threads = 1;
+    threads = (int)min<size_t>(threads, n);
+    auto chunkBegin = [&](int t) { return (size_t)((unsigned __int128)n * t / threads); };
+
+    vector<T> chunkMax(threads);
+    parallelForDynamic(threads, threads, [&](long long t, int) {
+        chunkMax[t] = *max_element(nums.begin() + chunkBegin((int)t), nums.begin() + chunkBegin((int)t + 1));
+    });
+    // rightMax[t] is the maximum of chunks > t; hasRight is false for the last.
+    vector<T> rightMax(threads);
+    for (int t = threads - 2; t >= 0; t--) {
+        rightMax[t] = t == threads - 2 ? chunkMax[t + 1] : max(rightMax[t + 1], chunkMax[t + 1]);
+    }
+
+    // Walks chunk t right to left, calling emit(x) for each leader.
+    auto scanChunk = [&](int t, auto emit) {
+        size_t i = chunkBegin(t + 1), begin = chunkBegin(t);
+        T bound = rightMax[t];
+        if (t == threads - 1) {
+            bound = nums[--i];
+            emit(bound);
+        }
+        while (i > begin) {
+            T x = nums[--i];
+            if (x > bound) {
+                emit(x);
+                bound = x;
+            }
+        }
+    };
+
+    vector<size_t> offset(threads + 1, 0);
+    parallelForDynamic(threads, threads, [&](long long t, int) {
+        size_t count = 0;
+        scanChunk((int)t, [&](T) { count++; });
+        offset[t + 1] = count;
+    });
+    for (int t = 0; t < threads; t++) offset[t + 1] += offset[t];
+
+    vector<T> leaders(offset[threads]);
+    parallelForDynamic(threads, threads, [&](long long t, int) {
+        size_t slot = offset[t + 1];
+        scanChunk((int)t, [&](T x) { leaders[--slot] = x; });
+    });
+    return leaders;
+}
+
 int main() {
     vector<int> nums1 = {1, 2, 5, 3, 1, 2};
     vector<int> nums2 = {-3, 4, 5, 1, -4, -5};
@@ -63,5 +129,17 @@ int main() {
     for (int x : ans4) cout << x << " ";
     cout << endl;
 
+    // Parallel
+    auto ans5 = leadersParallel(nums2);
+    cout << "Parallel Output 2: ";
+    for (int x : ans5) cout << x << " ";
+    cout << endl;
+
+    vector<float> series = {0.5f, 2.25f, -1.0f, 2.0f, 1.5f};
+    auto ans6 = leadersParallel(series);
+    cout << "Parallel Output (float): ";
+    for (float x : ans6) cout << x << " ";
+    cout << endl;
+
     return 0;
 }
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../common/autotune.h"
 using namespace std;
 
 // Brute Force Approach (O(n^2))
@@ -44,6 +45,114 @@ int longestConsecutiveOptimal(vector<int>& nums) {
     return longest;
 }
 
+// Dense Bitmap Approach (O(n + range / 64))
+// One bit per value in [lo, hi]; the longest run of set bits is the answer.
+// Runs are found a whole word at a time: ctz finds where a run starts, ctz of
+// the complement gives its length, and runs touching a word boundary are
+// joined with the next word's. Memory is (hi - lo) / 8 bytes instead of a
+// hash node per element.
+// Time Complexity: O(n + (hi - lo) / 64)
+// Space Complexity: O((hi - lo) / 64)
+int longestConsecutiveBitmap(const vector<int>& nums, int lo, int hi) {
+    if (nums.empty()) return 0;
+    size_t range = (size_t)((long long)hi - lo) + 1;
+    vector<uint64_t> bits((range + 63) / 64, 0);
+    for (int x : nums) {
+        size_t v = (size_t)((long long)x - lo);
+        bits[v >> 6] |= 1ULL << (v & 63);
+    }
+
+    long long best = 0, current = 0, runEnd = -1; // runEnd: one past the current run
+    for (size_t i = 0; i < bits.size(); i++) {
+        uint64_t w = bits[i];
+        long long base = (long long)i * 64;
+        if (w == ~0ULL) {
+            current = runEnd == base ? current + 64 : 64;
+            runEnd = base + 64;
+            best = max(best, current);
+            continue;
+        }
+        while (w) {
+            int start = __builtin_ctzll(w);
+            int len = __builtin_ctzll(~(w >> start));
+            current = runEnd == base + start ? current + len : len;
+            runEnd = base + start + len;
+            best = max(best, current);
+            w = start + len == 64 ? 0 : w & ~((1ULL << (start + len)) - 1);
+        }
+    }
+    return (int)best;
+}
+
+// LSD Radix Sort Approach (O(n))
+// Sorts the values as order-preserving unsigned keys with four 8-bit passes
+// (passes whose digit is the same for every key are skipped), then counts
+// runs in one scan, skipping duplicates. Two 4-byte buffers per element.
+// Time Complexity: O(n)
+// Space Complexity: O(n)
+int longestConsecutiveRadix(const vector<int>& nums) {
+    size_t n = nums.size();
+    if (n == 0) return 0;
+    vector<uint32_t> keys(n), scratch(n);
+    vector<array<size_t, 256>> count(4);
+    for (auto& c : count) c.fill(0);
+    for (size_t i = 0; i < n; i++) {
+        uint32_t k = (uint32_t)nums[i] ^ 0x80000000u;
+        keys[i] = k;
+        for (int d = 0; d < 4; d++) count[d][(k >> (8 * d)) & 255]++;
+    }
+    for (int d = 0; d < 4; d++) {
+        auto& c = count[d];
+        if (*max_element(c.begin(), c.end()) == n) continue; // digit is constant
+        size_t sum = 0;
+        for (auto& x : c) {
+            size_t here = x;
+            x = sum;
+            sum += here;
+        }
+        for (uint32_t k : keys) scratch[c[(k >> (8 * d)) & 255]++] = k;
+        keys.swap(scratch);
+    }
+
+    int best = 1, current = 1;
+    for (size_t i = 1; i < n; i++) {
+        if (keys[i] == keys[i - 1]) continue;
+        current = keys[i] == keys[i - 1] + 1 ? current + 1 : 1;
+        best = max(best, current);
+    }
+    return best;
+}
+
+enum class ConsecutiveEngine { Auto, Bitmap, RadixSort };
+
+// Picks the bitmap when it is no bigger than the input itself: range <= 32n
+// bits by default, the "consecutive.bitmap_bits_per_element" threshold of
+// the tuning profile (common/autotune.h) when calibrated. The decision
+// starts from sampled features (about 1024 evenly spaced values), so inputs
+// that are clearly sparse never pay for an exact min/max pass; the bitmap
+// is only built after the exact range has confirmed the estimate.
+// Time Complexity: O(n + min(range / 64, n))
+// Space Complexity: O(min(range / 64, n))
+int longestConsecutive(const vector<int>& nums, ConsecutiveEngine engine = ConsecutiveEngine::Auto) {
+    size_t n = nums.size();
+    if (n == 0) return 0;
+    static const TunedValue bitsPerElement("consecutive.bitmap_bits_per_element", 32);
+    auto fitsBitmap = [&](long long lo, long long hi) { return (double)(hi - lo) < bitsPerElement * (double)n; };
+
+    bool automatic = engine == ConsecutiveEngine::Auto;
+    if (automatic) {
+        InputFeatures f = sampleFeatures(nums);
+        engine = fitsBitmap(f.minValue, f.maxValue) ? ConsecutiveEngine::Bitmap : ConsecutiveEngine::RadixSort;
+    }
+    if (engine == ConsecutiveEngine::Bitmap) {
+        auto [lo, hi] = minmax_element(nums.begin(), nums.end());
+        // Auto falls back to the radix sort if the exact range is too wide.
+        if (!automatic || fitsBitmap(*lo, *hi)) return longestConsecutiveBitmap(nums, *lo, *hi);
+    }
+    return longestConsecutiveRadix(nums);
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> nums1 = {100, 4, 200, 1, 3, 2};
     vector<int> nums2 = {0, 3, 7, 2, 5, 8, 4, 6, 0, 1};
@@ -54,5 +163,10 @@ int main() {
     cout << "Brute Force Result (Example2): " << longestConsecutiveBrute(nums2) << endl;
     cout << "Optimal Result (Example2): " << longestConsecutiveOptimal(nums2) << endl;
 
+    cout << "Bitmap Result (Example2): " << longestConsecutive(nums2, ConsecutiveEngine::Bitmap) << endl;
+    cout << "Radix Sort Result (Example1): " << longestConsecutive(nums1, ConsecutiveEngine::RadixSort) << endl;
+    cout << "Auto Result (Example1): " << longestConsecutive(nums1) << endl;
+
     return 0;
 }
+#endif
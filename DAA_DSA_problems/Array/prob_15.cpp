@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "../common/flat_hash_map.h"
+#include "../common/parallel.h"
 using namespace std;
 
 // Brute Force Approach (O(n^2))
@@ -17,8 +19,9 @@ int countSubarraysBrute(vector<int>& nums, int k) {
 }
 
 // Optimal Approach using Prefix Sum + HashMap (O(n))
+// The flat map is sized for all n + 1 prefixes up front, so it never rehashes.
 int countSubarraysOptimal(vector<int>& nums, int k) {
-    unordered_map<int, int> prefixFreq;
+    FlatHashMap<int, int> prefixFreq(nums.size() + 1);
     prefixFreq[0] = 1; // base case for subarray starting at index 0
 
     int prefixSum = 0, count = 0;
@@ -26,8 +29,8 @@ int countSubarraysOptimal(vector<int>& nums, int k) {
         prefixSum += num;
 
         // Check if prefixSum - k exists
-        if (prefixFreq.find(prefixSum - k) != prefixFreq.end()) {
-            count += prefixFreq[prefixSum - k];
+        if (const int* freq = prefixFreq.find(prefixSum - k)) {
+            count += *freq;
         }
 
         // Store/update prefixSum frequency
@@ -36,6 +39,80 @@ int countSubarraysOptimal(vector<int>& nums, int k) {
     return count;
 }
 
+// Chunk-Parallel Approach (O(n / threads))
+// A subarray (i, j] has sum k exactly when prefix[j] - prefix[i] == k.
+// Phase 1, one task per chunk: walk the chunk with a chunk-local 64-bit
+// prefix, count the pairs that lie entirely inside the chunk, and keep a
+// histogram of the local prefixes. An exclusive scan of the chunk totals then
+// gives each chunk its offset, turning local prefixes into global ones.
+// Phase 2 joins pairs that cross chunks: the histogram entries (global value
+// and multiplicity) are scattered into key partitions, and each partition
+// replays its chunks in order, querying value - k against everything the
+// earlier chunks inserted. Pairs with the empty prefix (value 0) are seeded
+// into its partition first. Every pair is counted once, so the result equals
+// the sequential count; sums are 64-bit and cannot overflow.
+// Time Complexity: O(n / threads + threads) expected
+// Space Complexity: O(n)
+long long countSubarraysParallel(const vector<int>& nums, long long k, int threads = 0) {
+    long long n = nums.size();
+    threads = resolveThreads(threads);
+    if (n < (1 << 18)) threads = 1;
+    int chunks = (int)min<long long>(threads, max(1LL, n));
+    long long chunkSize = (n + chunks - 1) / chunks;
+
+    struct Chunk {
+        FlatHashMap<long long, long long> histogram;
+        long long total = 0, inside = 0, offset = 0;
+    };
+    vector<Chunk> chunk(chunks);
+    parallelForDynamic(chunks, threads, [&](long long c, int) {
+        Chunk& ch = chunk[c];
+        long long begin = c * chunkSize, end = min(n, begin + chunkSize);
+        ch.histogram.reserve(end - begin);
+        long long local = 0;
+        for (long long j = begin; j < end; j++) {
+            local += nums[j];
+            if (const long long* seen = ch.histogram.find(local - k)) ch.inside += *seen;
+            ch.histogram[local]++;
+        }
+        ch.total = local;
+    });
+    long long count = 0;
+    for (int c = 1; c < chunks; c++) chunk[c].offset = chunk[c - 1].offset + chunk[c - 1].total;
+    for (auto& ch : chunk) count += ch.inside;
+
+    // Partition by the high hash bits; the maps index by the low ones.
+    int parts = threads == 1 ? 1 : 4 * threads;
+    auto partOf = [&](long long key) { return (int)(((flatHashMix((uint64_t)key) >> 32) * parts) >> 32); };
+    using Entry = pair<long long, long long>; // global value, multiplicity
+    vector<vector<Entry>> inserts((size_t)chunks * parts), queries((size_t)chunks * parts);
+    parallelForDynamic(chunks, threads, [&](long long c, int) {
+        chunk[c].histogram.forEach([&](long long local, long long mult) {
+            long long value = local + chunk[c].offset;
+            inserts[c * parts + partOf(value)].push_back({value, mult});
+            queries[c * parts + partOf(value - k)].push_back({value - k, mult});
+        });
+        chunk[c].histogram = FlatHashMap<long long, long long>(); // release early
+    });
+
+    vector<long long> crossing(parts, 0);
+    parallelForDynamic(parts, threads, [&](long long p, int) {
+        size_t expected = 0;
+        for (int c = 0; c < chunks; c++) expected += inserts[c * parts + p].size();
+        FlatHashMap<long long, long long> earlier(expected + 1);
+        if (partOf(0) == p) earlier[0] = 1;
+        for (int c = 0; c < chunks; c++) {
+            for (auto& [key, mult] : queries[c * parts + p]) {
+                if (const long long* seen = earlier.find(key)) crossing[p] += *seen * mult;
+            }
+            for (auto& [value, mult] : inserts[c * parts + p]) earlier[value] += mult;
+        }
+    });
+    for (long long x : crossing) count += x;
+    return count;
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> nums1 = {1, 1, 1};
     int k1 = 2;
@@ -46,6 +123,8 @@ int main() {
     int k2 = 3;
     cout << "Brute Force Result (Example2): " << countSubarraysBrute(nums2, k2) << endl;
     cout << "Optimal Result (Example2): " << countSubarraysOptimal(nums2, k2) << endl;
+    cout << "Parallel Result (Example2): " << countSubarraysParallel(nums2, k2) << endl;
 
     return 0;
 }
+#endif
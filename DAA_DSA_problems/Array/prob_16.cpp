@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../common/parallel.h"
 using namespace std;
 
 /* ===============================
@@ -38,6 +39,106 @@ int maxProductOptimal(vector<int> &nums) {
     return ans;
 }
 
+/* ===============================
+   Overflow-Safe Parallel Approach (Sign + Log Magnitude)
+   =============================== */
+
+// The best subarray as [begin, end) with its sign and log2 of its |product|,
+// so arbitrarily long products compare without overflowing.
+struct MaxProduct {
+    size_t begin = 0, end = 0;
+    int sign = -2; // -2: nothing recorded yet
+    double log2Abs = 0;
+
+    bool betterThan(const MaxProduct& o) const {
+        if (sign != o.sign) return sign > o.sign;
+        return sign > 0 ? log2Abs > o.log2Abs : sign < 0 && log2Abs < o.log2Abs;
+    }
+
+    // The exact product clamped to [LLONG_MIN, LLONG_MAX].
+    long long saturatedValue(const vector<int>& nums) const {
+        __int128 limit = (__int128)LLONG_MAX + 1, p = 1;
+        for (size_t i = begin; i < end; i++) {
+            p *= nums[i];
+            if (p >= limit || p <= -limit) return p > 0 ? LLONG_MAX : LLONG_MIN;
+        }
+        return (long long)p;
+    }
+};
+
+// Best product inside the zero-free run [b, e). Every |x| >= 1, so extending a
+// subarray never shrinks its magnitude: with an even number of negatives the
+// whole run wins, otherwise the longer-in-magnitude of "drop everything from
+// the last negative on" and "drop everything up to the first negative".
+// Time Complexity: O(e - b)
+// Space Complexity: O(1)
+MaxProduct maxProductInRun(const vector<int>& nums, size_t b, size_t e) {
+    size_t firstNeg = e, lastNeg = e, negatives = 0;
+    double total = 0, upToFirst = 0, fromLast = 0;
+    for (size_t i = b; i < e; i++) {
+        double l = log2(fabs((double)nums[i]));
+        total += l;
+        if (nums[i] < 0) {
+            if (negatives++ == 0) {
+                firstNeg = i;
+                upToFirst = total;
+            }
+            lastNeg = i;
+            fromLast = 0;
+        }
+        fromLast += l;
+    }
+    if (negatives % 2 == 0) return {b, e, 1, total};
+    if (e - b == 1) return {b, e, -1, total}; // a lone negative
+    MaxProduct left{b, lastNeg, 1, total - fromLast}, right{firstNeg + 1, e, 1, total - upToFirst};
+    if (left.begin == left.end) return right;
+    if (right.begin == right.end) return left;
+    return right.betterThan(left) ? right : left;
+}
+
+// Splits nums at its zeros and solves the zero-free runs independently on a
+// thread pool, then keeps the best run (or a zero, if no run is positive).
+// Zero positions are found chunk-parallel; runs are handed out in batches.
+// Throws invalid_argument on empty input.
+// Time Complexity: O(n / threads + zeros)
+// Space Complexity: O(zeros)
+MaxProduct maxProductParallel(const vector<int>& nums, int threads = 0) {
+    size_t n = nums.size();
+    if (n == 0) throw invalid_argument("maxProductParallel: empty input");
+    threads = resolveThreads(threads);
+    if (n < ((size_t)1 << 18)) threads = 1;
+
+    vector<vector<size_t>> zerosIn(threads);
+    parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+        for (long long i = begin; i < end; i++) {
+            if (nums[i] == 0) zerosIn[t].push_back(i);
+        }
+    });
+    vector<size_t> cuts; // run boundaries: every zero, plus n
+    for (auto& z : zerosIn) cuts.insert(cuts.end(), z.begin(), z.end());
+    bool hasZero = !cuts.empty();
+    cuts.push_back(n);
+
+    const size_t BATCH = 256;
+    vector<MaxProduct> best(threads);
+    parallelForDynamic((long long)((cuts.size() + BATCH - 1) / BATCH), threads, [&](long long batch, int t) {
+        size_t first = batch * BATCH, last = min(cuts.size(), first + BATCH);
+        for (size_t r = first; r < last; r++) {
+            size_t b = r == 0 ? 0 : cuts[r - 1] + 1, e = cuts[r];
+            if (b == e) continue;
+            MaxProduct run = maxProductInRun(nums, b, e);
+            if (run.betterThan(best[t])) best[t] = run;
+        }
+    });
+
+    MaxProduct answer;
+    if (hasZero) answer = {cuts[0], cuts[0] + 1, 0, 0};
+    for (auto& b : best) {
+        if (b.betterThan(answer)) answer = b;
+    }
+    return answer;
+}
+
 /* ===============================
    Main Function (Driver Code)
    =============================== */
@@ -51,5 +152,17 @@ int main() {
     cout << "Brute Force Result: " << maxProductBruteForce(nums) << endl;
     cout << "Optimal Result: " << maxProductOptimal(nums) << endl;
 
+    MaxProduct best = maxProductParallel(nums);
+    cout << "Parallel Result: " << best.saturatedValue(nums) << " (indices " << best.begin << ".." << best.end - 1
+         << ")" << endl;
+
+    // 60 factors of -7 and 7 around zeros: far beyond 64 bits, still ordered.
+    vector<int> gains;
+    for (int i = 0; i < 60; i++) gains.push_back(i % 3 ? 7 : -7);
+    gains.push_back(0);
+    gains.push_back(5);
+    MaxProduct big = maxProductParallel(gains);
+    cout << "Long Gain Product: 2^" << big.log2Abs << " (saturated " << big.saturatedValue(gains) << ")" << endl;
+
     return 0;
 }
@@ -1,4 +1,7 @@
 #include <bits/stdc++.h>
+#include "../common/bench.h"
+#include "../common/flat_hash_map.h"
+#include "../common/subarray_window.h"
 using namespace std;
 
 
@@ -26,7 +29,7 @@ int longestSubarrayBruteForce(vector<int> &nums, int k) {
 
 
 int longestSubarrayOptimal(vector<int> &nums, int k) {
-    unordered_map<int, int> prefixSumIndex;
+    FlatHashMap<int, int> prefixSumIndex(nums.size());
     int sum = 0, maxLen = 0;
 
     for (int i = 0; i < nums.size(); i++) {
@@ -35,19 +38,31 @@ int longestSubarrayOptimal(vector<int> &nums, int k) {
         if (sum == k)
             maxLen = i + 1;
 
-        if (prefixSumIndex.find(sum - k) != prefixSumIndex.end())
-            maxLen = max(maxLen, i - prefixSumIndex[sum - k]);
+        if (const int* first = prefixSumIndex.find(sum - k))
+            maxLen = max(maxLen, i - *first);
 
-        if (prefixSumIndex.find(sum) == prefixSumIndex.end())
-            prefixSumIndex[sum] = i;
+        prefixSumIndex.tryEmplace(sum, i); // keeps the earliest index
     }
     return maxLen;
 }
 
+//Adaptive Approach (Sliding Window for Non-Negative Input, else Hash Map)
+
+// Routes non-negative input (detected or hinted) to the O(1)-memory window
+// and mixed-sign input to the prefix-sum hash map.
+// Time Complexity: O(n)
+// Space Complexity: O(1) for non-negative input, O(n) otherwise
+int longestSubarrayAuto(vector<int> &nums, int k, SignHint hint = SignHint::Detect) {
+    bool nonNegative = hint == SignHint::NonNegative ||
+                       (hint == SignHint::Detect && !hasNegative(nums.data(), nums.size()));
+    return nonNegative ? longestSubarrayNonNegative(nums, k) : longestSubarrayOptimal(nums, k);
+}
+
 /* ==================================================
    Main Function (Driver Code)
    ================================================== */
-int main() {
+// Pass "bench" to also time both paths on 2^22 values.
+int main(int argc, char** argv) {
     vector<int> nums = {10, 5, 2, 7, 1, 9};
     int k = 15;
 
@@ -57,6 +72,20 @@ int main() {
 
     cout << "Brute Force Result: " << longestSubarrayBruteForce(nums, k) << endl;
     cout << "Optimal Result: " << longestSubarrayOptimal(nums, k) << endl;
+    cout << "Adaptive Result: " << longestSubarrayAuto(nums, k) << endl;
+
+    if (argc < 2 || string(argv[1]) != "bench") return 0;
+
+    // Both paths on the same 2^22 non-negative values
+    mt19937 rng(20);
+    vector<int> big(1 << 22);
+    for (int &x : big) x = rng() % 16;
+    int bigK = 4000;
+    int hashed = 0, windowed = 0;
+    Measurement mh = measure(hashed, [&] { return longestSubarrayOptimal(big, bigK); });
+    Measurement mw = measure(windowed, [&] { return longestSubarrayAuto(big, bigK); });
+    cout << "n = " << big.size() << ": hash map " << hashed << " in " << mh.ms << " ms; "
+         << "sliding window " << windowed << " in " << mw.ms << " ms (detection included)" << endl;
 
     return 0;
 }
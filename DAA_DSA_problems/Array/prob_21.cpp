@@ -32,8 +32,83 @@ vector<int> twoSumOptimal(vector<int> &nums, int target) {
     return {};
 }
 
+//Indexed Approach (Sorted Copy, Many Targets per Array)
+
+// Built once per array; every query is then a two-pointer scan over the
+// sorted copy with no allocation. The scan starts between two bounds: only
+// values v with v + min <= target can be the larger half and only values with
+// v + max >= target the smaller half. Targets outside [min pair, max pair]
+// are rejected in O(1). For a batch, the targets are visited in ascending
+// order, so both bounds only move forward and are advanced incrementally
+// instead of binary searched; answers are stored back in input order.
+// When several pairs match, any one of them is returned (the problem
+// guarantees a single solution), as original indices in increasing order.
+class TwoSumIndex {
+    vector<long long> value; // sorted ascending
+    vector<int> index;       // original position of value[i]
+
+    pair<int, int> scan(long long target, size_t lo, size_t hi) const {
+        while (lo < hi) {
+            long long sum = value[lo] + value[hi];
+            if (sum == target) return minmax(index[lo], index[hi]);
+            if (sum < target) lo++;
+            else hi--;
+        }
+        return {-1, -1};
+    }
+
+    bool reachable(long long target) const {
+        size_t n = value.size();
+        return n >= 2 && target >= value[0] + value[1] && target <= value[n - 2] + value[n - 1];
+    }
+
+public:
+    // Time Complexity: O(n log n)
+    // Space Complexity: O(n)
+    explicit TwoSumIndex(const vector<int> &nums) {
+        vector<int> order(nums.size());
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&](int a, int b) { return nums[a] < nums[b]; });
+        value.reserve(nums.size());
+        for (int i : order) value.push_back(nums[i]);
+        index = move(order);
+    }
+
+    // {i, j} with i < j, or {-1, -1} if no pair sums to target.
+    // Time Complexity: O(log n + w), w = width of the bounded window (<= n)
+    // Space Complexity: O(1)
+    pair<int, int> query(long long target) const {
+        if (!reachable(target)) return {-1, -1};
+        size_t n = value.size();
+        size_t lo = lower_bound(value.begin(), value.end(), target - value[n - 1]) - value.begin();
+        size_t hi = upper_bound(value.begin(), value.end(), target - value[0]) - value.begin() - 1;
+        return scan(target, lo, hi);
+    }
+
+    // Answers every target, in input order.
+    // Time Complexity: O(Q log Q + n + sum of window widths)
+    // Space Complexity: O(Q)
+    vector<pair<int, int>> queryBatch(const vector<long long> &targets) const {
+        vector<pair<int, int>> answer(targets.size(), {-1, -1});
+        vector<int> order(targets.size());
+        iota(order.begin(), order.end(), 0);
+        sort(order.begin(), order.end(), [&](int a, int b) { return targets[a] < targets[b]; });
+
+        size_t n = value.size(), lo = 0, hiEnd = 0; // hiEnd: one past the last candidate
+        for (int q : order) {
+            long long t = targets[q];
+            if (!reachable(t)) continue;
+            while (value[lo] + value[n - 1] < t) lo++;
+            while (hiEnd < n && value[hiEnd] + value[0] <= t) hiEnd++;
+            answer[q] = scan(t, lo, hiEnd - 1);
+        }
+        return answer;
+    }
+};
+
 // Main Function (Driver Code)
    
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> nums = {2, 7, 11, 15};
     int target = 9;
@@ -53,5 +128,12 @@ int main() {
     for (int x : ans2) cout << x << " ";
     cout << endl;
 
+    TwoSumIndex index(nums);
+    vector<long long> targets = {26, 9, 100, 18, 13};
+    cout << "Indexed Batch Result: ";
+    for (auto [i, j] : index.queryBatch(targets)) cout << "[" << i << "," << j << "] ";
+    cout << endl;
+
     return 0;
 }
+#endif
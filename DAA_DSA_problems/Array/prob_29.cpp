@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "../common/flat_hash_map.h"
+#include "../common/parallel.h"
 using namespace std;
 
 vector<int> majorityElement(vector<int>& nums) {
@@ -39,6 +41,152 @@ vector<int> majorityElement(vector<int>& nums) {
     return result;
 }
 
+// Misra-Gries heavy-hitter summary with k - 1 counters: after one pass over
+// a stream of n items, every item occurring more than n / k times holds a
+// counter, and each counter underestimates its item's true count by at most
+// n / k. majorityElement above is the k = 3 case.
+// A new item takes a free counter; when none is free every counter is
+// decremented and the empty ones are dropped. Each decrement round removes
+// k - 1 units that earlier increments added, so a pass costs O(1) amortized
+// per item. The counters live in two flat arrays with a FlatHashMap index
+// from item to slot, rebuilt after each decrement round.
+// Two summaries merge by adding counters and, if more than k - 1 remain,
+// subtracting the k-th largest count from all of them (Agarwal et al.),
+// which keeps the same n / k guarantee for the combined stream, so workers
+// can summarize shards independently.
+// Time Complexity: O(1) amortized per item, O(k log k) per merge
+// Space Complexity: O(k)
+class MisraGries {
+    int slots;
+    long long seen = 0;
+    vector<int> items;
+    vector<long long> counts;
+    FlatHashMap<int, int> slotOf;
+
+    void reindex() {
+        slotOf.clear();
+        for (int i = 0; i < (int)items.size(); i++) slotOf[items[i]] = i;
+    }
+
+    // Drops every counter whose count falls to zero after subtracting by.
+    void decrementAll(long long by) {
+        size_t keep = 0;
+        for (size_t i = 0; i < items.size(); i++) {
+            if (counts[i] > by) {
+                items[keep] = items[i];
+                counts[keep++] = counts[i] - by;
+            }
+        }
+        items.resize(keep);
+        counts.resize(keep);
+        reindex();
+    }
+
+public:
+    explicit MisraGries(int k) : slots(max(1, k - 1)) {
+        items.reserve(slots);
+        counts.reserve(slots);
+        slotOf.reserve(slots);
+    }
+
+    void add(int x, long long weight = 1) {
+        seen += weight;
+        if (int* at = slotOf.find(x)) {
+            counts[*at] += weight;
+            return;
+        }
+        while (weight > 0) {
+            if ((int)items.size() < slots) {
+                slotOf[x] = (int)items.size();
+                items.push_back(x);
+                counts.push_back(weight);
+                return;
+            }
+            long long low = *min_element(counts.begin(), counts.end());
+            long long by = min(low, weight);
+            weight -= by;
+            decrementAll(by);
+        }
+    }
+
+    void addAll(const int* data, size_t n) {
+        for (size_t i = 0; i < n; i++) add(data[i]);
+    }
+
+    static MisraGries merge(const MisraGries& a, const MisraGries& b) {
+        MisraGries r(a.slots + 1);
+        r.seen = a.seen + b.seen;
+        FlatHashMap<int, long long> sum(a.items.size() + b.items.size());
+        for (size_t i = 0; i < a.items.size(); i++) sum[a.items[i]] += a.counts[i];
+        for (size_t i = 0; i < b.items.size(); i++) sum[b.items[i]] += b.counts[i];
+        sum.forEach([&](int item, long long count) {
+            r.items.push_back(item);
+            r.counts.push_back(count);
+        });
+        long long by = 0;
+        if ((int)r.items.size() > r.slots) {
+            vector<long long> sorted = r.counts;
+            nth_element(sorted.begin(), sorted.begin() + r.slots, sorted.end(), greater<long long>());
+            by = sorted[r.slots]; // the k-th largest count
+        }
+        r.decrementAll(by);
+        return r;
+    }
+
+    long long streamLength() const { return seen; }
+    long long errorBound() const { return seen / (slots + 1); }
+
+    // (item, lower bound on its count); every item occurring more than
+    // n / k times is among them.
+    vector<pair<int, long long>> candidates() const {
+        vector<pair<int, long long>> out;
+        for (size_t i = 0; i < items.size(); i++) out.push_back({items[i], counts[i]});
+        sort(out.begin(), out.end(), [](auto& x, auto& y) { return x.second > y.second || (x.second == y.second && x.first < y.first); });
+        return out;
+    }
+};
+
+// Exact second pass for when the data can be re-read: keeps the candidates
+// that really occur more than n / k times, in ascending order.
+// Time Complexity: O(n)
+// Space Complexity: O(k)
+vector<int> verifyHeavyHitters(const int* data, size_t n, const MisraGries& sketch, int k) {
+    FlatHashMap<int, long long> exact;
+    for (auto& c : sketch.candidates()) exact[c.first] = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (long long* c = exact.find(data[i])) ++*c;
+    }
+    vector<int> result;
+    exact.forEach([&](int item, long long count) {
+        if (count > (long long)n / k) result.push_back(item);
+    });
+    sort(result.begin(), result.end());
+    return result;
+}
+
+// Every element occurring more than n / k times (k = 3 gives
+// majorityElement above), from per-thread sketches merged into one, with
+// the exact verification pass when verify is set. Without it the result
+// may include false positives but never misses a true heavy hitter.
+// Time Complexity: O(n / threads + threads * k log k)
+// Space Complexity: O(threads * k)
+vector<int> majorityElementK(const vector<int>& nums, int k, bool verify = true, int threads = 0) {
+    size_t n = nums.size();
+    threads = resolveThreads(threads);
+    if (n < ((size_t)1 << 18)) threads = 1;
+    vector<MisraGries> parts(threads, MisraGries(k));
+    parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+        parts[t].addAll(nums.data() + begin, (size_t)(end - begin));
+    });
+    MisraGries sketch = parts[0];
+    for (int t = 1; t < threads; t++) sketch = MisraGries::merge(sketch, parts[t]);
+    if (verify) return verifyHeavyHitters(nums.data(), n, sketch, k);
+    vector<int> result;
+    for (auto& c : sketch.candidates()) result.push_back(c.first);
+    sort(result.begin(), result.end());
+    return result;
+}
+
 int main() {
     vector<int> nums = {1, 2, 1, 1, 3, 2};
     vector<int> ans = majorityElement(nums);
@@ -47,5 +195,19 @@ int main() {
         cout << x << " ";
     cout << endl;
 
+    for (int x : majorityElementK(nums, 3))
+        cout << x << " ";
+    cout << endl;
+
+    // One pass over a stream we cannot re-read: 4 counters bound every
+    // error by n / 5.
+    MisraGries sketch(5);
+    mt19937 rng(7);
+    for (int i = 0; i < 1000000; i++) sketch.add(i % 4 == 0 ? 42 : i % 7 == 0 ? 7 : (int)(rng() % 100000));
+    cout << "Stream of " << sketch.streamLength() << ", error <= " << sketch.errorBound() << ":";
+    for (auto& c : sketch.candidates())
+        cout << " " << c.first << "(>=" << c.second << ")";
+    cout << endl;
+
     return 0;
 }
@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "../common/parallel.h"
+#include "../common/alloc_profile.h"
 using namespace std;
 
 // 🔹 Brute Force Approach (O(n³))
@@ -58,11 +60,97 @@ vector<vector<int>> threeSumOptimal(vector<int>& nums) {
     return res;
 }
 
+// 🔹 Parallel Approach (O(n² / threads))
+// Scans the triplets whose smallest element is sorted[i], for i in
+// [begin, end), calling emit(a, b, c) once per distinct triplet. Duplicate
+// first elements are skipped by looking at sorted[i - 1] in the shared array,
+// so a block starting in the middle of a run of equal values skips it exactly
+// like the sequential loop. Sums are 64-bit; the sorted order also lets a
+// first element be skipped (or the scan stopped) when no pair can reach 0.
+template <class Emit>
+void threeSumBlock(const vector<int>& sorted, size_t begin, size_t end, Emit emit) {
+    size_t n = sorted.size();
+    for (size_t i = begin; i < end && i + 2 < n; i++) {
+        long long a = sorted[i];
+        if (i > 0 && sorted[i] == sorted[i - 1]) continue;
+        if (a + sorted[i + 1] + sorted[i + 2] > 0) break;      // every later sum is larger
+        if (a + sorted[n - 2] + sorted[n - 1] < 0) continue;   // cannot reach 0
+        size_t left = i + 1, right = n - 1;
+        while (left < right) {
+            long long sum = a + sorted[left] + sorted[right];
+            if (sum == 0) {
+                emit(sorted[i], sorted[left], sorted[right]);
+                int l = sorted[left], r = sorted[right];
+                while (left < right && sorted[left] == l) left++;
+                while (left < right && sorted[right] == r) right--;
+            } else if (sum < 0) {
+                left++;
+            } else {
+                right--;
+            }
+        }
+    }
+}
+
+static constexpr size_t THREE_SUM_BLOCK = 32; // first elements per work item
+
+// Sorts nums, then hands out blocks of first elements dynamically (early
+// blocks have the longest scans). Each thread appends to its own flat
+// buffer of array<int,3> and notes which block each stretch came from; the
+// stretches are then copied out in block order, so the result matches
+// threeSumOptimal's order without one heap vector per triplet.
+// Time Complexity: O(n log n + n² / threads)
+// Space Complexity: O(triplets)
+vector<array<int, 3>> threeSumParallel(vector<int>& nums, int threads = 0) {
+    sort(nums.begin(), nums.end());
+    size_t n = nums.size(), blocks = (n + THREE_SUM_BLOCK - 1) / THREE_SUM_BLOCK;
+    threads = n < 2048 ? 1 : resolveThreads(threads);
+
+    vector<vector<array<int, 3>>> buffer(threads);
+    struct Stretch { int thread; size_t begin, end; };
+    vector<Stretch> stretch(blocks);
+    parallelForDynamic(blocks, threads, [&](long long b, int t) {
+        auto& out = buffer[t];
+        size_t first = out.size();
+        threeSumBlock(nums, b * THREE_SUM_BLOCK, (b + 1) * THREE_SUM_BLOCK,
+                      [&](int x, int y, int z) { out.push_back({x, y, z}); });
+        stretch[b] = {t, first, out.size()};
+    });
+
+    size_t total = 0;
+    for (auto& s : stretch) total += s.end - s.begin;
+    vector<array<int, 3>> res(total);
+    auto w = res.begin();
+    for (auto& s : stretch) {
+        w = copy(buffer[s.thread].begin() + s.begin, buffer[s.thread].begin() + s.end, w);
+    }
+    return res;
+}
+
+// Count-only mode: the same scan, materializing nothing.
+// Time Complexity: O(n log n + n² / threads)
+// Space Complexity: O(threads)
+long long threeSumCountParallel(vector<int>& nums, int threads = 0) {
+    sort(nums.begin(), nums.end());
+    size_t n = nums.size(), blocks = (n + THREE_SUM_BLOCK - 1) / THREE_SUM_BLOCK;
+    threads = n < 2048 ? 1 : resolveThreads(threads);
+    vector<long long> count(threads, 0);
+    parallelForDynamic(blocks, threads, [&](long long b, int t) {
+        threeSumBlock(nums, b * THREE_SUM_BLOCK, (b + 1) * THREE_SUM_BLOCK, [&](int, int, int) { count[t]++; });
+    });
+    return accumulate(count.begin(), count.end(), 0LL);
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> nums = {2, -2, 0, 3, -3, 5};
 
     cout << "🔸 Brute Force Output:\n";
-    vector<vector<int>> brute = threeSumBruteForce(nums);
+    vector<vector<int>> brute;
+    {
+        DAA_ALLOC_SCOPE("threeSumBruteForce");
+        brute = threeSumBruteForce(nums);
+    }
     for (auto& t : brute) {
         cout << "[ ";
         for (int x : t) cout << x << " ";
@@ -70,12 +158,23 @@ int main() {
     }
 
     cout << "\n🔹 Optimal Output:\n";
-    vector<vector<int>> optimal = threeSumOptimal(nums);
+    vector<vector<int>> optimal;
+    {
+        DAA_ALLOC_SCOPE("threeSumOptimal");
+        optimal = threeSumOptimal(nums);
+    }
     for (auto& t : optimal) {
         cout << "[ ";
         for (int x : t) cout << x << " ";
         cout << "]\n";
     }
 
+    cout << "\n🔹 Parallel Output:\n";
+    for (auto& t : threeSumParallel(nums)) {
+        cout << "[ " << t[0] << " " << t[1] << " " << t[2] << " ]\n";
+    }
+    cout << "Triplet Count: " << threeSumCountParallel(nums) << "\n";
+
     return 0;
 }
+#endif
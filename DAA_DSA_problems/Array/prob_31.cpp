@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../common/flat_hash_map.h"
 using namespace std;
 
 // 🔹 Brute Force Approach (O(n^2))
@@ -21,7 +22,7 @@ int largestSubarraySumZeroBruteForce(vector<int>& arr) {
 
 // 🔹 Optimal Approach (O(n)) using Hash Map
 int largestSubarraySumZeroOptimal(vector<int>& arr) {
-    unordered_map<int, int> prefixSumIndex; // stores first occurrence of prefix sum
+    FlatHashMap<int, int> prefixSumIndex(arr.size()); // stores first occurrence of prefix sum
     int sum = 0;
     int maxLen = 0;
 
@@ -31,17 +32,17 @@ int largestSubarraySumZeroOptimal(vector<int>& arr) {
         if (sum == 0) {
             maxLen = i + 1; // subarray from 0 to i
         } 
-        else if (prefixSumIndex.find(sum) != prefixSumIndex.end()) {
-            maxLen = max(maxLen, i - prefixSumIndex[sum]);
-        } 
         else {
-            prefixSumIndex[sum] = i; // store first occurrence
+            // One probe: stores i as the first occurrence, or returns the earlier one
+            auto [first, inserted] = prefixSumIndex.tryEmplace(sum, i);
+            if (!inserted) maxLen = max(maxLen, i - *first);
         }
     }
 
     return maxLen;
 }
 
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> arr = {15, -2, 2, -8, 1, 7, 10, 23};
 
@@ -50,3 +51,4 @@ int main() {
 
     return 0;
 }
+#endif
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../common/parallel.h"
 using namespace std;
 
 void mergeArrays(vector<int>& nums1, int m, vector<int>& nums2, int n) {
@@ -21,6 +22,123 @@ void mergeArrays(vector<int>& nums1, int m, vector<int>& nums2, int n) {
     }
 }
 
+// How many of the first d outputs of the stable merge of A[0, na) and
+// B[0, nb) come from A (equal keys take A first).
+size_t mergeSplit(const int* A, size_t na, const int* B, size_t nb, size_t d) {
+    size_t lo = d > nb ? d - nb : 0, hi = min(d, na);
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        if (A[i] <= B[d - i - 1]) lo = i + 1;
+        else hi = i;
+    }
+    return lo;
+}
+
+// Merge-path merge of nums1[0, m) and nums2[0, n) into nums1[0, m + n).
+// The output is produced back to front in rounds of ROUND slots. A round
+// first locates where its first and last slot split between the inputs;
+// the nums1 elements it will consume are then copied to a ROUND-sized
+// scratch buffer (the round's writes may land on them), and the round is cut
+// along its merge path into one disjoint output range per thread. Later
+// rounds only read nums1 below the current split, which no round has
+// written yet, so the merge stays in nums1 with O(ROUND) extra memory.
+// Time Complexity: O((m + n) / threads + (m + n) / ROUND * threads * log(m + n))
+// Space Complexity: O(ROUND)
+void mergeArraysParallel(vector<int>& nums1, int m, vector<int>& nums2, int n, int threads = 0) {
+    const size_t ROUND = 1 << 20, total = (size_t)m + n;
+    threads = total < (1 << 18) ? 1 : resolveThreads(threads);
+    if (threads == 1) {
+        mergeArrays(nums1, m, nums2, n);
+        return;
+    }
+    int* out = nums1.data();
+    const int* B = nums2.data();
+    vector<int> scratch(min(ROUND, (size_t)m));
+
+    size_t hiD = total, hiI = m; // outputs [hiD, total) are final; hiI = nums1 consumed below hiD
+    while (hiD > 0) {
+        size_t loD = hiD > ROUND ? hiD - ROUND : 0;
+        size_t loI = mergeSplit(out, m, B, n, loD);
+        size_t loJ = loD - loI, hiJ = hiD - hiI;
+        copy(out + loI, out + hiI, scratch.begin());
+        const int* A = scratch.data();
+        size_t na = hiI - loI, nb = hiJ - loJ, width = hiD - loD;
+        parallelForDynamic(threads, threads, [&](long long t, int) {
+            size_t d0 = width * t / threads, d1 = width * (t + 1) / threads;
+            size_t i = mergeSplit(A, na, B + loJ, nb, d0), j = d0 - i;
+            for (size_t d = d0; d < d1; d++) {
+                out[loD + d] = j == nb || (i < na && A[i] <= B[loJ + j]) ? A[i++] : B[loJ + j++];
+            }
+        });
+        hiD = loD;
+        hiI = loI;
+    }
+}
+
+// k-way merge of sorted runs into one sorted vector. The output is cut into
+// one rank range per thread; the cut for rank r is found by binary
+// searching the value v holding rank r (counting <= v with upper_bound in
+// every run), taking all elements below v and then handing out the copies
+// of v run by run. Each thread then merges its slices of all runs through a
+// min-heap of run heads.
+// Time Complexity: O(N log k / threads + threads * k * log N * 32)
+// Space Complexity: O(N) for the result
+vector<int> kWayMerge(const vector<vector<int>>& runs, int threads = 0) {
+    size_t k = runs.size(), total = 0;
+    for (auto& r : runs) total += r.size();
+    vector<int> out(total);
+    threads = total < (1 << 18) ? 1 : resolveThreads(threads);
+
+    // cut[t][r]: where thread t starts in run r (cut[threads] = run ends)
+    auto cutAt = [&](size_t rank) {
+        vector<size_t> pos(k);
+        if (rank == total) {
+            for (size_t r = 0; r < k; r++) pos[r] = runs[r].size();
+            return pos;
+        }
+        long long lo = INT_MIN, hi = INT_MAX;
+        while (lo < hi) { // smallest v with count(<= v) > rank
+            long long v = lo + (hi - lo) / 2;
+            size_t atMost = 0;
+            for (auto& run : runs) atMost += upper_bound(run.begin(), run.end(), v) - run.begin();
+            if (atMost > rank) hi = v;
+            else lo = v + 1;
+        }
+        size_t taken = 0;
+        for (size_t r = 0; r < k; r++) {
+            pos[r] = lower_bound(runs[r].begin(), runs[r].end(), lo) - runs[r].begin();
+            taken += pos[r];
+        }
+        for (size_t r = 0; r < k && taken < rank; r++) {
+            size_t equal = (upper_bound(runs[r].begin(), runs[r].end(), lo) - runs[r].begin()) - pos[r];
+            size_t use = min(equal, rank - taken);
+            pos[r] += use;
+            taken += use;
+        }
+        return pos;
+    };
+
+    vector<vector<size_t>> cut(threads + 1);
+    parallelForDynamic(threads + 1, threads, [&](long long t, int) { cut[t] = cutAt(total * t / threads); });
+    parallelForDynamic(threads, threads, [&](long long t, int) {
+        using Head = pair<int, size_t>; // value, run
+        priority_queue<Head, vector<Head>, greater<Head>> heads;
+        vector<size_t> at = cut[t];
+        for (size_t r = 0; r < k; r++) {
+            if (at[r] < cut[t + 1][r]) heads.push({runs[r][at[r]], r});
+        }
+        size_t w = total * t / threads;
+        while (!heads.empty()) {
+            auto [v, r] = heads.top();
+            heads.pop();
+            out[w++] = v;
+            if (++at[r] < cut[t + 1][r]) heads.push({runs[r][at[r]], r});
+        }
+    });
+    return out;
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> nums1 = {-5, -2, 4, 5, 0, 0, 0}; // m+n size with extra space
     vector<int> nums2 = {-3, 1, 8};
@@ -32,6 +150,11 @@ int main() {
     for (int x : nums1) cout << x << " ";
     cout << endl;
 
+    vector<int> merged = kWayMerge({{-5, -2, 4, 5}, {-3, 1, 8}, {0, 2, 2}});
+    cout << "3-way Merged: ";
+    for (int x : merged) cout << x << " ";
+    cout << endl;
+
     return 0;
 }
-
+#endif
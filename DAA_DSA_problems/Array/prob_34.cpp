@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "../common/flat_hash_map.h"
+#include "../common/parallel.h"
 using namespace std;
 
 vector<vector<int>> fourSum(vector<int>& nums, int target) {
@@ -35,6 +37,117 @@ vector<vector<int>> fourSum(vector<int>& nums, int target) {
     return res;
 }
 
+// Generalized kSum over a sorted array with 64-bit sums. pre[] holds prefix
+// sums, so for a candidate first element sorted[i] the smallest reachable
+// sum (sorted[i..i+k)) and the largest (sorted[i] plus the k - 1 largest
+// values) are O(1) lookups: if even the smallest exceeds target no later i
+// can work, and if the largest falls short this i is skipped. The last two
+// levels are the usual two-pointer scan. Calls emit(path) once per distinct
+// combination, in lexicographic order.
+template <class Emit>
+void kSumSearch(const vector<int>& sorted, const vector<long long>& pre, size_t start, int k, long long target,
+                vector<int>& path, Emit& emit) {
+    size_t n = sorted.size();
+    if (n - start < (size_t)k) return;
+    if (k == 1) {
+        if (binary_search(sorted.begin() + start, sorted.end(), target)) {
+            path.push_back((int)target);
+            emit(path);
+            path.pop_back();
+        }
+        return;
+    }
+    if (k == 2) {
+        size_t left = start, right = n - 1;
+        while (left < right) {
+            long long sum = (long long)sorted[left] + sorted[right];
+            if (sum == target) {
+                path.push_back(sorted[left]);
+                path.push_back(sorted[right]);
+                emit(path);
+                path.resize(path.size() - 2);
+                int l = sorted[left], r = sorted[right];
+                while (left < right && sorted[left] == l) left++;
+                while (left < right && sorted[right] == r) right--;
+            } else if (sum < target) {
+                left++;
+            } else {
+                right--;
+            }
+        }
+        return;
+    }
+    for (size_t i = start; i + k <= n; i++) {
+        if (i > start && sorted[i] == sorted[i - 1]) continue;
+        if (pre[i + k] - pre[i] > target) break;
+        if (sorted[i] + (pre[n] - pre[n - k + 1]) < target) continue;
+        path.push_back(sorted[i]);
+        kSumSearch(sorted, pre, i + 1, k - 1, target - sorted[i], path, emit);
+        path.pop_back();
+    }
+}
+
+// Sorts nums and returns every distinct k-combination summing to target.
+// For k >= 3 the first-element loop runs on a thread pool (one work item per
+// index, handed out dynamically because early indices have more work); each
+// index gets its own output list and the lists are joined in index order,
+// so the result is the same as the sequential search.
+// Time Complexity: O(n^(k-1) / threads), pruned by the sum bounds
+// Space Complexity: O(k) per thread besides the output
+vector<vector<int>> kSum(vector<int>& nums, int k, long long target, int threads = 0) {
+    vector<vector<int>> res;
+    if (k < 1 || nums.size() < (size_t)k) return res;
+    sort(nums.begin(), nums.end());
+    size_t n = nums.size();
+    vector<long long> pre(n + 1, 0);
+    for (size_t i = 0; i < n; i++) pre[i + 1] = pre[i] + nums[i];
+
+    if (k <= 2 || n < 256) {
+        vector<int> path;
+        auto emit = [&](const vector<int>& p) { res.push_back(p); };
+        kSumSearch(nums, pre, 0, k, target, path, emit);
+        return res;
+    }
+    vector<vector<vector<int>>> byFirst(n - k + 1);
+    parallelForDynamic((long long)byFirst.size(), resolveThreads(threads), [&](long long i, int) {
+        if (i > 0 && nums[i] == nums[i - 1]) return;
+        if (pre[i + k] - pre[i] > target) return;
+        if (nums[i] + (pre[n] - pre[n - k + 1]) < target) return;
+        vector<int> path = {nums[i]};
+        auto emit = [&](const vector<int>& p) { byFirst[i].push_back(p); };
+        kSumSearch(nums, pre, i + 1, k - 1, target - nums[i], path, emit);
+    });
+    for (auto& list : byFirst) {
+        for (auto& q : list) res.push_back(move(q));
+    }
+    return res;
+}
+
+// fourSum with bound pruning, 64-bit sums and a parallel outer loop.
+vector<vector<int>> fourSumParallel(vector<int>& nums, long long target, int threads = 0) {
+    return kSum(nums, 4, target, threads);
+}
+
+// Count-only engine: the number of index quadruples i < j < k < l with
+// nums[i] + nums[j] + nums[k] + nums[l] == target (positions, not distinct
+// values, are counted). Walking k left to right, the bucket map holds the
+// sums of all pairs (i, j) with j < k, so each (k, l) pair looks up its
+// complement once and then pairs (i, k) are added before k advances.
+// Time Complexity: O(n^2) expected
+// Space Complexity: O(n^2) for the pair-sum buckets
+long long fourSumCount(const vector<int>& nums, long long target) {
+    size_t n = nums.size();
+    FlatHashMap<long long, long long> pairsBefore(n * (n - (n > 0)) / 2);
+    long long count = 0;
+    for (size_t k = 0; k < n; k++) {
+        for (size_t l = k + 1; l < n; l++) {
+            if (const long long* c = pairsBefore.find(target - nums[k] - nums[l])) count += *c;
+        }
+        for (size_t i = 0; i < k; i++) pairsBefore[(long long)nums[i] + nums[k]]++;
+    }
+    return count;
+}
+
 int main() {
     vector<int> nums = {1, -2, 3, 5, 7, 9};
     int target = 7;
@@ -47,6 +160,17 @@ int main() {
         for (int x : q) cout << x << " ";
         cout << "]" << endl;
     }
+
+    cout << "Quadruplets (parallel, pruned): " << endl;
+    for (auto &q : fourSumParallel(nums, target)) {
+        cout << "[ ";
+        for (int x : q) cout << x << " ";
+        cout << "]" << endl;
+    }
+    cout << "Index quadruples summing to target: " << fourSumCount(nums, target) << endl;
+
+    vector<int> big = {1000000000, 1000000000, 1000000000, 1000000000, -5, 5, 0};
+    cout << "5-sum to 4e9 (no overflow): " << kSum(big, 5, 4000000000LL).size() << endl;
     return 0;
 }
 
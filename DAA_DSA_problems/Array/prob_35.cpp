@@ -1,8 +1,10 @@
 #include <bits/stdc++.h>
+#include "../common/flat_hash_map.h"
+#include "../common/autotune.h"
 using namespace std;
 
 int countSubarraysXor(vector<int>& nums, int k) {
-    unordered_map<int, int> freq;
+    FlatHashMap<int, int> freq(nums.size());
     int prefixXor = 0, count = 0;
 
     for (int num : nums) {
@@ -13,8 +15,8 @@ int countSubarraysXor(vector<int>& nums, int k) {
 
         // Case 2: check if there exists a prefix with XOR = prefixXor ^ k
         int need = prefixXor ^ k;
-        if (freq.find(need) != freq.end()) {
-            count += freq[need];
+        if (const int* seen = freq.find(need)) {
+            count += *seen;
         }
 
         // Store current prefixXor
@@ -23,6 +25,143 @@ int countSubarraysXor(vector<int>& nums, int k) {
     return count;
 }
 
+// Number of bits needed for the widest value (negative values need all 32).
+int observedBitWidth(const vector<int>& nums) {
+    uint32_t all = 0;
+    for (int x : nums) all |= (uint32_t)x;
+    return all ? 32 - __builtin_clz(all) : 0;
+}
+
+// Direct-indexed engine: when every value fits in b bits so does every prefix
+// XOR, so the hash map becomes a flat count array of 2^b entries.
+// Time Complexity: O(n + 2^b)
+// Space Complexity: O(2^b)
+long long countSubarraysXorDirect(const vector<int>& nums, int k, int bits) {
+    uint32_t size = 1u << bits;
+    if ((uint32_t)k >= size) return 0; // no two b-bit prefixes XOR to k
+    vector<uint32_t> freq(size, 0);
+    freq[0] = 1; // the empty prefix
+    uint32_t prefixXor = 0;
+    long long count = 0;
+    for (int num : nums) {
+        prefixXor ^= (uint32_t)num;
+        count += freq[prefixXor ^ (uint32_t)k];
+        freq[prefixXor]++;
+    }
+    return count;
+}
+
+// Picks the engine from the observed bit width: a count array up to 2^20
+// entries (4 MiB) by default, or up to the "xor_count.direct_max_bits" of
+// the tuning profile (common/autotune.h); the flat hash map beyond that.
+long long countSubarraysXorAuto(vector<int>& nums, int k) {
+    static const TunedValue directMaxBits("xor_count.direct_max_bits", 20);
+    int bits = observedBitWidth(nums);
+    if (bits <= min(30.0, (double)directMaxBits)) return countSubarraysXorDirect(nums, k, bits);
+    return countSubarraysXor(nums, k);
+}
+
+// Binary trie over fixed-width prefix XORs, most significant bit first.
+// Every node counts the values below it, so "how many stored y have
+// x ^ y < k" is one root-to-leaf walk: wherever k has a 1, all values that
+// make that XOR bit 0 are smaller and are added at once.
+// Time Complexity: O(bits) per operation
+// Space Complexity: O(n * bits)
+class XorPrefixTrie {
+    struct Node {
+        int child[2] = {0, 0}; // 0 = absent (the root is never a child)
+        int count = 0;
+    };
+    vector<Node> nodes;
+    int bits;
+
+public:
+    explicit XorPrefixTrie(int width, size_t expected = 0) : nodes(1), bits(width) {
+        nodes.reserve(expected * width + 1);
+    }
+
+    void insert(uint32_t x) {
+        int cur = 0;
+        nodes[0].count++;
+        for (int b = bits - 1; b >= 0; b--) {
+            int bit = x >> b & 1;
+            if (!nodes[cur].child[bit]) {
+                nodes[cur].child[bit] = (int)nodes.size();
+                nodes.emplace_back();
+            }
+            cur = nodes[cur].child[bit];
+            nodes[cur].count++;
+        }
+    }
+
+    // Stored values y with (x ^ y) < k.
+    long long countLess(uint32_t x, uint32_t k) const {
+        long long count = 0;
+        int cur = 0;
+        for (int b = bits - 1; b >= 0 && cur >= 0; b--) {
+            int xb = x >> b & 1;
+            const Node& node = nodes[cur];
+            if (k >> b & 1) {
+                if (node.child[xb]) count += nodes[node.child[xb]].count;
+                cur = node.child[xb ^ 1] ? node.child[xb ^ 1] : -1;
+            } else {
+                cur = node.child[xb] ? node.child[xb] : -1;
+            }
+        }
+        return count;
+    }
+
+    // Largest x ^ y over the stored values; the trie must not be empty.
+    uint32_t maxXor(uint32_t x) const {
+        uint32_t best = 0;
+        int cur = 0;
+        for (int b = bits - 1; b >= 0; b--) {
+            int want = (x >> b & 1) ^ 1;
+            if (nodes[cur].child[want]) {
+                best |= 1u << b;
+                cur = nodes[cur].child[want];
+            } else {
+                cur = nodes[cur].child[want ^ 1];
+            }
+        }
+        return best;
+    }
+};
+
+// Subarrays whose XOR is strictly less than k (values and k as unsigned).
+// Time Complexity: O(n * b)
+// Space Complexity: O(n * b)
+long long countSubarraysXorLess(const vector<int>& nums, uint32_t k) {
+    int bits = max(observedBitWidth(nums), k ? 32 - __builtin_clz(k) : 0);
+    if (bits == 0) return 0; // every XOR is 0 and k is 0
+    XorPrefixTrie trie(bits, nums.size() + 1);
+    trie.insert(0);
+    uint32_t prefixXor = 0;
+    long long count = 0;
+    for (int num : nums) {
+        prefixXor ^= (uint32_t)num;
+        count += trie.countLess(prefixXor, k);
+        trie.insert(prefixXor);
+    }
+    return count;
+}
+
+// Largest XOR of any non-empty subarray.
+// Time Complexity: O(n * b)
+// Space Complexity: O(n * b)
+uint32_t maxSubarrayXor(const vector<int>& nums) {
+    int bits = max(1, observedBitWidth(nums));
+    XorPrefixTrie trie(bits, nums.size() + 1);
+    trie.insert(0);
+    uint32_t prefixXor = 0, best = 0;
+    for (int num : nums) {
+        prefixXor ^= (uint32_t)num;
+        best = max(best, trie.maxXor(prefixXor));
+        trie.insert(prefixXor);
+    }
+    return best;
+}
+
 int main() {
     vector<int> nums1 = {4, 2, 2, 6, 4};
     int k1 = 6;
@@ -32,6 +171,10 @@ int main() {
     int k2 = 5;
     cout << "Output: " << countSubarraysXor(nums2, k2) << endl; // 2
 
+    cout << "Direct-indexed Output: " << countSubarraysXorAuto(nums1, k1) << endl; // 4
+    cout << "Subarrays with XOR < 5: " << countSubarraysXorLess(nums2, 5) << endl;
+    cout << "Max Subarray XOR: " << maxSubarrayXor(nums2) << endl;
+
     return 0;
 }
 
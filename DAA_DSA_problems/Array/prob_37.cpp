@@ -1,8 +1,9 @@
 #include <bits/stdc++.h>
+#include "../common/merge_count.h"
 using namespace std;
 
 // Brute Force Approach
-int numberOfInversions(vector<int>&a, int n) {
+int numberOfInversionsBruteForce(vector<int>&a, int n) {
 
     // Count the number of pairs:
     int cnt = 0;
@@ -74,3 +75,66 @@ int numberOfInversions(vector<int>&a, int n) {
     // Count the number of pairs:
     return mergeSort(a, 0, n - 1);
 }
+
+// Parallel Approach (one scratch buffer, 64-bit counts)
+
+// Sorts a and returns its inversion count as a 64-bit value: the shared
+// merge-sort counting engine (common/merge_count.h) with its pairs
+// a[i] > a[j], run on a thread pool with one scratch buffer allocated up
+// front. Works for any ordered element type (int, int64_t, double).
+// Time Complexity: O(n log n / threads)
+// Space Complexity: O(n)
+template <class T>
+long long numberOfInversionsParallel(vector<T> &a, int threads = 0) {
+    return mergeSortCount(a, ScaledGreater<T>(1, 0), threads);
+}
+
+// Fenwick Tree Approach (over compressed values)
+// Walks from the right, counting how many already-seen values are strictly
+// smaller; ranks come from the sorted distinct values.
+// Time Complexity: O(n log n)
+// Space Complexity: O(n)
+long long numberOfInversionsFenwick(const vector<int> &a) {
+    vector<int> values(a);
+    sort(values.begin(), values.end());
+    values.erase(unique(values.begin(), values.end()), values.end());
+    vector<long long> tree(values.size() + 1, 0);
+    long long cnt = 0;
+    for (size_t i = a.size(); i-- > 0;) {
+        size_t rank = lower_bound(values.begin(), values.end(), a[i]) - values.begin(); // 0-based
+        for (size_t k = rank; k > 0; k -= k & -k) cnt += tree[k];  // seen values < a[i]
+        for (size_t k = rank + 1; k <= values.size(); k += k & -k) tree[k]++;
+    }
+    return cnt;
+}
+
+// Kendall tau distance between two rankings of the items 0..n-1 (each
+// listed best first): the number of item pairs the rankings order
+// differently, i.e. the inversions of ranking a relabelled by positions in b.
+// Time Complexity: O(n log n / threads)
+// Space Complexity: O(n)
+long long kendallTauDistance(const vector<int> &a, const vector<int> &b, int threads = 0) {
+    vector<int> positionInB(b.size());
+    for (size_t i = 0; i < b.size(); i++) positionInB[b[i]] = (int)i;
+    vector<int> relabelled(a.size());
+    for (size_t i = 0; i < a.size(); i++) relabelled[i] = positionInB[a[i]];
+    return numberOfInversionsParallel(relabelled, threads);
+}
+
+#ifndef DAA_NO_MAIN
+int main() {
+    vector<int> a = {5, 3, 2, 4, 1};
+    int n = a.size();
+
+    vector<int> b = a, c = a;
+    cout << "Brute Force Output: " << numberOfInversionsBruteForce(b, n) << endl;
+    cout << "Optimal Output: " << numberOfInversions(c, n) << endl;
+    cout << "Fenwick Output: " << numberOfInversionsFenwick(a) << endl;
+    c = a;
+    cout << "Parallel Output: " << numberOfInversionsParallel(c) << endl;
+
+    vector<int> rankA = {0, 1, 2, 3, 4}, rankB = {1, 0, 4, 2, 3};
+    cout << "Kendall tau distance: " << kendallTauDistance(rankA, rankB) << endl;
+    return 0;
+}
+#endif
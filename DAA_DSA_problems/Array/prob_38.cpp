@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../common/merge_count.h"
 using namespace std;
 
 // Brute Force Approach
@@ -15,7 +16,7 @@ int countPairs(vector<int>&a, int n) {
     return cnt;
 }
 
-int team(vector <int> & skill, int n) {
+int teamBruteForce(vector <int> & skill, int n) {
     return countPairs(skill, n);
 }
 
@@ -84,3 +85,36 @@ int team(vector <int> & skill, int n)
     return mergeSort(skill, 0, n - 1);
 }
 
+
+// Parallel Approach (shared merge-sort counting engine)
+
+// Pairs i < j with a[i] > c * a[j] + d, for any c >= 0 and offset d, on
+// int, int64_t or double input. The counting and merging live in
+// common/merge_count.h, which prob_37's inversion counter (c = 1, d = 0)
+// shares; integer comparisons there widen to __int128, so 2 * a[j] cannot
+// overflow. Sorts a in place.
+// Time Complexity: O(n log n / threads)
+// Space Complexity: O(n)
+template <class T>
+long long countSignificantPairs(vector<T> &a, T c, T d, int threads = 0) {
+    return mergeSortCount(a, ScaledGreater<T>(c, d), threads);
+}
+
+// Reverse pairs a[i] > 2 * a[j] with a 64-bit count.
+long long teamParallel(vector<int> &skill, int threads = 0) {
+    return countSignificantPairs(skill, 2, 0, threads);
+}
+
+#ifndef DAA_NO_MAIN
+int main() {
+    vector<int> skill = {4, 1, 2, 3, 1};
+    int n = skill.size();
+
+    vector<int> a = skill, b = skill;
+    cout << "Brute Force Output: " << teamBruteForce(a, n) << endl;
+    cout << "Optimal Output: " << team(b, n) << endl;
+    b = skill;
+    cout << "Parallel Output: " << teamParallel(b) << endl;
+    return 0;
+}
+#endif
@@ -2,6 +2,10 @@
 // Roll No.: 2511AI46
 
 #include<bits/stdc++.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "../common/parallel.h"
 using namespace std;
 
 // TC: O(n) SC: O(1)
@@ -21,6 +25,161 @@ void optimal(vector<int> &v)
     reverse(v.begin(),v.end());
     return;
 }
+// ---------- Rotate left by k ----------
+// All versions rotate v left by k in place (a negative k rotates right) and
+// leave v unchanged when k is a multiple of v.size().
+
+// x[t] <-> y[len - 1 - t] for t in [0, len); x and y must not overlap.
+// 8 ints per step from the front of x and the back of y with AVX2.
+// TC: O(len) SC: O(1)
+inline void reverseSwap(int* x, int* y, size_t len)
+{
+    size_t t=0;
+#ifdef __AVX2__
+    const __m256i rev=_mm256_setr_epi32(7,6,5,4,3,2,1,0);
+    for(;t+8<=len;t+=8)
+    {
+        int* yb=y+len-t-8;
+        __m256i a=_mm256_loadu_si256((const __m256i*)(x+t));
+        __m256i b=_mm256_loadu_si256((const __m256i*)yb);
+        _mm256_storeu_si256((__m256i*)(x+t),_mm256_permutevar8x32_epi32(b,rev));
+        _mm256_storeu_si256((__m256i*)yb,_mm256_permutevar8x32_epi32(a,rev));
+    }
+#endif
+    for(;t<len;t++)
+        swap(x[t],y[len-1-t]);
+}
+
+// x[t] <-> y[t] for t in [0, len); x and y must not overlap.
+// TC: O(len) SC: O(1)
+inline void swapBlocks(int* x, int* y, size_t len)
+{
+    size_t t=0;
+#ifdef __AVX2__
+    for(;t+8<=len;t+=8)
+    {
+        __m256i a=_mm256_loadu_si256((const __m256i*)(x+t));
+        __m256i b=_mm256_loadu_si256((const __m256i*)(y+t));
+        _mm256_storeu_si256((__m256i*)(x+t),b);
+        _mm256_storeu_si256((__m256i*)(y+t),a);
+    }
+#endif
+    for(;t<len;t++)
+        swap(x[t],y[t]);
+}
+
+// Reverses p[0..len): the first half is exchanged with the mirrored second.
+inline void reverseRange(int* p, size_t len)
+{
+    reverseSwap(p,p+len-len/2,len/2);
+}
+
+inline size_t normalizeShift(long long k, size_t n)
+{
+    long long m=(long long)n;
+    return (size_t)(((k%m)+m)%m);
+}
+
+// Triple reversal: reverse [0,k), reverse [k,n), reverse everything. Every
+// pass streams inwards from both ends, which the prefetcher handles well.
+// TC: O(n) SC: O(1)
+void rotateLeftReversal(vector<int> &v, long long k)
+{
+    size_t n=v.size();
+    if(n<2) return;
+    size_t s=normalizeShift(k,n);
+    if(s==0) return;
+    reverseRange(v.data(),s);
+    reverseRange(v.data()+s,n-s);
+    reverseRange(v.data(),n);
+}
+
+// Block swap (Gries-Mills): swap the shorter block into its final place and
+// repeat on the remainder; every element moves exactly once per swap and the
+// swaps are straight SIMD copies of two forward streams.
+// TC: O(n) SC: O(1)
+void rotateLeftBlockSwap(vector<int> &v, long long k)
+{
+    size_t n=v.size();
+    if(n<2) return;
+    size_t s=normalizeShift(k,n);
+    if(s==0) return;
+    int* p=v.data();
+    size_t i=s, j=n-s; // lengths of the unfinished left and right blocks
+    while(i!=j)
+    {
+        if(i<j)
+        {
+            swapBlocks(p+s-i,p+s+j-i,i);
+            j-=i;
+        }
+        else
+        {
+            swapBlocks(p+s-i,p+s,j);
+            i-=j;
+        }
+    }
+    swapBlocks(p+s-i,p+s,i);
+}
+
+// Cycle leader (juggling): follows the gcd(n, k) cycles of the permutation,
+// moving each element once straight to its final slot. Fewest writes, but
+// the jumps of k elements defeat the cache on large arrays.
+// TC: O(n) SC: O(1)
+void rotateLeftCycleLeader(vector<int> &v, long long k)
+{
+    size_t n=v.size();
+    if(n<2) return;
+    size_t s=normalizeShift(k,n);
+    if(s==0) return;
+    size_t cycles=__gcd(n,s);
+    for(size_t start=0;start<cycles;start++)
+    {
+        int first=v[start];
+        size_t j=start;
+        while(true)
+        {
+            size_t next=j+s;
+            if(next>=n) next-=n;
+            if(next==start) break;
+            v[j]=v[next];
+            j=next;
+        }
+        v[j]=first;
+    }
+}
+
+// Parallel triple reversal for large arrays. Each reversal is split into
+// tiles of TILE mirrored pairs (two 64 KiB streams, sized for L2) that
+// threads take dynamically; the three reversals run one after another.
+// TC: O(n / threads) SC: O(1)
+void rotateLeftParallel(vector<int> &v, long long k, int threads=0)
+{
+    const size_t TILE=1<<14;
+    size_t n=v.size();
+    if(n<2) return;
+    size_t s=normalizeShift(k,n);
+    if(s==0) return;
+    threads=resolveThreads(threads);
+    if(n<((size_t)1<<20) || threads==1)
+    {
+        rotateLeftReversal(v,k);
+        return;
+    }
+    auto reverseTiled=[&](int* p, size_t len)
+    {
+        size_t half=len/2, tiles=(half+TILE-1)/TILE;
+        parallelForDynamic((long long)tiles,threads,[&](long long t, int)
+        {
+            size_t a=(size_t)t*TILE, b=min(half,a+TILE);
+            reverseSwap(p+a,p+len-b,b-a);
+        });
+    };
+    reverseTiled(v.data(),s);
+    reverseTiled(v.data()+s,n-s);
+    reverseTiled(v.data(),n);
+}
+
 int main()
 {
     int n;
@@ -32,5 +191,13 @@ int main()
     optimal(v);
     for(int i=0;i<n;i++)
         cout<<v[i]<<"  ";
+    cout<<endl;
+
+    // Rotate the (already once-rotated) input left by two more places.
+    vector<int> w=v;
+    rotateLeftBlockSwap(w,2);
+    for(int i=0;i<n;i++)
+        cout<<w[i]<<"  ";
+    cout<<endl;
     return 0;
 }
@@ -2,6 +2,8 @@
 // Roll No.: 2511AI46
 
 #include<bits/stdc++.h>
+#include "../common/simd_compress.h"
+#include "../common/parallel.h"
 using namespace std;
 
 // This function moves all zeros to the end of the vector.
@@ -60,6 +62,97 @@ void shiftZerosOptimal(vector<int> &arr) {
     }
 }
 
+// Predicate for the SIMD compaction kernels below. keep(x) decides one
+// element; the AVX2 hook returns all-ones lanes for the elements to keep.
+struct NonZero {
+    static bool keep(int x) { return x != 0; }
+#ifdef __AVX2__
+    static __m256i keepMask(__m256i v) {
+        return _mm256_xor_si256(_mm256_cmpeq_epi32(v, _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+    }
+#endif
+};
+
+// Copies the elements of src[0..n) that Pred keeps, in order, to dst and
+// returns how many there were; dst has room for capacity elements, which
+// must be at least that many. dst may equal src (in-place compaction): the
+// write position never passes the read position. Each vector is tested with
+// one compare and its survivors are compressed with compressStore8, which
+// may store all 8 lanes, so the vector loop runs only while 8 slots remain
+// below capacity.
+// Time Complexity: O(n / 8)
+// Space Complexity: O(1)
+template <class Pred>
+size_t compactByPredicate(const int* src, int* dst, size_t n, [[maybe_unused]] size_t capacity) {
+    size_t i = 0, w = 0;
+#ifdef __AVX2__
+    for (; i + 8 <= n && w + 8 <= capacity; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        w += compressStore8(dst + w, v, laneMask8(Pred::keepMask(v)));
+    }
+#endif
+    for (; i < n; i++) {
+        if (Pred::keep(src[i])) dst[w++] = src[i];
+    }
+    return w;
+}
+
+// Stable partition: the kept elements move forward in their original order
+// and the tail is overwritten with fill. The tail is one wide fill (std::fill
+// on ints compiles to full-width vector stores).
+// Time Complexity: O(n / 8)
+// Space Complexity: O(1)
+template <class Pred = NonZero>
+size_t partitionStableByPredicate(vector<int> &arr, int fill = 0) {
+    size_t kept = compactByPredicate<Pred>(arr.data(), arr.data(), arr.size(), arr.size());
+    std::fill(arr.begin() + kept, arr.end(), fill);
+    return kept;
+}
+
+// Out-of-place parallel version: each thread counts the kept elements of
+// its chunk, an exclusive prefix sum over the counts gives every chunk its
+// output offset, and the chunks are then compacted and the tail filled in
+// parallel. dst must not overlap src, and no chunk writes outside its own
+// slice of dst.
+// Time Complexity: O(n / (8 * threads))
+// Space Complexity: O(threads)
+template <class Pred = NonZero>
+size_t partitionStableByPredicateParallel(const int* src, int* dst, size_t n, int fill = 0, int threads = 0) {
+    threads = resolveThreads(threads);
+    if (n < ((size_t)1 << 20)) threads = 1;
+    vector<size_t> offset(threads + 1, 0);
+    parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+        size_t count = 0;
+        for (long long i = begin; i < end; i++) count += Pred::keep(src[i]);
+        offset[t + 1] = count;
+    });
+    for (int t = 0; t < threads; t++) offset[t + 1] += offset[t];
+    size_t kept = offset[threads];
+    parallelChunks((long long)n, threads, [&](long long begin, long long end, int t) {
+        compactByPredicate<Pred>(src + begin, dst + offset[t], (size_t)(end - begin), offset[t + 1] - offset[t]);
+    });
+    parallelChunks((long long)(n - kept), threads, [&](long long begin, long long end, int) {
+        std::fill(dst + kept + begin, dst + kept + end, fill);
+    });
+    return kept;
+}
+
+// SIMD in-place version of shiftZerosOptimal.
+// Time Complexity: O(n / 8)
+// Space Complexity: O(1)
+void shiftZerosSimd(vector<int> &arr) {
+    partitionStableByPredicate<NonZero>(arr);
+}
+
+// Parallel version; the result is built in a second buffer and swapped in.
+// Time Complexity: O(n / (8 * threads))
+// Space Complexity: O(n)
+void shiftZerosParallel(vector<int> &arr, int threads = 0) {
+    vector<int> out(arr.size());
+    partitionStableByPredicateParallel<NonZero>(arr.data(), out.data(), arr.size(), 0, threads);
+    arr.swap(out);
+}
+
 int main() {
     int size;
     cout << "Enter the size of the array: ";
@@ -71,15 +164,19 @@ int main() {
         cin >> data[i];
     }
 
-    // Uncomment one of the lines below to test a specific function.
-    // shiftZerosBruteForce(data);
+    vector<int> brute = data, simd = data, parallel = data;
     shiftZerosOptimal(data);
+    shiftZerosBruteForce(brute);
+    shiftZerosSimd(simd);
+    shiftZerosParallel(parallel);
 
     cout << "Array after moving zeros: ";
     for (int i = 0; i < size; i++) {
         cout << data[i] << " ";
     }
     cout << endl;
+    cout << "Brute force, SIMD and parallel versions agree: "
+         << (brute == data && simd == data && parallel == data ? "yes" : "no") << endl;
 
     return 0;
 }
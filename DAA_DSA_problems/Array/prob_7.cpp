@@ -2,6 +2,9 @@
 // Roll No.: 2511AI46
 
 #include<bits/stdc++.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
 // Time Complexity: O(n)
@@ -30,6 +33,85 @@ int Optimal(vector<int> arr, int target) {
     return -1;
 }
 
+// Non-owning view of the array to search (the repo builds as C++17, so no
+// std::span); constructing one from a vector copies nothing.
+struct IntView {
+    const int* data;
+    size_t size;
+
+    IntView(const int* d, size_t n) : data(d), size(n) {}
+    IntView(const vector<int>& v) : data(v.data()), size(v.size()) {}
+};
+
+// First index of target in a[from, to), or -1. Four vectors (32 ints) are
+// compared per step and ORed, so there is one branch per 32 elements; the
+// exact lane comes from count-trailing-zeros on the movemask.
+// Time Complexity: O(n / 8)
+// Space Complexity: O(1)
+inline long long findFirstSimd(const int* a, size_t from, size_t to, int target) {
+    size_t i = from;
+#ifdef __AVX2__
+    const __m256i t = _mm256_set1_epi32(target);
+    auto block = [&](size_t at) {
+        return _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + at)), t);
+    };
+    for (; i + 32 <= to; i += 32) {
+        __m256i e0 = block(i), e1 = block(i + 8), e2 = block(i + 16), e3 = block(i + 24);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+        if (_mm256_testz_si256(any, any)) continue;
+        __m256i parts[4] = {e0, e1, e2, e3};
+        for (int p = 0; p < 4; p++) {
+            unsigned m = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(parts[p]));
+            if (m) return (long long)(i + 8 * p + __builtin_ctz(m));
+        }
+    }
+    for (; i + 8 <= to; i += 8) {
+        unsigned m = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(block(i)));
+        if (m) return (long long)(i + __builtin_ctz(m));
+    }
+#endif
+    for (; i < to; i++) {
+        if (a[i] == target) return (long long)i;
+    }
+    return -1;
+}
+
+// Zero-copy single lookup.
+// Time Complexity: O(n / 8)
+// Space Complexity: O(1)
+long long linearSearchSimd(IntView a, int target) {
+    return findFirstSimd(a.data, 0, a.size, target);
+}
+
+// First index of every target in one pass over the data. The array is
+// walked in L1-sized blocks; each block is searched (with findFirstSimd) for
+// every target not yet found, and found targets drop out of the active
+// list. The data therefore streams from memory once per batch, while the
+// per-target scans hit L1.
+// Time Complexity: O(n * m / 8) worst case, for m targets
+// Space Complexity: O(m)
+vector<long long> linearSearchBatch(IntView a, const vector<int>& targets) {
+    const size_t BLOCK = 2048; // 8 KiB of ints
+    vector<long long> result(targets.size(), -1);
+    vector<int> active(targets.size());
+    iota(active.begin(), active.end(), 0);
+    for (size_t from = 0; from < a.size && !active.empty(); from += BLOCK) {
+        size_t to = min(a.size, from + BLOCK);
+        for (size_t k = 0; k < active.size();) {
+            int q = active[k];
+            long long at = findFirstSimd(a.data, from, to, targets[q]);
+            if (at < 0) {
+                k++;
+                continue;
+            }
+            result[q] = at;
+            active[k] = active.back();
+            active.pop_back();
+        }
+    }
+    return result;
+}
+
 int main() {
     int n;
     cout << "Enter the size of the array: ";
@@ -44,7 +126,15 @@ int main() {
 
     cout << "Enter the target: ";
     cin>>target;
-    cout<<Optimal(data,target);
+    cout<<Optimal(data,target)<<endl;
+    cout<<linearSearchSimd(data,target)<<endl;
+
+    // One pass for several probes at once: the target, the first element
+    // and a value that is not present.
+    vector<int> probes{target, n > 0 ? data[0] : 0, INT_MIN};
+    vector<long long> found=linearSearchBatch(data,probes);
+    for(size_t q=0;q<probes.size();q++)
+        cout<<probes[q]<<" -> "<<found[q]<<endl;
 
     return 0;
 }
@@ -0,0 +1,350 @@
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Shared headers first: the problem files below are pulled into their own
+// namespaces, and #pragma once would otherwise hide these from all but the
+// first namespace that includes them.
+#include "dp_table.h"
+#include "subset_bitset.h"
+#include "subset_count.h"
+#include "wavefront_dp.h"
+#include "../common/parallel.h"
+#include "../common/bench.h"
+#include "../common/op_counters.h"
+
+#define DAA_NO_MAIN
+namespace p01 {
+#include "prob_01.cpp"
+}
+namespace p02 {
+#include "prob_02.cpp"
+}
+namespace p03 {
+#include "prob_03.cpp"
+}
+namespace p09 {
+#include "prob_09.cpp"
+}
+namespace p10 {
+#include "prob_10.cpp"
+}
+namespace p14 {
+#include "prob_14.cpp"
+}
+namespace p15 {
+#include "prob_15.cpp"
+}
+namespace p16 {
+#include "prob_16.cpp"
+}
+#undef DAA_NO_MAIN
+
+using namespace std;
+
+// Scaling curves for the brute-force, memoized and tabulated DP variants.
+//
+// For every problem the input grows through a size sweep and each variant
+// runs on the same generated input in a forked child, so a variant can be
+// stopped after the timeout (SIGALRM), and a crash such as a recursion that
+// overflows the stack is reported without taking the harness down. The child
+// reports wall time and peak resident memory (common/bench.h) and the
+// counter of cells or calls it evaluated; once a variant times out or
+// crashes it is skipped for the larger sizes. Results of one size are
+// checked against the first variant that finished, and the exit code is 1 if
+// any disagreed. Output is CSV on stdout:
+//   problem,variant,size,status,time_ms,cells,peak_kb,result
+// status is ok, mismatch, timeout, crashed or skipped; cells is empty
+// unless built with -DDAA_OP_COUNTERS, and since counting costs an atomic
+// per counted step, times are best taken from a build without it.
+//   dp_bench [quick] [timeout=<seconds>] [seed]
+// "quick" runs only the two smallest sizes of every sweep.
+
+static uint64_t benchSeed = 12345;
+static bool quickMode = false;
+static unsigned timeoutSec = 2;
+static int mismatches = 0;
+
+struct Variant {
+    string name;
+    const char* counter; // op counter holding its cells or calls, or nullptr
+    function<long long()> run;
+};
+
+struct Outcome {
+    string status = "ok";
+    double ms = 0;
+    long peakKb = 0;
+    long long cells = -1;
+    long long result = 0;
+};
+
+static long long counterValue(const char* name) {
+#ifdef DAA_OP_COUNTERS
+    if (!name) return -1;
+    return op_counters::Registry::instance().get(name).value.load(std::memory_order_relaxed);
+#else
+    (void)name;
+    return -1;
+#endif
+}
+
+// Runs v in a child process with an alarm set and collects its outcome
+// through a pipe.
+static Outcome runIsolated(const Variant& v) {
+    struct Report {
+        double ms;
+        long peakKb;
+        long long cells, result;
+    };
+    Outcome out;
+    int fds[2];
+    if (pipe(fds) != 0) throw runtime_error("pipe failed");
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) throw runtime_error("fork failed");
+    if (pid == 0) {
+        close(fds[0]);
+        alarm(timeoutSec);
+        long long before = counterValue(v.counter);
+        Report r{};
+        Measurement m = measure(r.result, v.run);
+        r.ms = m.ms;
+        r.peakKb = m.peakKb;
+        r.cells = before < 0 ? -1 : counterValue(v.counter) - before;
+        ssize_t written = write(fds[1], &r, sizeof r);
+        _exit(written == (ssize_t) sizeof r ? 0 : 1);
+    }
+    close(fds[1]);
+    Report r{};
+    ssize_t got = read(fds[0], &r, sizeof r);
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (WIFSIGNALED(status)) {
+        out.status = WTERMSIG(status) == SIGALRM ? "timeout" : "crashed";
+    } else if (got != (ssize_t) sizeof r || WEXITSTATUS(status) != 0) {
+        out.status = "crashed";
+    } else {
+        out.ms = r.ms;
+        out.peakKb = r.peakKb;
+        out.cells = r.cells;
+        out.result = r.result;
+    }
+    return out;
+}
+
+static void row(const string& problem, const string& variant, long long size, const Outcome& o) {
+    printf("%s,%s,%lld,%s,", problem.c_str(), variant.c_str(), size, o.status.c_str());
+    if (o.status == "ok" || o.status == "mismatch") {
+        printf("%.3f,", o.ms);
+        if (o.cells >= 0) printf("%lld", o.cells);
+        printf(",%ld,%lld\n", o.peakKb, o.result);
+    } else {
+        printf(",,,\n");
+    }
+    fflush(stdout);
+}
+
+// One problem: makeVariants(size) builds the input for that size (outside
+// any timed region) and returns the variants to run on it.
+template <class Make>
+void sweepProblem(const string& problem, vector<long long> sizes, Make makeVariants) {
+    if (quickMode && sizes.size() > 2) sizes.resize(2);
+    set<string> retired;
+    for (long long size : sizes) {
+        vector<Variant> variants = makeVariants(size);
+        bool haveReference = false;
+        long long reference = 0;
+        for (const Variant& v : variants) {
+            if (retired.count(v.name)) {
+                Outcome skipped;
+                skipped.status = "skipped";
+                row(problem, v.name, size, skipped);
+                continue;
+            }
+            Outcome o = runIsolated(v);
+            if (o.status == "ok") {
+                if (!haveReference) {
+                    haveReference = true;
+                    reference = o.result;
+                } else if (o.result != reference) {
+                    o.status = "mismatch";
+                    mismatches++;
+                }
+            } else {
+                retired.insert(v.name);
+            }
+            row(problem, v.name, size, o);
+        }
+    }
+}
+
+static mt19937_64 rngFor(const string& problem, long long size) {
+    return mt19937_64(benchSeed ^ hash<string>()(problem) ^ (uint64_t) size * 0x9E3779B97F4A7C15ULL);
+}
+
+static vector<int> randomValues(mt19937_64& rng, size_t n, int lo, int hi) {
+    uniform_int_distribution<int> d(lo, hi);
+    vector<int> v(n);
+    for (int& x : v) x = d(rng);
+    return v;
+}
+
+static void benchStairs() {
+    const long long MOD = 1000000007;
+    sweepProblem("stairs", {10, 20, 30, 35, 40, 45, 90}, [&](long long n) {
+        return vector<Variant>{
+            {"brute", "waysBruteForce.calls", [=] { return p01::waysBruteForce((int) n) % MOD; }},
+            {"optimal", "waysOptimal.cells", [=] { return p01::waysOptimal((int) n) % MOD; }},
+            {"fastDoubling", "fibonacciPairMod.steps", [=] { return (long long) p01::waysMod(n, MOD); }},
+        };
+    });
+}
+
+static void benchFrog() {
+    sweepProblem("frog", {10, 20, 25, 30, 35, 100000, 10000000}, [&](long long n) {
+        auto rng = rngFor("frog", n);
+        auto h = make_shared<vector<int>>(randomValues(rng, n, 0, 1000));
+        return vector<Variant>{
+            {"brute", "frogBrute.calls", [=] { return (long long) p02::frogBrute((int) n - 1, *h); }},
+            {"optimal", "frogOptimal.cells", [=] { return (long long) p02::frogOptimal(*h); }},
+            {"streaming", "FrogStream.cells", [=] { return p02::frogStreamCost(h->begin(), h->end()); }},
+        };
+    });
+}
+
+static void benchFrogK() {
+    const int k = 64;
+    sweepProblem("frogK64", {1000, 10000, 100000, 1000000, 10000000}, [&](long long n) {
+        auto rng = rngFor("frogK64", n);
+        auto h = make_shared<vector<int>>(randomValues(rng, n, 0, 1000));
+        return vector<Variant>{
+            {"memo", "solveUtil.transitions", [=] { return (long long) p03::solve((int) n, *h, k); }},
+            {"bottomUp", "solveBottomUp.transitions", [=] { return (long long) p03::solveBottomUp(*h, k); }},
+        };
+    });
+}
+
+static void benchMinCost() {
+    sweepProblem("gridMinCost", {4, 8, 10, 12, 14, 100, 1000, 4000}, [&](long long side) {
+        auto rng = rngFor("gridMinCost", side);
+        auto grid = make_shared<vector<vector<int>>>(side);
+        for (auto& r : *grid) r = randomValues(rng, side, 0, 9);
+        auto flat = make_shared<FlatGrid<int>>(FlatGrid<int>::fromNested(*grid));
+        // The brute force and table versions read the file's globals
+        auto useGlobals = [=] {
+            p09::grid = *grid;
+            p09::n = p09::m = (int) side;
+        };
+        return vector<Variant>{
+            {"brute", "minCostBrute.calls", [=] { useGlobals(); return (long long) p09::minCostBrute(0, 0); }},
+            {"table", "minCostDP.cells", [=] { useGlobals(); return (long long) p09::minCostDP(); }},
+            {"wavefront", "minCostWavefront.cells", [=] { return p09::minCostWavefront(*flat); }},
+        };
+    });
+}
+
+static void benchTriangle() {
+    sweepProblem("triangle", {10, 18, 22, 26, 1000, 5000}, [&](long long rows) {
+        auto rng = rngFor("triangle", rows);
+        auto tri = make_shared<vector<vector<int>>>(rows);
+        for (long long r = 0; r < rows; r++) (*tri)[r] = randomValues(rng, r + 1, -100, 100);
+        auto packed = make_shared<p10::PackedTriangle>(p10::PackedTriangle::fromNested(*tri));
+        auto useGlobals = [=] {
+            p10::triangle = *tri;
+            p10::n = (int) rows;
+        };
+        return vector<Variant>{
+            {"brute", "minPathBrute.calls", [=] { useGlobals(); return (long long) p10::minPathBrute(0, 0); }},
+            {"rolling", "minPathDP.cells", [=] { useGlobals(); return (long long) p10::minPathDP(); }},
+            {"packedSimd", "minPathPacked.cells", [=] { return (long long) p10::minPathPacked(*packed); }},
+        };
+    });
+}
+
+// The int-per-cell memo that prob_14 used before DpTable, kept as the
+// memory baseline for its byte-plus-bit table
+static bool subsetSumNestedUtil(int ind, int target, const vector<int>& arr, vector<vector<int>>& dp) {
+    if (target == 0) return true;
+    if (ind == 0) return arr[0] == target;
+    if (dp[ind][target] != -1) return dp[ind][target];
+    bool notTaken = subsetSumNestedUtil(ind - 1, target, arr, dp);
+    bool taken = arr[ind] <= target && subsetSumNestedUtil(ind - 1, target - arr[ind], arr, dp);
+    dp[ind][target] = notTaken || taken;
+    return dp[ind][target];
+}
+
+static void benchSubsetSumMemo() {
+    // Even values and an odd target: no subset reaches it, so both memos
+    // fill every reachable cell and peak_kb compares the table layouts
+    sweepProblem("subsetSumMemo", {100, 500, 1000, 2000}, [&](long long n) {
+        auto rng = rngFor("subsetSumMemo", n);
+        auto arr = make_shared<vector<int>>(randomValues(rng, n, 1, 10));
+        for (int& x : *arr) x *= 2;
+        int K = accumulate(arr->begin(), arr->end(), 0) / 2 | 1;
+        return vector<Variant>{
+            {"nestedInt", nullptr, [=] {
+                vector<vector<int>> dp(n, vector<int>(K + 1, -1));
+                return (long long) subsetSumNestedUtil((int) n - 1, K, *arr, dp);
+            }},
+            {"dpTable", nullptr, [=] { return (long long) p14::MemoSolution().subsetSumToK((int) n, K, *arr); }},
+        };
+    });
+}
+
+static void benchPartition() {
+    sweepProblem("minPartition", {10, 16, 20, 24, 200, 2000}, [&](long long n) {
+        auto rng = rngFor("minPartition", n);
+        auto arr = make_shared<vector<int>>(randomValues(rng, n, 1, 1000));
+        return vector<Variant>{
+            {"brute", "partition.bruteHelper.calls", [=] { return (long long) p15::bruteForce(*arr); }},
+            {"boolDp", "partition.optimalDP.cells", [=] { return (long long) p15::optimalDP(*arr); }},
+            {"bitset", "SumBitset.words", [=] { return p15::optimalDPBitset(*arr); }},
+        };
+    });
+}
+
+static void benchSubsetCount() {
+    // Small values keep every exact count inside the int the table version uses
+    sweepProblem("subsetCount", {10, 16, 20, 24, 28}, [&](long long n) {
+        auto rng = rngFor("subsetCount", n);
+        auto arr = make_shared<vector<int>>(randomValues(rng, n, 1, 20));
+        int K = accumulate(arr->begin(), arr->end(), 0) / 2;
+        return vector<Variant>{
+            {"brute", "subsetCount.bruteHelper.calls", [=] { return (long long) p16::bruteForce(*arr, K); }},
+            {"table", "subsetCount.optimalDP.cells", [=] { return (long long) p16::optimalDP(*arr, K); }},
+            {"allTargets", "subsetCountsUpTo.cells", [=] { return (long long) p16::allTargetCounts(*arr, K)[K]; }},
+        };
+    });
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "quick") quickMode = true;
+        else if (arg.rfind("timeout=", 0) == 0) timeoutSec = max(1, stoi(arg.substr(8)));
+        else benchSeed = stoull(arg);
+    }
+
+    printf("problem,variant,size,status,time_ms,cells,peak_kb,result\n");
+    benchStairs();
+    benchFrog();
+    benchFrogK();
+    benchMinCost();
+    benchTriangle();
+    benchSubsetSumMemo();
+    benchPartition();
+    benchSubsetCount();
+
+    if (mismatches) fprintf(stderr, "%d variant results disagreed\n", mismatches);
+    return mismatches ? 1 : 0;
+}
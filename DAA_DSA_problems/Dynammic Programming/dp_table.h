@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Flat memo tables for the top-down solutions (prob_03, prob_13, prob_14,
+// prob_17, prob_19).
+//
+// DpTable<T, Extents...> is one contiguous row-major block of cells instead
+// of nested vectors. Each extent is either a compile-time size or DYN, given
+// at construction; with only static extents the strides are compile-time
+// constants. Cells are either pre-filled with a sentinel (the usual -1), or,
+// with trackComputed, left unfilled and backed by a packed bitmap of
+// computed cells, so they can use the narrowest type the values need (a
+// bool result fits int8_t) without reserving a sentinel value.
+//
+// Storage comes from a DpArena. Tables never free themselves; the arena's
+// reset() releases all of them at once and keeps one block big enough for
+// everything allocated so far, so a solver that resets it per call stops
+// allocating after the first one. T must be trivially copyable.
+
+class DpArena {
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t size;
+    };
+    std::vector<Block> blocks;
+    std::size_t used = 0; // bytes taken from blocks.back()
+
+    void addBlock(std::size_t size) {
+        blocks.push_back({std::unique_ptr<unsigned char[]>(new unsigned char[size]), size});
+        used = 0;
+    }
+
+public:
+    explicit DpArena(std::size_t initialBytes = 0) {
+        if (initialBytes) addBlock(initialBytes);
+    }
+
+    void* allocate(std::size_t bytes, std::size_t align) {
+        if (!blocks.empty()) {
+            auto base = reinterpret_cast<std::uintptr_t>(blocks.back().data.get());
+            std::size_t at = ((base + used + align - 1) & ~(std::uintptr_t)(align - 1)) - base;
+            if (at + bytes <= blocks.back().size) {
+                used = at + bytes;
+                return blocks.back().data.get() + at;
+            }
+        }
+        addBlock(std::max(bytes + align, blocks.empty() ? std::size_t(4096) : 2 * blocks.back().size));
+        return allocate(bytes, align);
+    }
+
+    void reset() {
+        if (blocks.size() > 1) {
+            std::size_t total = 0;
+            for (const Block& b : blocks) total += b.size;
+            blocks.clear();
+            addBlock(total);
+        }
+        used = 0;
+    }
+
+    std::size_t capacity() const {
+        std::size_t total = 0;
+        for (const Block& b : blocks) total += b.size;
+        return total;
+    }
+};
+
+inline constexpr std::size_t DYN = 0;
+
+template <class T, std::size_t... Extents>
+class DpTable {
+    static_assert(sizeof...(Extents) > 0, "DpTable needs at least one dimension");
+    static_assert(std::is_trivially_copyable_v<T>, "DpTable cells live in raw arena memory");
+
+    static constexpr std::size_t Rank = sizeof...(Extents);
+    static constexpr std::size_t DynamicCount = ((Extents == DYN ? 1 : 0) + ...);
+
+    static constexpr std::array<std::size_t, Rank> staticStrides() {
+        std::array<std::size_t, Rank> e = {Extents...}, s{};
+        std::size_t acc = 1;
+        for (std::size_t r = Rank; r-- > 0;) {
+            s[r] = acc;
+            acc *= e[r];
+        }
+        return s;
+    }
+
+    std::array<std::size_t, Rank> stride{};
+    std::size_t cells = 0;
+    T* data = nullptr;
+    uint64_t* computed = nullptr; // only with trackComputed
+    T sentinel{};
+
+    template <class... I>
+    std::size_t index(I... idx) const {
+        static_assert(sizeof...(I) == Rank, "one index per dimension");
+        const std::size_t k[] = {static_cast<std::size_t>(idx)...};
+        std::size_t flat = 0;
+        if constexpr (DynamicCount == 0) {
+            constexpr auto s = staticStrides();
+            for (std::size_t r = 0; r < Rank; r++) flat += k[r] * s[r];
+        } else {
+            for (std::size_t r = 0; r < Rank; r++) flat += k[r] * stride[r];
+        }
+        return flat;
+    }
+
+public:
+    // dynamicExtents lists the DYN dimensions in order. Without
+    // trackComputed every cell starts as sentinel and known() tests for it.
+    DpTable(DpArena& arena, std::array<std::size_t, DynamicCount> dynamicExtents, T sentinelValue = T(),
+            bool trackComputed = false)
+        : sentinel(sentinelValue) {
+        std::array<std::size_t, Rank> extent = {Extents...};
+        for (std::size_t r = 0, d = 0; r < Rank; r++)
+            if (extent[r] == DYN) extent[r] = dynamicExtents[d++];
+        cells = 1;
+        for (std::size_t r = Rank; r-- > 0;) {
+            stride[r] = cells;
+            cells *= extent[r];
+        }
+        data = static_cast<T*>(arena.allocate(std::max<std::size_t>(cells, 1) * sizeof(T), alignof(T)));
+        if (trackComputed) {
+            std::size_t words = (cells + 63) / 64;
+            computed = static_cast<uint64_t*>(arena.allocate(std::max<std::size_t>(words, 1) * 8, alignof(uint64_t)));
+            std::memset(computed, 0, words * 8);
+        } else {
+            std::fill(data, data + cells, sentinel);
+        }
+    }
+
+    template <class... I>
+    T& operator()(I... idx) { return data[index(idx...)]; }
+    template <class... I>
+    const T& operator()(I... idx) const { return data[index(idx...)]; }
+
+    template <class... I>
+    bool known(I... idx) const {
+        std::size_t i = index(idx...);
+        if (computed) return computed[i / 64] >> (i % 64) & 1;
+        return !(data[i] == sentinel);
+    }
+
+    // Records value for the cell and returns it, for "return dp.store(...)".
+    template <class... I>
+    T store(T value, I... idx) {
+        std::size_t i = index(idx...);
+        data[i] = value;
+        if (computed) computed[i / 64] |= 1ULL << (i % 64);
+        return value;
+    }
+
+    std::size_t size() const { return cells; }
+    std::size_t bytes() const { return cells * sizeof(T) + (computed ? (cells + 63) / 64 * 8 : 0); }
+};
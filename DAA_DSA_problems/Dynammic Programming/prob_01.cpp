@@ -1,10 +1,12 @@
 #include <bits/stdc++.h>
+#include "../common/op_counters.h"
 using namespace std;
 
 //Optmal DP
 long long waysOptimal(int n) {
     if (n <= 0) return 0;   
     if (n == 1) return 1;
+    DAA_COUNT_ADD("waysOptimal.cells", n - 1);
 
     long long prev2 = 1;    // ways to reach stair 0
     long long prev1 = 1;    // ways to reach stair 1
@@ -19,17 +21,144 @@ long long waysOptimal(int n) {
 
 // Brute-force recursive
 long long waysBruteForce(int n, int current = 0) {
+    DAA_COUNT("waysBruteForce.calls");
     if (current == n) return 1;
     if (current > n)  return 0;
     return waysBruteForce(n, current + 1) +
            waysBruteForce(n, current + 2);
 }
 
+static uint64_t mulMod(uint64_t a, uint64_t b, uint64_t mod) {
+    return (uint64_t)((unsigned __int128)a * b % mod);
+}
+
+// a + b and a - b mod mod for a, b < mod, exact for every modulus up to
+// 2^64 - 1: a sum that wraps past 2^64 is still >= mod, and subtracting mod
+// modulo 2^64 lands on the right value.
+static uint64_t addMod(uint64_t a, uint64_t b, uint64_t mod) {
+    uint64_t s = a + b;
+    return (s < a || s >= mod) ? s - mod : s;
+}
+
+static uint64_t subMod(uint64_t a, uint64_t b, uint64_t mod) {
+    return a >= b ? a - b : a + (mod - b);
+}
+
+// Fast doubling on the Fibonacci matrix [[1,1],[1,0]]^n = [[F(n+1),F(n)],[F(n),F(n-1)]]:
+// squaring it gives F(2m) = F(m) * (2F(m+1) - F(m)) and F(2m+1) = F(m)^2 + F(m+1)^2,
+// so the bits of n are consumed from the top with two products each.
+// Returns {F(n), F(n+1)} mod mod.
+// Time Complexity: O(log n)
+// Space Complexity: O(1)
+pair<uint64_t, uint64_t> fibonacciPairMod(uint64_t n, uint64_t mod) {
+    uint64_t a = 0, b = 1 % mod; // F(0), F(1)
+    DAA_COUNT_ADD("fibonacciPairMod.steps", 64);
+    for (int bit = 63; bit >= 0; --bit) {
+        uint64_t c = mulMod(a, subMod(addMod(b, b, mod), a, mod), mod); // F(2m)
+        uint64_t d = addMod(mulMod(a, a, mod), mulMod(b, b, mod), mod);  // F(2m+1)
+        if (n >> bit & 1) {
+            a = d;
+            b = addMod(c, d, mod);
+        } else {
+            a = c;
+            b = d;
+        }
+    }
+    return {a, b};
+}
+
+// Ways to climb n stairs with steps of 1 or 2, mod mod, for n up to 2^64 - 1.
+// ways(n) = F(n + 1); n == 0 gives 0 to match waysOptimal.
+// Time Complexity: O(log n)
+// Space Complexity: O(1)
+uint64_t waysMod(uint64_t n, uint64_t mod = 1000000007) {
+    if (mod == 0) throw invalid_argument("waysMod: modulus must be positive");
+    if (n == 0) return 0;
+    return fibonacciPairMod(n, mod).second;
+}
+
+// Stair counting for any set of allowed step sizes: ways[i] is the sum of
+// ways[i - s] over the steps s, with ways[0] = 1. With K the largest step,
+// the state (ways[i], ..., ways[i - K + 1]) advances by the K x K companion
+// matrix M, so ways[n] is the first entry of M^n applied to (1, 0, ..., 0).
+// The powers M^(2^b) are built once in the constructor; a query then only
+// multiplies the state vector by the powers for the set bits of n, which is
+// O(K^2) per bit instead of the O(K^3) of a matrix product, and every query
+// of a batch shares the same table.
+// Time Complexity: O(64 K^3) to build, O(K^2 log n) per query
+// Space Complexity: O(64 K^2)
+class StepWaysMod {
+    using Matrix = vector<vector<uint64_t>>;
+
+    size_t K;
+    uint64_t mod;
+    vector<Matrix> powers; // powers[b] = M^(2^b)
+
+    Matrix multiply(const Matrix& x, const Matrix& y) const {
+        Matrix z(K, vector<uint64_t>(K, 0));
+        for (size_t i = 0; i < K; ++i)
+            for (size_t t = 0; t < K; ++t) {
+                if (x[i][t] == 0) continue;
+                for (size_t j = 0; j < K; ++j) z[i][j] = addMod(z[i][j], mulMod(x[i][t], y[t][j], mod), mod);
+            }
+        return z;
+    }
+
+public:
+    StepWaysMod(const vector<int>& steps, uint64_t modulus = 1000000007) : mod(modulus) {
+        if (steps.empty() || mod == 0) throw invalid_argument("StepWaysMod: need steps and a positive modulus");
+        int largest = 0;
+        for (int s : steps) {
+            if (s <= 0) throw invalid_argument("StepWaysMod: step sizes must be positive");
+            largest = max(largest, s);
+        }
+        K = largest;
+        Matrix m(K, vector<uint64_t>(K, 0));
+        for (int s : steps) m[0][s - 1] = addMod(m[0][s - 1], 1 % mod, mod); // repeated sizes count twice
+        for (size_t j = 1; j < K; ++j) m[j][j - 1] = 1 % mod;
+        powers.push_back(m);
+        for (int b = 1; b < 64; ++b) powers.push_back(multiply(powers.back(), powers.back()));
+    }
+
+    uint64_t query(uint64_t n) const {
+        vector<uint64_t> v(K, 0), next(K);
+        v[0] = 1 % mod;
+        for (int b = 0; b < 64 && (n >> b) != 0; ++b) {
+            if (!(n >> b & 1)) continue;
+            const Matrix& p = powers[b];
+            for (size_t i = 0; i < K; ++i) {
+                uint64_t acc = 0;
+                for (size_t j = 0; j < K; ++j) acc = addMod(acc, mulMod(p[i][j], v[j], mod), mod);
+                next[i] = acc;
+            }
+            v.swap(next);
+        }
+        return v[0];
+    }
+
+    vector<uint64_t> queryBatch(const vector<uint64_t>& ns) const {
+        vector<uint64_t> res;
+        res.reserve(ns.size());
+        for (uint64_t n : ns) res.push_back(query(n));
+        return res;
+    }
+};
+
+#ifndef DAA_NO_MAIN
 int main() {
     int n;
     cin >> n;
 
     cout << "Bruteforce: " << waysBruteForce(n) << "\n";
     cout << "Optimal: "    << waysOptimal(n)     << "\n";
+    cout << "Mod 1e9+7: "  << waysMod(n)         << "\n";
+    cout << "n = 10^18 mod 1e9+7: " << waysMod(1000000000000000000ULL) << "\n";
+
+    // Steps of 1, 2 or 3, several n sharing one power table
+    StepWaysMod tribonacci({1, 2, 3});
+    cout << "Steps {1,2,3}:";
+    for (uint64_t w : tribonacci.queryBatch({1, 2, 3, 4, 10, 1000000000000000000ULL})) cout << " " << w;
+    cout << "\n";
     return 0;
 }
+#endif
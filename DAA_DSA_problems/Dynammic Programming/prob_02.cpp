@@ -1,10 +1,16 @@
 
 
 #include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../common/op_counters.h"
 using namespace std;
 
 // Brute-force: exponential recursion
 int frogBrute(int idx, const vector<int> &h) {
+    DAA_COUNT("frogBrute.calls");
     if (idx == 0) return 0;               // cost to stand at stair 0 is 0
     int oneStep = frogBrute(idx - 1, h) + abs(h[idx] - h[idx - 1]);
     int twoStep = INT_MAX;
@@ -17,6 +23,7 @@ int frogBrute(int idx, const vector<int> &h) {
 int frogOptimal(const vector<int> &h) {
     int n = h.size();
     if (n <= 1) return 0;                   // already at last stair
+    DAA_COUNT_ADD("frogOptimal.cells", n);
 
     int prev2 = 0;                          // dp[0]
     int prev1 = abs(h[1] - h[0]);           // dp[1]
@@ -31,6 +38,127 @@ int frogOptimal(const vector<int> &h) {
     return prev1;                           // dp[n-1]
 }
 
+// Streaming frog DP: heights are pushed one at a time and only the last two
+// dp values and heights are kept, so the input never has to fit in memory.
+// Costs are 64-bit since long profiles overflow int. With recordPath set,
+// each step also logs one bit (reached from i - 2 rather than i - 1), from
+// which path() walks back from the last stair; ties take the single step.
+// Time Complexity: O(1) per height
+// Space Complexity: O(1), plus n / 8 bytes for the choice log
+class FrogStream {
+    long long prev2 = 0, prev1 = 0; // dp[i-2], dp[i-1]
+    int h2 = 0, h1 = 0;             // h[i-2], h[i-1]
+    size_t count = 0;
+    bool recording;
+    vector<uint64_t> fromTwoBack;
+
+public:
+    explicit FrogStream(bool recordPath = false) : recording(recordPath) {}
+
+    void push(int h) {
+        DAA_COUNT("FrogStream.cells");
+        long long cur = 0;
+        bool two = false;
+        if (count == 1) {
+            cur = llabs((long long)h - h1);
+        } else if (count > 1) {
+            long long oneStep = prev1 + llabs((long long)h - h1);
+            long long twoStep = prev2 + llabs((long long)h - h2);
+            two = twoStep < oneStep;
+            cur = two ? twoStep : oneStep;
+        }
+        if (recording) {
+            if (count % 64 == 0) fromTwoBack.push_back(0);
+            if (two) fromTwoBack.back() |= 1ULL << (count % 64);
+        }
+        prev2 = prev1;
+        prev1 = cur;
+        h2 = h1;
+        h1 = h;
+        ++count;
+    }
+
+    size_t size() const { return count; }
+    long long cost() const { return prev1; } // dp[n-1], 0 while fewer than two heights
+
+    // Stair indices of one cheapest route, 0 first.
+    vector<size_t> path() const {
+        if (!recording) throw logic_error("FrogStream: path was not recorded");
+        vector<size_t> route;
+        if (count == 0) return route;
+        for (size_t i = count - 1;; ) {
+            route.push_back(i);
+            if (i == 0) break;
+            i -= (fromTwoBack[i / 64] >> (i % 64) & 1) ? 2 : 1;
+        }
+        reverse(route.begin(), route.end());
+        return route;
+    }
+};
+
+// Minimum cost over any input range of heights.
+template <class It>
+long long frogStreamCost(It first, It last, vector<size_t>* path = nullptr) {
+    FrogStream frog(path != nullptr);
+    for (; first != last; ++first) frog.push(*first);
+    if (path) *path = frog.path();
+    return frog.cost();
+}
+
+// Heights as whitespace-separated integers until end of stream.
+long long frogFromStream(istream& in, vector<size_t>* path = nullptr) {
+    FrogStream frog(path != nullptr);
+    int h;
+    while (in >> h) frog.push(h);
+    if (!in.eof()) throw runtime_error("frogFromStream: malformed height");
+    if (path) *path = frog.path();
+    return frog.cost();
+}
+
+// Same text format read straight from a read-only mapping of the file, with
+// the kernel told the access is sequential so it reads ahead and drops pages
+// behind the scan; resident memory stays small however big the file is.
+long long frogFromMappedFile(const string& file, vector<size_t>* path = nullptr) {
+    int fd = open(file.c_str(), O_RDONLY);
+    if (fd < 0) throw runtime_error("cannot open heights file " + file);
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw runtime_error("cannot stat heights file " + file);
+    }
+    size_t length = st.st_size;
+    FrogStream frog(path != nullptr);
+    if (length == 0) {
+        close(fd);
+        if (path) *path = frog.path();
+        return 0;
+    }
+    void* base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) throw runtime_error("cannot map heights file " + file);
+    madvise(base, length, MADV_SEQUENTIAL);
+
+    const char* p = static_cast<const char*>(base);
+    const char* end = p + length;
+    bool ok = true;
+    while (ok) {
+        while (p < end && isspace((unsigned char)*p)) ++p;
+        if (p == end) break;
+        bool negative = *p == '-';
+        if (*p == '-' || *p == '+') ++p;
+        long long value = 0;
+        const char* digits = p;
+        while (p < end && *p >= '0' && *p <= '9' && value <= INT_MAX) value = value * 10 + (*p++ - '0');
+        if (p == digits || value > (long long)INT_MAX + negative || (p < end && !isspace((unsigned char)*p))) ok = false;
+        else frog.push((int)(negative ? -value : value));
+    }
+    munmap(base, length);
+    if (!ok) throw runtime_error("malformed height in " + file);
+    if (path) *path = frog.path();
+    return frog.cost();
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     int n;
     cin >> n;
@@ -41,5 +169,11 @@ int main() {
          << frogBrute(n - 1, height) << "\n";
     cout << "Optimal: "
          << frogOptimal(height) << "\n";
+
+    vector<size_t> route;
+    cout << "Streaming: " << frogStreamCost(height.begin(), height.end(), &route) << "\nPath:";
+    for (size_t i : route) cout << " " << i;
+    cout << "\n";
     return 0;
 }
+#endif
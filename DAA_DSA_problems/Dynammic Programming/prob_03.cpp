@@ -2,15 +2,22 @@
 #include <vector>
 #include <algorithm> // Required for std::min and std::abs
 #include <climits>   // Required for INT_MAX
+#include <cstdlib>   // Required for std::abs on int
+#include "dp_table.h"
+#include "../common/op_counters.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 using namespace std;
 
-int solveUtil(int ind, vector<int>& height, vector<int>& dp, int k) {
+int solveUtil(int ind, vector<int>& height, DpTable<int, DYN>& dp, int k) {
     // Base case: starting point (index 0) has zero cost
     if (ind == 0) return 0;
 
     // Return already computed result
-    if (dp[ind] != -1) return dp[ind];
+    if (dp.known(ind)) return dp(ind);
+    DAA_COUNT_ADD("solveUtil.transitions", min(k, ind));
 
     // Initialize minimum steps as a large value
     int mmSteps = INT_MAX;
@@ -33,17 +40,68 @@ int solveUtil(int ind, vector<int>& height, vector<int>& dp, int k) {
     }
     
     // Save the result in dp array and return it
-    return dp[ind] = mmSteps;
+    return dp.store(mmSteps, ind);
 }
 
 int solve(int n, vector<int>& height, int k) {
     if (n == 0) return 0;
-    // DP array initialized to -1
-    vector<int> dp(n, -1);
+    // Flat DP array initialized to -1; the arena is reused across calls
+    static thread_local DpArena arena;
+    arena.reset();
+    DpTable<int, DYN> dp(arena, {(size_t)n}, -1);
     // Start recursion from the last index (n-1)
     return solveUtil(n - 1, height, dp, k);
 }
 
+// min over t in [0, len) of dp[t] + |h - hs[t]|: the inner loop of the k-jump
+// recurrence, eight lanes at a time with AVX2.
+static int windowMinCost(const int* dp, const int* hs, int h, int len) {
+    int best = INT_MAX;
+    int t = 0;
+#if defined(__AVX2__)
+    if (len >= 8) {
+        __m256i hv = _mm256_set1_epi32(h);
+        __m256i acc = _mm256_set1_epi32(INT_MAX);
+        for (; t + 8 <= len; t += 8) {
+            __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dp + t));
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hs + t));
+            acc = _mm256_min_epi32(acc, _mm256_add_epi32(d, _mm256_abs_epi32(_mm256_sub_epi32(hv, x))));
+        }
+        __m128i m = _mm_min_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+        m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+        best = _mm_cvtsi128_si32(m);
+    }
+#endif
+    for (; t < len; t++) best = min(best, dp[t] + abs(h - hs[t]));
+    return best;
+}
+
+// Bottom-up k-jump frog: no recursion, and only the last k dp values are
+// kept. The ring is stored twice over (dp[t] goes to slots t % k and
+// t % k + k), so the window dp[i-k .. i-1] is always the contiguous run
+// starting at slot i % k, lined up with height[i-k .. i-1], and the inner
+// minimum is one vectorized pass. Same int range as solve.
+// Time Complexity: O(n * k / 8) with AVX2
+// Space Complexity: O(k)
+int solveBottomUp(const vector<int>& height, int k) {
+    int n = height.size();
+    if (n <= 1) return 0;
+    k = min(k, n - 1);
+    if (k <= 0) return INT_MAX; // last stone unreachable, as in solve
+    vector<int> ring(2 * k);
+    ring[0] = ring[k] = 0;
+    int cur = 0;
+    for (int i = 1; i < n; i++) {
+        if (i < k) cur = windowMinCost(ring.data(), height.data(), height[i], i);
+        else cur = windowMinCost(ring.data() + i % k, height.data() + (i - k), height[i], k);
+        ring[i % k] = ring[i % k + k] = cur;
+        DAA_COUNT_ADD("solveBottomUp.transitions", min(i, k));
+    }
+    return cur;
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     int n, k;
 
@@ -87,6 +145,8 @@ int main() {
     // The problem is "Frog Jump with K Steps," a classic Dynamic Programming problem. 
     int min_cost = solve(n, height, k);
     cout << "The minimum cost (energy) to reach the last stone is: **" << min_cost << "**" << endl;
+    cout << "Bottom-up (rolling window): " << solveBottomUp(height, k) << endl;
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
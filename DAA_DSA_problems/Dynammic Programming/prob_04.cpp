@@ -1,6 +1,9 @@
 #include <iostream>
 #include <vector>
 #include <algorithm> // Required for std::max
+#include <climits>
+#include <stdexcept>
+#include "../common/parallel.h"
 
 using namespace std;
 
@@ -37,6 +40,90 @@ int maximumNonAdjacentSum(vector<int>& arr) {
     return solve_recursive(arr, n - 1, dp);
 }
 
+// The recurrence f(i) = max(f(i-1), f(i-2) + x_i) is linear over the
+// (max, +) semiring: (f(i), f(i-1)) = M(x_i) * (f(i-1), f(i-2)) with
+// M(x) = [[0, x], [0, -inf]]. Matrix products are associative, so any
+// stretch of the array collapses to one 2x2 matrix and stretches combine in
+// O(1); starting from f(-1) = f(-2) = 0 the answer is max(P[0][0], P[0][1]).
+struct MaxPlus2 {
+    static constexpr long long NEG = LLONG_MIN / 4; // -inf, kept far from overflow
+    long long m[2][2];
+
+    static MaxPlus2 identity() { return {{{0, NEG}, {NEG, 0}}}; }
+    static MaxPlus2 element(int x) { return {{{0, x}, {0, NEG}}}; }
+
+    // The stretch a followed by the stretch b, i.e. the product b * a.
+    static MaxPlus2 then(const MaxPlus2& a, const MaxPlus2& b) {
+        MaxPlus2 r;
+        for (int i = 0; i < 2; i++)
+            for (int j = 0; j < 2; j++) {
+                long long best = NEG;
+                for (int t = 0; t < 2; t++) {
+                    if (b.m[i][t] <= NEG || a.m[t][j] <= NEG) continue;
+                    best = max(best, b.m[i][t] + a.m[t][j]);
+                }
+                r.m[i][j] = best;
+            }
+        return r;
+    }
+
+    long long answer() const { return max({0LL, m[0][0], m[0][1]}); }
+};
+
+// Each thread folds one contiguous chunk into a matrix; the chunk matrices
+// are then combined left to right. Sums are 64-bit.
+// Time Complexity: O(n / threads + threads)
+// Space Complexity: O(threads)
+long long maximumNonAdjacentSumParallel(const vector<int>& arr, int threads = 0) {
+    size_t n = arr.size();
+    threads = n < (1 << 16) ? 1 : resolveThreads(threads);
+    vector<MaxPlus2> chunk(threads, MaxPlus2::identity());
+    parallelChunks(n, threads, [&](size_t begin, size_t end, int t) {
+        MaxPlus2 acc = MaxPlus2::identity();
+        for (size_t i = begin; i < end; i++) acc = MaxPlus2::then(acc, MaxPlus2::element(arr[i]));
+        chunk[t] = acc;
+    });
+    MaxPlus2 total = MaxPlus2::identity();
+    for (const MaxPlus2& c : chunk) total = MaxPlus2::then(total, c);
+    return total.answer();
+}
+
+// Segment tree of MaxPlus2 stretches: point updates and the best
+// non-adjacent sum of any subrange [l, r) without re-solving the array.
+// Time Complexity: O(n) build, O(log n) per update and query
+// Space Complexity: O(n)
+class NonAdjacentSumTree {
+    size_t size = 1;
+    vector<MaxPlus2> tree;
+
+public:
+    explicit NonAdjacentSumTree(const vector<int>& arr) {
+        while (size < arr.size()) size <<= 1;
+        tree.assign(2 * size, MaxPlus2::identity());
+        for (size_t i = 0; i < arr.size(); i++) tree[size + i] = MaxPlus2::element(arr[i]);
+        for (size_t v = size - 1; v >= 1; v--) tree[v] = MaxPlus2::then(tree[2 * v], tree[2 * v + 1]);
+    }
+
+    void update(size_t i, int value) {
+        if (i >= size) throw out_of_range("NonAdjacentSumTree::update");
+        size_t v = size + i;
+        tree[v] = MaxPlus2::element(value);
+        for (v >>= 1; v >= 1; v >>= 1) tree[v] = MaxPlus2::then(tree[2 * v], tree[2 * v + 1]);
+    }
+
+    long long query(size_t l, size_t r) const {
+        if (l > r || r > size) throw out_of_range("NonAdjacentSumTree::query");
+        MaxPlus2 left = MaxPlus2::identity(), right = MaxPlus2::identity();
+        for (l += size, r += size; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) left = MaxPlus2::then(left, tree[l++]);
+            if (r & 1) right = MaxPlus2::then(tree[--r], right);
+        }
+        return MaxPlus2::then(left, right).answer();
+    }
+
+    long long all() const { return tree[1].answer(); }
+};
+
 // --- Main Execution Block ---
 int main() {
     int n;
@@ -75,7 +162,14 @@ int main() {
     int maxSum = maximumNonAdjacentSum(arr);
 
     // Output the final result
-    cout << "The maximum non-adjacent sum is: " << **maxSum** << endl;
+    cout << "The maximum non-adjacent sum is: " << maxSum << endl;
+    cout << "Via (max,+) chunk reduction: " << maximumNonAdjacentSumParallel(arr) << endl;
+
+    // Re-solve after a point update without touching the rest of the array
+    NonAdjacentSumTree tree(arr);
+    tree.update(0, arr[0] + 100);
+    cout << "After arr[0] += 100: " << tree.all() << endl;
+    if (n >= 2) cout << "Best over arr[1..n-1]: " << tree.query(1, n) << endl;
 
     return 0;
 }
\ No newline at end of file
@@ -22,10 +22,111 @@ int uniquePaths(int m, int n) {
     return dp[n-1];
 }
 
+// Closed form: a path is a choice of which m-1 of the m+n-2 moves go down,
+// so uniquePaths(m, n) = C(m+n-2, min(m,n)-1).
+
+// Small grids straight from a table built at compile time by Pascal's rule.
+// 34 x 34 is the largest square whose entries all fit in 64 bits.
+constexpr int SMALL_PATHS = 34;
+
+constexpr array<array<uint64_t, SMALL_PATHS>, SMALL_PATHS> makeSmallPathsTable() {
+    array<array<uint64_t, SMALL_PATHS>, SMALL_PATHS> t{};
+    for (int i = 0; i < SMALL_PATHS; i++)
+        for (int j = 0; j < SMALL_PATHS; j++) t[i][j] = (i == 0 || j == 0) ? 1 : t[i - 1][j] + t[i][j - 1];
+    return t;
+}
+
+constexpr auto smallPathsTable = makeSmallPathsTable();
+static_assert(smallPathsTable[2][6] == 28, "uniquePaths(3, 7)");
+
+// Grids with a side above SMALL_PATHS throw out_of_range; use
+// uniquePathsExact for those.
+// Time Complexity: O(1)
+// Space Complexity: O(1), the table is static data
+constexpr uint64_t uniquePathsSmall(int m, int n) {
+    if (m <= 0 || n <= 0) return 0;
+    if (m > SMALL_PATHS || n > SMALL_PATHS) throw out_of_range("uniquePathsSmall: grid side above SMALL_PATHS");
+    return smallPathsTable[m - 1][n - 1];
+}
+
+// Exact count in 128 bits. The running product C(N-k+i, i) stays an integer
+// at every step; cancelling gcd(r, i) first keeps the intermediate no larger
+// than the result, which is exact for every count below 2^128 (square grids
+// up to 66 x 66) and throws overflow_error beyond.
+// Time Complexity: O(min(m, n))
+// Space Complexity: O(1)
+unsigned __int128 uniquePathsExact(uint64_t m, uint64_t n) {
+    if (m == 0 || n == 0) return 0;
+    uint64_t N = m + n - 2, k = min(m, n) - 1;
+    unsigned __int128 r = 1;
+    for (uint64_t i = 1; i <= k; i++) {
+        uint64_t num = N - k + i, den = i;
+        uint64_t g = std::gcd((uint64_t)(r % den), den);
+        // r / g and num / (den / g) are both exact because r * num / den is an integer
+        unsigned __int128 out;
+        if (__builtin_mul_overflow(r / g, (unsigned __int128)(num / (den / g)), &out))
+            throw overflow_error("uniquePathsExact: count does not fit in 128 bits");
+        r = out;
+    }
+    return r;
+}
+
+// Counts modulo a prime p for huge grids: factorials and inverse factorials
+// up to maxN = m+n-2 are tabulated once (the inverses from one Fermat
+// inversion and a backward sweep), after which every grid size is three
+// table loads and two products.
+// Time Complexity: O(maxN + log p) to build, O(1) per query
+// Space Complexity: O(maxN)
+class PathCountMod {
+    uint64_t p;
+    vector<uint64_t> fact, invFact;
+
+    uint64_t power(uint64_t b, uint64_t e) const {
+        uint64_t r = 1 % p;
+        for (b %= p; e; e >>= 1, b = b * b % p)
+            if (e & 1) r = r * b % p;
+        return r;
+    }
+
+public:
+    explicit PathCountMod(size_t maxN, uint64_t prime = 1000000007) : p(prime) {
+        if (p < 2 || p >= (1ULL << 32)) throw invalid_argument("PathCountMod: modulus must be a 32-bit prime");
+        if (maxN >= p) throw invalid_argument("PathCountMod: table would reach the modulus");
+        fact.resize(maxN + 1);
+        invFact.resize(maxN + 1);
+        fact[0] = 1;
+        for (size_t i = 1; i <= maxN; i++) fact[i] = fact[i - 1] * i % p;
+        invFact[maxN] = power(fact[maxN], p - 2);
+        for (size_t i = maxN; i > 0; i--) invFact[i - 1] = invFact[i] * i % p;
+    }
+
+    uint64_t choose(uint64_t N, uint64_t k) const {
+        if (k > N) return 0;
+        if (N >= fact.size()) throw out_of_range("PathCountMod: N beyond the table");
+        return fact[N] * invFact[k] % p * invFact[N - k] % p;
+    }
+
+    uint64_t uniquePaths(uint64_t m, uint64_t n) const {
+        if (m == 0 || n == 0) return 0;
+        return choose(m + n - 2, m - 1);
+    }
+};
+
+static string toString(unsigned __int128 x) {
+    string s;
+    do s += char('0' + (int)(x % 10)); while (x /= 10);
+    return string(s.rbegin(), s.rend());
+}
+
 int main() {
     int m = 3, n = 7;
     cout << uniquePaths(m, n);  // Output: 28
     
     m = 3, n = 3;
     cout << "\n" << uniquePaths(m, n);  // Output: 6
+
+    cout << "\n" << uniquePathsSmall(3, 7);                    // table lookup
+    cout << "\n" << toString(uniquePathsExact(60, 60));         // exact past 64 bits
+    PathCountMod counts(2000000);
+    cout << "\n" << counts.uniquePaths(1000000, 1000000) << "\n"; // mod 1e9+7
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "wavefront_dp.h"
 using namespace std;
 
 int mazePaths(vector<vector<int>>& grid) {
@@ -55,6 +56,19 @@ int mazePathsOptimized(vector<vector<int>>& grid) {
     return dp[m-1];
 }
 
+// Tiled wavefront version over a flat grid (-1 = blocked). Counts grow far
+// past 64 bits on large open grids, so they are taken modulo mod.
+// Time Complexity: O(n * m / threads)
+// Space Complexity: O(n + m + threads * tile)
+uint64_t mazePathsWavefront(const FlatGrid<int>& grid, uint64_t mod = 1000000007, int threads = 0) {
+    return wavefrontDp<uint64_t>(grid.rows, grid.cols, [&](size_t r, size_t c, const uint64_t* up, const uint64_t* left) -> uint64_t {
+        if (grid(r, c) == -1) return 0;
+        if (!up && !left) return 1 % mod;
+        uint64_t ways = (up ? *up : 0) + (left ? *left : 0);
+        return ways >= mod ? ways - mod : ways;
+    }, threads);
+}
+
 int main() {
     vector<vector<int>> grid = {
         {0, 0, 0, 0},
@@ -64,5 +78,6 @@ int main() {
     };
     
     cout << mazePaths(grid) << "\n";              // Output: 4
-    cout << mazePathsOptimized(grid);             // Output: 4
+    cout << mazePathsOptimized(grid) << "\n";    // Output: 4
+    cout << mazePathsWavefront(FlatGrid<int>::fromNested(grid)) << "\n"; // Output: 4
 }
\ No newline at end of file
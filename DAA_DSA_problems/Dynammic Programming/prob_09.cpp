@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "wavefront_dp.h"
+#include "../common/op_counters.h"
 using namespace std;
 
 int n, m;
@@ -10,6 +12,7 @@ vector<vector<int>> grid;
 // Space Complexity: O(n+m)      → Recursion stack
 
 int minCostBrute(int i, int j) {
+    DAA_COUNT("minCostBrute.calls");
     // Base cases
     if (i == n - 1 && j == m - 1) {
         return grid[i][j];  // reached destination
@@ -35,6 +38,7 @@ int minCostBrute(int i, int j) {
 
 int minCostDP() {
     vector<vector<int>> dp(n, vector<int>(m, 0));
+    DAA_COUNT_ADD("minCostDP.cells", (long long)n * m);
 
     dp[0][0] = grid[0][0];
 
@@ -55,8 +59,23 @@ int minCostDP() {
     return dp[n-1][m-1];
 }
 
+// 3. TILED WAVEFRONT APPROACH - parallel, no table, no globals
+// Tiles of the dp are filled in anti-diagonal order by a thread pool over a
+// flat row-major grid; costs are 64-bit.
+// Time Complexity : O(n * m / threads)
+// Space Complexity: O(n + m + threads * tile)
+
+long long minCostWavefront(const FlatGrid<int>& g, int threads = 0) {
+    DAA_COUNT_ADD("minCostWavefront.cells", g.rows * g.cols);
+    return wavefrontDp<long long>(g.rows, g.cols, [&](size_t r, size_t c, const long long* up, const long long* left) {
+        long long best = up && left ? min(*up, *left) : up ? *up : left ? *left : 0;
+        return best + g(r, c);
+    }, threads);
+}
+
 // Driver code
 
+#ifndef DAA_NO_MAIN
 int main() {
 
     grid = {
@@ -80,6 +99,8 @@ int main() {
     cout << "DP Optimal Approach   : " << minCostDP() << endl;
     // Time: O(n*m), Space: O(n*m)
 
+    cout << "Tiled Wavefront       : " << minCostWavefront(FlatGrid<int>::fromNested(grid)) << endl;
+
     // Example 2 - Larger grid (Brute force will hang!)
     /*
     grid = vector<vector<int>>(20, vector<int>(20, 1));
@@ -89,4 +110,5 @@ int main() {
     */
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
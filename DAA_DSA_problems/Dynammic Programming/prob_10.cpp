@@ -1,4 +1,8 @@
 #include <bits/stdc++.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "../common/op_counters.h"
 using namespace std;
 
 vector<vector<int>> triangle;
@@ -9,6 +13,7 @@ int n;
 // Time Complexity : O(2^n)   where n = number of rows
 // Space Complexity: O(n)     recursion stack
 int minPathBrute(int row, int col) {
+    DAA_COUNT("minPathBrute.calls");
     // Base case: reached last row
     if (row == n - 1) {
         return triangle[row][col];
@@ -27,6 +32,7 @@ int minPathBrute(int row, int col) {
 int minPathDP() {
     int rows = triangle.size();
     vector<int> dp = triangle[rows - 1];  // start with last row
+    DAA_COUNT_ADD("minPathDP.cells", (long long)rows * (rows + 1) / 2);
 
     // Go from second-last row to top
     for (int row = rows - 2; row >= 0; row--) {
@@ -40,7 +46,56 @@ int minPathDP() {
     return dp[0]; 
 }
 
+// Triangle packed row after row in one array: (row, col) is at
+// row * (row + 1) / 2 + col, so row r is the contiguous run starting there.
+struct PackedTriangle {
+    int rows = 0;
+    vector<int> cells;
+
+    static PackedTriangle fromNested(const vector<vector<int>>& t) {
+        PackedTriangle p;
+        p.rows = t.size();
+        for (int r = 0; r < p.rows; r++) {
+            if ((int)t[r].size() != r + 1) throw invalid_argument("row " + to_string(r) + " must have r + 1 entries");
+            p.cells.insert(p.cells.end(), t[r].begin(), t[r].end());
+        }
+        return p;
+    }
+
+    const int* row(int r) const { return cells.data() + (size_t)r * (r + 1) / 2; }
+};
+
+// 3. REENTRANT SIMD APPROACH - one row buffer, no globals
+// Same bottom-up recurrence row[j] = min(row[j], row[j+1]) + t[i][j], swept
+// left to right so row[j+1] is still the value from the row below when it is
+// read; with AVX2 eight columns are done per step (a block reads up to
+// row[j+8], which the block has not written yet). Nothing is shared, so
+// several triangles can be solved at once from different threads.
+// Time Complexity : O(n² / 8) with AVX2
+// Space Complexity: O(n)
+int minPathPacked(const PackedTriangle& t) {
+    if (t.rows == 0) return 0;
+    vector<int> dp(t.row(t.rows - 1), t.row(t.rows - 1) + t.rows);
+    DAA_COUNT_ADD("minPathPacked.cells", t.cells.size());
+    for (int r = t.rows - 2; r >= 0; r--) {
+        const int* cur = t.row(r);
+        int col = 0;
+#if defined(__AVX2__)
+        for (; col + 8 <= r + 1; col += 8) {
+            __m256i here = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dp.data() + col));
+            __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dp.data() + col + 1));
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cur + col));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dp.data() + col),
+                                _mm256_add_epi32(_mm256_min_epi32(here, right), value));
+        }
+#endif
+        for (; col <= r; col++) dp[col] = cur[col] + min(dp[col], dp[col + 1]);
+    }
+    return dp[0];
+}
+
 // Driver code 
+#ifndef DAA_NO_MAIN
 int main() {
     triangle = {
         {2},
@@ -62,6 +117,7 @@ int main() {
     cout << "=== Results ===\n";
     cout << "Brute Force (Recursion): " << minPathBrute(0, 0) << endl;
     cout << "DP Optimal Approach   : " << minPathDP() << endl;
+    cout << "Packed SIMD Approach  : " << minPathPacked(PackedTriangle::fromNested(triangle)) << endl;
 
     // Test Case 2 - Single element
     cout << "\n--- Test Case 2 ---\n";
@@ -72,4 +128,5 @@ int main() {
     cout << "DP Optimal : " << minPathDP() << endl;
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
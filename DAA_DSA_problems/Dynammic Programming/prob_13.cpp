@@ -1,15 +1,20 @@
 //memoization
 
 #include <bits/stdc++.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "dp_table.h"
+#include "../common/parallel.h"
 using namespace std;
 
 // Class to solve Ninja and his friends using memoization
-class Solution {
+class MemoSolution {
 public:
     // Recursive function with memoization
     int solve(int i, int j1, int j2, int n, int m,
               vector<vector<int>>& grid,
-              vector<vector<vector<int>>>& dp) {
+              DpTable<int, DYN, DYN, DYN>& dp) {
         // Out of boundary check
         if (j1 < 0 || j1 >= m || j2 < 0 || j2 >= m)
             return -1e9;
@@ -21,7 +26,7 @@ public:
         }
         
         // If already computed return it
-        if (dp[i][j1][j2] != -1) return dp[i][j1][j2];
+        if (dp.known(i, j1, j2)) return dp(i, j1, j2);
         
         // Take chocolates from current cell(s)
         int maxi = -1e9;
@@ -36,37 +41,25 @@ public:
             }
         }
         // Store result
-        return dp[i][j1][j2] = maxi;
+        return dp.store(maxi, i, j1, j2);
     }
     
     // Main function to call
     int maximumChocolates(int n, int m, vector<vector<int>>& grid) {
-        vector<vector<vector<int>>> dp(n,
-            vector<vector<int>>(m, vector<int>(m, -1)));
+        // One flat n x m x m block from the reused arena instead of n * m vectors
+        arena.reset();
+        DpTable<int, DYN, DYN, DYN> dp(arena, {(size_t)n, (size_t)m, (size_t)m}, -1);
         return solve(0, 0, m - 1, n, m, grid, dp);
     }
-};
 
-// Driver code
-int main() {
-    vector<vector<int>> grid = {
-        {2, 3, 1, 2},
-        {3, 4, 2, 2},
-        {5, 6, 3, 5}
-    };
-    int n = grid.size(), m = grid[0].size();
-    Solution obj;
-    cout << obj.maximumChocolates(n, m, grid) << endl;
-    return 0;
-}
+private:
+    DpArena arena;
+};
 
 //tabulation
 
-#include <bits/stdc++.h>
-using namespace std;
-
 // Class to solve Ninja and his friends using tabulation
-class Solution {
+class TabulationSolution {
 public:
     int maximumChocolates(int n, int m, vector<vector<int>>& grid) {
         // 3D DP table
@@ -110,7 +103,77 @@ public:
     }
 };
 
+//rolling two-layer (half table, parallel rows)
+
+// Same recurrence with two layers instead of n. The value of (j1, j2) equals
+// that of (j2, j1), so a layer keeps only j1 <= j2: row j1 holds columns
+// j1 - 2 .. m, where columns j1 - 2 and j1 - 1 mirror (j1 - 2, j1) and
+// (j1 - 1, j1), and column m, columns below 0 and rows -1 and m are INT_MIN
+// padding. Every one of the 9 probes of a half-table cell then lands on a
+// stored slot, so the inner loop has no bounds tests: for one j1 it is three
+// rows times three shifted contiguous runs over j2, maxed eight at a time.
+// Rows j1 of a layer are independent and are shared out to threads.
+// Time Complexity: O(n * m^2 * 9 / (8 * threads))
+// Space Complexity: O(m^2), both layers together about one m x m table
+class RollingSolution {
+public:
+    int maximumChocolates(int n, int m, vector<vector<int>>& grid, int threads = 0) {
+        if (n <= 0 || m <= 0) return 0;
+        // Row r (from -1 to m) spans columns r - 2 .. m
+        vector<size_t> start(m + 3, 0);
+        for (int r = -1; r <= m; r++) start[r + 2] = start[r + 1] + (m - r + 3);
+        auto slot = [&](int r, int c) { return start[r + 1] + (c - r + 2); };
+        vector<int> prev(start[m + 2], INT_MIN), cur(start[m + 2], INT_MIN);
+
+        auto fillMirrors = [&](vector<int>& layer) {
+            for (int r = 1; r < m; r++)
+                for (int c = max(0, r - 2); c < r; c++) layer[slot(r, c)] = layer[slot(c, r)];
+        };
+        auto addCells = [&](vector<int>& layer, const vector<int>& row, int j1) {
+            int* out = &layer[slot(j1, j1)];
+            for (int j2 = j1; j2 < m; j2++) out[j2 - j1] += row[j1] + (j2 == j1 ? 0 : row[j2]);
+        };
+
+        for (int j1 = 0; j1 < m; j1++) {
+            fill(&prev[slot(j1, j1)], &prev[slot(j1, m)], 0);
+            addCells(prev, grid[n - 1], j1);
+        }
+        fillMirrors(prev);
+
+        threads = m < 256 ? 1 : resolveThreads(threads);
+        for (int i = n - 2; i >= 0; i--) {
+            parallelForDynamic(m, threads, [&](long long j1Index, int) {
+                int j1 = (int)j1Index;
+                int* out = &cur[slot(j1, j1)];
+                int len = m - j1;
+                const int* probe[9];
+                for (int d1 = -1; d1 <= 1; d1++)
+                    for (int d2 = -1; d2 <= 1; d2++) probe[(d1 + 1) * 3 + d2 + 1] = &prev[slot(j1 + d1, j1 + d2)];
+                int t = 0;
+#if defined(__AVX2__)
+                for (; t + 8 <= len; t += 8) {
+                    __m256i best = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(probe[0] + t));
+                    for (int p = 1; p < 9; p++)
+                        best = _mm256_max_epi32(best, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(probe[p] + t)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + t), best);
+                }
+#endif
+                for (; t < len; t++) {
+                    int best = probe[0][t];
+                    for (int p = 1; p < 9; p++) best = max(best, probe[p][t]);
+                    out[t] = best;
+                }
+                addCells(cur, grid[i], j1);
+            });
+            fillMirrors(cur);
+            swap(prev, cur);
+        }
+        return prev[slot(0, m - 1)];
+    }
+};
+
 // Driver code
+#ifndef DAA_NO_MAIN
 int main() {
     vector<vector<int>> grid = {
         {2, 3, 1, 2},
@@ -118,7 +181,12 @@ int main() {
         {5, 6, 3, 5}
     };
     int n = grid.size(), m = grid[0].size();
-    Solution obj;
-    cout << obj.maximumChocolates(n, m, grid) << endl;
+    MemoSolution memo;
+    TabulationSolution tabulation;
+    RollingSolution rolling;
+    cout << memo.maximumChocolates(n, m, grid) << endl;
+    cout << tabulation.maximumChocolates(n, m, grid) << endl;
+    cout << rolling.maximumChocolates(n, m, grid) << endl;
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -1,12 +1,14 @@
 //memoization
 
 #include <bits/stdc++.h>
+#include "dp_table.h"
+#include "subset_bitset.h"
 using namespace std;
 
-class Solution {
+class MemoSolution {
 public:
     // Recursive helper function to check if a subset sum equals target
-    bool subsetSumUtil(int ind, int target, vector<int>& arr, vector<vector<int>>& dp) {
+    bool subsetSumUtil(int ind, int target, vector<int>& arr, DpTable<bool, DYN, DYN>& dp) {
         // Base case: target achieved
         if (target == 0) return true;
 
@@ -14,7 +16,7 @@ public:
         if (ind == 0) return arr[0] == target;
 
         // Check memoization table
-        if (dp[ind][target] != -1) return dp[ind][target];
+        if (dp.known(ind, target)) return dp(ind, target);
 
         // Choice 1: do not take the current element
         bool notTaken = subsetSumUtil(ind - 1, target, arr, dp);
@@ -26,37 +28,24 @@ public:
         }
 
         // Store result in DP table
-        return dp[ind][target] = notTaken || taken;
+        return dp.store(notTaken || taken, ind, target);
     }
 
     // Main function to check if subset with sum = k exists
     bool subsetSumToK(int n, int k, vector<int>& arr) {
-        vector<vector<int>> dp(n, vector<int>(k + 1, -1));
+        // One byte per cell plus a computed bitmap, instead of an int with a -1 sentinel
+        arena.reset();
+        DpTable<bool, DYN, DYN> dp(arena, {(size_t)n, (size_t)k + 1}, false, true);
         return subsetSumUtil(n - 1, k, arr, dp);
     }
-};
-
-// Driver code
-int main() {
-    vector<int> arr = {1, 2, 3, 4};
-    int k = 4;
-    int n = arr.size();
-
-    Solution sol;
-    if (sol.subsetSumToK(n, k, arr))
-        cout << "Subset with the given target found";
-    else
-        cout << "Subset with the given target not found";
 
-    return 0;
-}
+private:
+    DpArena arena;
+};
 
 //tabulation
 
-#include <bits/stdc++.h>
-using namespace std;
-
-class Solution {
+class TabulationSolution {
 public:
     // Function to check if there is a subset of 'arr' with a sum equal to 'k'
     bool subsetSumToK(int n, int k, vector<int> &arr) {
@@ -95,17 +84,40 @@ public:
     }
 };
 
+//bitset
+
+class BitsetSolution {
+public:
+    // One word-parallel pass, reach |= reach << arr[i], over sums 0..k; no
+    // n x (k+1) table. Elements must be non-negative.
+    // Time Complexity: O(n * k / 64)
+    // Space Complexity: O(k / 64)
+    bool subsetSumToK(int n, int k, vector<int> &arr) {
+        if (k < 0) return false;
+        vector<int> used(arr.begin(), arr.begin() + n);
+        return reachableSums(used, k).test(k);
+    }
+};
+
 // Driver code
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> arr = {1, 2, 3, 4};
     int k = 4;
     int n = arr.size();
 
-    Solution sol;
-    if (sol.subsetSumToK(n, k, arr))
+    MemoSolution memo;
+    TabulationSolution tabulation;
+    BitsetSolution bitset;
+    bool found = memo.subsetSumToK(n, k, arr);
+    if (found)
         cout << "Subset with the given target found";
     else
         cout << "Subset with the given target not found";
+    cout << endl;
+    cout << "Tabulation and bitset versions agree: "
+         << (tabulation.subsetSumToK(n, k, arr) == found && bitset.subsetSumToK(n, k, arr) == found ? "yes" : "no") << endl;
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -1,8 +1,11 @@
 #include <bits/stdc++.h>
+#include "subset_bitset.h"
+#include "../common/op_counters.h"
 using namespace std;
 
 // ------------------- Brute Force --------------------
 int bruteHelper(int idx, int currSum, int totalSum, vector<int>& arr) {
+    DAA_COUNT("partition.bruteHelper.calls");
     if (idx == arr.size()) {
         int otherSum = totalSum - currSum;
         return abs(currSum - otherSum);
@@ -33,6 +36,7 @@ int optimalDP(vector<int>& arr) {
     dp[0] = true;
 
     for (int num : arr) {
+        DAA_COUNT_ADD("partition.optimalDP.cells", max(0, target - num + 1));
         for (int t = target; t >= num; t--) {
             dp[t] = dp[t] || dp[t - num];
         }
@@ -49,15 +53,29 @@ int optimalDP(vector<int>& arr) {
     return totalSum - 2 * s1;
 }
 
+// ------------------- Bitset DP --------------------
+// Same sweep with all sums up to total/2 updated 64 (or 256 with AVX2) at a
+// time, then the highest reachable sum at or below total/2 is found by
+// scanning words from the top. Sums are 64-bit; elements must be non-negative.
+long long optimalDPBitset(const vector<int>& arr) {
+    long long totalSum = 0;
+    for (int x : arr) totalSum += x;
+    SumBitset reach = reachableSums(arr, totalSum / 2);
+    return totalSum - 2 * reach.highestAtMost(totalSum / 2);
+}
+
 // ------------------- Main (for testing) --------------------
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> arr = {1, 6, 11, 5};
 
     cout << "Brute Force Result: " << bruteForce(arr) << endl;
     cout << "Optimal DP Result: " << optimalDP(arr) << endl;
+    cout << "Bitset DP Result: " << optimalDPBitset(arr) << endl;
 
     return 0;
 }
+#endif
 
 
 /*
@@ -70,4 +88,8 @@ Space Complexity  : O(N)   (Recursion stack)
 --- Optimal DP Approach ---
 Time Complexity   : O(N * S)   where S = total sum of array
 Space Complexity  : O(S)   (1D DP array)
+
+--- Bitset DP Approach ---
+Time Complexity   : O(N * S / 64)   (/ 256 with AVX2)
+Space Complexity  : O(S / 64)
 */
\ No newline at end of file
@@ -1,8 +1,11 @@
 #include <bits/stdc++.h>
+#include "subset_count.h"
+#include "../common/op_counters.h"
 using namespace std;
 
 // ------------------- Brute Force --------------------
 int bruteHelper(int idx, int currSum, int K, vector<int>& arr) {
+    DAA_COUNT("subsetCount.bruteHelper.calls");
     if (idx == arr.size()) {
         return (currSum == K) ? 1 : 0;
     }
@@ -29,6 +32,7 @@ int optimalDP(vector<int>& arr, int K) {
     dp[0] = 1; // One way to form sum 0 → take nothing
 
     for (int num : arr) {
+        DAA_COUNT_ADD("subsetCount.optimalDP.cells", max(0, K - num + 1));
         for (int t = K; t >= num; t--) {
             dp[t] += dp[t - num];
         }
@@ -37,8 +41,18 @@ int optimalDP(vector<int>& arr, int K) {
     return dp[K];
 }
 
+// ------------------- All Targets (modular) --------------------
+// One pass fills the counts of every target 0..maxK (mod 1e9+7 by default),
+// so any number of K queries are table lookups. Zeros count correctly: each
+// one doubles every count.
+vector<uint32_t> allTargetCounts(const vector<int>& arr, int maxK, uint32_t mod = 1000000007) {
+    if (maxK < 0) return {};
+    return subsetCountsUpTo(arr, maxK, mod);
+}
+
 
 // ------------------- Main for testing --------------------
+#ifndef DAA_NO_MAIN
 int main() {
     vector<int> arr = {1, 2, 3, 3};
     int K = 6;
@@ -46,8 +60,14 @@ int main() {
     cout << "Brute Force Count: " << bruteForce(arr, K) << endl;
     cout << "Optimal DP Count : " << optimalDP(arr, K) << endl;
 
+    vector<uint32_t> counts = allTargetCounts(arr, K);
+    cout << "All targets 0.." << K << "  :";
+    for (uint32_t c : counts) cout << " " << c;
+    cout << endl;
+
     return 0;
 }
+#endif
 
 
 /*
@@ -61,4 +81,8 @@ Space Complexity  : O(N)   (Recursion stack)
 Time Complexity   : O(N * K)
 Space Complexity  : O(K)   (1D DP array)
 
+--- All Targets Approach ---
+Time Complexity   : O(N * K / 8)   (AVX2 inner loop), every target at once
+Space Complexity  : O(K)
+
 */
@@ -1,20 +1,25 @@
 //memoization
 
 #include <bits/stdc++.h>
+#include "dp_table.h"
+#include "subset_count.h"
 using namespace std;
 
-class Solution {
+class MemoSolution {
 public:
     // Function to count subsets that sum up to target
     int countSubsets(vector<int>& nums, int target) {
-        // Initialize dp table with -1 (uncomputed states)
-        vector<vector<int>> dp(nums.size(), vector<int>(target + 1, -1));
+        // Flat dp table from the reused arena, -1 = uncomputed
+        arena.reset();
+        DpTable<int, DYN, DYN> dp(arena, {nums.size(), (size_t)target + 1}, -1);
         return solve(nums.size() - 1, target, nums, dp);
     }
 
 private:
+    DpArena arena;
+
     // Recursive helper with memoization
-    int solve(int index, int target, vector<int>& nums, vector<vector<int>>& dp) {
+    int solve(int index, int target, vector<int>& nums, DpTable<int, DYN, DYN>& dp) {
         // Base case: if target is 0, we found a valid subset
         if (target == 0) return 1;
 
@@ -22,7 +27,7 @@ private:
         if (index == 0) return (nums[0] == target ? 1 : 0);
 
         // If already computed, return from dp
-        if (dp[index][target] != -1) return dp[index][target];
+        if (dp.known(index, target)) return dp(index, target);
 
         // Case 1: Exclude current element
         int notTake = solve(index - 1, target, nums, dp);
@@ -34,24 +39,13 @@ private:
         }
 
         // Store result in dp and return
-        return dp[index][target] = take + notTake;
+        return dp.store(take + notTake, index, target);
     }
 };
 
-int main() {
-    vector<int> nums = {1, 2, 3, 3};
-    int target = 6;
-    Solution obj;
-    cout << obj.countSubsets(nums, target) << endl;
-    return 0;
-}
-
 //tabulation
 
-#include <bits/stdc++.h>
-using namespace std;
-
-class Solution {
+class TabulationSolution {
 public:
     int countSubsets(vector<int>& arr, int K) {
         // Get number of elements
@@ -86,10 +80,34 @@ public:
     }
 };
 
+//all targets (1D, modular)
+
+class AllTargetsSolution {
+public:
+    // Counts for every target 0..maxTarget from one backward 1D pass, modulo
+    // mod; counts[K] answers any K without recomputing. Unlike the versions
+    // above, zeros in nums are counted (each doubles every count).
+    // Time Complexity: O(n * maxTarget / 8) with AVX2
+    // Space Complexity: O(maxTarget)
+    vector<uint32_t> countAll(const vector<int>& nums, int maxTarget, uint32_t mod = 1000000007) {
+        if (maxTarget < 0) return {};
+        return subsetCountsUpTo(nums, maxTarget, mod);
+    }
+};
+
+#ifndef DAA_NO_MAIN
 int main() {
-    Solution obj;
-    vector<int> arr = {1, 2, 3, 3};
-    int K = 6;
-    cout << obj.countSubsets(arr, K) << endl;
+    vector<int> nums = {1, 2, 3, 3};
+    int target = 6;
+    MemoSolution memo;
+    TabulationSolution tabulation;
+    cout << memo.countSubsets(nums, target) << endl;
+    cout << tabulation.countSubsets(nums, target) << endl;
+
+    nums.push_back(0);
+    AllTargetsSolution obj;
+    vector<uint32_t> counts = obj.countAll(nums, 6);
+    for (int K = 0; K <= 6; K++) cout << "K=" << K << ": " << counts[K] << endl;
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "subset_count.h"
+#include "../common/alloc_profile.h"
 using namespace std;
 
 class Solution {
@@ -40,12 +42,54 @@ public:
         }
         return dp[K];
     }
+
+    // Many differences against the same array: a split with difference d
+    // is a subset summing to (total + d) / 2, so one subset-count pass up to
+    // the largest such target (a single in-place reversed loop, no per-row
+    // vectors) answers every d by lookup. Counts are modulo mod; zeros in
+    // arr are counted.
+    // Time Complexity: O(n * (total + max d) / 2 / 8 + |ds|) with AVX2
+    // Space Complexity: O(total + max d)
+    vector<uint32_t> countPartitionsMany(const vector<int>& arr, const vector<long long>& ds,
+                                         uint32_t mod = 1000000007) {
+        long long totalSum = 0;
+        for (int x : arr) totalSum += x;
+        auto target = [&](long long d) -> long long {
+            long long twice = totalSum + d;
+            if (twice < 0 || twice % 2 != 0 || d > totalSum) return -1;
+            return twice / 2;
+        };
+        long long maxK = -1;
+        for (long long d : ds) maxK = max(maxK, target(d));
+
+        vector<uint32_t> counts = maxK >= 0 ? subsetCountsUpTo(arr, maxK, mod) : vector<uint32_t>();
+        vector<uint32_t> res;
+        res.reserve(ds.size());
+        for (long long d : ds) {
+            long long K = target(d);
+            res.push_back(K >= 0 ? counts[K] : 0);
+        }
+        return res;
+    }
 };
 
+#ifndef DAA_NO_MAIN
 int main() {
     Solution sol;
     vector<int> arr = {1, 2, 3, 4};
     int d = 1;
-    cout << sol.countPartitions(arr, d) << endl;
+    {
+        DAA_ALLOC_SCOPE("countPartitions");
+        cout << sol.countPartitions(arr, d) << endl;
+    }
+
+    vector<long long> ds = {0, 1, 2, 4, 10};
+    vector<uint32_t> many;
+    {
+        DAA_ALLOC_SCOPE("countPartitionsMany");
+        many = sol.countPartitionsMany(arr, ds);
+    }
+    for (size_t i = 0; i < ds.size(); i++) cout << "d=" << ds[i] << ": " << many[i] << endl;
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -1,9 +1,13 @@
 //memoization
 
 #include <bits/stdc++.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "dp_table.h"
 using namespace std;
 
-class Solution {
+class MemoSolution {
 public:
     // Function to check if the substring S1[0..i] contains only '*'
     bool isAllStars(string &S1, int i) {
@@ -16,7 +20,7 @@ public:
     }
 
     // Recursive function with memoization to check wildcard matching
-    bool wildcardMatchingUtil(string &S1, string &S2, int i, int j, vector<vector<int>> &dp) {
+    bool wildcardMatchingUtil(string &S1, string &S2, int i, int j, DpTable<bool, DYN, DYN> &dp) {
         // Base Case 1: Both strings are exhausted
         if (i < 0 && j < 0)
             return true;
@@ -30,22 +34,22 @@ public:
             return isAllStars(S1, i);
 
         // If already computed, return stored value
-        if (dp[i][j] != -1)
-            return dp[i][j];
+        if (dp.known(i, j))
+            return dp(i, j);
 
         // If characters match or pattern has '?'
         if (S1[i] == S2[j] || S1[i] == '?')
-            return dp[i][j] = wildcardMatchingUtil(S1, S2, i - 1, j - 1, dp);
+            return dp.store(wildcardMatchingUtil(S1, S2, i - 1, j - 1, dp), i, j);
 
         // If pattern has '*', we have two choices:
         // 1. Treat '*' as matching empty sequence -> move pattern index i-1
         // 2. Treat '*' as matching one or more characters -> move text index j-1
         if (S1[i] == '*')
-            return dp[i][j] = wildcardMatchingUtil(S1, S2, i - 1, j, dp) ||
-                               wildcardMatchingUtil(S1, S2, i, j - 1, dp);
+            return dp.store(wildcardMatchingUtil(S1, S2, i - 1, j, dp) ||
+                                wildcardMatchingUtil(S1, S2, i, j - 1, dp), i, j);
 
         // If no match
-        return dp[i][j] = false;
+        return dp.store(false, i, j);
     }
 
     // Main function to be called from driver code
@@ -53,38 +57,21 @@ public:
         int n = S1.size();
         int m = S2.size();
 
-        // DP array initialized to -1 to indicate uncomputed states
-        vector<vector<int>> dp(n, vector<int>(m, -1));
+        // Flat bool table with a computed bitmap in place of -1 sentinels
+        arena.reset();
+        DpTable<bool, DYN, DYN> dp(arena, {(size_t)n, (size_t)m}, false, true);
 
         // Call the recursive utility function starting from the last indices
         return wildcardMatchingUtil(S1, S2, n - 1, m - 1, dp);
     }
-};
-
-// Driver Code
-int main() {
-    // Example pattern and text
-    string S1 = "ab*cd";
-    string S2 = "abdefcd";
-
-    // Create a Solution object
-    Solution obj;
-
-    // Call the matching function and display the result
-    if (obj.wildcardMatching(S1, S2))
-        cout << "String S1 and S2 do match";
-    else
-        cout << "String S1 and S2 do not match";
 
-    return 0;
-}
+private:
+    DpArena arena;
+};
 
 //tabulation
 
-#include <bits/stdc++.h>
-using namespace std;
-
-class Solution {
+class TabulationSolution {
 public:
     // Helper function to check if all first i characters in the pattern are '*'
     // This is important for the base case: '*' can match an empty string
@@ -152,22 +139,161 @@ public:
     }
 };
 
-int main() {
-    // Create an object of Solution class
-    Solution sol;
+//compiled pattern (greedy segments, SIMD search, LRU cache)
+
+// A pattern split on '*' into literal segments ('?' still matches any one
+// character). Between two stars any placement of a segment that leaves the
+// most text for the rest is best, so matching is greedy: the piece before
+// the first star is a prefix test, the piece after the last star a suffix
+// test, and every middle segment is taken at its leftmost occurrence after
+// the previous one. This is the star-backtracking scan with each backtrack
+// replaced by a segment search, so no table is ever built.
+// Segment search filters candidate windows on the first and last non-'?'
+// bytes of the segment, 32 windows per AVX2 step (memchr without AVX2), and
+// verifies only the survivors.
+// Time Complexity: O(|P|) to compile, O(|S| + candidates * segment) per match
+// Space Complexity: O(|P|)
+class CompiledPattern {
+    struct Segment {
+        string text;
+        size_t first = 0, last = 0; // non-'?' anchors; first == npos if all '?'
+    };
+
+    bool hasStar = false;
+    Segment prefix, suffix; // before the first and after the last '*'
+    vector<Segment> middle;
+
+    static Segment makeSegment(string s) {
+        Segment seg;
+        seg.first = s.find_first_not_of('?');
+        seg.last = s.find_last_not_of('?');
+        seg.text = move(s);
+        return seg;
+    }
 
-    // Define the pattern string (S1) and text string (S2)
-    string S1 = "ab*cd";
-    string S2 = "abdefcd";
+    static bool matchesAt(const Segment& seg, const char* t) {
+        for (size_t k = 0; k < seg.text.size(); k++)
+            if (seg.text[k] != '?' && seg.text[k] != t[k]) return false;
+        return true;
+    }
+
+    // Leftmost s in [from, to - |seg|] where seg matches t[s..], or npos.
+    static size_t find(const Segment& seg, const char* t, size_t from, size_t to) {
+        size_t len = seg.text.size();
+        if (to - from < len) return string::npos;
+        size_t lastStart = to - len;
+        if (seg.first == string::npos) return from;
+        size_t s = from;
+#if defined(__AVX2__)
+        const __m256i c1 = _mm256_set1_epi8(seg.text[seg.first]);
+        const __m256i c2 = _mm256_set1_epi8(seg.text[seg.last]);
+        for (; s + 32 <= lastStart + 1; s += 32) {
+            __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t + s + seg.first));
+            __m256i b2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t + s + seg.last));
+            uint32_t hits = (uint32_t)_mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi8(b1, c1), _mm256_cmpeq_epi8(b2, c2)));
+            for (; hits; hits &= hits - 1) {
+                size_t cand = s + __builtin_ctz(hits);
+                if (matchesAt(seg, t + cand)) return cand;
+            }
+        }
+#endif
+        while (s <= lastStart) {
+            const void* hit = memchr(t + s + seg.first, seg.text[seg.first], lastStart - s + 1);
+            if (!hit) return string::npos;
+            size_t cand = static_cast<const char*>(hit) - t - seg.first;
+            if (matchesAt(seg, t + cand)) return cand;
+            s = cand + 1;
+        }
+        return string::npos;
+    }
+
+public:
+    explicit CompiledPattern(const string& pattern) {
+        size_t firstStar = pattern.find('*');
+        if (firstStar == string::npos) {
+            prefix = makeSegment(pattern);
+            return;
+        }
+        hasStar = true;
+        size_t lastStar = pattern.rfind('*');
+        prefix = makeSegment(pattern.substr(0, firstStar));
+        suffix = makeSegment(pattern.substr(lastStar + 1));
+        for (size_t i = firstStar + 1; i < lastStar;) {
+            size_t next = pattern.find('*', i);
+            if (next > i) middle.push_back(makeSegment(pattern.substr(i, next - i)));
+            i = next + 1;
+        }
+    }
+
+    bool matches(const string& s) const {
+        const char* t = s.data();
+        size_t n = s.size();
+        if (!hasStar) return n == prefix.text.size() && matchesAt(prefix, t);
+        size_t head = prefix.text.size(), tail = suffix.text.size();
+        if (head + tail > n || !matchesAt(prefix, t) || !matchesAt(suffix, t + n - tail)) return false;
+        size_t pos = head, end = n - tail;
+        for (const Segment& seg : middle) {
+            size_t at = find(seg, t, pos, end);
+            if (at == string::npos) return false;
+            pos = at + seg.text.size();
+        }
+        return true;
+    }
+};
+
+// Least-recently-used cache of compiled patterns, for many texts checked
+// against a working set of patterns. Entries are shared, so a pattern handed
+// out stays valid after it is evicted. Not synchronized: use one per thread.
+// Time Complexity: O(|P|) expected per lookup (hashing), plus compiling on a miss
+// Space Complexity: O(capacity * |P|)
+class PatternCache {
+    using Entry = pair<string, shared_ptr<const CompiledPattern>>;
+
+    size_t capacity;
+    list<Entry> order; // most recent first
+    unordered_map<string, list<Entry>::iterator> byPattern;
+
+public:
+    explicit PatternCache(size_t capacity = 4096) : capacity(max<size_t>(capacity, 1)) {}
 
-    // Call the function and check if pattern matches text
-    bool result = sol.wildcardMatching(S1, S2);
+    shared_ptr<const CompiledPattern> get(const string& pattern) {
+        auto it = byPattern.find(pattern);
+        if (it != byPattern.end()) {
+            order.splice(order.begin(), order, it->second);
+            return it->second->second;
+        }
+        if (order.size() == capacity) {
+            byPattern.erase(order.back().first);
+            order.pop_back();
+        }
+        order.emplace_front(pattern, make_shared<const CompiledPattern>(pattern));
+        byPattern.emplace(pattern, order.begin());
+        return order.front().second;
+    }
+
+    size_t size() const { return order.size(); }
+};
+
+class CompiledSolution {
+    PatternCache cache;
 
-    // Output the result
-    if (result)
-        cout << "String S1 and S2 do match";
-    else
-        cout << "String S1 and S2 do not match";
+public:
+    bool wildcardMatching(const string &S1, const string &S2) { return cache.get(S1)->matches(S2); }
+};
 
+#ifndef DAA_NO_MAIN
+int main() {
+    MemoSolution memo;
+    TabulationSolution tabulation;
+    CompiledSolution compiled;
+    string S1 = "ab*cd";
+    for (string S2 : {"abdefcd", "abcd", "abdefc", "abxcdcd"}) {
+        bool result = compiled.wildcardMatching(S1, S2);
+        cout << S2 << (result ? " matches " : " does not match ") << S1
+             << (memo.wildcardMatching(S1, S2) == result && tabulation.wildcardMatching(S1, S2) == result ? "" : " (versions disagree)")
+             << endl;
+    }
     return 0;
-}
\ No newline at end of file
+}
+#endif
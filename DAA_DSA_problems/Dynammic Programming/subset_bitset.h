@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../common/op_counters.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Word-parallel subset-sum reachability shared by the subset-sum (prob_14)
+// and minimum partition difference (prob_15) problems.
+//
+// Bit s of the set says "some subset sums to s". Adding an element a is
+// reach |= reach << a, done 64 sums per word (256 per AVX2 step) instead of
+// one bool at a time. The shift runs in place from the top word down: every
+// word it reads lies at or below the word it writes, so it still holds its
+// old value when it is read.
+
+class SumBitset {
+    std::size_t nbits;
+    std::vector<uint64_t> words;
+
+public:
+    // Sums 0 .. maxSum, all unreachable.
+    explicit SumBitset(std::size_t maxSum) : nbits(maxSum + 1), words((maxSum + 64) / 64, 0) {}
+    // Sums 0 .. maxSum from the words of an earlier set (see data()).
+    SumBitset(std::size_t maxSum, std::vector<uint64_t> w) : nbits(maxSum + 1), words(std::move(w)) {
+        if (words.size() != (maxSum + 64) / 64) throw std::invalid_argument("SumBitset: word count does not match maxSum");
+    }
+
+    std::size_t size() const { return nbits; }
+    bool test(std::size_t s) const { return s < nbits && (words[s / 64] >> (s % 64) & 1); }
+    void set(std::size_t s) { words[s / 64] |= 1ULL << (s % 64); }
+    const std::vector<uint64_t>& data() const { return words; }
+
+    // reach |= reach << shift, for result bits 0 .. upto only (bits above
+    // upto must already be clear and remain so).
+    void orShifted(std::size_t shift, std::size_t upto) {
+        upto = std::min(upto, nbits - 1);
+        if (shift > upto) return;
+        const std::size_t ws = shift / 64, bs = shift % 64;
+        DAA_COUNT_ADD("SumBitset.words", upto / 64 + 1 - ws);
+        long long w = static_cast<long long>(upto / 64);
+        const long long first = static_cast<long long>(ws);
+        uint64_t* d = words.data();
+#if defined(__AVX2__)
+        const __m128i left = _mm_cvtsi32_si128(static_cast<int>(bs));
+        const __m128i right = _mm_cvtsi32_si128(static_cast<int>(64 - bs)); // 64 shifts to zero
+        for (; w - 3 >= first + 1; w -= 4) {
+            // dst words [w-3, w]; sources [w-3-ws, w-ws] and one word lower
+            __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d + (w - 3 - ws)));
+            __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d + (w - 4 - ws)));
+            __m256i shifted = _mm256_or_si256(_mm256_sll_epi64(hi, left), _mm256_srl_epi64(lo, right));
+            __m256i* out = reinterpret_cast<__m256i*>(d + (w - 3));
+            _mm256_storeu_si256(out, _mm256_or_si256(_mm256_loadu_si256(out), shifted));
+        }
+#endif
+        for (; w >= first; w--) {
+            uint64_t v = d[w - ws] << bs;
+            if (bs && w - 1 >= first) v |= d[w - 1 - ws] >> (64 - bs);
+            d[w] |= v;
+        }
+        // Drop what was shifted past upto inside its word
+        std::size_t top = upto / 64, keep = upto % 64 + 1;
+        if (keep < 64) d[top] &= (1ULL << keep) - 1;
+    }
+
+    // Largest reachable sum <= s, or -1.
+    long long highestAtMost(std::size_t s) const {
+        if (nbits == 0) return -1;
+        s = std::min(s, nbits - 1);
+        long long w = static_cast<long long>(s / 64);
+        uint64_t cur = words[w];
+        if (s % 64 != 63) cur &= (1ULL << (s % 64 + 1)) - 1;
+        for (;;) {
+            if (cur) return w * 64 + 63 - __builtin_clzll(cur);
+            if (--w < 0) return -1;
+            cur = words[w];
+        }
+    }
+};
+
+// Every subset sum up to limit reachable from arr. Elements must be
+// non-negative; zeros change nothing. Only words up to the running total are
+// touched, so early elements cost little even when limit is large.
+// Time Complexity: O(n * min(limit, sum) / 64), four words per AVX2 step
+// Space Complexity: O(limit / 64)
+inline SumBitset reachableSums(const std::vector<int>& arr, std::size_t limit) {
+    SumBitset reach(limit);
+    reach.set(0);
+    std::size_t total = 0;
+    for (int a : arr) {
+        if (a < 0) throw std::invalid_argument("reachableSums: negative element");
+        if (a == 0) continue;
+        total = std::min(limit, total + static_cast<std::size_t>(a));
+        reach.orShifted(static_cast<std::size_t>(a), total);
+    }
+    return reach;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../common/op_counters.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Subset counting for every target at once, shared by the count-subsets
+// problems (prob_16, prob_17) and the partition-by-difference counts
+// (prob_18).
+//
+// counts[s] is the number of subsets (by position) summing to s, modulo
+// mod. Each element a applies counts[s] += counts[s - a] for s from maxSum
+// down to a, so every source is read before it is updated; eight targets are
+// done per AVX2 step, and a block that overlaps its own sources (a < 8)
+// still loads them before storing. A zero doubles every count (it can be
+// left in or out), so zeros are folded into one multiplication by 2^zeros.
+
+// x + y mod m for x, y < m < 2^31: one add and a conditional subtract.
+inline uint32_t addMod(uint32_t x, uint32_t y, uint32_t m) {
+    uint32_t s = x + y;
+    return s >= m ? s - m : s;
+}
+
+// Time Complexity: O(n * maxSum / 8) with AVX2
+// Space Complexity: O(maxSum)
+inline std::vector<uint32_t> subsetCountsUpTo(const std::vector<int>& arr, std::size_t maxSum,
+                                               uint32_t mod = 1000000007) {
+    if (mod == 0 || mod > (1u << 31)) throw std::invalid_argument("subsetCountsUpTo: modulus must be in [1, 2^31]");
+    std::vector<uint32_t> counts(maxSum + 1, 0);
+    counts[0] = 1 % mod;
+    std::size_t zeros = 0;
+    for (int a : arr) {
+        if (a < 0) throw std::invalid_argument("subsetCountsUpTo: negative element");
+        if (a == 0) {
+            zeros++;
+            continue;
+        }
+        if (static_cast<std::size_t>(a) > maxSum) continue;
+        DAA_COUNT_ADD("subsetCountsUpTo.cells", maxSum - a + 1);
+        uint32_t* c = counts.data();
+        long long s = static_cast<long long>(maxSum);
+#if defined(__AVX2__)
+        const __m256i m = _mm256_set1_epi32(static_cast<int>(mod));
+        for (; s - 7 >= a; s -= 8) {
+            __m256i dst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + (s - 7)));
+            __m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + (s - 7 - a)));
+            __m256i sum = _mm256_add_epi32(dst, src);
+            // sum - mod wraps above sum exactly when sum < mod
+            sum = _mm256_min_epu32(sum, _mm256_sub_epi32(sum, m));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + (s - 7)), sum);
+        }
+#endif
+        for (; s >= a; s--) c[s] = addMod(c[s], c[s - a], mod);
+    }
+    if (zeros) {
+        uint64_t factor = 1 % mod, base = 2 % mod;
+        for (std::size_t e = zeros; e; e >>= 1, base = base * base % mod)
+            if (e & 1) factor = factor * base % mod;
+        for (uint32_t& x : counts) x = static_cast<uint32_t>(x * factor % mod);
+    }
+    return counts;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "../common/parallel.h"
+
+// Grid DP whose cell (r, c) depends only on (r - 1, c) and (r, c - 1),
+// shared by the maze path count (prob_08) and the minimum path cost
+// (prob_09).
+//
+// The table is cut into tile x tile squares. A tile depends only on the one
+// above and the one to its left, so all tiles of an anti-diagonal are
+// independent and are handed to a thread pool together; the diagonals run
+// one after another. No table is kept: a tile walks its rows through one
+// rolling row buffer and reads its inputs from two boundary arrays,
+//   bottomEdge[c]  last computed row of the tile above, for column c
+//   rightEdge[r]   last computed column of the tile to the left, for row r
+// which it overwrites with its own bottom row and right column. Only the
+// tiles of one tile column touch a stretch of bottomEdge (one tile row for
+// rightEdge), and they do so one diagonal apart, so no locking is needed.
+// Memory is O(rows + cols + threads * tile) whatever the grid size.
+
+// Row-major grid in one array: cell (r, c) is cells[r * cols + c].
+template <class T>
+struct FlatGrid {
+    std::size_t rows = 0, cols = 0;
+    std::vector<T> cells;
+
+    FlatGrid() = default;
+    FlatGrid(std::size_t rows, std::size_t cols, T fill = T()) : rows(rows), cols(cols), cells(rows * cols, fill) {}
+
+    // Every row of the nested grid must have the same length.
+    template <class U>
+    static FlatGrid fromNested(const std::vector<std::vector<U>>& grid) {
+        FlatGrid g(grid.size(), grid.empty() ? 0 : grid[0].size());
+        for (std::size_t r = 0; r < g.rows; r++) std::copy(grid[r].begin(), grid[r].end(), g.cells.begin() + r * g.cols);
+        return g;
+    }
+
+    T& operator()(std::size_t r, std::size_t c) { return cells[r * cols + c]; }
+    const T& operator()(std::size_t r, std::size_t c) const { return cells[r * cols + c]; }
+};
+
+// Returns the value of cell (rows - 1, cols - 1). cell(r, c, up, left) gives
+// the value of (r, c) from pointers to its two dependencies, nullptr on the
+// first row and column respectively.
+// Time Complexity: O(rows * cols / threads + (rows + cols) / tile) cell steps
+// Space Complexity: O(rows + cols + threads * tile)
+template <class T, class Cell>
+T wavefrontDp(std::size_t rows, std::size_t cols, Cell cell, int threads = 0, std::size_t tile = 256) {
+    if (rows == 0 || cols == 0 || tile == 0) throw std::invalid_argument("wavefrontDp: empty grid or tile");
+    threads = rows * cols < (1u << 20) ? 1 : resolveThreads(threads);
+    std::size_t tileRows = (rows + tile - 1) / tile, tileCols = (cols + tile - 1) / tile;
+    std::vector<T> bottomEdge(cols), rightEdge(rows);
+    std::vector<std::vector<T>> rowBuffer(threads, std::vector<T>(tile));
+
+    auto runTile = [&](std::size_t ti, std::size_t tj, int tid) {
+        std::size_t r0 = ti * tile, r1 = std::min(rows, r0 + tile);
+        std::size_t c0 = tj * tile, c1 = std::min(cols, c0 + tile);
+        T* row = rowBuffer[tid].data(); // row[c - c0]
+        for (std::size_t r = r0; r < r1; r++) {
+            // row still holds row r - 1 until each slot is overwritten
+            const T* up = r == r0 ? (r == 0 ? nullptr : bottomEdge.data() + c0) : row;
+            const T* left = c0 == 0 ? nullptr : &rightEdge[r];
+            for (std::size_t c = c0; c < c1; c++) {
+                T* out = row + (c - c0);
+                *out = cell(r, c, up ? up + (c - c0) : nullptr, left);
+                left = out;
+            }
+            rightEdge[r] = row[c1 - 1 - c0];
+        }
+        std::copy(row, row + (c1 - c0), bottomEdge.begin() + c0);
+    };
+
+    for (std::size_t d = 0; d + 1 < tileRows + tileCols; d++) {
+        std::size_t iLo = d + 1 > tileCols ? d + 1 - tileCols : 0, iHi = std::min(d, tileRows - 1);
+        parallelForDynamic(static_cast<long long>(iHi - iLo + 1), threads,
+                           [&](long long k, int tid) { runTile(iLo + k, d - (iLo + k), tid); });
+    }
+    return bottomEdge[cols - 1];
+}
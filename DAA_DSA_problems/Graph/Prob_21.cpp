@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "csr_graph.h"
 using namespace std;
 
 class Graph {
@@ -65,6 +66,132 @@ public:
         }
         return false;
     }
+
+    // Flat copy of the adjacency list (vertex 0 is unused, as above).
+    CsrGraph toCsr() const {
+        return csrFromAdjacency(adj);
+    }
+};
+
+// ---------------- Optimal on CSR ----------------
+// Same colouring DFS as detectCycleOptimal, but the neighbours of a node are a
+// contiguous slice of one array and both flags share one byte per node.
+// Time Complexity: O(V + E)
+// Space Complexity: O(V)
+bool dfsCSR(const CsrGraph &g, int node, vector<char> &state) {
+    state[node] = 1; // on the recursion stack
+    for (int nbr : g.adj(node)) {
+        if (state[nbr] == 0) {
+            if (dfsCSR(g, nbr, state)) return true;
+        } else if (state[nbr] == 1) {
+            return true;
+        }
+    }
+    state[node] = 2; // finished
+    return false;
+}
+
+bool detectCycleCSR(const CsrGraph &g) {
+    vector<char> state(g.V, 0);
+    for (int i = 0; i < g.V; i++) {
+        if (state[i] == 0 && dfsCSR(g, i, state)) return true;
+    }
+    return false;
+}
+
+// ---------------- Online (Pearce-Kelly) ----------------
+// Maintains a topological order while edges arrive one at a time and rejects
+// any edge that would close a cycle. An edge u -> v that already agrees with
+// the order costs O(1). Otherwise only the affected region is searched:
+// forward from v and backward from u, limited to the order positions between
+// v and u. The two visited sets are then re-packed into the positions they
+// already occupied, so nothing outside the region moves.
+// Time Complexity: O(|region| log |region| + edges of region) per insert
+// Space Complexity: O(V + E)
+class OnlineCycleDetector {
+    int V;
+    vector<vector<int>> out, in;
+    vector<int> ord;          // ord[node] = position in the topological order
+    vector<int> mark;         // generation stamp of the current search
+    int generation = 0;
+    vector<int> fwd, bwd, stk;
+
+    // Forward DFS from v over nodes with ord < ub; false if u is reached.
+    bool searchForward(int v, int ub, int target) {
+        fwd.clear();
+        stk.assign(1, v);
+        mark[v] = generation;
+        while (!stk.empty()) {
+            int node = stk.back();
+            stk.pop_back();
+            fwd.push_back(node);
+            for (int nbr : out[node]) {
+                if (nbr == target) return false;
+                if (mark[nbr] != generation && ord[nbr] < ub) {
+                    mark[nbr] = generation;
+                    stk.push_back(nbr);
+                }
+            }
+        }
+        return true;
+    }
+
+    // Backward DFS from u over nodes with ord > lb.
+    void searchBackward(int u, int lb) {
+        bwd.clear();
+        stk.assign(1, u);
+        mark[u] = generation;
+        while (!stk.empty()) {
+            int node = stk.back();
+            stk.pop_back();
+            bwd.push_back(node);
+            for (int nbr : in[node]) {
+                if (mark[nbr] != generation && ord[nbr] > lb) {
+                    mark[nbr] = generation;
+                    stk.push_back(nbr);
+                }
+            }
+        }
+    }
+
+public:
+    // Nodes are 0..V-1 (pass V+1 for 1-based ids, as Graph does).
+    explicit OnlineCycleDetector(int V) : V(V), out(V), in(V), ord(V), mark(V, 0) {
+        for (int i = 0; i < V; i++) ord[i] = i;
+    }
+
+    // Adds u -> v unless it would create a cycle; returns whether it was added.
+    bool tryAddEdge(int u, int v) {
+        if (u == v) return false;
+        if (ord[u] > ord[v]) {
+            generation++;
+            if (!searchForward(v, ord[u], u)) return false;
+            searchBackward(u, ord[v]);
+
+            // Backward set first, then forward set, each in its old order.
+            auto byOrd = [&](int a, int b) { return ord[a] < ord[b]; };
+            sort(bwd.begin(), bwd.end(), byOrd);
+            sort(fwd.begin(), fwd.end(), byOrd);
+            vector<int> slots;
+            slots.reserve(bwd.size() + fwd.size());
+            for (int x : bwd) slots.push_back(ord[x]);
+            for (int x : fwd) slots.push_back(ord[x]);
+            sort(slots.begin(), slots.end());
+            size_t i = 0;
+            for (int x : bwd) ord[x] = slots[i++];
+            for (int x : fwd) ord[x] = slots[i++];
+        }
+        out[u].push_back(v);
+        in[v].push_back(u);
+        return true;
+    }
+
+    // Current topological order of all nodes.
+    vector<int> order() const {
+        vector<int> res(V);
+        for (int i = 0; i < V; i++) res[ord[i]] = i;
+        return res;
+    }
 };
 
 int main() {
@@ -86,6 +213,16 @@ int main() {
 
     cout << "Brute Force: " << (g.detectCycleBrute() ? "true" : "false") << endl;
     cout << "Optimal: " << (g.detectCycleOptimal() ? "true" : "false") << endl;
+    cout << "Optimal (CSR): " << (detectCycleCSR(g.toCsr()) ? "true" : "false") << endl;
+
+    // Online: the same edges inserted one by one; the cycle-closing one is rejected.
+    OnlineCycleDetector online(N + 1);
+    int edges[][2] = {{1, 2}, {2, 3}, {3, 4}, {3, 7}, {4, 5}, {5, 6}, {7, 5}, {2, 8}, {8, 9}, {9, 10}, {10, 8}};
+    for (auto &e : edges) {
+        if (!online.tryAddEdge(e[0], e[1])) {
+            cout << "Online: edge " << e[0] << " -> " << e[1] << " rejected (would create a cycle)" << endl;
+        }
+    }
 
     return 0;
 }
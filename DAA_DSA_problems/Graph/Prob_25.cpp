@@ -2,6 +2,17 @@
 #include <unordered_set>
 #include <algorithm>
 #include <iostream>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "../common/parallel.h"
+#include "../common/fast_io.h"
 
 using namespace std;
 
@@ -78,7 +89,7 @@ private:
 
 public:
     // Problem II: Check if all tasks can be completed
-    bool canFinish(int numTasks, vector<vector<int>>& prerequisites) {
+    bool canFinish(int numTasks, const vector<vector<int>>& prerequisites) {
         // Build adjacency list (reverse graph: prereq -> task)
         vector<vector<int>> adj(numTasks);
         for (const auto& pre : prerequisites) {
@@ -98,7 +109,7 @@ public:
     }
 
     // Problem I: Find a valid order of tasks
-    vector<int> findOrder(int numTasks, vector<vector<int>>& prerequisites) {
+    vector<int> findOrder(int numTasks, const vector<vector<int>>& prerequisites) {
         // Build adjacency list (reverse graph: prereq -> task)
         vector<vector<int>> adj(numTasks);
         for (const auto& pre : prerequisites) {
@@ -119,13 +130,177 @@ public:
     }
 };
 
+// Outcome of TaskExecutor::run. Times are in milliseconds; finishMs is
+// measured from the start of the run.
+struct ExecutionReport {
+    bool scheduled = false;      // false if the prerequisites contain a cycle
+    vector<double> latencyMs;    // time spent inside each task
+    vector<double> finishMs;     // when each task completed
+    vector<int> criticalPath;    // slowest prerequisite chain, first task first
+    double criticalPathMs = 0;   // summed latency along criticalPath
+    double wallMs = 0;           // whole run, scheduling included
+};
+
+// Runs every task once, each only after all of its prerequisites finished.
+//
+// Every worker owns a deque of ready tasks: it pushes and pops at the back
+// (most recently released first, so a chain of dependents stays on one core)
+// and, when empty, steals from the front of another worker's deque. A task
+// becomes ready when an atomic in-degree counter drops to zero, and exactly
+// the worker that took it to zero enqueues it.
+// Cycles are rejected before anything runs, using OptimalSolution's DFS.
+// Time Complexity: O(V + E) scheduling overhead plus the tasks themselves
+// Space Complexity: O(V + E)
+class TaskExecutor {
+    using Clock = chrono::steady_clock;
+
+    struct WorkerQueue {
+        mutex lock;
+        deque<int> ready;
+    };
+
+    int numTasks;
+    int threads;
+    vector<vector<int>> prerequisites;
+    vector<vector<int>> dependents; // prereq -> tasks waiting on it
+    vector<int> inDegree;
+
+    static double millis(Clock::duration d) {
+        return chrono::duration<double, milli>(d).count();
+    }
+
+public:
+    TaskExecutor(int numTasks, const vector<vector<int>>& prerequisites, int threads = 0)
+        : numTasks(numTasks), threads(resolveThreads(threads)), prerequisites(prerequisites),
+          dependents(numTasks), inDegree(numTasks, 0) {
+        for (const auto& pre : prerequisites) {
+            dependents[pre[1]].push_back(pre[0]);
+            inDegree[pre[0]]++;
+        }
+    }
+
+    // Calls task(i) for every i. If a task throws, the remaining tasks still
+    // run and the first exception is rethrown once all workers stopped.
+    ExecutionReport run(const function<void(int)>& task) {
+        ExecutionReport report;
+        if (!OptimalSolution().canFinish(numTasks, prerequisites)) return report;
+        report.scheduled = true;
+        report.latencyMs.assign(numTasks, 0);
+        report.finishMs.assign(numTasks, 0);
+        if (numTasks == 0) return report;
+
+        const int workers = min(threads, numTasks);
+        vector<WorkerQueue> queues(workers);
+        unique_ptr<atomic<int>[]> pending(new atomic<int>[numTasks]);
+        for (int i = 0; i < numTasks; i++) pending[i].store(inDegree[i], memory_order_relaxed);
+
+        // Deal the initially ready tasks round-robin.
+        int dealt = 0;
+        for (int i = 0; i < numTasks; i++) {
+            if (inDegree[i] == 0) queues[dealt++ % workers].ready.push_back(i);
+        }
+
+        atomic<int> remaining(numTasks);
+        mutex errorLock;
+        exception_ptr firstError;
+        const Clock::time_point start = Clock::now();
+
+        auto takeTask = [&](int self, int& out) {
+            {
+                lock_guard<mutex> g(queues[self].lock);
+                if (!queues[self].ready.empty()) {
+                    out = queues[self].ready.back();
+                    queues[self].ready.pop_back();
+                    return true;
+                }
+            }
+            for (int k = 1; k < workers; k++) {
+                WorkerQueue& victim = queues[(self + k) % workers];
+                lock_guard<mutex> g(victim.lock);
+                if (!victim.ready.empty()) {
+                    out = victim.ready.front();
+                    victim.ready.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        auto worker = [&](int self) {
+            while (remaining.load(memory_order_acquire) > 0) {
+                int t;
+                if (!takeTask(self, t)) {
+                    this_thread::yield();
+                    continue;
+                }
+                Clock::time_point begin = Clock::now();
+                try {
+                    task(t);
+                } catch (...) {
+                    lock_guard<mutex> g(errorLock);
+                    if (!firstError) firstError = current_exception();
+                }
+                Clock::time_point end = Clock::now();
+                report.latencyMs[t] = millis(end - begin);
+                report.finishMs[t] = millis(end - start);
+
+                for (int next : dependents[t]) {
+                    if (pending[next].fetch_sub(1, memory_order_acq_rel) == 1) {
+                        lock_guard<mutex> g(queues[self].lock);
+                        queues[self].ready.push_back(next);
+                    }
+                }
+                remaining.fetch_sub(1, memory_order_acq_rel);
+            }
+        };
+
+        vector<thread> pool;
+        for (int w = 1; w < workers; w++) pool.emplace_back(worker, w);
+        worker(0);
+        for (auto& th : pool) th.join();
+        report.wallMs = millis(Clock::now() - start);
+
+        // Longest prerequisite chain by measured latency, in topological order.
+        vector<int> order = OptimalSolution().findOrder(numTasks, prerequisites);
+        vector<double> chain(numTasks, 0);
+        vector<int> via(numTasks, -1);
+        vector<vector<int>> before(numTasks);
+        for (const auto& pre : prerequisites) before[pre[0]].push_back(pre[1]);
+        int last = order[0];
+        for (int t : order) {
+            for (int p : before[t]) {
+                if (via[t] < 0 || chain[p] > chain[via[t]]) via[t] = p;
+            }
+            chain[t] = report.latencyMs[t] + (via[t] >= 0 ? chain[via[t]] : 0);
+            if (chain[t] > chain[last]) last = t;
+        }
+        for (int t = last; t >= 0; t = via[t]) report.criticalPath.push_back(t);
+        reverse(report.criticalPath.begin(), report.criticalPath.end());
+        report.criticalPathMs = chain[last];
+
+        if (firstError) rethrow_exception(firstError);
+        return report;
+    }
+};
+
+#ifndef DAA_NO_MAIN
 // Main function to handle input and output
-int main() {
+// Pass "exec" to also run every task through TaskExecutor (each one sleeps
+// for 1 ms) and print the critical path.
+int main(int argc, char** argv) {
     int numTasks, numPairs;
-    cin >> numTasks >> numPairs;
-    vector<vector<int>> prerequisites(numPairs, vector<int>(2));
-    for (int i = 0; i < numPairs; ++i) {
-        cin >> prerequisites[i][0] >> prerequisites[i][1];
+    vector<vector<int>> prerequisites;
+    try {
+        FastInput in;
+        in >> numTasks >> numPairs;
+        if (numTasks < 0 || numPairs < 0) throw runtime_error("task and pair counts must be non-negative");
+        prerequisites.assign(numPairs, vector<int>(2));
+        for (int i = 0; i < numPairs; ++i) {
+            in >> prerequisites[i][0] >> prerequisites[i][1];
+        }
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
     }
 
     OptimalSolution opt; // Using optimal solution for output
@@ -135,5 +310,16 @@ int main() {
     // Problem I: Output the order (or nothing if empty)
     vector<int> order = opt.findOrder(numTasks, prerequisites);
     // As per instruction, do not print the order
+
+    if (argc < 2 || string(argv[1]) != "exec") return 0;
+
+    // Run the tasks for real: each one just sleeps for a moment
+    TaskExecutor executor(numTasks, prerequisites);
+    ExecutionReport report = executor.run([](int) { this_thread::sleep_for(chrono::milliseconds(1)); });
+    if (report.scheduled) {
+        cout << "Critical path: " << report.criticalPath.size() << " tasks, "
+             << report.criticalPathMs << " ms" << endl;
+    }
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -2,6 +2,13 @@
 #include <unordered_set>
 #include <algorithm>
 #include <iostream>
+#include <memory>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include "csr_graph.h"
+#include "../common/temp_path.h"
 
 using namespace std;
 
@@ -90,6 +97,168 @@ public:
     }
 };
 
+// Optimal Approach on CSR: same DFS colouring, with the adjacency stored as
+// one contiguous neighbor array and the safe flag folded into the state byte.
+// Time Complexity: O(V + E)
+// Space Complexity: O(V)
+class CsrSolution {
+private:
+    // state: 0 = unvisited, 1 = visiting, 2 = unsafe, 3 = safe
+    bool dfs(int node, const CsrGraph& g, vector<char>& state) {
+        if (state[node] == 1) return false; // Cycle detected
+        if (state[node] >= 2) return state[node] == 3; // Already processed
+        state[node] = 1;
+        for (int neighbor : g.adj(node)) {
+            if (!dfs(neighbor, g, state)) {
+                state[node] = 2;
+                return false;
+            }
+        }
+        state[node] = 3; // Terminal nodes fall through to here as well
+        return true;
+    }
+
+public:
+    vector<int> eventualSafeNodes(const CsrGraph& g) {
+        vector<char> state(g.V, 0);
+        vector<int> result;
+        for (int i = 0; i < g.V; ++i) {
+            if (state[i] == 0) dfs(i, g, state);
+            if (state[i] == 3) result.push_back(i); // Ascending by construction
+        }
+        return result;
+    }
+};
+
+// Two bits of state per node, 32 nodes per word.
+class PackedStates {
+    vector<uint64_t> words;
+
+public:
+    explicit PackedStates(int n) : words((n + 31) / 32, 0) {}
+
+    int get(int v) const { return words[v >> 5] >> ((v & 31) * 2) & 3; }
+    void set(int v, int s) {
+        int shift = (v & 31) * 2;
+        words[v >> 5] = (words[v >> 5] & ~(3ULL << shift)) | (static_cast<uint64_t>(s) << shift);
+    }
+};
+
+// Kahn-style peeling on the reverse graph: a node is safe exactly when all of
+// its out-edges lead to safe nodes, so start from the terminal nodes and walk
+// incoming edges backwards, decrementing out-degrees; a node whose count hits
+// zero is safe. Iterative, so no recursion depth limit.
+class PeelingSolution {
+    // PENDING: not known safe. FRONTIER: found safe, incoming edges not yet
+    // peeled. NEXT: found safe during the current disk pass. SAFE: done.
+    enum { PENDING = 0, FRONTIER = 1, NEXT = 2, SAFE = 3 };
+
+    static vector<int> collectSafe(const PackedStates& state, int V) {
+        vector<int> result;
+        for (int i = 0; i < V; ++i) {
+            if (state.get(i) == SAFE) result.push_back(i);
+        }
+        return result;
+    }
+
+public:
+    // In-memory version over a CSR graph.
+    // Time Complexity: O(V + E)
+    // Space Complexity: O(V + E) for the reverse graph, 2 bits + one counter per node
+    vector<int> eventualSafeNodes(const CsrGraph& g) {
+        CsrGraph reverse = g.transpose();
+        vector<int> outDegree(g.V);
+        PackedStates state(g.V);
+        vector<int> queue;
+        for (int i = 0; i < g.V; ++i) {
+            outDegree[i] = g.degree(i);
+            if (outDegree[i] == 0) {
+                state.set(i, SAFE);
+                queue.push_back(i);
+            }
+        }
+        for (size_t head = 0; head < queue.size(); ++head) {
+            for (int pred : reverse.adj(queue[head])) {
+                if (--outDegree[pred] == 0) {
+                    state.set(pred, SAFE);
+                    queue.push_back(pred);
+                }
+            }
+        }
+        return collectSafe(state, g.V);
+    }
+
+    // Out-of-core version for graphs whose edges do not fit in memory. The
+    // edge file is a flat array of int32 {u, v} pairs (u -> v), see
+    // writeEdgeFile. Only the per-node counters and states stay resident.
+    //
+    // Each pass streams the file in chunks of chunkEdges and peels every edge
+    // whose target joined the frontier in the previous pass, so every edge is
+    // peeled exactly once; the number of passes is the depth of the peeling.
+    // Time Complexity: O(E * (depth + 1)) sequential reads, O(V) work per pass
+    // Space Complexity: O(V + chunkEdges)
+    vector<int> eventualSafeNodes(int V, const string& edgeFile, size_t chunkEdges = 1 << 20) {
+        unique_ptr<FILE, decltype(&fclose)> in(fopen(edgeFile.c_str(), "rb"), &fclose);
+        if (!in) throw runtime_error("cannot open edge file " + edgeFile);
+        vector<int32_t> buffer(2 * chunkEdges);
+
+        auto forEachEdge = [&](auto&& fn) {
+            rewind(in.get());
+            size_t got;
+            while ((got = fread(buffer.data(), 2 * sizeof(int32_t), chunkEdges, in.get())) > 0) {
+                for (size_t e = 0; e < got; ++e) {
+                    int u = buffer[2 * e], v = buffer[2 * e + 1];
+                    if (u < 0 || u >= V || v < 0 || v >= V) {
+                        throw runtime_error("edge endpoint out of range in " + edgeFile);
+                    }
+                    fn(u, v);
+                }
+            }
+            if (ferror(in.get())) throw runtime_error("read error in edge file " + edgeFile);
+        };
+
+        vector<int> outDegree(V, 0);
+        forEachEdge([&](int u, int) { outDegree[u]++; });
+
+        PackedStates state(V);
+        bool grew = false;
+        for (int i = 0; i < V; ++i) {
+            if (outDegree[i] == 0) {
+                state.set(i, FRONTIER);
+                grew = true;
+            }
+        }
+        while (grew) {
+            forEachEdge([&](int u, int v) {
+                if (state.get(v) == FRONTIER && --outDegree[u] == 0) state.set(u, NEXT);
+            });
+            grew = false;
+            for (int i = 0; i < V; ++i) {
+                int s = state.get(i);
+                if (s == FRONTIER) state.set(i, SAFE);
+                else if (s == NEXT) {
+                    state.set(i, FRONTIER);
+                    grew = true;
+                }
+            }
+        }
+        return collectSafe(state, V);
+    }
+};
+
+// Writes adj as the binary edge file read by PeelingSolution.
+void writeEdgeFile(const string& path, const vector<vector<int>>& adj) {
+    FILE* out = fopen(path.c_str(), "wb");
+    if (!out) throw runtime_error("cannot create edge file " + path);
+    for (int u = 0; u < (int)adj.size(); ++u) {
+        for (int v : adj[u]) {
+            int32_t edge[2] = {u, v};
+            fwrite(edge, sizeof(edge), 1, out);
+        }
+    }
+    fclose(out);
+}
+
 // Main function to handle input and output
 int main() {
     int V, E;
@@ -104,6 +273,21 @@ int main() {
 
     OptimalSolution opt;
     vector<int> safeNodes = opt.eventualSafeNodes(V, adj);
+
+    // The CSR layout, reverse-graph peeling and the disk-streamed peeling
+    // must agree; only the optimal line is printed
+    CsrSolution csr;
+    PeelingSolution peel;
+    string edgeFile = tempFilePath("prob_26_edges.bin");
+    writeEdgeFile(edgeFile, adj);
+    vector<int> safeNodesDisk = peel.eventualSafeNodes(V, edgeFile, 4);
+    remove(edgeFile.c_str());
+    if (csr.eventualSafeNodes(csrFromAdjacency(adj)) != safeNodes ||
+        peel.eventualSafeNodes(csrFromAdjacency(adj)) != safeNodes || safeNodesDisk != safeNodes) {
+        cerr << "a safe-node variant disagrees with OptimalSolution" << endl;
+        return 1;
+    }
+
     // Output safe nodes in sorted order
     for (int node : safeNodes) {
         cout << node << " ";
@@ -1,8 +1,15 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <array>
 #include <queue>
 #include <iostream>
+#include <cstdint>
+#include <cstring>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+#include "../common/parallel.h"
 
 using namespace std;
 
@@ -121,6 +128,99 @@ public:
     }
 };
 
+// Index of the first byte where a and b differ within their first n bytes,
+// or n if they agree. Compares 32 (AVX2) or 16 (SSE2) bytes per step and
+// locates the mismatch with one count-trailing-zeros on the compare mask.
+// Time Complexity: O(n / 32)
+// Space Complexity: O(1)
+inline size_t firstMismatch(const char* a, const char* b, size_t n) {
+    size_t i = 0;
+#ifdef __AVX2__
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        uint32_t diff = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+        if (diff) return i + __builtin_ctz(diff);
+    }
+#endif
+#ifdef __SSE2__
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        uint32_t diff = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFF;
+        if (diff) return i + __builtin_ctz(diff);
+    }
+#endif
+    for (; i < n; ++i) {
+        if (a[i] != b[i]) return i;
+    }
+    return n;
+}
+
+// Optimal Approach, vectorized: same topological sort, but the first
+// difference of each adjacent pair is found with firstMismatch, and every
+// edge is a bit in a 26x26 matrix (row u = letters after u), so duplicate
+// edges cost nothing. Adjacent pairs are independent, so the dictionary is
+// split across threads, each with its own matrix, and the matrices are ORed.
+// Letters after a node are visited in ascending order.
+// Time Complexity: O(total length / 32 / threads + 26^2)
+// Space Complexity: O(26) words per thread
+class SimdSolution {
+private:
+    bool dfs(int idx, const uint32_t after[26], vector<int>& state, vector<char>& order) {
+        if (state[idx] == 1) return false; // Cycle detected
+        if (state[idx] == 2) return true;
+        state[idx] = 1;
+        for (uint32_t next = after[idx]; next; next &= next - 1) {
+            if (!dfs(__builtin_ctz(next), after, state, order)) return false;
+        }
+        state[idx] = 2;
+        order.push_back(char('a' + idx));
+        return true;
+    }
+
+public:
+    vector<char> alienOrder(int K, const vector<string>& dict, int threads = 0) {
+        const long long pairs = dict.size() < 2 ? 0 : (long long)dict.size() - 1;
+        threads = resolveThreads(threads);
+        vector<array<uint32_t, 27>> local(threads); // 26 rows + present mask
+        for (auto& rows : local) rows.fill(0);
+
+        parallelChunks(pairs, threads, [&](long long begin, long long end, int t) {
+            uint32_t* rows = local[t].data();
+            uint32_t present = 0;
+            for (long long i = begin; i < end; ++i) {
+                const string& w1 = dict[i];
+                const string& w2 = dict[i + 1];
+                if (i == begin) for (char c : w1) present |= 1u << (c - 'a');
+                for (char c : w2) present |= 1u << (c - 'a');
+                size_t j = firstMismatch(w1.data(), w2.data(), min(w1.size(), w2.size()));
+                if (j < min(w1.size(), w2.size())) rows[w1[j] - 'a'] |= 1u << (w2[j] - 'a');
+            }
+            rows[26] |= present;
+        });
+
+        uint32_t after[26] = {0};
+        uint32_t present = 0;
+        for (const auto& rows : local) {
+            for (int c = 0; c < 26; ++c) after[c] |= rows[c];
+            present |= rows[26];
+        }
+
+        // Collect all characters (up to K), then DFS as in OptimalSolution
+        vector<int> state(26, 0);
+        vector<char> order;
+        int taken = 0;
+        for (int i = 0; i < 26 && taken < K; ++i) {
+            if (!(present >> i & 1)) continue;
+            taken++;
+            if (state[i] == 0 && !dfs(i, after, state, order)) return {};
+        }
+        reverse(order.begin(), order.end());
+        return order;
+    }
+};
+
 // Main function to handle input and output
 int main() {
     int N, K;
@@ -132,6 +232,18 @@ int main() {
 
     OptimalSolution opt;
     vector<char> order = opt.alienOrder(K, dict);
+
+    // Vectorized constraint extraction: its DFS visits successors in another
+    // order, so it may return a different valid order; check it, don't print it
+    SimdSolution simd;
+    vector<char> orderSimd = simd.alienOrder(K, dict);
+    bool agrees = order.empty() ? orderSimd.empty()
+                                : orderSimd.size() == order.size() && isValidOrder(orderSimd, dict);
+    if (!agrees) {
+        cerr << "SimdSolution disagrees with OptimalSolution" << endl;
+        return 1;
+    }
+
     // Output the order
     for (char c : order) {
         cout << c << " ";
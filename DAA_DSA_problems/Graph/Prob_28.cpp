@@ -2,6 +2,8 @@
 #include <queue>
 #include <climits>
 #include <iostream>
+#include "direction_optimizing_bfs.h"
+#include "../common/fast_io.h"
 
 using namespace std;
 
@@ -79,22 +81,49 @@ public:
     }
 };
 
+// Hybrid Approach: direction-optimizing BFS on a CSR graph
+// Same distances as OptimalSolution (-1 for unreachable nodes); the middle
+// levels run bottom-up over bitmap frontiers across all cores.
+class HybridSolution {
+public:
+    vector<int> shortestPath(int n, vector<vector<int>>& edges, int src) {
+        return hybridBfsDistances(csrFromEdges(n, edges, true), src);
+    }
+};
+
 // Main function to handle input and output
 int main() {
     int n, m;
-    cin >> n >> m;
-    vector<vector<int>> edges(m, vector<int>(2));
-    for (int i = 0; i < m; ++i) {
-        cin >> edges[i][0] >> edges[i][1];
+    vector<vector<int>> edges;
+    try {
+        FastInput in;
+        in >> n >> m;
+        if (n < 0 || m < 0) throw runtime_error("node and edge counts must be non-negative");
+        edges.assign(m, vector<int>(2));
+        for (int i = 0; i < m; ++i) {
+            in >> edges[i][0] >> edges[i][1];
+        }
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
     }
     int src = 0; // Source is fixed at 0
 
     OptimalSolution opt;
     vector<int> distances = opt.shortestPath(n, edges, src);
+
+    // The direction-optimizing BFS must agree; only one line is printed
+    HybridSolution hybrid;
+    if (hybrid.shortestPath(n, edges, src) != distances) {
+        cerr << "HybridSolution disagrees with OptimalSolution" << endl;
+        return 1;
+    }
+
     // Output distances
+    FastOutput out;
     for (int dist : distances) {
-        cout << dist << " ";
+        out << dist << ' ';
     }
-    cout << endl;
+    out << '\n';
     return 0;
 }
\ No newline at end of file
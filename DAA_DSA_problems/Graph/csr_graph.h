@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Compressed-sparse-row graph shared by the Graph/ solutions.
+//
+// All edges live in one contiguous neighbors array; the out-edges of u are
+// neighbors[offsets[u] .. offsets[u + 1]). The weights array is either empty
+// (unweighted graph) or runs parallel to neighbors.
+//
+// Unlike vector<vector<int>>, there is no per-node heap allocation, so a
+// traversal walks memory front to back instead of chasing V pointers.
+struct CsrGraph {
+    // Read-only view over a slice of one of the flat arrays.
+    struct Range {
+        const int* first = nullptr;
+        const int* last = nullptr;
+
+        const int* begin() const { return first; }
+        const int* end() const { return last; }
+        int size() const { return static_cast<int>(last - first); }
+        bool empty() const { return first == last; }
+        int operator[](int i) const { return first[i]; }
+    };
+
+    int V = 0;
+    std::vector<int> offsets;   // V + 1 entries
+    std::vector<int> neighbors; // E entries
+    std::vector<int> weights;   // E entries or empty
+
+    int numVertices() const { return V; }
+    int numEdges() const { return static_cast<int>(neighbors.size()); }
+    bool weighted() const { return !weights.empty(); }
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+
+    // Out-neighbours of u, in the order the edges were added.
+    Range adj(int u) const {
+        const int* base = neighbors.data();
+        return {base + offsets[u], base + offsets[u + 1]};
+    }
+
+    // Weights of the out-edges of u, parallel to adj(u).
+    Range adjWeights(int u) const {
+        const int* base = weights.data();
+        return {base + offsets[u], base + offsets[u + 1]};
+    }
+
+    // Graph with every edge reversed, built in O(V + E).
+    CsrGraph transpose() const {
+        CsrGraph t;
+        t.V = V;
+        t.offsets.assign(V + 1, 0);
+        t.neighbors.resize(neighbors.size());
+        if (weighted()) t.weights.resize(weights.size());
+
+        for (int v : neighbors) t.offsets[v + 1]++;
+        for (int i = 0; i < V; i++) t.offsets[i + 1] += t.offsets[i];
+
+        std::vector<int> cursor(t.offsets.begin(), t.offsets.end() - 1);
+        for (int u = 0; u < V; u++) {
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int slot = cursor[neighbors[e]]++;
+                t.neighbors[slot] = u;
+                if (weighted()) t.weights[slot] = weights[e];
+            }
+        }
+        return t;
+    }
+};
+
+// Flat weighted edge record, for algorithms that consume a plain edge array
+// (MST, Bellman-Ford) rather than an adjacency structure.
+struct WeightedEdge {
+    int u, v, w;
+};
+
+// Collects an edge list into three flat arrays and turns it into a CsrGraph
+// with a counting sort on the source vertex.
+// Edges of the same source keep their insertion order, so traversals over the
+// result visit neighbours in the same order as the adjacency-list versions.
+// Time Complexity: O(V + E)
+// Space Complexity: O(V + E), with no per-node allocations
+class CsrBuilder {
+    int V;
+    bool hasWeights = false;
+    std::vector<int> src, dst, wt;
+
+public:
+    explicit CsrBuilder(int V, std::size_t expectedEdges = 0) : V(V) {
+        src.reserve(expectedEdges);
+        dst.reserve(expectedEdges);
+    }
+
+    void addEdge(int u, int v) {
+        src.push_back(u);
+        dst.push_back(v);
+        if (hasWeights) wt.push_back(1);
+    }
+
+    void addEdge(int u, int v, int w) {
+        if (!hasWeights) {
+            // First weighted edge: back-fill unit weights for earlier ones.
+            hasWeights = true;
+            wt.assign(src.size(), 1);
+        }
+        src.push_back(u);
+        dst.push_back(v);
+        wt.push_back(w);
+    }
+
+    // Adds u -> v and v -> u.
+    void addUndirectedEdge(int u, int v) {
+        addEdge(u, v);
+        addEdge(v, u);
+    }
+
+    void addUndirectedEdge(int u, int v, int w) {
+        addEdge(u, v, w);
+        addEdge(v, u, w);
+    }
+
+    CsrGraph build() const {
+        CsrGraph g;
+        g.V = V;
+        g.offsets.assign(V + 1, 0);
+        g.neighbors.resize(dst.size());
+        if (hasWeights) g.weights.resize(wt.size());
+
+        for (int u : src) g.offsets[u + 1]++;
+        for (int i = 0; i < V; i++) g.offsets[i + 1] += g.offsets[i];
+
+        std::vector<int> cursor(g.offsets.begin(), g.offsets.end() - 1);
+        for (std::size_t e = 0; e < src.size(); e++) {
+            int slot = cursor[src[e]]++;
+            g.neighbors[slot] = dst[e];
+            if (hasWeights) g.weights[slot] = wt[e];
+        }
+        return g;
+    }
+};
+
+// Builds a CSR graph from {u, v} or {u, v, w} rows, the edge format most
+// Graph/ solutions take as input.
+inline CsrGraph csrFromEdges(int V, const std::vector<std::vector<int>>& edges, bool undirected = false) {
+    CsrBuilder b(V, edges.size() * (undirected ? 2 : 1));
+    for (const auto& e : edges) {
+        if (e.size() >= 3) {
+            if (undirected) b.addUndirectedEdge(e[0], e[1], e[2]);
+            else b.addEdge(e[0], e[1], e[2]);
+        } else {
+            if (undirected) b.addUndirectedEdge(e[0], e[1]);
+            else b.addEdge(e[0], e[1]);
+        }
+    }
+    return b.build();
+}
+
+inline CsrGraph csrFromEdges(int V, const std::vector<std::pair<int, int>>& edges, bool undirected = false) {
+    CsrBuilder b(V, edges.size() * (undirected ? 2 : 1));
+    for (const auto& e : edges) {
+        if (undirected) b.addUndirectedEdge(e.first, e.second);
+        else b.addEdge(e.first, e.second);
+    }
+    return b.build();
+}
+
+// Flattens an existing adjacency list (index = source vertex).
+inline CsrGraph csrFromAdjacency(const std::vector<std::vector<int>>& adj) {
+    CsrGraph g;
+    g.V = static_cast<int>(adj.size());
+    g.offsets.assign(g.V + 1, 0);
+    for (int u = 0; u < g.V; u++) g.offsets[u + 1] = g.offsets[u] + static_cast<int>(adj[u].size());
+    g.neighbors.reserve(g.offsets[g.V]);
+    for (const auto& row : adj) g.neighbors.insert(g.neighbors.end(), row.begin(), row.end());
+    return g;
+}
+
+// Flattens a weighted adjacency list of {neighbor, weight} pairs.
+inline CsrGraph csrFromAdjacency(const std::vector<std::vector<std::pair<int, int>>>& adj) {
+    CsrGraph g;
+    g.V = static_cast<int>(adj.size());
+    g.offsets.assign(g.V + 1, 0);
+    for (int u = 0; u < g.V; u++) g.offsets[u + 1] = g.offsets[u] + static_cast<int>(adj[u].size());
+    g.neighbors.reserve(g.offsets[g.V]);
+    g.weights.reserve(g.offsets[g.V]);
+    for (const auto& row : adj) {
+        for (const auto& e : row) {
+            g.neighbors.push_back(e.first);
+            g.weights.push_back(e.second);
+        }
+    }
+    return g;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.h"
+
+// Iterative depth-first search over a CSR graph with compile-time hooks.
+//
+// The explicit stack holds (node, edge cursor) pairs, one per node on the
+// current path, so the traversal visits nodes and edges in exactly the order
+// of the recursive textbook DFS but never grows the call stack; a path of
+// 10^7 nodes costs 10^7 heap frames and nothing else. The visitor is a
+// template parameter, so empty hooks compile away and the rest inline into
+// the loop.
+//
+// Hooks (derive from DfsVisitor and hide the ones you need):
+//   onDiscover(u, parent)          u turns grey; parent is -1 for a root
+//   onTreeEdge(u, v, e)            v is new and becomes a child of u
+//   onBackEdge(u, v, e)            v is grey, i.e. still on the search path
+//   onForwardOrCrossEdge(u, v, e)  v is already finished (black)
+//   onFinish(u, parent)            all edges of u are done
+//   stop()                         checked after every hook; true aborts
+// e is the edge slot in g.neighbors, so g.weights[e] (when present) can
+// carry an input edge id. Edges are classified as for a directed graph: on an
+// undirected CSR graph the edge back to the parent arrives as onBackEdge and
+// the reverse of each back edge arrives as onForwardOrCrossEdge.
+// Any graph type with CsrGraph's V, offsets[] and neighbors[] members works
+// (e.g. the mmap'ed GraphView of graph_file.h).
+struct DfsVisitor {
+    void onDiscover(int, int) {}
+    void onTreeEdge(int, int, int) {}
+    void onBackEdge(int, int, int) {}
+    void onForwardOrCrossEdge(int, int, int) {}
+    void onFinish(int, int) {}
+    bool stop() const { return false; }
+};
+
+// Reusable traversal state: colours and the frame stack survive between
+// runs so repeated searches over graphs of the same size do not reallocate.
+// Time Complexity: O(V + E) per full traversal
+// Space Complexity: O(V)
+class IterativeDfs {
+public:
+    enum Color : uint8_t { WHITE = 0, GREY = 1, BLACK = 2 };
+
+private:
+    std::vector<uint8_t> color;
+    std::vector<std::pair<int, int>> frames; // (node, next edge slot)
+
+public:
+    explicit IterativeDfs(int V = 0) : color(V, WHITE) { frames.reserve(V); }
+
+    // Marks every node white again, resizing for a graph with V nodes.
+    void reset(int V) {
+        color.assign(V, WHITE);
+        frames.clear();
+    }
+
+    Color state(int u) const { return static_cast<Color>(color[u]); }
+
+    // Searches from root if it is still white. Returns false if the visitor
+    // asked to stop; the colours then describe the partial search.
+    template <class Graph, class Visitor>
+    bool visit(const Graph& g, int root, Visitor& vis) {
+        if (color[root] != WHITE) return true;
+        color[root] = GREY;
+        vis.onDiscover(root, -1);
+        if (vis.stop()) return false;
+        frames.clear();
+        frames.push_back({root, g.offsets[root]});
+
+        while (!frames.empty()) {
+            int node = frames.back().first;
+            int& cursor = frames.back().second;
+            if (cursor < g.offsets[node + 1]) {
+                int e = cursor++;
+                int v = g.neighbors[e];
+                if (color[v] == WHITE) {
+                    vis.onTreeEdge(node, v, e);
+                    color[v] = GREY;
+                    vis.onDiscover(v, node);
+                    frames.push_back({v, g.offsets[v]}); // invalidates cursor
+                } else if (color[v] == GREY) {
+                    vis.onBackEdge(node, v, e);
+                } else {
+                    vis.onForwardOrCrossEdge(node, v, e);
+                }
+            } else {
+                frames.pop_back();
+                color[node] = BLACK;
+                vis.onFinish(node, frames.empty() ? -1 : frames.back().first);
+            }
+            if (vis.stop()) return false;
+        }
+        return true;
+    }
+
+    // Searches from every still-white node in index order.
+    template <class Graph, class Visitor>
+    bool visitAll(const Graph& g, Visitor& vis) {
+        for (int u = 0; u < g.V; u++) {
+            if (!visit(g, u, vis)) return false;
+        }
+        return true;
+    }
+};
+
+// One-shot full traversal of g.
+template <class Graph, class Visitor>
+bool depthFirstSearch(const Graph& g, Visitor& vis) {
+    IterativeDfs dfs(g.V);
+    return dfs.visitAll(g, vis);
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "csr_graph.h"
+#include "../common/parallel.h"
+
+// Direction-optimizing (top-down / bottom-up) BFS over a CSR graph; directed
+// graphs also pass their transpose for the bottom-up steps.
+//
+// Top-down expands the frontier edge by edge, which is cheap while the
+// frontier is small. On small-world graphs the middle levels cover most of
+// the graph; there it is cheaper to go bottom-up: every unvisited vertex scans
+// its own neighbours and stops at the first one found in the frontier bitmap.
+// Bottom-up steps write disjoint 64-bit words of the next frontier, so they
+// run in parallel without atomics.
+//
+// Switching rule (Beamer et al.): go bottom-up once the frontier's edge count
+// exceeds unexploredEdges / alpha, and back top-down once the frontier holds
+// fewer than V / beta vertices.
+struct HybridBfsOptions {
+    int alpha = 14;
+    int beta = 24;
+    int threads = 0; // <= 0: all cores
+};
+
+// Distance from src to every vertex along out-edges, -1 if unreachable.
+// Top-down steps walk g; bottom-up steps scan in-edges, taken from in, which
+// must be g.transpose() (or g itself when g stores both directions of each
+// edge), so directed graphs work too.
+// Time Complexity: O(V + E) worst case, far fewer edge checks on small-world graphs
+// Space Complexity: O(V) plus two V-bit frontier bitmaps
+inline std::vector<int> hybridBfsDistances(const CsrGraph& g, const CsrGraph& in, int src, HybridBfsOptions opt = {}) {
+    const int V = g.V;
+    const int words = (V + 63) / 64;
+    const int threads = resolveThreads(opt.threads);
+    std::vector<int> dist(V, -1);
+    if (V == 0) return dist;
+
+    std::vector<uint64_t> frontierBits(words, 0), nextBits(words, 0);
+    std::vector<int> frontier{src}, next;
+    dist[src] = 0;
+
+    long long unexploredEdges = g.numEdges() - g.degree(src);
+    bool bottomUp = false;
+    int level = 0;
+
+    while (true) {
+        long long frontierEdges = 0;
+        long long frontierSize = 0;
+        if (bottomUp) {
+            for (uint64_t w : frontierBits) frontierSize += __builtin_popcountll(w);
+        } else {
+            frontierSize = static_cast<long long>(frontier.size());
+            for (int u : frontier) frontierEdges += g.degree(u);
+        }
+        if (frontierSize == 0) break;
+
+        // Pick the direction for this level.
+        if (!bottomUp && frontierEdges > unexploredEdges / opt.alpha) {
+            std::fill(frontierBits.begin(), frontierBits.end(), 0);
+            for (int u : frontier) frontierBits[u >> 6] |= 1ULL << (u & 63);
+            bottomUp = true;
+        } else if (bottomUp && frontierSize < V / opt.beta) {
+            frontier.clear();
+            for (int w = 0; w < words; w++) {
+                for (uint64_t bits = frontierBits[w]; bits; bits &= bits - 1) {
+                    frontier.push_back(w * 64 + __builtin_ctzll(bits));
+                }
+            }
+            bottomUp = false;
+        }
+
+        const int nextLevel = level + 1;
+        if (bottomUp) {
+            std::vector<long long> explored(threads, 0);
+            parallelChunks(words, threads, [&](long long wb, long long we, int t) {
+                long long edges = 0;
+                for (long long w = wb; w < we; w++) {
+                    uint64_t out = 0;
+                    int base = static_cast<int>(w * 64);
+                    int end = base + 64 < V ? base + 64 : V;
+                    for (int v = base; v < end; v++) {
+                        if (dist[v] != -1) continue;
+                        for (int u : in.adj(v)) {
+                            if (frontierBits[u >> 6] >> (u & 63) & 1) {
+                                dist[v] = nextLevel;
+                                out |= 1ULL << (v - base);
+                                edges += g.degree(v);
+                                break;
+                            }
+                        }
+                    }
+                    nextBits[w] = out;
+                }
+                explored[t] = edges;
+            });
+            for (long long e : explored) unexploredEdges -= e;
+            frontierBits.swap(nextBits);
+        } else {
+            next.clear();
+            for (int u : frontier) {
+                for (int v : g.adj(u)) {
+                    if (dist[v] == -1) {
+                        dist[v] = nextLevel;
+                        next.push_back(v);
+                        unexploredEdges -= g.degree(v);
+                    }
+                }
+            }
+            frontier.swap(next);
+        }
+        level = nextLevel;
+    }
+    return dist;
+}
+
+// Undirected form: g must store both directions of each edge
+// (csrFromEdges(..., true)), so it is its own transpose.
+inline std::vector<int> hybridBfsDistances(const CsrGraph& g, int src, HybridBfsOptions opt = {}) {
+    return hybridBfsDistances(g, g, src, opt);
+}
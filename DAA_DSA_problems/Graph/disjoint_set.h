@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../common/op_counters.h"
+
+// Union-find shared by the Graph/ solutions (prob_10, prob_11, prob_37..40).
+//
+// findParent is iterative with path halving: every node on the walk is
+// pointed at its grandparent, which gives the same near-constant amortized
+// bound as full path compression without recursing once per level.
+// Time Complexity: O(alpha(n)) amortized per operation
+// Space Complexity: O(n)
+class DisjointSet {
+public:
+    std::vector<int> rank, parent, size;
+
+    explicit DisjointSet(int n) : rank(n, 0), parent(n), size(n, 1) {
+        for (int i = 0; i < n; i++) parent[i] = i;
+    }
+
+    // With DAA_OP_COUNTERS, records the number of finds and the length of
+    // each walk (total and longest).
+    int findParent(int u) {
+        DAA_COUNTERS_ONLY(int steps = 0;)
+        while (parent[u] != u) {
+            parent[u] = parent[parent[u]];
+            u = parent[u];
+            DAA_COUNTERS_ONLY(steps++;)
+        }
+        DAA_COUNT("dsu.find");
+        DAA_COUNT_ADD("dsu.find_path_total", steps);
+        DAA_COUNT_MAX("dsu.find_path_max", steps);
+        return u;
+    }
+
+    // Both unions return false when u and v were already in one set.
+    bool unionByRank(int u, int v) {
+        int pu = findParent(u);
+        int pv = findParent(v);
+        if (pu == pv) return false;
+        if (rank[pu] < rank[pv]) std::swap(pu, pv);
+        parent[pv] = pu;
+        size[pu] += size[pv];
+        if (rank[pu] == rank[pv]) rank[pu]++;
+        return true;
+    }
+
+    bool unionBySize(int u, int v) {
+        int pu = findParent(u);
+        int pv = findParent(v);
+        if (pu == pv) return false;
+        if (size[pu] < size[pv]) std::swap(pu, pv);
+        parent[pv] = pu;
+        size[pu] += size[pv];
+        return true;
+    }
+
+    bool sameSet(int u, int v) { return findParent(u) == findParent(v); }
+    int setSize(int u) { return size[findParent(u)]; }
+    int count() const { return static_cast<int>(parent.size()); }
+
+    // Appends a new singleton set and returns its id, for callers that
+    // discover their nodes on the fly.
+    int makeSet() {
+        int id = count();
+        rank.push_back(0);
+        parent.push_back(id);
+        size.push_back(1);
+        return id;
+    }
+};
+
+// Lock-free union-find for several threads uniting edges at once.
+//
+// Roots are linked with a single compare-and-swap on the parent slot of the
+// root with the larger index, so a link either installs atomically or the
+// union retries from fresh roots. No thread blocks on another, and a failed
+// CAS means some other link succeeded, so the structure as a whole always
+// makes progress (lock-free); it is not wait-free, since one thread's union
+// can keep losing races and retrying while others finish theirs. Linking by
+// index keeps the forest acyclic without ranks, and the path halving in
+// findParent is also done with CAS (a lost race only skips one shortcut).
+// Time Complexity: O(log n) expected per operation under concurrent use
+// Space Complexity: O(n)
+class ConcurrentDisjointSet {
+    int n;
+    std::unique_ptr<std::atomic<int>[]> parent;
+
+public:
+    explicit ConcurrentDisjointSet(int n) : n(n), parent(new std::atomic<int>[n]) {
+        for (int i = 0; i < n; i++) parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    int count() const { return n; }
+
+    int findParent(int u) {
+        while (true) {
+            int p = parent[u].load(std::memory_order_acquire);
+            if (p == u) return u;
+            int gp = parent[p].load(std::memory_order_acquire);
+            if (p != gp) parent[u].compare_exchange_weak(p, gp, std::memory_order_release, std::memory_order_relaxed);
+            u = gp;
+        }
+    }
+
+    // Returns true for exactly one of any set of racing calls that join the
+    // same two sets.
+    bool unite(int u, int v) {
+        while (true) {
+            u = findParent(u);
+            v = findParent(v);
+            if (u == v) return false;
+            if (u < v) std::swap(u, v); // link the larger index under the smaller
+            int expected = u;
+            if (parent[u].compare_exchange_strong(expected, v, std::memory_order_acq_rel)) return true;
+        }
+    }
+
+    bool sameSet(int u, int v) {
+        while (true) {
+            u = findParent(u);
+            v = findParent(v);
+            if (u == v) return true;
+            // u was still a root after v was found, so they really differ.
+            if (parent[u].load(std::memory_order_acquire) == u) return false;
+        }
+    }
+};
@@ -0,0 +1,234 @@
+#include <bits/stdc++.h>
+
+// Shared headers first: the problem files below are pulled into their own
+// namespaces, and #pragma once would otherwise hide these from all but the
+// first namespace that includes them.
+#include "csr_graph.h"
+#include "bit_matrix.h"
+#include "disjoint_set.h"
+#include "graph_file.h"
+#include "incremental_schedule.h"
+#include "priority_queues.h"
+#include "streaming_cycle.h"
+#include "graph_generators.h"
+#include "../common/parallel.h"
+#include "../common/bench.h"
+#include "../common/op_counters.h"
+#include "../common/autotune.h"
+#include "../common/temp_path.h"
+
+#define DAA_NO_MAIN
+namespace p02 {
+#include "prob_02.cpp"
+}
+namespace p05 {
+#include "prob_05.cpp"
+}
+namespace p06 {
+#include "prob_06.cpp"
+}
+namespace p10 {
+#include "prob_10.cpp"
+}
+namespace p14 {
+#include "prob_14.cpp"
+}
+namespace p24 {
+#include "prob_24.cpp"
+}
+namespace p37 {
+#include "prob_37.cpp"
+}
+#undef DAA_NO_MAIN
+
+using namespace std;
+
+// Brute-force vs. optimal benchmark over synthetic graph families.
+//
+// For every problem, family and size the brute and optimal entry points get
+// the same generated input (inputs are built outside the timed region). Each
+// row reports wall time, the peak resident memory reached during that run,
+// and throughput in millions of (V + E) per second; the pair is marked
+// MISMATCH if the two results differ, and the exit code is 1 if any pair did.
+//   graph_bench [quick] [seed]
+// "quick" runs only the smallest size of every sweep.
+
+struct Family {
+    string name;
+    int V;
+    EdgeList edges;
+};
+
+static uint64_t benchSeed = 12345;
+static bool quickMode = false;
+static int mismatches = 0;
+
+// Undirected families at roughly V vertices.
+static vector<Family> undirectedFamilies(int V) {
+    int side = max(1, (int) sqrt((double) V));
+    return {
+        {"erdos-renyi", V, erdosRenyiEdges(V, 8, benchSeed + V)},
+        {"grid", side * side, gridEdges(side, side)},
+        {"power-law", V, powerLawEdges(V, 4, benchSeed + 2 * V)},
+    };
+}
+
+static vector<int> sweep(initializer_list<int> sizes) {
+    vector<int> v(sizes);
+    if (quickMode) v.resize(1);
+    return v;
+}
+
+static string describe(bool b) { return b ? "true" : "false"; }
+static string describe(int x) { return to_string(x); }
+static string describe(const vector<int>& d) {
+    long long sum = 0;
+    for (int x : d) sum += x;
+    return "sum=" + to_string(sum);
+}
+
+static void printHeader() {
+    printf("%-16s %-18s %8s %9s  %-8s %10s %9s %9s  %s\n", "problem", "family", "V", "E", "variant", "time_ms",
+           "peak_MiB", "Mitems/s", "result");
+}
+
+static void row(const string& problem, const string& family, int V, size_t E, const char* variant,
+                const Measurement& m, const string& result) {
+    double mitems = m.ms > 0 ? (V + (double) E) / (m.ms * 1000.0) : 0.0;
+    printf("%-16s %-18s %8d %9zu  %-8s %10.3f %9.1f %9.2f  %s\n", problem.c_str(), family.c_str(), V, E, variant,
+           m.ms, m.peakKb / 1024.0, mitems, result.c_str());
+}
+
+// Times brute() and optimal() on one input and compares their results.
+template <class Brute, class Optimal>
+void runPair(const string& problem, const string& family, int V, size_t E, Brute brute, Optimal optimal) {
+    decltype(brute()) a{};
+    decltype(optimal()) b{};
+    Measurement mb = measure(a, brute);
+    Measurement mo = measure(b, optimal);
+    bool same = a == b;
+    if (!same) mismatches++;
+    row(problem, family, V, E, "brute", mb, describe(a));
+    row(problem, family, V, E, "optimal", mo, describe(b) + (same ? "" : "  MISMATCH"));
+    fflush(stdout);
+}
+
+static void benchProvinces() {
+    for (int V : sweep({256, 1024, 2048})) {
+        for (auto& f : undirectedFamilies(V)) {
+            auto matrix = toAdjacencyMatrix(f.V, f.edges, true);
+            for (int i = 0; i < f.V; i++) matrix[i][i] = 1;
+            runPair("provinces", f.name, f.V, f.edges.size(),
+                    [&] { return p02::countProvincesBruteForce(matrix); },
+                    [&] { return p02::countProvincesOptimal(matrix); });
+        }
+    }
+}
+
+static void benchBipartite() {
+    for (int V : sweep({256, 1024, 2048})) {
+        for (auto& f : undirectedFamilies(V)) {
+            auto matrix = toAdjacencyMatrix(f.V, f.edges, true);
+            auto adj = toAdjacencyList(f.V, f.edges, true);
+            runPair("bipartite", f.name, f.V, f.edges.size(),
+                    [&] { return p05::isBipartiteBruteForce(f.V, matrix); },
+                    [&] { return p05::isBipartiteOptimal(f.V, adj); });
+        }
+    }
+}
+
+static void benchCycle() {
+    for (int V : sweep({256, 1024, 2048})) {
+        for (auto& f : undirectedFamilies(V)) {
+            // Spanning forests are the interesting case: no cycle means a full scan.
+            EdgeList forest;
+            DisjointSet ds(f.V);
+            for (auto& e : f.edges) {
+                if (ds.unionBySize(e.first, e.second)) forest.push_back(e);
+            }
+            for (auto* edges : {&f.edges, &forest}) {
+                auto matrix = toAdjacencyMatrix(f.V, *edges, true);
+                auto adj = toAdjacencyList(f.V, *edges, true);
+                runPair("cycle", f.name + (edges == &forest ? "/tree" : ""), f.V, edges->size(),
+                        [&] { return p14::isCycleBruteForce(f.V, matrix); },
+                        [&] { return p14::isCycleOptimal(f.V, adj); });
+            }
+        }
+    }
+}
+
+static void benchDijkstra() {
+    for (int V : sweep({1024, 4096, 16384})) {
+        for (auto& f : undirectedFamilies(V)) {
+            auto adj = toWeightedAdjacency(f.V, withRandomWeights(f.edges, 100, benchSeed + V), true);
+            runPair("dijkstra", f.name, f.V, f.edges.size(),
+                    [&] { return p06::dijkstraBruteForce(f.V, adj, 0); },
+                    [&] { return p06::dijkstraOptimal(f.V, adj, 0); });
+        }
+    }
+}
+
+static void benchMakeConnected() {
+    for (int V : sweep({1 << 12, 1 << 15, 1 << 18})) {
+        for (auto& f : undirectedFamilies(V)) {
+            vector<vector<int>> edges;
+            edges.reserve(f.edges.size());
+            // Drop every third edge so the graph splits into several components.
+            for (size_t i = 0; i < f.edges.size(); i++) {
+                if (i % 3) edges.push_back({f.edges[i].first, f.edges[i].second});
+            }
+            p10::Solution sol;
+            runPair("makeConnected", f.name, f.V, edges.size(),
+                    [&] { return sol.makeConnectedBruteForce(f.V, edges); },
+                    [&] { return sol.makeConnectedOptimal(f.V, edges); });
+        }
+    }
+}
+
+static void benchKruskal() {
+    for (int V : sweep({1 << 12, 1 << 15, 1 << 18})) {
+        for (auto& f : undirectedFamilies(V)) {
+            auto weighted = withRandomWeights(f.edges, 1000, benchSeed + V);
+            auto forBrute = weighted, forOptimal = weighted; // both sort in place
+            runPair("kruskal", f.name, f.V, weighted.size(),
+                    [&] { return p37::kruskalBruteForce(f.V, forBrute); },
+                    [&] { return p37::kruskalOptimal(f.V, forOptimal); });
+        }
+    }
+}
+
+static void benchCourseSchedule() {
+    for (int V : sweep({1 << 10, 1 << 13, 1 << 16})) {
+        EdgeList dag = randomDagEdges(V, 4, benchSeed + V);
+        for (int withCycle = 0; withCycle < 2; withCycle++) {
+            // {course, prerequisite}: edge u -> v means v needs u.
+            vector<pair<int, int>> prereq;
+            prereq.reserve(dag.size() + 1);
+            for (auto& e : dag) prereq.push_back({e.second, e.first});
+            if (withCycle && !dag.empty()) prereq.push_back({dag[0].first, dag[0].second});
+            runPair("courseSchedule", withCycle ? "dag+cycle" : "dag", V, prereq.size(),
+                    [&] { return p24::canFinishBruteForce(V, prereq); },
+                    [&] { return !p24::findOrderOptimal(V, prereq).empty(); });
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "quick") quickMode = true;
+        else benchSeed = stoull(arg);
+    }
+
+    printHeader();
+    benchProvinces();
+    benchBipartite();
+    benchCycle();
+    benchDijkstra();
+    benchMakeConnected();
+    benchKruskal();
+    benchCourseSchedule();
+
+    if (mismatches) printf("\n%d brute/optimal pairs disagreed\n", mismatches);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,37 @@
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include "graph_file.h"
+
+using namespace std;
+
+// Converts a text edge list ("V E", then E lines of "u v" or "u v w") read
+// from stdin into the mmap-able binary graph file of graph_file.h.
+//   graph_convert [-w] output.bin < edges.txt
+// -w reads a third weight column. Edges are stored directed, as listed.
+// Time Complexity: O(V + E)
+// Space Complexity: O(V + E)
+int main(int argc, char** argv) {
+    bool weighted = false;
+    string output;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "-w") weighted = true;
+        else output = arg;
+    }
+    if (output.empty()) {
+        cerr << "usage: " << argv[0] << " [-w] output.bin < edges.txt" << endl;
+        return 2;
+    }
+
+    ios::sync_with_stdio(false);
+    try {
+        CsrGraph g = readEdgeListText(cin, weighted);
+        writeGraphFile(output, g);
+        cout << "wrote " << g.V << " vertices, " << g.numEdges() << " edges to " << output << endl;
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
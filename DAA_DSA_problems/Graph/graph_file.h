@@ -0,0 +1,196 @@
+#pragma once
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "csr_graph.h"
+
+// Binary CSR graph file that is mmap'ed and used in place, so loading a graph
+// costs one page-table setup instead of parsing text.
+//
+// Layout (native byte order, every section starts on a 64-byte boundary):
+//   GraphFileHeader
+//   int32 offsets[V + 1]
+//   int32 neighbors[E]
+//   int32 weights[E]          only if FLAG_WEIGHTED
+// The arrays are exactly CsrGraph's, so the mapped view below exposes the
+// same V / offsets / neighbors / weights names and the CSR solutions (and
+// IterativeDfs) run on it unchanged.
+struct GraphFileHeader {
+    static constexpr char MAGIC[8] = {'D', 'A', 'A', 'C', 'S', 'R', '\0', '\1'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t FLAG_WEIGHTED = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t numVertices;
+    uint64_t numEdges;
+    uint64_t offsetsAt, neighborsAt, weightsAt; // byte positions, 0 = absent
+};
+
+inline uint64_t graphFileAlign(uint64_t pos) { return (pos + 63) & ~uint64_t(63); }
+
+// Non-owning CSR view over a mapped file (or any three int arrays).
+struct GraphView {
+    int V = 0;
+    int E = 0;
+    const int* offsets = nullptr;
+    const int* neighbors = nullptr;
+    const int* weights = nullptr; // nullptr when unweighted
+
+    int numVertices() const { return V; }
+    int numEdges() const { return E; }
+    bool weighted() const { return weights != nullptr; }
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+    CsrGraph::Range adj(int u) const { return {neighbors + offsets[u], neighbors + offsets[u + 1]}; }
+    CsrGraph::Range adjWeights(int u) const { return {weights + offsets[u], weights + offsets[u + 1]}; }
+
+    // Reversed graph in ordinary memory, for algorithms that need both.
+    CsrGraph transpose() const {
+        CsrGraph t;
+        t.V = V;
+        t.offsets.assign(V + 1, 0);
+        t.neighbors.resize(E);
+        if (weighted()) t.weights.resize(E);
+        for (int e = 0; e < E; e++) t.offsets[neighbors[e] + 1]++;
+        for (int i = 0; i < V; i++) t.offsets[i + 1] += t.offsets[i];
+        std::vector<int> cursor(t.offsets.begin(), t.offsets.end() - 1);
+        for (int u = 0; u < V; u++) {
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int slot = cursor[neighbors[e]]++;
+                t.neighbors[slot] = u;
+                if (weighted()) t.weights[slot] = weights[e];
+            }
+        }
+        return t;
+    }
+};
+
+inline GraphView viewOf(const CsrGraph& g) {
+    return {g.V, g.numEdges(), g.offsets.data(), g.neighbors.data(), g.weighted() ? g.weights.data() : nullptr};
+}
+
+// Writes g in the format above.
+inline void writeGraphFile(const std::string& path, const CsrGraph& g) {
+    GraphFileHeader h{};
+    std::memcpy(h.magic, GraphFileHeader::MAGIC, sizeof h.magic);
+    h.version = GraphFileHeader::VERSION;
+    h.flags = g.weighted() ? GraphFileHeader::FLAG_WEIGHTED : 0;
+    h.numVertices = g.V;
+    h.numEdges = g.neighbors.size();
+    h.offsetsAt = graphFileAlign(sizeof h);
+    h.neighborsAt = graphFileAlign(h.offsetsAt + (h.numVertices + 1) * sizeof(int32_t));
+    h.weightsAt = g.weighted() ? graphFileAlign(h.neighborsAt + h.numEdges * sizeof(int32_t)) : 0;
+
+    std::FILE* out = std::fopen(path.c_str(), "wb");
+    if (!out) throw std::runtime_error("cannot create graph file " + path);
+    uint64_t pos = 0;
+    bool ok = true;
+    auto put = [&](uint64_t at, const void* data, std::size_t bytes) {
+        static const char zeros[64] = {};
+        while (ok && pos < at) {
+            std::size_t pad = static_cast<std::size_t>(at - pos < 64 ? at - pos : 64);
+            ok = std::fwrite(zeros, 1, pad, out) == pad;
+            pos += pad;
+        }
+        if (ok && bytes) ok = std::fwrite(data, 1, bytes, out) == bytes;
+        pos += bytes;
+    };
+    put(0, &h, sizeof h);
+    put(h.offsetsAt, g.offsets.data(), g.offsets.size() * sizeof(int32_t));
+    put(h.neighborsAt, g.neighbors.data(), g.neighbors.size() * sizeof(int32_t));
+    if (g.weighted()) put(h.weightsAt, g.weights.data(), g.weights.size() * sizeof(int32_t));
+    ok = std::fclose(out) == 0 && ok;
+    if (!ok) throw std::runtime_error("write error in graph file " + path);
+}
+
+// Parses the text input the Graph/ mains read from cin: "V E" followed by E
+// lines of "u v" (or "u v w" when weighted). Directed edges, as given.
+// Time Complexity: O(V + E)
+// Space Complexity: O(V + E)
+inline CsrGraph readEdgeListText(std::istream& in, bool weighted) {
+    long long V, E;
+    if (!(in >> V >> E) || V < 0 || E < 0 || V > INT_MAX || E > INT_MAX) {
+        throw std::runtime_error("bad edge list header");
+    }
+    CsrBuilder b(static_cast<int>(V), static_cast<std::size_t>(E));
+    for (long long i = 0; i < E; i++) {
+        int u, v, w = 1;
+        if (!(in >> u >> v) || (weighted && !(in >> w))) throw std::runtime_error("truncated edge list");
+        if (u < 0 || u >= V || v < 0 || v >= V) throw std::runtime_error("edge endpoint out of range");
+        if (weighted) b.addEdge(u, v, w);
+        else b.addEdge(u, v);
+    }
+    return b.build();
+}
+
+// One-off converter from the text format to a graph file.
+inline void convertEdgeListToGraphFile(std::istream& in, const std::string& path, bool weighted) {
+    writeGraphFile(path, readEdgeListText(in, weighted));
+}
+
+// Read-only mapping of a graph file. The header and section bounds are
+// checked once; the arrays themselves are trusted, not scanned.
+class MappedGraphFile {
+    void* base = MAP_FAILED;
+    std::size_t length = 0;
+    GraphView view;
+
+public:
+    explicit MappedGraphFile(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("cannot open graph file " + path);
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(GraphFileHeader))) {
+            close(fd);
+            throw std::runtime_error("not a graph file: " + path);
+        }
+        length = static_cast<std::size_t>(st.st_size);
+        base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) throw std::runtime_error("cannot map graph file " + path);
+
+        const GraphFileHeader& h = *static_cast<const GraphFileHeader*>(base);
+        uint64_t V = h.numVertices, E = h.numEdges;
+        bool weighted = h.flags & GraphFileHeader::FLAG_WEIGHTED;
+        bool valid = std::memcmp(h.magic, GraphFileHeader::MAGIC, sizeof h.magic) == 0 &&
+                     h.version == GraphFileHeader::VERSION && V < INT_MAX && E <= INT_MAX &&
+                     h.offsetsAt % 64 == 0 && h.neighborsAt % 64 == 0 && h.weightsAt % 64 == 0 &&
+                     h.offsetsAt + (V + 1) * 4 <= length && h.neighborsAt + E * 4 <= length &&
+                     (!weighted || (h.weightsAt && h.weightsAt + E * 4 <= length));
+        if (valid) {
+            const char* bytes = static_cast<const char*>(base);
+            view.V = static_cast<int>(V);
+            view.E = static_cast<int>(E);
+            view.offsets = reinterpret_cast<const int*>(bytes + h.offsetsAt);
+            view.neighbors = reinterpret_cast<const int*>(bytes + h.neighborsAt);
+            view.weights = weighted ? reinterpret_cast<const int*>(bytes + h.weightsAt) : nullptr;
+            valid = view.offsets[0] == 0 && view.offsets[V] == static_cast<int>(E);
+        }
+        if (!valid) {
+            munmap(base, length);
+            throw std::runtime_error("corrupt graph file " + path);
+        }
+        madvise(base, length, MADV_SEQUENTIAL);
+    }
+
+    MappedGraphFile(const MappedGraphFile&) = delete;
+    MappedGraphFile& operator=(const MappedGraphFile&) = delete;
+    ~MappedGraphFile() {
+        if (base != MAP_FAILED) munmap(base, length);
+    }
+
+    const GraphView& graph() const { return view; }
+};
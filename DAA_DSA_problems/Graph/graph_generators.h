@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../common/flat_hash_map.h"
+
+// Seeded synthetic graph families for the benchmarks and differential checks.
+// Every generator returns a simple edge list (no self-loops, no duplicate
+// pairs) and is deterministic in (size, seed), so a failing case can be
+// replayed exactly. Undirected generators list each edge once with u < v.
+
+using EdgeList = std::vector<std::pair<int, int>>;
+
+namespace graph_gen_detail {
+inline uint64_t pairKey(int u, int v) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(u)) << 32 | static_cast<uint32_t>(v);
+}
+} // namespace graph_gen_detail
+
+// G(n, m) random graph with m = V * avgDegree / 2 distinct edges.
+// Time Complexity: O(V + E) expected
+// Space Complexity: O(E)
+inline EdgeList erdosRenyiEdges(int V, double avgDegree, uint64_t seed) {
+    EdgeList edges;
+    if (V < 2) return edges;
+    long long maxEdges = static_cast<long long>(V) * (V - 1) / 2;
+    long long m = std::min<long long>(maxEdges, static_cast<long long>(V * avgDegree / 2));
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> node(0, V - 1);
+    FlatHashMap<uint64_t, char> seen(m);
+    edges.reserve(m);
+    while (static_cast<long long>(edges.size()) < m) {
+        int u = node(rng), v = node(rng);
+        if (u == v) continue;
+        if (u > v) std::swap(u, v);
+        if (seen.tryEmplace(graph_gen_detail::pairKey(u, v)).second) edges.push_back({u, v});
+    }
+    return edges;
+}
+
+// rows x cols 4-neighbour lattice; vertex r * cols + c.
+inline EdgeList gridEdges(int rows, int cols) {
+    EdgeList edges;
+    edges.reserve(2LL * rows * cols);
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int u = r * cols + c;
+            if (c + 1 < cols) edges.push_back({u, u + 1});
+            if (r + 1 < rows) edges.push_back({u, u + cols});
+        }
+    }
+    return edges;
+}
+
+// Barabasi-Albert preferential attachment: each new vertex links to
+// edgesPerNode distinct earlier vertices picked proportionally to degree,
+// giving a power-law degree tail with a few large hubs.
+// Time Complexity: O(V * edgesPerNode) expected
+// Space Complexity: O(E)
+inline EdgeList powerLawEdges(int V, int edgesPerNode, uint64_t seed) {
+    EdgeList edges;
+    if (V < 2) return edges;
+    std::mt19937_64 rng(seed);
+    std::vector<int> endpoints; // every edge contributes both ends
+    endpoints.reserve(2LL * V * edgesPerNode);
+    int core = std::min(V, edgesPerNode + 1);
+    for (int u = 0; u < core; u++) {
+        for (int v = u + 1; v < core; v++) {
+            edges.push_back({u, v});
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    }
+    std::vector<int> picked;
+    for (int v = core; v < V; v++) {
+        picked.clear();
+        while (static_cast<int>(picked.size()) < std::min(edgesPerNode, v)) {
+            int u = endpoints.empty() ? static_cast<int>(rng() % v) : endpoints[rng() % endpoints.size()];
+            if (std::find(picked.begin(), picked.end(), u) == picked.end()) picked.push_back(u);
+        }
+        for (int u : picked) {
+            edges.push_back({u, v});
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    }
+    return edges;
+}
+
+// Random DAG: a hidden random order ranks the vertices and every edge goes
+// from lower to higher rank. Edges are directed u -> v.
+// Time Complexity: O(V + E) expected
+// Space Complexity: O(V + E)
+inline EdgeList randomDagEdges(int V, double avgOutDegree, uint64_t seed) {
+    EdgeList edges = erdosRenyiEdges(V, 2 * avgOutDegree, seed);
+    std::vector<int> rankOf(V);
+    std::iota(rankOf.begin(), rankOf.end(), 0);
+    std::mt19937_64 rng(seed ^ 0x5bd1e995);
+    std::shuffle(rankOf.begin(), rankOf.end(), rng);
+    std::vector<int> vertexAt(V);
+    for (int v = 0; v < V; v++) vertexAt[rankOf[v]] = v;
+    for (auto& e : edges) e = {vertexAt[e.first], vertexAt[e.second]}; // first < second as ranks
+    return edges;
+}
+
+// Random bipartite graph: a hidden random side per vertex and about
+// V * avgDegree / 2 distinct edges, each joining the two sides.
+// Time Complexity: O(V + E) expected
+// Space Complexity: O(V + E)
+inline EdgeList randomBipartiteEdges(int V, double avgDegree, uint64_t seed) {
+    EdgeList edges = erdosRenyiEdges(V, 2 * avgDegree, seed);
+    std::mt19937_64 rng(seed ^ 0x27d4eb2f);
+    std::vector<char> side(V);
+    for (char& s : side) s = static_cast<char>(rng() & 1);
+    edges.erase(std::remove_if(edges.begin(), edges.end(), [&](const std::pair<int, int>& e) {
+                    return side[e.first] == side[e.second];
+                }),
+                edges.end());
+    return edges;
+}
+
+// Random forest of exactly `trees` trees (1 <= trees <= V): every vertex
+// but the first of each tree links to a random earlier vertex of its tree.
+// Time Complexity: O(V)
+// Space Complexity: O(V)
+inline EdgeList randomForestEdges(int V, int trees, uint64_t seed) {
+    EdgeList edges;
+    if (V < 1) return edges;
+    trees = std::max(1, std::min(trees, V));
+    std::mt19937_64 rng(seed);
+    std::vector<int> order(V);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+    edges.reserve(V - trees);
+    // order[0 .. trees) are the roots; vertex order[i] joins tree i % trees
+    for (int i = trees; i < V; i++) {
+        int k = i / trees; // earlier members of the tree: order[i % trees + j * trees], j < k
+        int parent = order[i % trees + static_cast<int>(rng() % k) * trees];
+        int u = order[i];
+        edges.push_back({std::min(u, parent), std::max(u, parent)});
+    }
+    return edges;
+}
+
+// {u, v, w} rows with weights uniform in [1, maxWeight].
+inline std::vector<std::vector<int>> withRandomWeights(const EdgeList& edges, int maxWeight, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> weight(1, maxWeight);
+    std::vector<std::vector<int>> rows;
+    rows.reserve(edges.size());
+    for (auto& e : edges) rows.push_back({e.first, e.second, weight(rng)});
+    return rows;
+}
+
+// Conversions to the input shapes the Graph/ solutions take.
+inline std::vector<std::vector<int>> toAdjacencyList(int V, const EdgeList& edges, bool undirected) {
+    std::vector<std::vector<int>> adj(V);
+    for (auto& e : edges) {
+        adj[e.first].push_back(e.second);
+        if (undirected) adj[e.second].push_back(e.first);
+    }
+    return adj;
+}
+
+inline std::vector<std::vector<int>> toAdjacencyMatrix(int V, const EdgeList& edges, bool undirected) {
+    std::vector<std::vector<int>> m(V, std::vector<int>(V, 0));
+    for (auto& e : edges) {
+        m[e.first][e.second] = 1;
+        if (undirected) m[e.second][e.first] = 1;
+    }
+    return m;
+}
+
+inline std::vector<std::vector<std::pair<int, int>>> toWeightedAdjacency(int V, const std::vector<std::vector<int>>& rows,
+                                                                       bool undirected) {
+    std::vector<std::vector<std::pair<int, int>>> adj(V);
+    for (auto& r : rows) {
+        adj[r[0]].push_back({r[1], r[2]});
+        if (undirected) adj[r[1]].push_back({r[0], r[2]});
+    }
+    return adj;
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+// Row-major grid with a one-cell sentinel border, shared by the grid BFS
+// solutions (prob_03, prob_04, prob_13, prob_17, prob_20).
+//
+// Cells live in one (rows + 2) x (cols + 2) array; cell (r, c) is stored at
+// index(r, c) = (r + 1) * stride + c + 1, so the four neighbours of index i
+// are i - stride, i + 1, i + stride, i - 1. The border ring holds a value the
+// caller picks so that it never passes the "may visit" test, which lets the
+// neighbour loops run without any bounds checks.
+template <class T>
+class Grid2D {
+    int nRows = 0, nCols = 0, rowStride = 2;
+    std::vector<T> cells;
+
+public:
+    Grid2D() = default;
+
+    Grid2D(int rows, int cols, T border, T fill = T())
+        : nRows(rows), nCols(cols), rowStride(cols + 2),
+          cells(static_cast<std::size_t>(rows + 2) * (cols + 2), fill) {
+        fillBorder(border);
+    }
+
+    // Copies a nested-vector grid; every row must have the same length.
+    template <class U>
+    static Grid2D fromNested(const std::vector<std::vector<U>>& grid, T border) {
+        int rows = static_cast<int>(grid.size());
+        Grid2D g(rows, rows ? static_cast<int>(grid[0].size()) : 0, border);
+        for (int r = 0; r < rows; r++) {
+            std::copy(grid[r].begin(), grid[r].end(), g.cells.begin() + g.index(r, 0));
+        }
+        return g;
+    }
+
+    template <class U = T>
+    std::vector<std::vector<U>> toNested() const {
+        std::vector<std::vector<U>> out(nRows);
+        for (int r = 0; r < nRows; r++) {
+            out[r].assign(cells.begin() + index(r, 0), cells.begin() + index(r, 0) + nCols);
+        }
+        return out;
+    }
+
+    void fillBorder(T border) {
+        const int width = rowStride;
+        std::fill(cells.begin(), cells.begin() + width, border);
+        std::fill(cells.end() - width, cells.end(), border);
+        for (int r = 1; r <= nRows; r++) {
+            cells[static_cast<std::size_t>(r) * width] = border;
+            cells[static_cast<std::size_t>(r) * width + width - 1] = border;
+        }
+    }
+
+    int rows() const { return nRows; }
+    int cols() const { return nCols; }
+    int stride() const { return rowStride; }
+
+    int index(int r, int c) const { return (r + 1) * rowStride + c + 1; }
+    int rowOf(int i) const { return i / rowStride - 1; }
+    int colOf(int i) const { return i % rowStride - 1; }
+
+    T& operator[](int i) { return cells[i]; }
+    const T& operator[](int i) const { return cells[i]; }
+    T& at(int r, int c) { return cells[index(r, c)]; }
+    const T& at(int r, int c) const { return cells[index(r, c)]; }
+    T* data() { return cells.data(); }
+    const T* data() const { return cells.data(); }
+
+    // Index deltas of the 4 (edge) or 8 (edge + corner) neighbours.
+    std::array<int, 4> offsets4() const { return {-rowStride, 1, rowStride, -1}; }
+    std::array<int, 8> offsets8() const {
+        return {-rowStride - 1, -rowStride, -rowStride + 1, -1, 1, rowStride - 1, rowStride, rowStride + 1};
+    }
+};
+
+// Level-synchronous multi-source BFS over the cell indices of a Grid2D.
+//
+// frontier holds the seed indices (already marked by the caller). For every
+// neighbour `to` of a frontier cell `from`, tryVisit(from, to) decides whether
+// `to` is visited, and must mark it so it is not visited twice; sentinel border
+// cells simply fail that test. Each round swaps two flat index arrays.
+// Returns the number of rounds that visited at least one new cell, i.e. the
+// eccentricity of the seed set within the visited region.
+// Time Complexity: O(R * C * Connectivity)
+// Space Complexity: O(R * C) for the frontier arrays
+template <int Connectivity = 4, class T, class TryVisit>
+int gridMultiSourceBfs(const Grid2D<T>& grid, std::vector<int> frontier, TryVisit tryVisit) {
+    static_assert(Connectivity == 4 || Connectivity == 8, "4- or 8-connectivity only");
+    int offsets[Connectivity];
+    if constexpr (Connectivity == 4) {
+        auto o = grid.offsets4();
+        std::copy(o.begin(), o.end(), offsets);
+    } else {
+        auto o = grid.offsets8();
+        std::copy(o.begin(), o.end(), offsets);
+    }
+
+    std::vector<int> next;
+    int rounds = 0;
+    while (true) {
+        next.clear();
+        for (int from : frontier) {
+            for (int k = 0; k < Connectivity; k++) {
+                int to = from + offsets[k];
+                if (tryVisit(from, to)) next.push_back(to);
+            }
+        }
+        if (next.empty()) break;
+        rounds++;
+        frontier.swap(next);
+    }
+    return rounds;
+}
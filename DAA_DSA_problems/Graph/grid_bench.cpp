@@ -0,0 +1,288 @@
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Shared headers first: the problem files below are pulled into their own
+// namespaces, and #pragma once would otherwise hide these from all but the
+// first namespace that includes them.
+#include "grid2d.h"
+#include "grid_kernels.h"
+#include "disjoint_set.h"
+#include "priority_queues.h"
+#include "../common/parallel.h"
+#include "../common/bench.h"
+#include "../common/random_inputs.h"
+#include "../common/op_counters.h"
+
+#define DAA_NO_MAIN
+namespace p03 {
+#include "prob_03.cpp"
+}
+namespace p04 {
+#include "prob_04.cpp"
+}
+namespace p07 {
+#include "prob_07.cpp"
+}
+namespace p08 {
+#include "prob_08.cpp"
+}
+namespace p13 {
+#include "prob_13.cpp"
+}
+namespace p16 {
+#include "prob_16.cpp"
+}
+namespace p17 {
+#include "prob_17.cpp"
+}
+namespace p20 {
+#include "prob_20.cpp"
+}
+#undef DAA_NO_MAIN
+
+using namespace std;
+
+// Compile-time grid kernels (grid_kernels.h) against the runtime loops they
+// replace, on random square grids.
+//
+// For every problem and size each variant solves its own copy of the same
+// grid (copies are made outside the timed region). "nested" is the
+// vector<vector> solution with its delrow/delcol loop, "runtime" the Grid2D
+// version on gridMultiSourceBfs with its run-time offset array, and
+// "kernel_<cell>" the gridFlood instantiations for that cell type (for the
+// oranges also "bitsliced", prob_03's word-parallel automaton, and for the
+// nearest-1 distances "sweep", prob_04's two-pass distance transform);
+// surrounded regions is measured against prob_16's bit-packed sweep. Each row
+// reports wall time, peak resident memory and millions of cells per second;
+// a variant is marked MISMATCH if it disagrees with the first one, and the
+// exit code is 1 if any did.
+//   grid_bench [quick] [seed]
+// "quick" runs only the smallest size.
+
+static uint64_t benchSeed = 12345;
+static bool quickMode = false;
+static int mismatches = 0;
+
+static vector<int> sweep(initializer_list<int> sizes) {
+    vector<int> v(sizes);
+    if (quickMode) v.resize(1);
+    return v;
+}
+
+// side x side cells, each value[k] with probability percent[k] / 100.
+static vector<vector<int>> randomCells(int side, const vector<int>& value, const vector<int>& percent, uint64_t seed) {
+    mt19937_64 rng(seed);
+    vector<vector<int>> g(side, vector<int>(side));
+    for (auto& row : g) {
+        for (int& cell : row) {
+            int roll = (int)(rng() % 100), k = 0;
+            while (k + 1 < (int)value.size() && roll >= percent[k]) roll -= percent[k++];
+            cell = value[k];
+        }
+    }
+    return g;
+}
+
+template <class U>
+static vector<vector<U>> convert(const vector<vector<int>>& g) {
+    vector<vector<U>> out(g.size());
+    for (size_t r = 0; r < g.size(); r++) out[r].assign(g[r].begin(), g[r].end());
+    return out;
+}
+
+static void printHeader() {
+    printf("%-14s %6s %10s  %-12s %10s %9s %9s  %s\n", "problem", "side", "cells", "variant", "time_ms", "peak_MiB",
+           "Mcells/s", "result");
+}
+
+struct Variant {
+    string name;
+    function<long long()> run;
+};
+
+// Times every variant on its own copy of one input; the first is the reference.
+static void runGroup(const string& problem, int side, vector<Variant> variants) {
+    long long cells = (long long)side * side, reference = 0;
+    for (size_t k = 0; k < variants.size(); k++) {
+        long long result = 0;
+        Measurement m = measure(result, variants[k].run);
+        if (k == 0) reference = result;
+        bool same = result == reference;
+        if (!same) mismatches++;
+        printf("%-14s %6d %10lld  %-12s %10.3f %9.1f %9.2f  %lld%s\n", problem.c_str(), side, cells,
+               variants[k].name.c_str(), m.ms, m.peakKb / 1024.0, m.ms > 0 ? cells / (m.ms * 1000.0) : 0.0, result,
+               same ? "" : "  MISMATCH");
+        fflush(stdout);
+    }
+}
+
+static void benchOranges() {
+    for (int side : sweep({256, 1024, 2048})) {
+        // No empty cells, so every orange rots and the answer is the rounds
+        auto g = randomCells(side, {1, 2}, {99, 1}, benchSeed + side);
+        auto nested = make_shared<vector<vector<int>>>(g);
+        auto runtime = make_shared<Grid2D<uint8_t>>(Grid2D<uint8_t>::fromNested(g, 0));
+        auto bytes = make_shared<Grid2D<uint8_t>>(*runtime);
+        auto chars = make_shared<Grid2D<char>>(Grid2D<char>::fromNested(g, 0));
+        auto fresh = make_shared<BitGrid2D>(BitGrid2D::fromNested(g, [](int c) { return c == 1; }));
+        auto sliced = make_shared<p03::BitSlicedOranges>(g);
+        auto rotten = make_shared<vector<int>>();
+        for (int r = 0; r < side; r++)
+            for (int c = 0; c < side; c++)
+                if (g[r][c] == 2) rotten->push_back(fresh->index(r, c));
+        runGroup("oranges", side, {
+            {"nested", [=] { return (long long)p03::orangesRottingOptimal(*nested); }},
+            {"runtime", [=] { return (long long)p03::orangesRottingFlat(*runtime); }},
+            {"kernel_u8", [=] { return (long long)p03::orangesRottingKernel(*bytes); }},
+            {"kernel_char", [=] { return (long long)p03::orangesRottingKernel(*chars); }},
+            {"kernel_bit", [=] { return (long long)p03::orangesRottingBits(*fresh, *rotten); }},
+            {"bitsliced", [=] { return (long long)sliced->run(); }},
+        });
+    }
+}
+
+static void benchShortestPath() {
+    for (int side : sweep({256, 1024, 2048})) {
+        auto g = randomCells(side, {1, 0}, {80, 20}, benchSeed + side);
+        g[0][0] = g[side - 1][side - 1] = 1;
+        auto open = Grid2D<uint8_t>::fromNested(g, 0);
+        pair<int, int> source{0, 0}, destination{side - 1, side - 1};
+        runGroup("maze_path", side, {
+            {"nested", [&] { return (long long)p07::optimalBFS(g, side, side, source, destination); }},
+            {"kernel_u8", [&] { return (long long)p07::shortestPathKernel(open, source, destination); }},
+        });
+    }
+}
+
+static void benchMinEffort() {
+    for (int side : sweep({256, 1024, 2048})) {
+        vector<vector<int>> heights(side);
+        for (int r = 0; r < side; r++) heights[r] = randomArray(side, 0, 255, benchSeed + side * 31 + r);
+        runGroup("min_effort", side, {
+            {"nested", [&] { return (long long)p08::minEffortBucketQueue(heights); }},
+            {"kernel_int", [&] { return (long long)p08::minEffortGridKernel(heights); }},
+        });
+    }
+}
+
+// Order-sensitive checksum of a distance grid, so variants must agree cell
+// by cell and not just on a total.
+template <class Rows>
+static long long distanceChecksum(const Rows& rows) {
+    uint64_t h = 0;
+    for (const auto& row : rows)
+        for (int d : row) h = h * 1000003 + (uint64_t)(d + 1);
+    return (long long)h;
+}
+
+static void benchNearestOne() {
+    for (int side : sweep({256, 1024, 2048})) {
+        auto g = randomCells(side, {1, 0}, {2, 98}, benchSeed + side);
+        auto flat = make_shared<Grid2D<uint8_t>>(Grid2D<uint8_t>::fromNested(g, 0));
+        runGroup("nearest_one", side, {
+            {"nested", [&] { return distanceChecksum(p04::solveOptimal(g)); }},
+            {"runtime", [=] { return distanceChecksum(p04::solveFlat(*flat).toNested()); }},
+            {"sweep", [=] {
+                 return distanceChecksum(p04::distanceTransform(*flat, p04::DistanceMetric::Manhattan).toNested());
+             }},
+        });
+    }
+}
+
+// Cells holding newColor after the fill.
+static long long countColor(const Grid2D<int>& image, int color) {
+    long long n = 0;
+    for (int r = 0; r < image.rows(); r++)
+        for (int c = 0; c < image.cols(); c++) n += image.at(r, c) == color;
+    return n;
+}
+
+static void benchFloodFill() {
+    for (int side : sweep({256, 1024, 2048})) {
+        auto g = randomCells(side, {1, 0}, {65, 35}, benchSeed + side);
+        g[side / 2][side / 2] = 1;
+        auto nested = make_shared<vector<vector<int>>>(g);
+        auto runtime = make_shared<Grid2D<int>>(Grid2D<int>::fromNested(g, 0));
+        auto kernel = make_shared<Grid2D<int>>(*runtime);
+        int s = side / 2;
+        runGroup("flood_fill", side, {
+            {"nested", [=] {
+                 long long n = 0;
+                 for (const auto& row : p13::floodFillBruteForce(*nested, s, s, 2)) n += count(row.begin(), row.end(), 2);
+                 return n;
+             }},
+            {"runtime", [=] { p13::floodFillFlat(*runtime, s, s, 2); return countColor(*runtime, 2); }},
+            {"kernel_int", [=] { p13::floodFillKernel(*kernel, s, s, 2); return countColor(*kernel, 2); }},
+        });
+    }
+}
+
+static void benchSurrounded() {
+    for (int side : sweep({256, 1024, 2048})) {
+        auto g = randomCells(side, {'O', 'X'}, {55, 45}, benchSeed + side);
+        auto packed = make_shared<vector<vector<char>>>(convert<char>(g));
+        auto kernel = make_shared<Grid2D<char>>(Grid2D<char>::fromNested(*packed, 'X'));
+        auto open = [](const auto& rows) {
+            long long n = 0;
+            for (const auto& row : rows) n += count(row.begin(), row.end(), 'O');
+            return n;
+        };
+        runGroup("surrounded", side, {
+            {"bitpacked", [=] { p16::fillBitPacked(*packed); return open(*packed); }},
+            {"kernel_char", [=] { p16::fillKernel(*kernel); return open(kernel->toNested()); }},
+        });
+    }
+}
+
+static void benchEnclaves() {
+    for (int side : sweep({256, 1024, 2048})) {
+        auto g = randomCells(side, {1, 0}, {55, 45}, benchSeed + side);
+        auto runtime = make_shared<Grid2D<uint8_t>>(Grid2D<uint8_t>::fromNested(g, 0));
+        auto bytes = make_shared<Grid2D<uint8_t>>(*runtime);
+        auto bits = make_shared<BitGrid2D>(BitGrid2D::fromNested(g, [](int c) { return c == 1; }));
+        runGroup("enclaves", side, {
+            {"nested", [&] { return (long long)p17::Solution().numberOfEnclaves(g); }},
+            {"runtime", [=] { return (long long)p17::numberOfEnclavesFlat(*runtime); }},
+            {"kernel_u8", [=] { return (long long)p17::numberOfEnclavesKernel(*bytes, CellEquals<1>(), 2); }},
+            {"kernel_bit", [=] { return (long long)p17::numberOfEnclavesKernel(*bits, CellSet(), false); }},
+        });
+    }
+}
+
+static void benchIslands() {
+    for (int side : sweep({256, 1024, 2048})) {
+        auto chars = convert<char>(randomCells(side, {'1', '0'}, {40, 60}, benchSeed + side));
+        auto runtime = make_shared<Grid2D<char>>(Grid2D<char>::fromNested(chars, '0'));
+        auto kernel = make_shared<Grid2D<char>>(*runtime);
+        auto bits = make_shared<BitGrid2D>(BitGrid2D::fromNested(chars, [](char c) { return c == '1'; }));
+        runGroup("islands", side, {
+            {"nested", [&] { return (long long)p20::Solution().numIslands(chars); }},
+            {"runtime", [=] { return (long long)p20::numIslandsFlat(*runtime); }},
+            {"kernel_char", [=] { return (long long)p20::numIslandsKernel(*kernel, CellEquals<'1'>(), '2'); }},
+            {"kernel_bit", [=] { return (long long)p20::numIslandsKernel(*bits, CellSet(), false); }},
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "quick") quickMode = true;
+        else benchSeed = stoull(arg);
+    }
+
+    printHeader();
+    benchOranges();
+    benchShortestPath();
+    benchMinEffort();
+    benchNearestOne();
+    benchFloodFill();
+    benchSurrounded();
+    benchEnclaves();
+    benchIslands();
+
+    if (mismatches) printf("\n%d variants disagreed with the first of their group\n", mismatches);
+    return mismatches ? 1 : 0;
+}
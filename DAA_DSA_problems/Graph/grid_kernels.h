@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "grid2d.h"
+
+// Grid traversals with the connectivity, the cell type and the passable
+// test fixed at compile time, for the grid solutions (prob_03, prob_07,
+// prob_08, prob_13, prob_16, prob_17, prob_20).
+//
+// The neighbour offsets of GridNeighbors<4> / <8> are written out one call
+// each, so a neighbour loop is straight-line code with no offset array. The
+// passable test is a functor type (CellEquals<'1'>, CellSet, or a lambda),
+// inlined into that code. Cells are read and written through cellAt / setCell,
+// which exist for Grid2D<T> (char, uint8_t, int cells) and BitGrid2D (one
+// bit per cell); a kernel instantiated for each compiles to a loop over that
+// cell type alone. Both grids share the sentinel-border layout of Grid2D, and
+// the border must fail the passable test.
+
+template <int Connectivity>
+struct GridNeighbors;
+
+template <>
+struct GridNeighbors<4> {
+    // Calls visit(delta) for the up, right, down and left neighbours.
+    template <class Visit>
+    static void forEach(int stride, Visit&& visit) {
+        visit(-stride);
+        visit(1);
+        visit(stride);
+        visit(-1);
+    }
+};
+
+template <>
+struct GridNeighbors<8> {
+    template <class Visit>
+    static void forEach(int stride, Visit&& visit) {
+        visit(-stride - 1);
+        visit(-stride);
+        visit(-stride + 1);
+        visit(-1);
+        visit(1);
+        visit(stride - 1);
+        visit(stride);
+        visit(stride + 1);
+    }
+};
+
+// Passable when the cell holds V.
+template <auto V>
+struct CellEquals {
+    template <class T>
+    constexpr bool operator()(T cell) const { return cell == static_cast<T>(V); }
+};
+
+// Passable when the bit is set (BitGrid2D).
+struct CellSet {
+    constexpr bool operator()(bool cell) const { return cell; }
+};
+
+// One bit per cell in Grid2D's layout, border bits clear: (r, c) is bit
+// index(r, c) = (r + 1) * stride + c + 1 of a flat word array.
+class BitGrid2D {
+    int nRows = 0, nCols = 0, rowStride = 2;
+    std::vector<uint64_t> words;
+
+public:
+    BitGrid2D() = default;
+
+    BitGrid2D(int rows, int cols)
+        : nRows(rows), nCols(cols), rowStride(cols + 2),
+          words((static_cast<std::size_t>(rows + 2) * (cols + 2) + 63) / 64, 0) {}
+
+    // Sets the cells of a nested-vector grid for which isSet(cell) holds.
+    template <class U, class IsSet>
+    static BitGrid2D fromNested(const std::vector<std::vector<U>>& grid, IsSet isSet) {
+        int rows = static_cast<int>(grid.size());
+        BitGrid2D g(rows, rows ? static_cast<int>(grid[0].size()) : 0);
+        for (int r = 0; r < rows; r++)
+            for (int c = 0; c < g.nCols; c++)
+                if (isSet(grid[r][c])) g.set(g.index(r, c));
+        return g;
+    }
+
+    int rows() const { return nRows; }
+    int cols() const { return nCols; }
+    int stride() const { return rowStride; }
+    int index(int r, int c) const { return (r + 1) * rowStride + c + 1; }
+
+    bool get(int i) const { return (words[static_cast<unsigned>(i) >> 6] >> (i & 63)) & 1; }
+    void set(int i) { words[static_cast<unsigned>(i) >> 6] |= uint64_t(1) << (i & 63); }
+    void clear(int i) { words[static_cast<unsigned>(i) >> 6] &= ~(uint64_t(1) << (i & 63)); }
+
+    // Number of set cells.
+    long long count() const {
+        long long n = 0;
+        for (uint64_t w : words) n += __builtin_popcountll(w);
+        return n;
+    }
+};
+
+template <class T>
+inline T cellAt(const Grid2D<T>& grid, int i) { return grid[i]; }
+template <class T, class V>
+inline void setCell(Grid2D<T>& grid, int i, V value) { grid[i] = static_cast<T>(value); }
+
+inline bool cellAt(const BitGrid2D& grid, int i) { return grid.get(i); }
+inline void setCell(BitGrid2D& grid, int i, bool value) {
+    if (value) grid.set(i);
+    else grid.clear(i);
+}
+
+struct GridFloodResult {
+    int rounds = 0;          // rounds that reached a new cell
+    long long visited = 0;   // cells marked, seeds excluded
+    bool reached = false;    // target was marked
+};
+
+// Level-synchronous multi-source flood: every passable neighbour of the
+// frontier is overwritten with mark (which must not be passable) and joins
+// the next frontier. Seeds are expected to be marked already. With a target
+// index the flood stops in the round that marks it, so rounds is then the
+// BFS distance from the seeds.
+// Time Complexity: O(cells visited * Connectivity)
+// Space Complexity: O(cells visited) for the frontiers
+template <int Connectivity, class Grid, class Passable, class Mark>
+GridFloodResult gridFlood(Grid& grid, std::vector<int> frontier, Passable passable, Mark mark, int target = -1) {
+    GridFloodResult res;
+    const int stride = grid.stride();
+    std::vector<int> next;
+    while (!frontier.empty()) {
+        next.clear();
+        for (int from : frontier) {
+            GridNeighbors<Connectivity>::forEach(stride, [&](int delta) {
+                int to = from + delta;
+                if (!passable(cellAt(grid, to))) return;
+                setCell(grid, to, mark);
+                next.push_back(to);
+                res.reached |= to == target;
+            });
+        }
+        if (next.empty()) break;
+        res.rounds++;
+        res.visited += static_cast<long long>(next.size());
+        if (res.reached) break;
+        frontier.swap(next);
+    }
+    return res;
+}
+
+// Marks every passable cell on the outer ring of the grid and returns them,
+// as the seeds of a flood from the boundary.
+// Time Complexity: O(R + C)
+// Space Complexity: O(R + C)
+template <class Grid, class Passable, class Mark>
+std::vector<int> gridBoundarySeeds(Grid& grid, Passable passable, Mark mark) {
+    std::vector<int> seeds;
+    int n = grid.rows(), m = grid.cols();
+    auto seed = [&](int r, int c) {
+        int i = grid.index(r, c);
+        if (!passable(cellAt(grid, i))) return;
+        setCell(grid, i, mark);
+        seeds.push_back(i);
+    };
+    for (int c = 0; c < m; c++) {
+        seed(0, c);
+        if (n > 1) seed(n - 1, c);
+    }
+    for (int r = 1; r + 1 < n; r++) {
+        seed(r, 0);
+        if (m > 1) seed(r, m - 1);
+    }
+    return seeds;
+}
+
+// Number of connected regions of passable cells; every region ends up
+// overwritten with mark.
+// Time Complexity: O(R * C * Connectivity)
+// Space Complexity: O(size of the largest region)
+template <int Connectivity, class Grid, class Passable, class Mark>
+int gridCountComponents(Grid& grid, Passable passable, Mark mark) {
+    int count = 0;
+    for (int r = 0; r < grid.rows(); r++) {
+        for (int i = grid.index(r, 0), end = i + grid.cols(); i < end; i++) {
+            if (!passable(cellAt(grid, i))) continue;
+            count++;
+            setCell(grid, i, mark);
+            gridFlood<Connectivity>(grid, {i}, passable, mark);
+        }
+    }
+    return count;
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../common/flat_hash_map.h"
+
+// Course catalog that stays schedulable-or-not under prerequisite inserts and
+// removals, for the course-schedule solutions (Array/prob_24, Graph/prob_24).
+//
+// The structure keeps a topological order of an acyclic subgraph H of the
+// catalog, updated with the Pearce-Kelly dynamic topological sort: an edge
+// that agrees with the current order costs O(1); otherwise only the nodes
+// whose positions lie between the edge's ends are searched and reshuffled. An
+// edge that would close a cycle is kept aside as "blocked" instead of going
+// into H, so
+//   canFinish()  <=>  no blocked edges,
+// which is O(1). Removing an edge from H cannot create a cycle, so the order
+// stays valid; after a removal the blocked edges are retried, because the
+// removed edge may have been part of every cycle they closed.
+//
+// Time Complexity: O(1) for order-preserving inserts and canFinish, otherwise
+//                  O(|affected region| log) per insert (Pearce-Kelly)
+// Space Complexity: O(N + E)
+class IncrementalSchedule {
+    std::vector<int> ord, nodeAt;         // position of each course, and inverse
+    std::vector<std::vector<int>> out, in; // edges of H, prerequisite -> course
+    std::vector<int> indeg;                // in-degree over all distinct edges
+    FlatHashMap<uint64_t, int> multiplicity; // (pre, course) -> copies added
+    std::vector<std::pair<int, int>> blocked;
+    std::vector<char> mark;
+    std::vector<int> fwd, bwd, stack;
+
+    static uint64_t key(int pre, int course) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(pre)) << 32 | static_cast<uint32_t>(course);
+    }
+
+    static void eraseOne(std::vector<int>& list, int v) {
+        auto it = std::find(list.begin(), list.end(), v);
+        *it = list.back();
+        list.pop_back();
+    }
+
+    // Collects the nodes reachable from start with ord <= ub into fwd.
+    // Returns false (with marks cleared) if target is among them.
+    bool searchForward(int start, int target, int ub) {
+        fwd.clear();
+        stack.assign(1, start);
+        mark[start] = 1;
+        while (!stack.empty()) {
+            int u = stack.back();
+            stack.pop_back();
+            fwd.push_back(u);
+            for (int v : out[u]) {
+                if (v == target) {
+                    for (int w : fwd) mark[w] = 0;
+                    for (int w : stack) mark[w] = 0;
+                    return false;
+                }
+                if (!mark[v] && ord[v] < ub) {
+                    mark[v] = 1;
+                    stack.push_back(v);
+                }
+            }
+        }
+        return true;
+    }
+
+    // Collects the nodes that reach start with ord > lb into bwd.
+    void searchBackward(int start, int lb) {
+        bwd.clear();
+        stack.assign(1, start);
+        mark[start] = 1;
+        while (!stack.empty()) {
+            int u = stack.back();
+            stack.pop_back();
+            bwd.push_back(u);
+            for (int v : in[u]) {
+                if (!mark[v] && ord[v] > lb) {
+                    mark[v] = 1;
+                    stack.push_back(v);
+                }
+            }
+        }
+    }
+
+    // Tries to put pre -> course into H. Returns false if it closes a cycle.
+    bool insertIntoOrder(int pre, int course) {
+        if (pre == course) return false;
+        int lb = ord[course], ub = ord[pre];
+        if (ub < lb) {
+            out[pre].push_back(course);
+            in[course].push_back(pre);
+            return true;
+        }
+        if (!searchForward(course, pre, ub)) return false;
+        searchBackward(pre, lb);
+
+        // Everything in bwd must now precede everything in fwd; reuse the
+        // union of their old positions, in sorted order.
+        auto byOrd = [&](int a, int b) { return ord[a] < ord[b]; };
+        std::sort(fwd.begin(), fwd.end(), byOrd);
+        std::sort(bwd.begin(), bwd.end(), byOrd);
+        std::vector<int> slots;
+        slots.reserve(fwd.size() + bwd.size());
+        for (int v : bwd) slots.push_back(ord[v]);
+        for (int v : fwd) slots.push_back(ord[v]);
+        std::sort(slots.begin(), slots.end());
+        std::size_t i = 0;
+        for (int v : bwd) {
+            mark[v] = 0;
+            ord[v] = slots[i++];
+            nodeAt[ord[v]] = v;
+        }
+        for (int v : fwd) {
+            mark[v] = 0;
+            ord[v] = slots[i++];
+            nodeAt[ord[v]] = v;
+        }
+        out[pre].push_back(course);
+        in[course].push_back(pre);
+        return true;
+    }
+
+    void retryBlocked() {
+        std::size_t keep = 0;
+        for (std::size_t i = 0; i < blocked.size(); i++) {
+            if (!insertIntoOrder(blocked[i].first, blocked[i].second)) blocked[keep++] = blocked[i];
+        }
+        blocked.resize(keep);
+    }
+
+public:
+    explicit IncrementalSchedule(int N)
+        : ord(N), nodeAt(N), out(N), in(N), indeg(N, 0), mark(N, 0) {
+        for (int i = 0; i < N; i++) ord[i] = nodeAt[i] = i;
+    }
+
+    // {course, prerequisite}, the pair layout findOrderOptimal takes.
+    void addPrerequisite(int course, int pre) {
+        int& copies = multiplicity[key(pre, course)];
+        if (copies++ > 0) return;
+        indeg[course]++;
+        if (!insertIntoOrder(pre, course)) blocked.push_back({pre, course});
+    }
+
+    // Returns false if the pair was not present.
+    bool removePrerequisite(int course, int pre) {
+        int* copies = multiplicity.find(key(pre, course));
+        if (!copies || *copies == 0) return false;
+        if (--*copies > 0) return true;
+        indeg[course]--;
+        auto it = std::find(blocked.begin(), blocked.end(), std::make_pair(pre, course));
+        if (it != blocked.end()) {
+            *it = blocked.back();
+            blocked.pop_back();
+        } else {
+            eraseOne(out[pre], course);
+            eraseOne(in[course], pre);
+            if (!blocked.empty()) retryBlocked();
+        }
+        return true;
+    }
+
+    bool canFinish() const { return blocked.empty(); }
+    int inDegree(int course) const { return indeg[course]; }
+
+    // A valid course order, or empty while the catalog has a cycle.
+    std::vector<int> order() const {
+        if (!canFinish()) return {};
+        return nodeAt;
+    }
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "incremental_schedule.h"
+
+// Benchmark for the course-schedule solutions (Array/prob_24, Graph/prob_24):
+// random adds and removes on a catalog of N courses; after every change the
+// catalog is asked whether it can still be scheduled, once through
+// IncrementalSchedule and once by rerunning findOrder from scratch, where
+// findOrder(N, pairs) returns an empty order on a cycle. The two answers are
+// compared change by change.
+//
+// Most added edges point forward (lower course first); one add in backEvery
+// points backward and may close a cycle. With the default of 4 at N = 1000
+// about half the states are unschedulable, so IncrementalSchedule's
+// blocked-edge path and the retries after removals are compared too.
+template <class FindOrder>
+void benchmarkIncrementalSchedule(int N, int changes, FindOrder findOrder, int backEvery = 4) {
+    std::mt19937 rng(42);
+    std::vector<std::pair<int, int>> live; // current prerequisites
+    std::vector<std::pair<int, std::pair<int, int>>> ops; // +1 add / -1 remove
+    for (int i = 0; i < changes; i++) {
+        if (!live.empty() && rng() % 3 == 0) {
+            int k = rng() % live.size();
+            ops.push_back({-1, live[k]});
+            live[k] = live.back();
+            live.pop_back();
+        } else {
+            int a = rng() % N, b = rng() % N;
+            if (a == b) b = (b + 1) % N;
+            // {course, prerequisite}: forward when the prerequisite is lower
+            bool back = rng() % backEvery == 0;
+            if ((a < b) != back) std::swap(a, b);
+            ops.push_back({+1, {a, b}});
+            live.push_back({a, b});
+        }
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    IncrementalSchedule inc(N);
+    std::vector<char> incremental;
+    incremental.reserve(ops.size());
+    for (auto& op : ops) {
+        if (op.first > 0) inc.addPrerequisite(op.second.first, op.second.second);
+        else inc.removePrerequisite(op.second.first, op.second.second);
+        incremental.push_back(inc.canFinish());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::vector<std::pair<int, int>> current;
+    std::vector<char> rebuild;
+    rebuild.reserve(ops.size());
+    for (auto& op : ops) {
+        if (op.first > 0) {
+            current.push_back(op.second);
+        } else {
+            auto it = std::find(current.begin(), current.end(), op.second);
+            *it = current.back();
+            current.pop_back();
+        }
+        rebuild.push_back(!findOrder(N, current).empty());
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    int schedulable = 0, mismatches = 0;
+    for (std::size_t i = 0; i < ops.size(); i++) {
+        schedulable += rebuild[i];
+        mismatches += incremental[i] != rebuild[i];
+    }
+    std::cout << "N = " << N << ", " << changes << " changes: incremental "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, rebuild "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms ("
+              << schedulable << " of " << ops.size() << " states schedulable, "
+              << mismatches << " mismatches)" << std::endl;
+}
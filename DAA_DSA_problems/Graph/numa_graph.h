@@ -0,0 +1,380 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "csr_graph.h"
+
+// CSR graph storage split by vertex range across NUMA nodes, on huge pages,
+// for the partitioned traversals of prob_01 (BFS) and prob_43 (SCC).
+//
+// Partition p owns the vertices [p * chunk, (p + 1) * chunk) and keeps its
+// offsets and out-neighbour lists (and, if asked, its in-neighbour lists)
+// in its own arrays. Every array is an anonymous mapping on 1 GiB or 2 MiB
+// hugetlbfs pages when the system has them reserved, otherwise on
+// transparent huge pages (madvise), otherwise on normal pages; it is bound
+// (preferred, so a full node spills instead of failing) to its partition's
+// node and first written by a thread pinned to that node. Traversals run
+// one worker per partition, pinned the same way, so a worker walks only its
+// own node's memory; work for a vertex another partition owns is handed to
+// that partition's queue.
+//
+// The topology comes from /sys/devices/system/node. DAA_NUMA_NODES=k
+// instead splits the CPUs into k simulated nodes, to exercise the
+// partitioned code paths on a single-node machine; memory is not bound
+// then, as those nodes do not exist.
+// Linux only: mbind and the affinity calls are raw syscalls and glibc
+// extensions, with no libnuma dependency.
+
+class NumaTopology {
+    std::vector<std::vector<int>> cpus; // per node
+    std::vector<int> nodeIds;           // kernel node number of each entry
+    bool simulated = false;
+
+    // "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}
+    static std::vector<int> parseCpuList(const std::string& list) {
+        std::vector<int> out;
+        size_t pos = 0;
+        while (pos < list.size()) {
+            size_t comma = list.find(',', pos);
+            std::string item = list.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+            size_t dash = item.find('-');
+            try {
+                int a = std::stoi(item), b = dash == std::string::npos ? a : std::stoi(item.substr(dash + 1));
+                for (int c = a; c <= b; c++) out.push_back(c);
+            } catch (const std::exception&) {
+            }
+            if (comma == std::string::npos) break;
+            pos = comma + 1;
+        }
+        return out;
+    }
+
+public:
+    // One node holding all the CPUs.
+    NumaTopology() {
+        cpus.assign(1, {});
+        nodeIds.assign(1, 0);
+        int n = std::max(1, (int)std::thread::hardware_concurrency());
+        for (int c = 0; c < n; c++) cpus[0].push_back(c);
+    }
+
+    // The machine's nodes, or the simulated split of $DAA_NUMA_NODES.
+    static NumaTopology detect() {
+        NumaTopology t;
+        std::vector<std::vector<int>> found;
+        std::vector<int> ids;
+        for (int node = 0; node < 1024; node++) {
+            std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            if (!in) {
+                if (node > 64 && found.empty()) break;
+                continue;
+            }
+            std::string list;
+            std::getline(in, list);
+            std::vector<int> c = parseCpuList(list);
+            if (c.empty()) continue; // memory-only node
+            found.push_back(c);
+            ids.push_back(node);
+        }
+        if (!found.empty()) {
+            t.cpus = found;
+            t.nodeIds = ids;
+        }
+        if (const char* sim = std::getenv("DAA_NUMA_NODES")) {
+            int k = std::atoi(sim);
+            if (k > 0) t = simulate(t, k);
+        }
+        return t;
+    }
+
+    // The CPUs of base dealt out round-robin over k made-up nodes.
+    static NumaTopology simulate(const NumaTopology& base, int k) {
+        NumaTopology t;
+        t.simulated = true;
+        t.cpus.assign(k, {});
+        t.nodeIds.assign(k, -1);
+        std::vector<int> all;
+        for (const auto& c : base.cpus) all.insert(all.end(), c.begin(), c.end());
+        for (size_t i = 0; i < all.size(); i++) t.cpus[i % k].push_back(all[i]);
+        for (int n = 0; n < k; n++)
+            if (t.cpus[n].empty()) t.cpus[n].push_back(all[n % all.size()]);
+        return t;
+    }
+
+    int nodes() const { return (int)cpus.size(); }
+    const std::vector<int>& cpusOf(int node) const { return cpus[node]; }
+    bool isSimulated() const { return simulated; }
+    // Kernel node number to bind memory to, -1 for a simulated node.
+    int memoryNode(int node) const { return simulated ? -1 : nodeIds[node]; }
+
+    // Node of the CPU the caller is running on (0 if unknown).
+    int currentNode() const {
+        int cpu = sched_getcpu();
+        for (int n = 0; n < nodes(); n++)
+            if (std::find(cpus[n].begin(), cpus[n].end(), cpu) != cpus[n].end()) return n;
+        return 0;
+    }
+
+    // Restricts the calling thread to the CPUs of node; false if the
+    // system refused.
+    bool pinCurrentThread(int node) const {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int c : cpus[node])
+            if (c < CPU_SETSIZE) CPU_SET(c, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof set, &set) == 0;
+    }
+};
+
+enum class PageKind { Normal, TransparentHuge, Huge2M, Huge1G };
+
+inline const char* pageKindName(PageKind k) {
+    switch (k) {
+        case PageKind::Huge1G: return "hugetlb 1GiB";
+        case PageKind::Huge2M: return "hugetlb 2MiB";
+        case PageKind::TransparentHuge: return "transparent huge";
+        default: return "normal";
+    }
+}
+
+// Fixed-size array in its own anonymous mapping, on the largest pages
+// available (see the top of the file). Pages are not touched here, so they
+// land where they are first written.
+template <class T>
+class HugePageArray {
+    T* ptr = nullptr;
+    std::size_t count = 0, mapped = 0;
+    PageKind kind = PageKind::Normal;
+
+    static constexpr std::size_t MB2 = std::size_t(2) << 20, GB1 = std::size_t(1) << 30;
+
+    static std::size_t roundUp(std::size_t n, std::size_t to) { return (n + to - 1) / to * to; }
+
+    void* tryMap(std::size_t bytes, int extraFlags) {
+        void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extraFlags, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+
+    void release() {
+        if (ptr) munmap(ptr, mapped);
+        ptr = nullptr;
+        count = mapped = 0;
+    }
+
+public:
+    HugePageArray() = default;
+
+    // memoryNode < 0: no binding. Throws bad_alloc if even normal pages
+    // cannot be mapped.
+    HugePageArray(std::size_t n, int memoryNode) : count(n) {
+        std::size_t bytes = std::max<std::size_t>(1, n * sizeof(T));
+        void* p = nullptr;
+#ifdef MAP_HUGETLB
+        if (bytes >= GB1 && (p = tryMap(roundUp(bytes, GB1), MAP_HUGETLB | (30 << MAP_HUGE_SHIFT)))) {
+            mapped = roundUp(bytes, GB1);
+            kind = PageKind::Huge1G;
+        } else if (bytes >= MB2 && (p = tryMap(roundUp(bytes, MB2), MAP_HUGETLB))) {
+            mapped = roundUp(bytes, MB2);
+            kind = PageKind::Huge2M;
+        }
+#endif
+        if (!p) {
+            mapped = roundUp(bytes, 4096);
+            p = tryMap(mapped, 0);
+            if (!p) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+            if (bytes >= MB2 && madvise(p, mapped, MADV_HUGEPAGE) == 0) kind = PageKind::TransparentHuge;
+#endif
+        }
+        ptr = static_cast<T*>(p);
+        if (memoryNode >= 0 && memoryNode < 64) {
+            unsigned long mask = 1UL << memoryNode;
+            syscall(SYS_mbind, p, mapped, MPOL_PREFERRED, &mask, sizeof mask * 8, 0); // a hint: failure is fine
+        }
+    }
+
+    HugePageArray(HugePageArray&& o) noexcept : ptr(o.ptr), count(o.count), mapped(o.mapped), kind(o.kind) {
+        o.ptr = nullptr;
+        o.count = o.mapped = 0;
+    }
+    HugePageArray& operator=(HugePageArray&& o) noexcept {
+        if (this != &o) {
+            release();
+            std::swap(ptr, o.ptr);
+            std::swap(count, o.count);
+            std::swap(mapped, o.mapped);
+            kind = o.kind;
+        }
+        return *this;
+    }
+    HugePageArray(const HugePageArray&) = delete;
+    HugePageArray& operator=(const HugePageArray&) = delete;
+    ~HugePageArray() { release(); }
+
+    T* data() { return ptr; }
+    const T* data() const { return ptr; }
+    std::size_t size() const { return count; }
+    T& operator[](std::size_t i) { return ptr[i]; }
+    const T& operator[](std::size_t i) const { return ptr[i]; }
+    PageKind pages() const { return kind; }
+};
+
+// One partition's half of the CSR: offsets[u - lo] .. offsets[u - lo + 1]
+// index its own neighbors array, which holds global vertex ids.
+struct GraphPartition {
+    int lo = 0, hi = 0, node = 0;
+    HugePageArray<int> offsets, neighbors;
+
+    CsrGraph::Range adj(int u) const {
+        const int* base = neighbors.data();
+        return {base + offsets[u - lo], base + offsets[u - lo + 1]};
+    }
+};
+
+// Sense-reversing barrier for the partition workers.
+class PartitionBarrier {
+    std::mutex lock;
+    std::condition_variable released;
+    int parties, waiting = 0;
+    long long generation = 0;
+
+public:
+    explicit PartitionBarrier(int parties) : parties(parties) {}
+
+    void arriveAndWait() {
+        std::unique_lock<std::mutex> guard(lock);
+        long long gen = generation;
+        if (++waiting == parties) {
+            waiting = 0;
+            generation++;
+            released.notify_all();
+            return;
+        }
+        released.wait(guard, [&] { return generation != gen; });
+    }
+};
+
+// Where a traversal's memory accesses went: an access is local when the
+// data is on the node of the worker touching it.
+struct NumaTraversalStats {
+    int partitions = 0, nodes = 0;
+    PageKind pages = PageKind::Normal;
+    long long localAccesses = 0, remoteAccesses = 0;
+
+    double remoteRatio() const {
+        long long all = localAccesses + remoteAccesses;
+        return all ? (double)remoteAccesses / all : 0.0;
+    }
+};
+
+class NumaPartitionedGraph {
+    NumaTopology topo;
+    int nV = 0, nParts = 1, chunk = 1;
+    long long nE = 0;
+    std::vector<GraphPartition> out, in;
+
+    std::vector<GraphPartition> split(const CsrGraph& g) {
+        std::vector<GraphPartition> parts(nParts);
+        for (size_t p = 0; p < parts.size(); p++) {
+            GraphPartition& part = parts[p];
+            part.lo = std::min(nV, (int)p * chunk);
+            part.hi = std::min(nV, part.lo + chunk);
+            part.node = (int)(p * topo.nodes() / parts.size());
+            int mem = topo.memoryNode(part.node);
+            part.offsets = HugePageArray<int>(part.hi - part.lo + 1, mem);
+            part.neighbors = HugePageArray<int>(g.offsets[part.hi] - g.offsets[part.lo], mem);
+        }
+        // First touch from the owning node
+        runPinned(parts, [&](int p) {
+            GraphPartition& part = parts[p];
+            int base = g.offsets[part.lo];
+            for (int u = part.lo; u <= part.hi; u++) part.offsets[u - part.lo] = g.offsets[u] - base;
+            std::copy(g.neighbors.begin() + base, g.neighbors.begin() + g.offsets[part.hi], part.neighbors.data());
+        });
+        return parts;
+    }
+
+    template <class Fn>
+    void runPinned(const std::vector<GraphPartition>& parts, Fn&& fn) const {
+        std::vector<std::thread> workers;
+        for (int p = 1; p < (int)parts.size(); p++) {
+            workers.emplace_back([&, p] {
+                topo.pinCurrentThread(parts[p].node);
+                fn(p);
+            });
+        }
+        // Partition 0 on a pinned helper too, so the caller keeps its affinity
+        std::thread first([&] {
+            topo.pinCurrentThread(parts[0].node);
+            fn(0);
+        });
+        first.join();
+        for (auto& w : workers) w.join();
+    }
+
+public:
+    // parts <= 0: one partition per node. withTranspose also stores the
+    // in-neighbour lists, partitioned the same way.
+    // Time Complexity: O(V + E), the copy done by one pinned thread per partition
+    // Space Complexity: O(V + E), twice with the transpose
+    explicit NumaPartitionedGraph(const CsrGraph& g, int parts = 0, bool withTranspose = false,
+                                  NumaTopology topology = NumaTopology::detect())
+        : topo(std::move(topology)), nV(g.V), nE(g.numEdges()) {
+        nParts = std::max(1, std::min(parts > 0 ? parts : topo.nodes(), std::max(1, nV)));
+        chunk = std::max(1, (nV + nParts - 1) / nParts);
+        out = split(g);
+        if (withTranspose) in = split(g.transpose());
+    }
+
+    int V() const { return nV; }
+    long long numEdges() const { return nE; }
+    int partitions() const { return (int)out.size(); }
+    bool hasTranspose() const { return !in.empty(); }
+    const NumaTopology& topology() const { return topo; }
+
+    int owner(int v) const { return v / chunk; }
+    const GraphPartition& partition(int p) const { return out[p]; }
+    const GraphPartition& transposed(int p) const { return in[p]; }
+
+    CsrGraph::Range adj(int u) const { return out[owner(u)].adj(u); }
+    CsrGraph::Range adjT(int u) const { return in[owner(u)].adj(u); }
+
+    // Page size of the neighbour arrays (the largest kind any got).
+    PageKind pages() const {
+        PageKind k = PageKind::Normal;
+        for (const auto& p : out) k = std::max(k, p.neighbors.pages());
+        return k;
+    }
+
+    NumaTraversalStats emptyStats() const {
+        NumaTraversalStats s;
+        s.partitions = partitions();
+        s.nodes = topo.nodes();
+        s.pages = pages();
+        return s;
+    }
+
+    // Calls fn(p) for every partition at once, each on its own thread
+    // pinned to the partition's node.
+    template <class Fn>
+    void runPinned(Fn&& fn) const {
+        runPinned(out, fn);
+    }
+};
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Addressable min-priority queues for Dijkstra-style algorithms.
+//
+// Both queues hold each vertex at most once and support lowering the key of a
+// vertex that is already queued, so they never grow past V entries (the
+// lazy-deletion priority_queue holds up to E stale entries instead).
+//
+// Common interface, used as a template parameter by the Dijkstra variants:
+//   Queue(int n)                  vertices are 0..n-1
+//   bool empty() const
+//   void pushOrDecrease(v, key)   insert v, or lower its key if queued
+//   std::pair<Key, int> popMin()  remove and return {key, vertex}
+//   void clear()                  empty the queue in O(size)
+
+// Indexed D-ary heap. D = 4 keeps the tree shallow while the children of a node
+// still share one cache line.
+// Time Complexity: O(log_D V) push/decrease, O(D log_D V) pop
+// Space Complexity: O(V)
+template <int D = 4, class Key = int>
+class IndexedDaryHeap {
+    std::vector<int> heap; // heap[i] = vertex stored at slot i
+    std::vector<int> pos;  // pos[v] = slot of v, or -1 if not queued
+    std::vector<Key> key;  // key[v] = current priority of v
+
+    void place(int slot, int v) {
+        heap[slot] = v;
+        pos[v] = slot;
+    }
+
+    void siftUp(int slot) {
+        int v = heap[slot];
+        while (slot > 0) {
+            int parent = (slot - 1) / D;
+            if (key[heap[parent]] <= key[v]) break;
+            place(slot, heap[parent]);
+            slot = parent;
+        }
+        place(slot, v);
+    }
+
+    void siftDown(int slot) {
+        int n = static_cast<int>(heap.size());
+        int v = heap[slot];
+        while (true) {
+            int first = slot * D + 1;
+            if (first >= n) break;
+            int last = first + D < n ? first + D : n;
+            int best = first;
+            for (int c = first + 1; c < last; c++) {
+                if (key[heap[c]] < key[heap[best]]) best = c;
+            }
+            if (key[heap[best]] >= key[v]) break;
+            place(slot, heap[best]);
+            slot = best;
+        }
+        place(slot, v);
+    }
+
+public:
+    explicit IndexedDaryHeap(int n) : pos(n, -1), key(n) {
+        heap.reserve(n);
+    }
+
+    bool empty() const { return heap.empty(); }
+    int size() const { return static_cast<int>(heap.size()); }
+    bool contains(int v) const { return pos[v] >= 0; }
+
+    // Drops whatever is still queued in O(size), so one heap can be reused
+    // across queries that stop before the queue drains.
+    void clear() {
+        for (int v : heap) pos[v] = -1;
+        heap.clear();
+    }
+
+    void pushOrDecrease(int v, Key k) {
+        if (pos[v] < 0) {
+            key[v] = k;
+            heap.push_back(v);
+            pos[v] = static_cast<int>(heap.size()) - 1;
+            siftUp(pos[v]);
+        } else if (k < key[v]) {
+            key[v] = k;
+            siftUp(pos[v]);
+        }
+    }
+
+    std::pair<Key, int> popMin() {
+        int v = heap[0];
+        pos[v] = -1;
+        int lastV = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            place(0, lastV);
+            siftDown(0);
+        }
+        return {key[v], v};
+    }
+};
+
+// Monotone radix heap for non-negative integer keys. Popped keys never
+// decrease (true for Dijkstra with non-negative weights), so a vertex lives in
+// bucket bitWidth(key ^ lastPopped); only the lowest non-empty bucket is ever
+// redistributed. Buckets are intrusive doubly linked lists over vertex ids,
+// which makes decrease-key an O(1) unlink/relink.
+// Time Complexity: O(1) push/decrease, amortized O(log C) pop (C = max key)
+// Space Complexity: O(V)
+class IndexedRadixHeap {
+    static const int BUCKETS = 33; // bucket 0 plus one per bit of a 32-bit key
+
+    std::vector<uint32_t> key;
+    std::vector<int> next, prev, bucketOf; // bucketOf[v] = -1 if not queued
+    int head[BUCKETS];
+    uint32_t lastPopped = 0;
+    int count = 0;
+
+    static int bitWidth(uint32_t x) {
+        return x == 0 ? 0 : 32 - __builtin_clz(x);
+    }
+
+    void link(int v, int b) {
+        bucketOf[v] = b;
+        prev[v] = -1;
+        next[v] = head[b];
+        if (head[b] >= 0) prev[head[b]] = v;
+        head[b] = v;
+    }
+
+    void unlink(int v) {
+        int b = bucketOf[v];
+        if (prev[v] >= 0) next[prev[v]] = next[v];
+        else head[b] = next[v];
+        if (next[v] >= 0) prev[next[v]] = prev[v];
+        bucketOf[v] = -1;
+    }
+
+public:
+    explicit IndexedRadixHeap(int n) : key(n), next(n), prev(n), bucketOf(n, -1) {
+        for (int b = 0; b < BUCKETS; b++) head[b] = -1;
+    }
+
+    bool empty() const { return count == 0; }
+    int size() const { return count; }
+    bool contains(int v) const { return bucketOf[v] >= 0; }
+
+    void clear() {
+        for (int b = 0; b < BUCKETS; b++) {
+            for (int v = head[b]; v >= 0; v = next[v]) bucketOf[v] = -1;
+            head[b] = -1;
+        }
+        lastPopped = 0;
+        count = 0;
+    }
+
+    void pushOrDecrease(int v, int k) {
+        uint32_t uk = static_cast<uint32_t>(k);
+        if (bucketOf[v] >= 0) {
+            if (uk >= key[v]) return;
+            unlink(v);
+        } else {
+            count++;
+        }
+        key[v] = uk;
+        link(v, bitWidth(uk ^ lastPopped));
+    }
+
+    std::pair<int, int> popMin() {
+        if (head[0] < 0) {
+            int b = 1;
+            while (head[b] < 0) b++;
+
+            // The new minimum is in bucket b; everything there moves down.
+            uint32_t minKey = UINT32_MAX;
+            for (int v = head[b]; v >= 0; v = next[v]) {
+                if (key[v] < minKey) minKey = key[v];
+            }
+            lastPopped = minKey;
+            int v = head[b];
+            head[b] = -1;
+            while (v >= 0) {
+                int nxt = next[v];
+                link(v, bitWidth(key[v] ^ lastPopped));
+                v = nxt;
+            }
+        }
+        int v = head[0];
+        unlink(v);
+        count--;
+        return {static_cast<int>(key[v]), v};
+    }
+};
@@ -2,6 +2,10 @@
 #include <vector>
 #include <queue>
 #include <set>
+#include "direction_optimizing_bfs.h"
+#include "bit_matrix.h"
+#include "numa_graph.h"
+#include "../common/op_counters.h"
 
 using namespace std;
 
@@ -27,12 +31,22 @@ vector<int> bfsAdjacencyMatrix(const vector<vector<int>>& adjMatrix, int startNo
             if (adjMatrix[currentNode][neighbor] == 1 && visitedNodes.find(neighbor) == visitedNodes.end()) {
                 visitedNodes.insert(neighbor);
                 nodeQueue.push(neighbor);
+                DAA_COUNT_MAX("bfsAdjacencyMatrix.queue_max", nodeQueue.size());
             }
         }
     }
     return traversalOrder;
 }
 
+// Matrix BFS on a bit-packed matrix: same traversal order as
+// bfsAdjacencyMatrix, but each row is scanned 64 neighbours per word and the
+// visited set is a bitmap instead of a set<int>.
+// Time Complexity: O(V^2 / 64)
+// Space Complexity: O(V^2 / 64) for the matrix, O(V / 64) extra
+vector<int> bfsAdjacencyMatrixBits(const BitAdjacencyMatrix& adjMatrix, int startNode) {
+    return bitBfsOrder(adjMatrix, startNode);
+}
+
 vector<int> bfsAdjacencyList(const vector<vector<int>>& adjList, int startNode) {
     vector<int> traversalOrder;
     if (adjList.empty()) return traversalOrder;
@@ -53,9 +67,128 @@ vector<int> bfsAdjacencyList(const vector<vector<int>>& adjList, int startNode)
             if (visitedNodes.find(neighbor) == visitedNodes.end()) {
                 visitedNodes.insert(neighbor);
                 nodeQueue.push(neighbor);
+                DAA_COUNT_MAX("bfsAdjacencyList.queue_max", nodeQueue.size());
+            }
+        }
+    }
+    return traversalOrder;
+}
+
+// Direction-optimizing BFS over the same adjacency list (flattened to CSR).
+// Visits the same nodes level by level as bfsAdjacencyList, directed lists
+// included: bottom-up steps scan the transposed graph. Within one level nodes
+// come out in ascending id order, since bottom-up steps discover a level all
+// at once rather than in queue order.
+vector<int> bfsAdjacencyListHybrid(const vector<vector<int>>& adjList, int startNode) {
+    vector<int> traversalOrder;
+    if (adjList.empty()) return traversalOrder;
+
+    CsrGraph g = csrFromAdjacency(adjList);
+    vector<int> level = hybridBfsDistances(g, g.transpose(), startNode);
+    vector<vector<int>> byLevel;
+    for (int node = 0; node < (int)level.size(); ++node) {
+        if (level[node] < 0) continue;
+        if (level[node] >= (int)byLevel.size()) byLevel.resize(level[node] + 1);
+        byLevel[level[node]].push_back(node);
+    }
+    for (const auto& nodes : byLevel) {
+        traversalOrder.insert(traversalOrder.end(), nodes.begin(), nodes.end());
+    }
+    return traversalOrder;
+}
+
+// Level-synchronous BFS over NUMA-partitioned storage (Graph/numa_graph.h).
+// One pinned worker per partition owns the distances and frontier of its
+// vertex range: it expands its frontier over its own adjacency arrays, sets
+// the distances of neighbours it owns, and queues the rest in an outbox for
+// their owner, which applies them after a barrier. Only those queued ids
+// cross partitions; no worker ever reads another partition's memory.
+// Returns the nodes in the order of bfsAdjacencyListHybrid (by level, then
+// id). stats, if given, receives the edges whose target was on the worker's
+// node (local) or another node (remote).
+// Time Complexity: O(V + E), plus two barriers per level
+// Space Complexity: O(V + E) for the outboxes in the worst case
+vector<int> bfsNumaPartitioned(const NumaPartitionedGraph& g, int startNode, NumaTraversalStats* stats = nullptr) {
+    vector<int> traversalOrder;
+    if (g.V() == 0) return traversalOrder;
+
+    const int P = g.partitions();
+    vector<vector<int>> dist(P);
+    vector<vector<vector<int>>> outbox(P, vector<vector<int>>(P)); // [from][to]
+    vector<char> nonEmpty(P, 0);
+    vector<long long> local(P, 0), remote(P, 0);
+    PartitionBarrier barrier(P);
+
+    g.runPinned([&](int p) {
+        const GraphPartition& part = g.partition(p);
+        dist[p].assign(part.hi - part.lo, -1); // first touched on the owning node
+        vector<int> frontier, next;
+        if (g.owner(startNode) == p) {
+            dist[p][startNode - part.lo] = 0;
+            frontier.push_back(startNode);
+        }
+        long long localEdges = 0, remoteEdges = 0;
+        for (int level = 0;; level++) {
+            for (int u : frontier) {
+                for (int v : part.adj(u)) {
+                    int q = g.owner(v);
+                    if (q == p) {
+                        localEdges++;
+                        if (dist[p][v - part.lo] < 0) {
+                            dist[p][v - part.lo] = level + 1;
+                            next.push_back(v);
+                        }
+                    } else {
+                        (g.partition(q).node == part.node ? localEdges : remoteEdges)++;
+                        outbox[p][q].push_back(v);
+                    }
+                }
+            }
+            barrier.arriveAndWait();
+            for (int q = 0; q < P; q++) {
+                for (int v : outbox[q][p]) {
+                    if (dist[p][v - part.lo] < 0) {
+                        dist[p][v - part.lo] = level + 1;
+                        next.push_back(v);
+                    }
+                }
+                outbox[q][p].clear();
             }
+            frontier.swap(next);
+            next.clear();
+            nonEmpty[p] = !frontier.empty();
+            barrier.arriveAndWait();
+            bool more = false;
+            for (int q = 0; q < P; q++) more |= nonEmpty[q] != 0;
+            if (!more) break;
         }
+        local[p] = localEdges;
+        remote[p] = remoteEdges;
+    });
+
+    vector<vector<int>> byLevel;
+    for (int p = 0; p < P; p++) {
+        int lo = g.partition(p).lo;
+        for (int i = 0; i < (int)dist[p].size(); i++) {
+            int d = dist[p][i];
+            if (d < 0) continue;
+            if (d >= (int)byLevel.size()) byLevel.resize(d + 1);
+            byLevel[d].push_back(lo + i);
+        }
+    }
+    for (const auto& nodes : byLevel) {
+        traversalOrder.insert(traversalOrder.end(), nodes.begin(), nodes.end());
     }
+
+    NumaTraversalStats s = g.emptyStats();
+    for (int p = 0; p < P; p++) {
+        s.localAccesses += local[p];
+        s.remoteAccesses += remote[p];
+    }
+    DAA_COUNT_ADD("numa.bfs.local_edges", s.localAccesses);
+    DAA_COUNT_ADD("numa.bfs.remote_edges", s.remoteAccesses);
+    DAA_COUNT_MAX("numa.bfs.remote_permille", s.remoteRatio() * 1000);
+    if (stats) *stats = s;
     return traversalOrder;
 }
 
@@ -85,6 +218,13 @@ int main() {
         cout << node + 1 << " ";
     }
     cout << endl;
+
+    vector<int> result1_bits = bfsAdjacencyMatrixBits(BitAdjacencyMatrix::fromMatrix(graph1_matrix), startNode1);
+    cout << "Example 1 (Bit Matrix): ";
+    for (int node : result1_bits) {
+        cout << node + 1 << " ";
+    }
+    cout << endl;
     
     vector<int> result1_list = bfsAdjacencyList(graph1_list, startNode1);
     cout << "Example 1 (List): ";
@@ -93,6 +233,13 @@ int main() {
     }
     cout << endl;
 
+    vector<int> result1_hybrid = bfsAdjacencyListHybrid(graph1_list, startNode1);
+    cout << "Example 1 (Hybrid): ";
+    for (int node : result1_hybrid) {
+        cout << node + 1 << " ";
+    }
+    cout << endl;
+
     // Example 2: Matrix and List for a larger graph
     vector<vector<int>> graph2_matrix = {
         {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
@@ -128,6 +275,13 @@ int main() {
         cout << node + 1 << " ";
     }
     cout << endl;
+
+    vector<int> result2_bits = bfsAdjacencyMatrixBits(BitAdjacencyMatrix::fromMatrix(graph2_matrix), startNode2);
+    cout << "Example 2 (Bit Matrix): ";
+    for (int node : result2_bits) {
+        cout << node + 1 << " ";
+    }
+    cout << endl;
     
     vector<int> result2_list = bfsAdjacencyList(graph2_list, startNode2);
     cout << "Example 2 (List): ";
@@ -136,5 +290,40 @@ int main() {
     }
     cout << endl;
 
+    vector<int> result2_hybrid = bfsAdjacencyListHybrid(graph2_list, startNode2);
+    cout << "Example 2 (Hybrid): ";
+    for (int node : result2_hybrid) {
+        cout << node + 1 << " ";
+    }
+    cout << endl;
+
+    NumaPartitionedGraph numa2(csrFromAdjacency(graph2_list), 2);
+    vector<int> result2_numa = bfsNumaPartitioned(numa2, startNode2);
+    cout << "Example 2 (NUMA partitioned): ";
+    for (int node : result2_numa) {
+        cout << node + 1 << " ";
+    }
+    cout << endl;
+
+    // Larger random graph, one partition per node (DAA_NUMA_NODES=k to
+    // simulate k nodes); the traversal order must match the hybrid BFS.
+    int bigV = 200000;
+    vector<vector<int>> bigList(bigV);
+    unsigned long long seed = 12345;
+    for (int e = 0; e < 6 * bigV; ++e) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int u = (int)((seed >> 33) % bigV);
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int v = (int)((seed >> 33) % bigV);
+        bigList[u].push_back(v);
+        bigList[v].push_back(u);
+    }
+    NumaPartitionedGraph bigNuma(csrFromAdjacency(bigList));
+    NumaTraversalStats stats;
+    bool same = bfsNumaPartitioned(bigNuma, 0, &stats) == bfsAdjacencyListHybrid(bigList, 0);
+    cout << "Random graph (NUMA partitioned): " << (same ? "matches" : "DIFFERS FROM") << " hybrid BFS, "
+         << stats.partitions << " partition(s) on " << stats.nodes << " node(s), " << pageKindName(stats.pages)
+         << " pages, " << stats.remoteRatio() * 100 << "% remote edges" << endl;
+
     return 0;
 }
@@ -1,6 +1,12 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <cstdint>
+#include <algorithm>
+#include "grid2d.h"
+#include "grid_kernels.h"
+#include "../common/op_counters.h"
+#include "../common/parallel.h"
 
 using namespace std;
 
@@ -75,6 +81,7 @@ int orangesRottingOptimal(vector<vector<int>>& grid) {
     }
     
     if (freshCount == 0) return 0;
+    DAA_COUNT_MAX("orangesRottingOptimal.queue_max", rottenQueue.size());
     
     int minutes = 0;
     int dx[] = {0, 0, 1, -1};
@@ -97,6 +104,7 @@ int orangesRottingOptimal(vector<vector<int>>& grid) {
                 if (nx >= 0 && nx < rows && ny >= 0 && ny < cols && grid[nx][ny] == 1) {
                     grid[nx][ny] = 2; // Rot the fresh orange
                     rottenQueue.push({nx, ny});
+                    DAA_COUNT_MAX("orangesRottingOptimal.queue_max", rottenQueue.size());
                     freshCount--;
                     rottedInThisMinute = true;
                 }
@@ -112,9 +120,204 @@ int orangesRottingOptimal(vector<vector<int>>& grid) {
     return freshCount == 0 ? minutes : -1;
 }
 
+// Same BFS on a flat grid with an empty (0) sentinel border: each minute is
+// one round of the shared multi-source kernel, with no bounds checks.
+// Works in place: fresh oranges that rot are set to 2.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N*M) for the frontier arrays, no per-row allocations
+int orangesRottingFlat(Grid2D<uint8_t>& grid) {
+    vector<int> rotten;
+    int freshCount = 0;
+    for (int r = 0; r < grid.rows(); ++r) {
+        for (int c = 0; c < grid.cols(); ++c) {
+            int i = grid.index(r, c);
+            if (grid[i] == 2) rotten.push_back(i);
+            else if (grid[i] == 1) freshCount++;
+        }
+    }
+    if (freshCount == 0) return 0;
+
+    int minutes = gridMultiSourceBfs(grid, rotten, [&](int, int to) {
+        if (grid[to] != 1) return false;
+        grid[to] = 2;
+        freshCount--;
+        return true;
+    });
+    return freshCount == 0 ? minutes : -1;
+}
+
+
+// orangesRottingFlat as an instantiation of the compile-time grid kernel
+// (grid_kernels.h): the 4-neighbour loop is unrolled and the fresh test
+// inlined. Cell is uint8_t or char; rotting happens in place.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N*M) for the frontier arrays
+template <class Cell>
+int orangesRottingKernel(Grid2D<Cell>& grid) {
+    vector<int> rotten;
+    long long freshCount = 0;
+    for (int r = 0; r < grid.rows(); ++r) {
+        for (int i = grid.index(r, 0), end = i + grid.cols(); i < end; ++i) {
+            if (grid[i] == 2) rotten.push_back(i);
+            else if (grid[i] == 1) freshCount++;
+        }
+    }
+    GridFloodResult res = gridFlood<4>(grid, std::move(rotten), CellEquals<1>(), 2);
+    return res.visited == freshCount ? res.rounds : -1;
+}
+
+// Same, with one bit per fresh orange: rotting clears the bit.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N*M / 8) for the bits plus the frontier arrays
+int orangesRottingBits(BitGrid2D& fresh, const vector<int>& rotten) {
+    GridFloodResult res = gridFlood<4>(fresh, rotten, CellSet(), false);
+    return fresh.count() == 0 ? res.rounds : -1;
+}
+
+// Rotting as a cellular automaton on bit-packed rows: bit c of row r's
+// words is column c. One minute rots every fresh orange next to the
+// oranges that rotted in the previous minute,
+//   newly = fresh & (frontier << 1 | frontier >> 1 | frontier above | frontier below)
+// 64 cells per word operation, with the carries between adjacent words of a
+// row. Oranges rotten earlier need not be shifted again (their neighbours
+// are already rotten or not fresh), so only the frontier mask is kept next
+// to fresh; empty cells are the bits set in neither, and since newly is
+// masked by fresh they need no mask of their own, nor do the padding bits
+// past the last column. Each minute touches only the rows within one of
+// the frontier, and splits them across threads when there are enough.
+class BitSlicedOranges {
+    int nRows = 0, nCols = 0, words = 0;
+    std::vector<uint64_t> fresh, frontier, next;
+    long long freshLeft = 0;
+    int frontierLo = 0, frontierHi = -1; // rows holding frontier bits
+
+    // Words per minute above which rows are split across threads: below it
+    // starting the threads costs more than the minute.
+    static constexpr long long PARALLEL_WORDS = 1 << 15;
+
+    // Writes the newly rotten bits of rows [a, b) into next and clears them
+    // from fresh; returns how many rotted and the rows that got any.
+    long long stepRows(int a, int b, int& lo, int& hi) {
+        long long rotted = 0;
+        for (int r = a; r < b; r++) {
+            const uint64_t* cur = &frontier[(size_t)r * words];
+            const uint64_t* up = r > 0 ? cur - words : nullptr;
+            const uint64_t* down = r + 1 < nRows ? cur + words : nullptr;
+            uint64_t* f = &fresh[(size_t)r * words];
+            uint64_t* out = &next[(size_t)r * words];
+            uint64_t any = 0;
+            for (int w = 0; w < words; w++) {
+                uint64_t x = cur[w];
+                uint64_t spread = x << 1 | x >> 1;
+                if (w > 0) spread |= cur[w - 1] >> 63;
+                if (w + 1 < words) spread |= cur[w + 1] << 63;
+                if (up) spread |= up[w];
+                if (down) spread |= down[w];
+                uint64_t rot = f[w] & spread;
+                f[w] &= ~rot;
+                out[w] = rot;
+                any |= rot;
+                rotted += __builtin_popcountll(rot);
+            }
+            if (any) {
+                lo = min(lo, r);
+                hi = max(hi, r);
+            }
+        }
+        return rotted;
+    }
+
+public:
+    BitSlicedOranges() = default;
+
+    // Cells are 0 empty, 1 fresh, 2 rotten, as in orangesRottingOptimal.
+    explicit BitSlicedOranges(const vector<vector<int>>& grid)
+        : nRows((int)grid.size()), nCols(grid.empty() ? 0 : (int)grid[0].size()), words((nCols + 63) / 64) {
+        fresh.assign((size_t)nRows * words, 0);
+        frontier.assign(fresh.size(), 0);
+        next.assign(fresh.size(), 0);
+        for (int r = 0; r < nRows; r++) {
+            for (int c = 0; c < nCols; c++) {
+                uint64_t bit = uint64_t(1) << (c & 63);
+                size_t w = (size_t)r * words + (c >> 6);
+                if (grid[r][c] == 1) {
+                    fresh[w] |= bit;
+                    freshLeft++;
+                } else if (grid[r][c] == 2) {
+                    frontier[w] |= bit;
+                    frontierLo = min(r, frontierHi < 0 ? r : frontierLo);
+                    frontierHi = r;
+                }
+            }
+        }
+    }
+
+    // Advances one minute; returns false, changing nothing, when no orange
+    // would rot.
+    bool step(int threads = 1) {
+        if (frontierHi < 0 || freshLeft == 0) return false;
+        int a = max(0, frontierLo - 1), b = min(nRows, frontierHi + 2);
+        int lo = nRows, hi = -1;
+        long long rotted = 0;
+        threads = (long long)(b - a) * words >= PARALLEL_WORDS ? resolveThreads(threads) : 1;
+        if (threads == 1) {
+            rotted = stepRows(a, b, lo, hi);
+        } else {
+            vector<long long> count(threads, 0);
+            vector<int> los(threads, nRows), his(threads, -1);
+            parallelChunks(b - a, threads, [&](long long begin, long long end, int t) {
+                count[t] = stepRows(a + (int)begin, a + (int)end, los[t], his[t]);
+            });
+            for (int t = 0; t < threads; t++) {
+                rotted += count[t];
+                lo = min(lo, los[t]);
+                hi = max(hi, his[t]);
+            }
+        }
+
+        // The old frontier's rows become the next target: rows outside
+        // [a, b) were not written, so clear what the old frontier left there
+        fill(frontier.begin() + (size_t)frontierLo * words, frontier.begin() + (size_t)(frontierHi + 1) * words, 0);
+        frontier.swap(next);
+        frontierLo = lo;
+        frontierHi = hi;
+        freshLeft -= rotted;
+        return rotted > 0;
+    }
+
+    // Minutes until no fresh orange is left, or -1 if some never rot.
+    // Stops at the first minute that rots nothing.
+    // Time Complexity: O(minutes * R * C / 64), less when the frontier spans few rows
+    // Space Complexity: O(R * C / 64) words for the three masks
+    int run(int threads = 1) {
+        int minutes = 0;
+        while (step(threads)) minutes++;
+        return freshLeft == 0 ? minutes : -1;
+    }
+
+    long long freshCount() const { return freshLeft; }
+};
+
+int orangesRottingBitSliced(const vector<vector<int>>& grid, int threads = 1) {
+    return BitSlicedOranges(grid).run(threads);
+}
+
+// Many independent grids, the simulation workload: one grid per task across
+// the threads, each grid stepped on its own thread.
+// Time Complexity: O(sum of each grid's run) / threads
+// Space Complexity: O(R * C / 64) per grid in flight
+vector<int> orangesRottingBitSlicedMany(const vector<vector<vector<int>>>& grids, int threads = 0) {
+    vector<int> minutes(grids.size());
+    parallelForDynamic((long long)grids.size(), threads,
+                       [&](long long i, int) { minutes[i] = BitSlicedOranges(grids[i]).run(1); });
+    return minutes;
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<vector<int>> example1 = { {2, 1, 1}, {0, 1, 1}, {1, 0, 1} };
     vector<vector<int>> example1_copy = example1; // To test both functions on the original input
+    Grid2D<uint8_t> flat1 = Grid2D<uint8_t>::fromNested(example1, 0);
 
     cout << "Example 1:" << endl;
     int bruteForceResult = orangesRottingBruteForce(example1);
@@ -123,10 +326,15 @@ int main() {
     int optimalResult = orangesRottingOptimal(example1_copy);
     cout << "Optimal Output: " << optimalResult << endl;
 
+    cout << "Flat Grid Output: " << orangesRottingFlat(flat1) << endl;
+
     cout << endl;
     
     vector<vector<int>> example2 = { {2, 1, 1}, {1, 1, 0}, {0, 1, 1} };
     vector<vector<int>> example2_copy = example2;
+    Grid2D<uint8_t> flat2 = Grid2D<uint8_t>::fromNested(example2, 0);
+    Grid2D<uint8_t> kernel2 = Grid2D<uint8_t>::fromNested(example2, 0);
+    vector<vector<int>> example2_bits = example2;
     
     cout << "Example 2:" << endl;
     int bruteForceResult2 = orangesRottingBruteForce(example2);
@@ -135,5 +343,22 @@ int main() {
     int optimalResult2 = orangesRottingOptimal(example2_copy);
     cout << "Optimal Output: " << optimalResult2 << endl;
 
+    cout << "Flat Grid Output: " << orangesRottingFlat(flat2) << endl;
+    cout << "Grid Kernel Output: " << orangesRottingKernel(kernel2) << endl;
+    cout << "Bit-Sliced Output: " << orangesRottingBitSliced(example2_bits) << endl;
+
+    // A batch of random grids, as a spread simulation would run them
+    vector<vector<vector<int>>> batch;
+    for (int g = 0; g < 6; g++) {
+        vector<vector<int>> grid(40, vector<int>(100));
+        for (int r = 0; r < 40; r++)
+            for (int c = 0; c < 100; c++) grid[r][c] = (r * 131 + c * 71 + g * 17) % 97 == 0 ? 2 : ((r * 7 + c * 3 + g) % 19 ? 1 : 0);
+        batch.push_back(grid);
+    }
+    cout << "Bit-Sliced Batch:";
+    for (int m : orangesRottingBitSlicedMany(batch, 2)) cout << " " << m;
+    cout << endl;
+
     return 0;
 }
+#endif
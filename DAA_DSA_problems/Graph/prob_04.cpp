@@ -2,6 +2,8 @@
 #include <vector>
 #include <queue>
 #include <climits>
+#include <cstdint>
+#include "grid2d.h"
 
 using namespace std;
 
@@ -86,6 +88,126 @@ vector<vector<int>> solveOptimal(const vector<vector<int>>& grid) {
     return dist;
 }
 
+// Multi-source BFS on flat grids. The distance grid's border is 0, so the
+// "still -1" test alone keeps the BFS inside the grid.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N*M)
+Grid2D<int> solveFlat(const Grid2D<uint8_t>& grid) {
+    Grid2D<int> dist(grid.rows(), grid.cols(), 0, -1);
+    vector<int> ones;
+    for (int r = 0; r < grid.rows(); ++r) {
+        for (int c = 0; c < grid.cols(); ++c) {
+            int i = grid.index(r, c);
+            if (grid[i] == 1) {
+                dist[i] = 0;
+                ones.push_back(i);
+            }
+        }
+    }
+    gridMultiSourceBfs(dist, ones, [&](int from, int to) {
+        if (dist[to] != -1) return false;
+        dist[to] = dist[from] + 1;
+        return true;
+    });
+    return dist;
+}
+
+enum class DistanceMetric { Manhattan, Chebyshev, Euclidean };
+
+// Distance transform by raster sweeps instead of a queue: every pass walks
+// the grid front to back (or back to front) one row at a time.
+//
+// Manhattan / Chebyshev: the classic two-pass chamfer transform with the 4-
+// or 8-neighbour mask. Within a row, the terms from the previous row do not
+// depend on each other, so they are applied as a whole-row min loop that the
+// compiler vectorizes; only the left-to-right (right-to-left) term stays a
+// scalar scan. Both masks give exact distances.
+// Euclidean: exact squared distances by the separable method of Meijster and
+// Felzenszwalb: vertical distances per column (vectorized row sweeps), then
+// the lower envelope of parabolas along each row.
+// Cells get -1 if the grid has no 1 at all, matching solveOptimal; Euclidean
+// cells hold the squared distance.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N*M)
+Grid2D<int> distanceTransform(const Grid2D<uint8_t>& grid, DistanceMetric metric) {
+    const int INF = INT_MAX / 4;
+    const int rows = grid.rows(), cols = grid.cols(), stride = grid.stride();
+    // The INF border makes the row above row 0 and the cells beside each row
+    // valid inputs to the sweeps.
+    Grid2D<int> dist(rows, cols, INF, INF);
+    bool anyOne = false;
+    for (int r = 0; r < rows; ++r) {
+        const uint8_t* in = &grid.at(r, 0);
+        int* out = &dist.at(r, 0);
+        for (int c = 0; c < cols; ++c) {
+            if (in[c] == 1) {
+                out[c] = 0;
+                anyOne = true;
+            }
+        }
+    }
+    if (!anyOne) {
+        for (int r = 0; r < rows; ++r) fill(&dist.at(r, 0), &dist.at(r, 0) + cols, -1);
+        return dist;
+    }
+
+    const bool diagonal = metric == DistanceMetric::Chebyshev;
+    // One chamfer pass; dir = +1 top-left to bottom-right, -1 the reverse.
+    auto sweep = [&](int dir) {
+        for (int k = 0; k < rows; ++k) {
+            int r = dir > 0 ? k : rows - 1 - k;
+            int* row = &dist.at(r, 0);
+            const int* prev = row - dir * stride;
+            for (int c = 0; c < cols; ++c) row[c] = min(row[c], prev[c] + 1);
+            if (diagonal) {
+                for (int c = 0; c < cols; ++c) row[c] = min(row[c], min(prev[c - 1], prev[c + 1]) + 1);
+            }
+            if (metric == DistanceMetric::Euclidean) continue; // vertical pass only
+            if (dir > 0) {
+                for (int c = 0; c < cols; ++c) row[c] = min(row[c], row[c - 1] + 1);
+            } else {
+                for (int c = cols - 1; c >= 0; --c) row[c] = min(row[c], row[c + 1] + 1);
+            }
+        }
+    };
+    sweep(+1);
+    sweep(-1);
+    if (metric != DistanceMetric::Euclidean) return dist;
+
+    // dist now holds the vertical distance g to the nearest 1 in the same
+    // column (INF for columns without one). Per row, the squared distance is
+    // min over c' of (c - c')^2 + g[c']^2: take the lower envelope of those
+    // parabolas, then read it off left to right.
+    vector<int> vertex(cols);
+    vector<double> boundary(cols + 1);
+    vector<long long> g2(cols);
+    for (int r = 0; r < rows; ++r) {
+        int* row = &dist.at(r, 0);
+        int hull = 0;
+        for (int c = 0; c < cols; ++c) {
+            if (row[c] >= INF) continue;
+            g2[c] = (long long)row[c] * row[c];
+            double s = -1e300;
+            while (hull > 0) {
+                int v = vertex[hull - 1];
+                s = ((g2[c] + (long long)c * c) - (g2[v] + (long long)v * v)) / (2.0 * (c - v));
+                if (s > boundary[hull - 1]) break;
+                hull--;
+            }
+            if (hull == 0) s = -1e300;
+            vertex[hull] = c;
+            boundary[hull] = s;
+            hull++;
+        }
+        for (int c = 0, h = 0; c < cols; ++c) {
+            while (h + 1 < hull && boundary[h + 1] <= c) h++;
+            long long dc = c - vertex[h];
+            row[c] = (int)(dc * dc + g2[vertex[h]]);
+        }
+    }
+    return dist;
+}
+
 // Helper function to print the grid
 void printGrid(const vector<vector<int>>& grid) {
     for (const auto& row : grid) {
@@ -96,6 +218,7 @@ void printGrid(const vector<vector<int>>& grid) {
     }
 }
 
+#ifndef DAA_NO_MAIN
 int main() {
     // Example 1: Standard case with multiple 1s
     vector<vector<int>> example1 = {
@@ -114,6 +237,12 @@ int main() {
     cout << "\nOptimal Output:" << endl;
     vector<vector<int>> resultOptimal1 = solveOptimal(example1);
     printGrid(resultOptimal1);
+
+    cout << "\nFlat Grid Output:" << endl;
+    printGrid(solveFlat(Grid2D<uint8_t>::fromNested(example1, 0)).toNested());
+
+    cout << "\nTwo-Pass Distance Transform (Manhattan):" << endl;
+    printGrid(distanceTransform(Grid2D<uint8_t>::fromNested(example1, 0), DistanceMetric::Manhattan).toNested());
     
     cout << "\n-------------------\n" << endl;
     
@@ -135,6 +264,19 @@ int main() {
     cout << "\nOptimal Output:" << endl;
     vector<vector<int>> resultOptimal2 = solveOptimal(example2);
     printGrid(resultOptimal2);
+
+    cout << "\nFlat Grid Output:" << endl;
+    printGrid(solveFlat(Grid2D<uint8_t>::fromNested(example2, 0)).toNested());
+
+    cout << "\nTwo-Pass Distance Transform (Manhattan):" << endl;
+    printGrid(distanceTransform(Grid2D<uint8_t>::fromNested(example2, 0), DistanceMetric::Manhattan).toNested());
+
+    cout << "\nChebyshev:" << endl;
+    printGrid(distanceTransform(Grid2D<uint8_t>::fromNested(example2, 0), DistanceMetric::Chebyshev).toNested());
+
+    cout << "\nSquared Euclidean:" << endl;
+    printGrid(distanceTransform(Grid2D<uint8_t>::fromNested(example2, 0), DistanceMetric::Euclidean).toNested());
     
     return 0;
 }
+#endif
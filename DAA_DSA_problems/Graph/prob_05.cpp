@@ -1,6 +1,12 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include "csr_graph.h"
+#include "../common/parallel.h"
 
 using namespace std;
 
@@ -75,6 +81,134 @@ bool isBipartiteOptimal(int V, const vector<vector<int>>& adjList) {
     return true;
 }
 
+// Incremental bipartiteness check over a stream of edges: union-find where
+// each node also stores the parity of its path to its parent, so the parity
+// to the root says which side of the component the node is on. An edge
+// inside one component is fine iff its ends have different parities;
+// between components, the roots are linked with the parity that makes it
+// fine. Once an edge breaks 2-colorability, it is remembered and the graph
+// stays non-bipartite.
+// Time Complexity: O(alpha(V)) amortized per edge
+// Space Complexity: O(V)
+class OnlineBipartiteChecker {
+    vector<int> parent, rank, parity; // parity[v]: side of v relative to parent[v]
+    long long edgesSeen = 0;
+    long long violationIndex = -1;
+    pair<int, int> violation = {-1, -1};
+
+    // Root of v, while compressing the path; sets side to v's parity to the root.
+    int find(int v, int &side) {
+        int root = v, p = 0;
+        while (parent[root] != root) {
+            p ^= parity[root];
+            root = parent[root];
+        }
+        side = p;
+        // Second pass: point every node on the path straight at the root.
+        while (parent[v] != root && v != root) {
+            int next = parent[v], nextParity = p ^ parity[v];
+            parent[v] = root;
+            parity[v] = p;
+            v = next;
+            p = nextParity;
+        }
+        return root;
+    }
+
+public:
+    explicit OnlineBipartiteChecker(int V) : parent(V), rank(V, 0), parity(V, 0) {
+        for (int i = 0; i < V; ++i) parent[i] = i;
+    }
+
+    // Adds the undirected edge u - v; returns whether the graph is still bipartite.
+    bool addEdge(int u, int v) {
+        long long index = edgesSeen++;
+        if (violationIndex >= 0) return false;
+        int pu, pv;
+        int ru = find(u, pu), rv = find(v, pv);
+        if (ru == rv) {
+            if (pu == pv) {
+                violationIndex = index;
+                violation = {u, v};
+                return false;
+            }
+            return true;
+        }
+        if (rank[ru] < rank[rv]) swap(ru, rv);
+        parent[rv] = ru;
+        parity[rv] = pu ^ pv ^ 1; // puts u and v on opposite sides
+        if (rank[ru] == rank[rv]) rank[ru]++;
+        return true;
+    }
+
+    // Adds a batch; returns whether the graph is still bipartite afterwards.
+    bool addEdges(const vector<pair<int, int>> &edges) {
+        for (const auto &e : edges) addEdge(e.first, e.second);
+        return bipartite();
+    }
+
+    bool bipartite() const { return violationIndex < 0; }
+    // First edge that made the graph non-bipartite, {-1, -1} if none, and
+    // its position in the stream (-1 if none).
+    pair<int, int> firstViolation() const { return violation; }
+    long long firstViolationIndex() const { return violationIndex; }
+};
+
+// One-off check with a parallel level-synchronous BFS colouring: each
+// frontier is split across threads, and a node is claimed by the thread
+// whose compare-and-swap colours it first. A final parallel pass over all
+// edges looks for a same-coloured pair. The graph must store both directions
+// of each edge (csrFromAdjacency of an undirected adjacency list).
+// Time Complexity: O(V + E) work
+// Space Complexity: O(V)
+bool isBipartiteParallel(const CsrGraph &g, int threads = 0) {
+    const int V = g.V;
+    threads = resolveThreads(threads);
+    unique_ptr<atomic<int>[]> color(new atomic<int>[V]);
+    for (int i = 0; i < V; ++i) color[i].store(-1, memory_order_relaxed);
+
+    vector<vector<int>> local(threads);
+    vector<int> frontier;
+    for (int seed = 0; seed < V; ++seed) {
+        if (color[seed].load(memory_order_relaxed) != -1) continue;
+        color[seed].store(0, memory_order_relaxed);
+        frontier.assign(1, seed);
+        for (int level = 0; !frontier.empty(); ++level) {
+            const int nextColor = (level + 1) & 1;
+            parallelChunks((long long)frontier.size(), threads, [&](long long lo, long long hi, int t) {
+                for (long long k = lo; k < hi; ++k) {
+                    for (int v : g.adj(frontier[k])) {
+                        int expected = -1;
+                        if (color[v].compare_exchange_strong(expected, nextColor, memory_order_relaxed)) {
+                            local[t].push_back(v);
+                        }
+                    }
+                }
+            });
+            frontier.clear();
+            for (auto &part : local) {
+                frontier.insert(frontier.end(), part.begin(), part.end());
+                part.clear();
+            }
+        }
+    }
+
+    atomic<bool> ok(true);
+    parallelChunks(V, threads, [&](long long lo, long long hi, int) {
+        for (long long u = lo; u < hi && ok.load(memory_order_relaxed); ++u) {
+            int cu = color[u].load(memory_order_relaxed);
+            for (int v : g.adj((int)u)) {
+                if (color[v].load(memory_order_relaxed) == cu) {
+                    ok.store(false, memory_order_relaxed);
+                    break;
+                }
+            }
+        }
+    });
+    return ok.load();
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     // Example 1: Bipartite Graph (a tree structure)
     int V1 = 5;
@@ -90,6 +224,7 @@ int main() {
 
     cout << "Example 1: Bipartite Graph (Tree)" << endl;
     cout << "Optimal (DFS) result: " << (isBipartiteOptimal(V1, adjList1) ? "1" : "0") << endl;
+    cout << "Parallel BFS result: " << (isBipartiteParallel(csrFromAdjacency(adjList1)) ? "1" : "0") << endl;
     
     // Example 2: Non-Bipartite Graph (a triangle)
     int V2 = 3;
@@ -103,6 +238,17 @@ int main() {
 
     cout << "\nExample 2: Non-Bipartite Graph (Triangle)" << endl;
     cout << "Optimal (DFS) result: " << (isBipartiteOptimal(V2, adjList2) ? "1" : "0") << endl;
+    cout << "Parallel BFS result: " << (isBipartiteParallel(csrFromAdjacency(adjList2)) ? "1" : "0") << endl;
+
+    // Streaming edges of the triangle one at a time
+    OnlineBipartiteChecker online(V2);
+    online.addEdges({{0, 1}, {1, 2}});
+    cout << "Online after 2 edges: " << (online.bipartite() ? "1" : "0") << endl;
+    online.addEdge(2, 0);
+    cout << "Online after 3 edges: " << (online.bipartite() ? "1" : "0")
+         << " (first violating edge " << online.firstViolation().first << "-"
+         << online.firstViolation().second << ")" << endl;
 
     return 0;
 }
+#endif
@@ -2,6 +2,12 @@
 #include <vector>
 #include <queue>
 #include <limits>
+#include <tuple>
+#include <cstdint>
+#include <cstdlib>
+#include "grid2d.h"
+#include "priority_queues.h"
+#include "grid_kernels.h"
 
 using namespace std;
 
@@ -79,6 +85,229 @@ int optimalBFS(const vector<vector<int>>& grid, int n, int m, pair<int, int> sou
     return -1;
 }
 
+// Point-to-point shortest paths on one binary maze, for many queries.
+//
+// The maze is stored once as a Grid2D with a blocked (0) sentinel border.
+// Costs, parents and the open list are reused across queries: per-query
+// state is stamped with a generation number, and the indexed heap is cleared
+// in O(size), so a query only pays for the cells it touches.
+// Moves cost 1 each; connectivity 8 adds diagonal moves, which may not cut
+// a blocked corner (both side cells must be open).
+class GridPathPlanner {
+    Grid2D<uint8_t> open;
+    int goal = -1;
+    vector<int> cost, parent;
+    vector<uint32_t> stamp;
+    uint32_t generation = 0;
+    IndexedDaryHeap<4, long long> heap;
+
+    void newQuery() {
+        heap.clear();
+        if (++generation == 0) {
+            fill(stamp.begin(), stamp.end(), 0);
+            generation = 1;
+        }
+    }
+
+    int known(int v) const { return stamp[v] == generation ? cost[v] : INT32_MAX; }
+
+    // Chebyshev (8) or Manhattan (4) distance: the exact cost of a single
+    // straight or diagonal segment, and an admissible heuristic.
+    int distance(int a, int b, int connectivity) const {
+        int dr = abs(open.rowOf(a) - open.rowOf(b)), dc = abs(open.colOf(a) - open.colOf(b));
+        return connectivity == 8 ? max(dr, dc) : dr + dc;
+    }
+
+    // Pops cells in order of f = cost + h; among equal f, the deeper one first.
+    void push(int v, int c, int from, int connectivity) {
+        if (c >= known(v)) return;
+        stamp[v] = generation;
+        cost[v] = c;
+        parent[v] = from;
+        long long f = c + distance(v, goal, connectivity);
+        heap.pushOrDecrease(v, (f << 32) - c);
+    }
+
+    bool passable(int v) const { return open[v] != 0; }
+
+    // Straight jump from i by (dr, dc); -1 if it runs into a wall.
+    // 8-connected: stop at a cell with a forced neighbour (a side cell that is
+    // open while the cell behind it is blocked). 4-connected: vertical jumps
+    // use the same rule, horizontal jumps stop wherever a vertical jump from
+    // the cell would find something (horizontal plays the diagonal's role).
+    int jumpStraight(int i, int dr, int dc, int connectivity) const {
+        const int S = open.stride(), step = dr * S + dc;
+        while (true) {
+            i += step;
+            if (!passable(i)) return -1;
+            if (i == goal) return i;
+            if (dr != 0) {
+                int back = -dr * S;
+                if ((passable(i - 1) && !passable(i - 1 + back)) || (passable(i + 1) && !passable(i + 1 + back)))
+                    return i;
+            } else if (connectivity == 8) {
+                if ((passable(i - S) && !passable(i - S - dc)) || (passable(i + S) && !passable(i + S - dc)))
+                    return i;
+            } else if (jumpStraight(i, -1, 0, 4) >= 0 || jumpStraight(i, 1, 0, 4) >= 0) {
+                return i;
+            }
+        }
+    }
+
+    // Diagonal jump (8-connected only): stop where a straight jump along
+    // either component finds something.
+    int jumpDiagonal(int i, int dr, int dc) const {
+        const int S = open.stride();
+        while (true) {
+            i += dr * S + dc;
+            if (!passable(i)) return -1;
+            if (i == goal) return i;
+            if (jumpStraight(i, 0, dc, 8) >= 0 || jumpStraight(i, dr, 0, 8) >= 0) return i;
+            if (!passable(i + dc) || !passable(i + dr * S)) return -1; // no corner cutting
+        }
+    }
+
+    int jump(int i, int dr, int dc, int connectivity) const {
+        return dr != 0 && dc != 0 ? jumpDiagonal(i, dr, dc) : jumpStraight(i, dr, dc, connectivity);
+    }
+
+    bool canStep(int i, int dr, int dc) const {
+        const int S = open.stride();
+        if (!passable(i + dr * S + dc)) return false;
+        return dr == 0 || dc == 0 || (passable(i + dc) && passable(i + dr * S));
+    }
+
+    // Directions worth jumping in from jump point x, given the direction it
+    // was reached in (pruning rules of Harabor & Grastien, no corner cutting).
+    int prunedDirections(int x, int connectivity, int dirs[8][2]) const {
+        int n = 0;
+        auto add = [&](int dr, int dc) {
+            if (canStep(x, dr, dc)) { dirs[n][0] = dr; dirs[n][1] = dc; n++; }
+        };
+        int p = parent[x];
+        if (p < 0) {
+            for (int dr = -1; dr <= 1; dr++)
+                for (int dc = -1; dc <= 1; dc++)
+                    if ((dr || dc) && (connectivity == 8 || !(dr && dc))) add(dr, dc);
+            return n;
+        }
+        int dr = (open.rowOf(x) > open.rowOf(p)) - (open.rowOf(x) < open.rowOf(p));
+        int dc = (open.colOf(x) > open.colOf(p)) - (open.colOf(x) < open.colOf(p));
+        const int S = open.stride();
+        if (connectivity == 4) {
+            add(dr, dc);
+            if (dc != 0) {
+                add(-1, 0);
+                add(1, 0);
+            } else {
+                if (passable(x - 1) && !passable(x - 1 - dr * S)) add(0, -1);
+                if (passable(x + 1) && !passable(x + 1 - dr * S)) add(0, 1);
+            }
+        } else if (dr != 0 && dc != 0) {
+            add(0, dc);
+            add(dr, 0);
+            add(dr, dc);
+        } else if (dc != 0) {
+            add(0, dc);
+            add(-1, dc);
+            add(1, dc);
+            add(-1, 0);
+            add(1, 0);
+        } else {
+            add(dr, 0);
+            add(dr, -1);
+            add(dr, 1);
+            add(0, -1);
+            add(0, 1);
+        }
+        return n;
+    }
+
+    // Shared setup; returns the answer directly for trivial queries, or -2.
+    int begin(pair<int, int> source, pair<int, int> destination, int &src) {
+        src = open.index(source.first, source.second);
+        goal = open.index(destination.first, destination.second);
+        if (!passable(src) || !passable(goal)) return -1;
+        if (src == goal) return 0;
+        newQuery();
+        stamp[src] = generation;
+        cost[src] = 0;
+        parent[src] = -1;
+        return -2;
+    }
+
+public:
+    explicit GridPathPlanner(const vector<vector<int>>& grid)
+        : open(Grid2D<uint8_t>::fromNested(grid, 0)),
+          cost((size_t)(open.rows() + 2) * open.stride()),
+          parent(cost.size()),
+          stamp(cost.size(), 0),
+          heap((int)cost.size()) {}
+
+    // A* with the Manhattan (4) or Chebyshev (8) heuristic. Same result as
+    // optimalBFS for connectivity 4.
+    // Time Complexity: O(K log K) for the K cells expanded, K <= N*M
+    // Space Complexity: O(N*M), allocated once per planner
+    int aStar(pair<int, int> source, pair<int, int> destination, int connectivity = 4) {
+        int src;
+        int early = begin(source, destination, src);
+        if (early != -2) return early;
+        heap.pushOrDecrease(src, 0);
+        while (!heap.empty()) {
+            int v = heap.popMin().second;
+            if (v == goal) return cost[v];
+            for (int dr = -1; dr <= 1; dr++) {
+                for (int dc = -1; dc <= 1; dc++) {
+                    if (!(dr || dc) || (connectivity == 4 && dr && dc) || !canStep(v, dr, dc)) continue;
+                    push(v + dr * open.stride() + dc, cost[v] + 1, v, connectivity);
+                }
+            }
+        }
+        return -1;
+    }
+
+    // Jump-point search: the open list only receives jump points, where an
+    // optimal path may need to turn; the straight runs between them are
+    // scanned without touching the heap.
+    // Time Complexity: O(N*M) scans worst case, far fewer heap operations than A*
+    // Space Complexity: O(N*M), allocated once per planner
+    int jumpPointSearch(pair<int, int> source, pair<int, int> destination, int connectivity = 4) {
+        int src;
+        int early = begin(source, destination, src);
+        if (early != -2) return early;
+        heap.pushOrDecrease(src, 0);
+        int dirs[8][2];
+        while (!heap.empty()) {
+            int x = heap.popMin().second;
+            if (x == goal) return cost[x];
+            int n = prunedDirections(x, connectivity, dirs);
+            for (int k = 0; k < n; k++) {
+                int j = jump(x, dirs[k][0], dirs[k][1], connectivity);
+                if (j >= 0) push(j, cost[x] + distance(x, j, connectivity), x, connectivity);
+            }
+        }
+        return -1;
+    }
+};
+
+
+// optimalBFS as an instantiation of the compile-time grid kernel
+// (grid_kernels.h) on a maze with a blocked (0) border: open cells of a copy
+// are closed as the flood reaches them, and it stops in the round that
+// reaches the destination.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N*M) for the copy and the frontier arrays
+int shortestPathKernel(const Grid2D<uint8_t>& open, pair<int, int> source, pair<int, int> destination) {
+    int from = open.index(source.first, source.second), to = open.index(destination.first, destination.second);
+    if (open[from] == 0 || open[to] == 0) return -1;
+    if (from == to) return 0;
+    Grid2D<uint8_t> maze = open;
+    maze[from] = 0;
+    GridFloodResult res = gridFlood<4>(maze, {from}, CellEquals<1>(), 0, to);
+    return res.reached ? res.rounds : -1;
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<vector<int>> grid = {
         {1, 1, 1, 1},
@@ -96,6 +325,13 @@ int main() {
     // Optimal approach
     int distOptimal = optimalBFS(grid, n, m, source, destination);
     cout << "Optimal (BFS) Result: " << distOptimal << endl;
+    cout << "Grid Kernel Result: " << shortestPathKernel(Grid2D<uint8_t>::fromNested(grid, 0), source, destination) << endl;
+
+    // Informed searches, sharing one planner
+    GridPathPlanner planner(grid);
+    cout << "A* Result: " << planner.aStar(source, destination) << endl;
+    cout << "Jump Point Search Result: " << planner.jumpPointSearch(source, destination) << endl;
+    cout << "Jump Point Search (8-connected) Result: " << planner.jumpPointSearch(source, destination, 8) << endl;
     
     // Brute-force approach
     vector<vector<bool>> visited(n, vector<bool>(m, false));
@@ -109,3 +345,4 @@ int main() {
     
     return 0;
 }
+#endif
@@ -6,6 +6,8 @@
 #include <functional>
 #include <tuple>
 #include <algorithm>
+#include "disjoint_set.h"
+#include "grid_kernels.h"
 
 using namespace std;
 
@@ -98,6 +100,167 @@ int minEffortDijkstra(const vector<vector<int>>& heights) {
     return -1; // Path not possible
 }
 
+// Kruskal-style threshold search: add grid edges in order of weight until
+// the corners are in one set; the last weight added is the answer, since the
+// minimum effort is the bottleneck weight of the minimum spanning tree path.
+// Time Complexity: O(E log E) for the sort, E = 2*N*M edges
+// Space Complexity: O(N*M)
+int minEffortUnionFind(const vector<vector<int>>& heights) {
+    int rows = heights.size();
+    int cols = heights[0].size();
+    if (rows * cols == 1) return 0;
+
+    vector<tuple<int, int, int>> edges; // {weight, u, v}
+    edges.reserve(2 * rows * cols);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            int v = r * cols + c;
+            if (c + 1 < cols) edges.push_back({abs(heights[r][c + 1] - heights[r][c]), v, v + 1});
+            if (r + 1 < rows) edges.push_back({abs(heights[r + 1][c] - heights[r][c]), v, v + cols});
+        }
+    }
+    sort(edges.begin(), edges.end());
+
+    DisjointSet ds(rows * cols);
+    const int target = rows * cols - 1;
+    for (auto [w, u, v] : edges) {
+        ds.unionBySize(u, v);
+        if (ds.sameSet(0, target)) return w;
+    }
+    return -1;
+}
+
+// One bucket per effort value only pays while the height range is O(N*M):
+// a grid whose heights span 1e9 would need tens of GB of buckets.
+const long long MAX_BUCKETS_PER_CELL = 4;
+
+bool bucketsFit(long long lo, long long hi, int cells) {
+    return hi - lo + 1 <= MAX_BUCKETS_PER_CELL * cells;
+}
+
+// Dial's algorithm: Dijkstra with one bucket per effort value. Efforts are
+// height differences, so they lie in [0, maxHeight - minHeight]; buckets are
+// sized from that range and scanned once in increasing order, so there is no
+// heap and no log factor. Stale bucket entries are skipped when popped.
+// Ranges above MAX_BUCKETS_PER_CELL * N*M go to minEffortUnionFind instead.
+// Time Complexity: O(N*M + H), H = height range, capped at O(N*M log(N*M))
+// Space Complexity: O(N*M)
+int minEffortBucketQueue(const vector<vector<int>>& heights) {
+    int rows = heights.size();
+    int cols = heights[0].size();
+    int lo = numeric_limits<int>::max(), hi = numeric_limits<int>::min();
+    vector<int> h(rows * cols);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            h[r * cols + c] = heights[r][c];
+            lo = min(lo, heights[r][c]);
+            hi = max(hi, heights[r][c]);
+        }
+    }
+
+    if (!bucketsFit(lo, hi, rows * cols)) return minEffortUnionFind(heights);
+
+    const int target = rows * cols - 1;
+    vector<vector<int>> buckets((long long)hi - lo + 1);
+    vector<int> efforts(rows * cols, numeric_limits<int>::max());
+    efforts[0] = 0;
+    buckets[0].push_back(0);
+
+    for (int e = 0; e < (int)buckets.size(); ++e) {
+        // The bucket may grow while it is scanned (zero-cost moves).
+        for (size_t k = 0; k < buckets[e].size(); ++k) {
+            int v = buckets[e][k];
+            if (efforts[v] != e) continue;
+            if (v == target) return e;
+            int r = v / cols, c = v % cols;
+            auto relax = [&](int u) {
+                int next = max(e, abs(h[u] - h[v]));
+                if (next < efforts[u]) {
+                    efforts[u] = next;
+                    buckets[next].push_back(u);
+                }
+            };
+            if (r > 0) relax(v - cols);
+            if (r + 1 < rows) relax(v + cols);
+            if (c > 0) relax(v - 1);
+            if (c + 1 < cols) relax(v + 1);
+        }
+        vector<int>().swap(buckets[e]);
+    }
+    return -1;
+}
+
+enum class EffortEngine { Auto, BinaryHeap, BucketQueue, UnionFind };
+
+// Runs the given engine. Auto picks BucketQueue when the height range fits
+// MAX_BUCKETS_PER_CELL buckets per cell and UnionFind when it is too large
+// for one bucket per value.
+int minEffort(const vector<vector<int>>& heights, EffortEngine engine = EffortEngine::Auto) {
+    if (engine == EffortEngine::Auto) {
+        int lo = numeric_limits<int>::max(), hi = numeric_limits<int>::min();
+        for (const auto& row : heights) {
+            for (int x : row) {
+                lo = min(lo, x);
+                hi = max(hi, x);
+            }
+        }
+        int cells = heights.size() * heights[0].size();
+        engine = bucketsFit(lo, hi, cells) ? EffortEngine::BucketQueue : EffortEngine::UnionFind;
+    }
+    switch (engine) {
+        case EffortEngine::BucketQueue: return minEffortBucketQueue(heights);
+        case EffortEngine::UnionFind: return minEffortUnionFind(heights);
+        default: return minEffortDijkstra(heights);
+    }
+}
+
+
+// minEffortBucketQueue on sentinel-bordered grids, with the neighbour loop
+// unrolled at compile time (GridNeighbors<4>) instead of four bounds-checked
+// calls. Border efforts are 0, so no relaxation ever enters the border.
+// Wide height ranges fall back to minEffortUnionFind, as in the nested version.
+// Time Complexity: O(N*M + H), H = height range, capped at O(N*M log(N*M))
+// Space Complexity: O(N*M)
+int minEffortGridKernel(const vector<vector<int>>& heights) {
+    int rows = heights.size();
+    int cols = heights[0].size();
+    int lo = numeric_limits<int>::max(), hi = numeric_limits<int>::min();
+    for (const auto& row : heights) {
+        for (int x : row) {
+            lo = min(lo, x);
+            hi = max(hi, x);
+        }
+    }
+    if (!bucketsFit(lo, hi, rows * cols)) return minEffortUnionFind(heights);
+
+    Grid2D<int> h = Grid2D<int>::fromNested(heights, 0);
+    Grid2D<int> efforts(rows, cols, 0, numeric_limits<int>::max());
+
+    const int start = efforts.index(0, 0), target = efforts.index(rows - 1, cols - 1);
+    vector<vector<int>> buckets((long long)hi - lo + 1);
+    efforts[start] = 0;
+    buckets[0].push_back(start);
+
+    for (int e = 0; e < (int)buckets.size(); ++e) {
+        for (size_t k = 0; k < buckets[e].size(); ++k) {
+            int v = buckets[e][k];
+            if (efforts[v] != e) continue;
+            if (v == target) return e;
+            GridNeighbors<4>::forEach(efforts.stride(), [&](int delta) {
+                int u = v + delta;
+                int next = max(e, abs(h[u] - h[v]));
+                if (next < efforts[u]) {
+                    efforts[u] = next;
+                    buckets[next].push_back(u);
+                }
+            });
+        }
+        vector<int>().swap(buckets[e]);
+    }
+    return -1;
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<vector<int>> heights = {{1, 2, 2}, {3, 8, 2}, {5, 3, 5}};
     int rows = heights.size();
@@ -113,6 +276,15 @@ int main() {
     // Optimal approach
     int optimalResult = minEffortDijkstra(heights);
     cout << "Optimal (Dijkstra) Result: " << optimalResult << endl;
+
+    cout << "Bucket Queue Result: " << minEffort(heights, EffortEngine::BucketQueue) << endl;
+    cout << "Union-Find Result: " << minEffort(heights, EffortEngine::UnionFind) << endl;
+    cout << "Grid Kernel Result: " << minEffortGridKernel(heights) << endl;
+
+    // Heights spanning 1e9: one bucket per value would need about 24 GB
+    vector<vector<int>> tall = {{0, 1000000000, 7}, {500000000, 3, 999999999}};
+    cout << "Wide Range (Auto): " << minEffort(tall) << ", Dijkstra: " << minEffortDijkstra(tall) << endl;
     
     return 0;
 }
+#endif
@@ -2,6 +2,13 @@
 #include <vector>       
 #include <queue>        
 #include <climits>      
+#include <atomic>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <string>
+#include "csr_graph.h"
+#include "../common/parallel.h"
 
 using namespace std;
 
@@ -97,10 +104,179 @@ public:
         }
         return ways[n - 1];  // number of shortest paths to destination
     }
+
+    // -------- Parallel (Delta-Stepping + Path Counting) --------
+    // Phase 1 computes dist with delta-stepping: tentative distances are
+    // grouped into buckets of width delta, and all vertices of the current
+    // bucket relax their edges in parallel through an atomic min on dist.
+    // Light edges (wt <= delta) can refill the current bucket, so they are
+    // relaxed until it stays empty; heavy edges are relaxed once afterwards.
+    //
+    // Phase 2 counts ways from the final distances only, so racing
+    // relaxations with equal distances cannot double-count or lose a path.
+    // With every road time >= minWt, two vertices whose distances differ by
+    // less than minWt can't lie on each other's shortest paths, so each
+    // window of width minWt is counted in parallel by pulling from neighbours
+    // u with dist[u] + wt == dist[v].
+    //
+    // delta <= 0 picks maxWt / averageDegree; threads <= 0 uses all cores.
+    // Time Complexity: O(E + V log V) work (the sort within each bucket)
+    // Space Complexity: O(V + E)
+    int countPathsDeltaStepping(int n, vector<vector<int>>& roads, long long delta = 0, int threads = 0) {
+        long long minWt = LLONG_MAX, maxWt = 0;
+        for (auto& r : roads) {
+            minWt = min<long long>(minWt, r[2]);
+            maxWt = max<long long>(maxWt, r[2]);
+        }
+        if (roads.empty() || minWt <= 0) {
+            // Zero-time roads would put dependent vertices in the same window.
+            return countPathsOptimal(n, roads);
+        }
+        threads = resolveThreads(threads);
+        if (delta <= 0) delta = max(1LL, maxWt * n / (2LL * (long long)roads.size()));
+
+        CsrGraph g = csrFromEdges(n, roads, true);
+        vector<atomic<long long>> dist(n);
+        for (auto& d : dist) d.store(LLONG_MAX, memory_order_relaxed);
+
+        // Pending distances lie in [i*delta, i*delta + maxWt], so a cyclic
+        // array of buckets is enough.
+        const long long numBuckets = maxWt / delta + 2;
+        vector<vector<int>> buckets(numBuckets);
+        vector<vector<int>> requests(threads);  // per-thread improved vertices
+        vector<long long> stamp(n, -1);          // dedupe within a frontier
+        vector<int> settledAt(n, -1);
+        vector<int> order;                       // reachable vertices by dist
+        order.reserve(n);
+
+        auto tryImprove = [&](int v, long long nd) {
+            long long cur = dist[v].load(memory_order_relaxed);
+            while (nd < cur) {
+                if (dist[v].compare_exchange_weak(cur, nd, memory_order_relaxed)) return true;
+            }
+            return false;
+        };
+
+        // Relaxes the edges of frontier whose weight falls in the chosen class,
+        // then files every improved vertex into its new bucket. Returns how
+        // many bucket entries were added.
+        auto relax = [&](const vector<int>& frontier, bool light) {
+            parallelChunks((long long)frontier.size(), threads, [&](long long b, long long e, int t) {
+                for (long long k = b; k < e; k++) {
+                    int u = frontier[k];
+                    long long du = dist[u].load(memory_order_relaxed);
+                    CsrGraph::Range nbrs = g.adj(u), wts = g.adjWeights(u);
+                    for (int j = 0; j < nbrs.size(); j++) {
+                        if ((wts[j] <= delta) != light) continue;
+                        if (tryImprove(nbrs[j], du + wts[j])) requests[t].push_back(nbrs[j]);
+                    }
+                }
+            });
+            long long filed = 0;
+            for (auto& req : requests) {
+                for (int v : req) {
+                    buckets[(dist[v].load(memory_order_relaxed) / delta) % numBuckets].push_back(v);
+                }
+                filed += req.size();
+                req.clear();
+            }
+            return filed;
+        };
+
+        dist[0].store(0, memory_order_relaxed);
+        buckets[0].push_back(0);
+        long long pending = 1, frontierId = 0;
+        vector<int> frontier, settled;
+        for (long long i = 0; pending > 0; i++) {
+            vector<int>& bucket = buckets[i % numBuckets];
+            if (bucket.empty()) continue;
+
+            settled.clear();
+            while (!bucket.empty()) {
+                // Keep only entries whose current distance still lands in bucket i.
+                frontier.clear();
+                frontierId++;
+                for (int v : bucket) {
+                    if (dist[v].load(memory_order_relaxed) / delta != i || stamp[v] == frontierId) continue;
+                    stamp[v] = frontierId;
+                    frontier.push_back(v);
+                    if (settledAt[v] != i) {
+                        settledAt[v] = (int)i;
+                        settled.push_back(v);
+                    }
+                }
+                pending -= bucket.size();
+                bucket.clear();
+                pending += relax(frontier, true);
+            }
+            pending += relax(settled, false);
+
+            // Every vertex of bucket i is final now.
+            sort(settled.begin(), settled.end(), [&](int a, int b) {
+                return dist[a].load(memory_order_relaxed) < dist[b].load(memory_order_relaxed);
+            });
+            order.insert(order.end(), settled.begin(), settled.end());
+        }
+
+        // Phase 2: pull-based path counting, one distance window at a time.
+        vector<int> ways(n, 0);
+        ways[0] = 1;
+        size_t start = 1; // order[0] is the source
+        while (start < order.size()) {
+            long long windowEnd = dist[order[start]].load(memory_order_relaxed) + minWt;
+            size_t end = start;
+            while (end < order.size() && dist[order[end]].load(memory_order_relaxed) < windowEnd) end++;
+
+            auto countRange = [&](long long b, long long e, int) {
+                for (long long k = b; k < e; k++) {
+                    int v = order[start + k];
+                    long long dv = dist[v].load(memory_order_relaxed);
+                    CsrGraph::Range nbrs = g.adj(v), wts = g.adjWeights(v);
+                    long long total = 0;
+                    for (int j = 0; j < nbrs.size(); j++) {
+                        if (dist[nbrs[j]].load(memory_order_relaxed) + wts[j] == dv) {
+                            total += ways[nbrs[j]];
+                        }
+                    }
+                    ways[v] = (int)(total % MOD);
+                }
+            };
+            long long len = (long long)(end - start);
+            // Small windows are not worth a fork-join.
+            parallelChunks(len, len >= 4096 ? threads : 1, countRange);
+            start = end;
+        }
+        return ways[n - 1];
+    }
 };
 
+// Scaling benchmark: one random road network, delta-stepping at 1..N threads.
+void scalingBenchmark(int n, int m, unsigned seed) {
+    mt19937 rng(seed);
+    vector<vector<int>> roads;
+    roads.reserve(m);
+    for (int i = 1; i < n; ++i) roads.push_back({(int)(rng() % i), i, (int)(rng() % 3) + 1}); // keep it connected
+    while ((int)roads.size() < m) roads.push_back({(int)(rng() % n), (int)(rng() % n), (int)(rng() % 3) + 1});
 
-int main() {
+    Solution sol;
+    auto start = chrono::steady_clock::now();
+    int expected = sol.countPathsOptimal(n, roads);
+    double base = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "n = " << n << ", m = " << m << ", Dijkstra: " << base << " ms (ways = " << expected << ")" << endl;
+
+    int maxThreads = max(4, hardwareThreads());
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        start = chrono::steady_clock::now();
+        int got = sol.countPathsDeltaStepping(n, roads, 0, t);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        cout << "  delta-stepping, " << t << " thread(s): " << ms << " ms"
+             << (got == expected ? "" : "  MISMATCH") << endl;
+    }
+}
+
+
+// Pass "bench" to also time the variants on a 200000-node random graph.
+int main(int argc, char** argv) {
     Solution sol;
 
     vector<vector<int>> roads = {
@@ -119,6 +295,12 @@ int main() {
 
     cout << "BruteForce: " << sol.countPathsBruteForce(n, roads) << endl;
     cout << "Optimal: " << sol.countPathsOptimal(n, roads) << endl;
+    cout << "Delta-Stepping: " << sol.countPathsDeltaStepping(n, roads, 2, 2) << endl;
+
+    if (argc < 2 || string(argv[1]) != "bench") return 0;
+
+    cout << "\nScaling:" << endl;
+    scalingBenchmark(200000, 1000000, 7);
 
     return 0;
 }
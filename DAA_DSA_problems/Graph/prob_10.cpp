@@ -1,42 +1,163 @@
 //P010
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include "disjoint_set.h"
+#include "../common/parallel.h"
+#include "graph_file.h"
+#include "../common/temp_path.h"
 
 using namespace std;
 
-class DSU {
-    vector<int> parent, size;
+// Sharded makeConnected: the connections are spread over shards (machines)
+// that never ship their edges. Shard s owns the vertex range
+// [s * n / S, (s + 1) * n / S); the edges it stores may touch any vertex. A
+// vertex stored outside its owner's shard is a ghost there, and the owner
+// learns about it from that shard's ghost list. Touched vertices that are
+// ghosts or that other shards name as ghosts are the boundary vertices,
+// and they are the only ones that leave a shard.
+
+// What a shard, or a merged group of shards, reports: how many connections
+// it holds, how many distinct vertices they touch and in how many
+// components, and for every boundary vertex the component it is in
+// (labels 0..labels-1, numbered per summary).
+struct DsuSummary {
+    long long edges = 0;
+    long long vertices = 0;
+    long long components = 0;
+    int labels = 0;
+    vector<pair<int, int>> boundary; // {vertex, label}, sorted by vertex
+
+    // Connections that join vertices already connected.
+    long long redundant() const { return edges - (vertices - components); }
+
+    // Size of the summary on the wire.
+    long long bytes() const { return 3 * (long long)sizeof(long long) + sizeof(int) + 8LL * boundary.size(); }
+};
+
+// One shard's connections, unioned on a DSU over the vertices they touch
+// (numbered locally, so memory follows the shard, not n).
+class EdgeShard {
+    int lo, hi;
+    unordered_map<int, int> local;
+    vector<int> globalId;
+    DisjointSet dsu{0};
+    long long edgeCount = 0, merges = 0;
+
+    int localId(int v) {
+        auto [it, inserted] = local.emplace(v, (int)globalId.size());
+        if (inserted) {
+            globalId.push_back(v);
+            dsu.makeSet();
+        }
+        return it->second;
+    }
+
 public:
-    DSU(int n) {
-        parent.resize(n);
-        size.resize(n, 1);
-        for (int i = 0; i < n; i++) parent[i] = i;
+    // Time Complexity: O(E * alpha(E)) expected
+    // Space Complexity: O(vertices touched)
+    EdgeShard(int lo, int hi, const vector<vector<int>>& edges) : lo(lo), hi(hi) {
+        for (const auto& e : edges) {
+            int u = localId(e[0]), v = localId(e[1]);
+            edgeCount++;
+            if (dsu.unionBySize(u, v)) merges++;
+        }
     }
 
-    int find(int a) {
-        if (parent[a] == a) return a;
-        return parent[a] = find(parent[a]);  // path compression
+    // Touched vertices owned by another shard, sorted, to be sent to their
+    // owners.
+    vector<int> ghosts() const {
+        vector<int> g;
+        for (int v : globalId)
+            if (v < lo || v >= hi) g.push_back(v);
+        sort(g.begin(), g.end());
+        return g;
     }
 
-    bool unionSet(int a, int b) {
-        a = find(a);
-        b = find(b);
-        if (a == b) return false;  // already connected
-        if (size[a] < size[b]) swap(a, b);
-        parent[b] = a;
-        size[a] += size[b];
-        return true;
+    // Summary over the ghosts plus the owned vertices in exported (those
+    // other shards reported as ghosts); exported may hold vertices this
+    // shard never touched, which are skipped.
+    // Time Complexity: O(B log B) for B boundary vertices
+    // Space Complexity: O(B)
+    DsuSummary summarize(const vector<int>& exported) {
+        DsuSummary s;
+        s.edges = edgeCount;
+        s.vertices = (long long)globalId.size();
+        s.components = s.vertices - merges;
+        vector<int> boundary = ghosts();
+        for (int v : exported)
+            if (local.count(v)) boundary.push_back(v);
+        sort(boundary.begin(), boundary.end());
+        boundary.erase(unique(boundary.begin(), boundary.end()), boundary.end());
+
+        unordered_map<int, int> labelOf; // local root -> label
+        for (int v : boundary) {
+            int root = dsu.findParent(local.at(v));
+            auto [it, inserted] = labelOf.emplace(root, s.labels);
+            if (inserted) s.labels++;
+            s.boundary.push_back({v, it->second});
+        }
+        return s;
     }
 };
 
+// Combines two summaries of disjoint shard groups: a boundary vertex both
+// know joins its two components (when they differ, one component fewer)
+// and is counted once. The merged summary keeps every boundary vertex
+// either side had, so its size stays within the number of boundary
+// vertices.
+// Time Complexity: O(Ba + Bb)
+// Space Complexity: O(Ba + Bb)
+DsuSummary mergeSummaries(const DsuSummary& a, const DsuSummary& b) {
+    DisjointSet labels(a.labels + b.labels);
+    DsuSummary m;
+    m.edges = a.edges + b.edges;
+    m.vertices = a.vertices + b.vertices;
+    m.components = a.components + b.components;
+
+    vector<pair<int, int>> joined; // {vertex, label in the combined numbering}
+    joined.reserve(a.boundary.size() + b.boundary.size());
+    size_t i = 0, j = 0;
+    while (i < a.boundary.size() || j < b.boundary.size()) {
+        if (j == b.boundary.size() || (i < a.boundary.size() && a.boundary[i].first < b.boundary[j].first)) {
+            joined.push_back(a.boundary[i++]);
+        } else if (i == a.boundary.size() || b.boundary[j].first < a.boundary[i].first) {
+            joined.push_back({b.boundary[j].first, a.labels + b.boundary[j].second});
+            j++;
+        } else {
+            if (labels.unionBySize(a.boundary[i].second, a.labels + b.boundary[j].second)) m.components--;
+            m.vertices--;
+            joined.push_back(a.boundary[i]);
+            i++, j++;
+        }
+    }
+
+    vector<int> relabel(a.labels + b.labels, -1);
+    for (auto& [v, label] : joined) {
+        int& compact = relabel[labels.findParent(label)];
+        if (compact < 0) compact = m.labels++;
+        m.boundary.push_back({v, compact});
+    }
+    return m;
+}
+
+// Traffic of one makeConnectedSharded run.
+struct ShardExchange {
+    long long ghostBytes = 0;   // ghost lists sent to owners
+    long long summaryBytes = 0; // summaries sent up the merge tree
+    int mergeRounds = 0;
+};
+
 class Solution {
 public:
     // Brute Force (basic DSU)
     int makeConnectedBruteForce(int n, vector<vector<int>>& edges) {
-        DSU dsu(n);
+        DisjointSet dsu(n);
         int extraEdges = 0;
         for (auto& e : edges) {
-            if (!dsu.unionSet(e[0], e[1])) {
+            if (!dsu.unionBySize(e[0], e[1])) {
                 // edge connecting same component is extra
                 extraEdges++;
             }
@@ -45,7 +166,7 @@ public:
         // Count components
         int components = 0;
         for (int i = 0; i < n; i++) {
-            if (dsu.find(i) == i) components++;
+            if (dsu.findParent(i) == i) components++;
         }
 
         int needed = components - 1;
@@ -55,23 +176,128 @@ public:
 
     // Optimal (same approach but cleaner)
     int makeConnectedOptimal(int n, vector<vector<int>>& edges) {
-        DSU dsu(n);
+        DisjointSet dsu(n);
         int extraEdges = 0;
         for (auto& e : edges) {
-            if (!dsu.unionSet(e[0], e[1])) extraEdges++;
+            if (!dsu.unionBySize(e[0], e[1])) extraEdges++;
         }
 
         int components = 0;
         for (int i = 0; i < n; i++) {
-            if (dsu.find(i) == i) components++;
+            if (dsu.findParent(i) == i) components++;
         }
 
         int needed = components - 1;
         return (extraEdges >= needed) ? needed : -1;
     }
+
+    // Parallel (lock-free DSU, edges ingested by all threads at once)
+    // Every successful unite removes one component, so the number of extra
+    // edges follows from the merge count and needs no per-edge bookkeeping.
+    int makeConnectedParallel(int n, vector<vector<int>>& edges, int threads = 0) {
+        ConcurrentDisjointSet dsu(n);
+        vector<long long> merges(resolveThreads(threads), 0);
+        parallelChunks((long long)edges.size(), threads, [&](long long b, long long e, int t) {
+            long long local = 0;
+            for (long long i = b; i < e; i++) {
+                if (dsu.unite(edges[i][0], edges[i][1])) local++;
+            }
+            merges[t] = local;
+        });
+
+        long long merged = 0;
+        for (long long m : merges) merged += m;
+        int components = n - (int)merged;
+        long long extraEdges = (long long)edges.size() - merged;
+
+        int needed = components - 1;
+        return (extraEdges >= needed) ? needed : -1;
+    }
+
+    // Sharded: shards[s] holds the connections stored on shard s. Each shard
+    // runs its DSU locally, sends its ghost list to the owners, then emits
+    // its summary; summaries are merged pairwise, level by level (shard s
+    // with s + 1, then with s + 2, ...), and the root summary gives the
+    // answer. Nothing proportional to E crosses between shards: only ghost
+    // lists and summaries, both bounded by the boundary vertices, whose
+    // sizes are added to *exchange when given.
+    // Time Complexity: O(E * alpha(E) + B log B * log S) for B boundary vertices
+    // Space Complexity: O(vertices touched per shard + B)
+    int makeConnectedSharded(int n, const vector<vector<vector<int>>>& shards, ShardExchange* exchange = nullptr) {
+        int S = max(1, (int)shards.size());
+        auto rangeStart = [&](int s) { return (int)((long long)s * n / S); };
+        auto owner = [&](int v) {
+            int s = (int)((long long)v * S / n);
+            while (s + 1 < S && rangeStart(s + 1) <= v) s++;
+            while (rangeStart(s) > v) s--;
+            return s;
+        };
+
+        vector<EdgeShard> local;
+        local.reserve(S);
+        for (int s = 0; s < S; s++)
+            local.emplace_back(rangeStart(s), rangeStart(s + 1), s < (int)shards.size() ? shards[s] : vector<vector<int>>());
+
+        vector<vector<int>> exported(S);
+        long long ghostBytes = 0;
+        for (int s = 0; s < S; s++) {
+            for (int v : local[s].ghosts()) {
+                exported[owner(v)].push_back(v);
+                ghostBytes += sizeof(int);
+            }
+        }
+
+        vector<DsuSummary> level(S);
+        for (int s = 0; s < S; s++) level[s] = local[s].summarize(exported[s]);
+
+        long long summaryBytes = 0;
+        int rounds = 0;
+        for (int step = 1; step < S; step *= 2, rounds++) {
+            for (int s = 0; s + step < S; s += 2 * step) {
+                summaryBytes += level[s + step].bytes();
+                level[s] = mergeSummaries(level[s], level[s + step]);
+            }
+        }
+        if (exchange) {
+            exchange->ghostBytes += ghostBytes;
+            exchange->summaryBytes += summaryBytes;
+            exchange->mergeRounds = rounds;
+        }
+
+        const DsuSummary& all = level[0];
+        long long components = all.components + (n - all.vertices); // untouched vertices stand alone
+        long long needed = components - 1;
+        return (all.redundant() >= needed) ? (int)needed : -1;
+    }
+
+    // Same DSU pass straight over a mapped graph file: every stored edge
+    // u -> v is one connection, read from the neighbors array in place.
+    int makeConnectedMapped(const GraphView& g) {
+        DisjointSet dsu(g.V);
+        long long extraEdges = 0;
+        for (int u = 0; u < g.V; u++) {
+            for (int v : g.adj(u)) {
+                if (!dsu.unionBySize(u, v)) extraEdges++;
+            }
+        }
+
+        int components = 0;
+        for (int i = 0; i < g.V; i++) {
+            if (dsu.findParent(i) == i) components++;
+        }
+
+        int needed = components - 1;
+        return (extraEdges >= needed) ? needed : -1;
+    }
+
+    int makeConnectedFromFile(const string& path) {
+        MappedGraphFile file(path);
+        return makeConnectedMapped(file.graph());
+    }
 };
 
 
+#ifndef DAA_NO_MAIN
 int main() {
     Solution sol;
 
@@ -86,6 +312,38 @@ int main() {
     int n2 = 9;
     cout << "BruteForce Result 2: " << sol.makeConnectedBruteForce(n2, edges2) << endl;
     cout << "Optimal Result 2: " << sol.makeConnectedOptimal(n2, edges2) << endl;
+    cout << "Parallel Result 2: " << sol.makeConnectedParallel(n2, edges2, 4) << endl;
+
+    vector<vector<vector<int>>> shards2 = {
+        {{0,1}, {0,2}, {0,3}},
+        {{1,2}, {2,3}, {4,5}},
+        {{5,6}, {7,8}},
+    };
+    cout << "Sharded Result 2: " << sol.makeConnectedSharded(n2, shards2) << endl;
+
+    // A larger network spread over 16 shards, with mostly shard-local links
+    int n3 = 200000, S = 16;
+    mt19937 rng(10);
+    vector<vector<int>> edges3;
+    vector<vector<vector<int>>> shards3(S);
+    for (int i = 0; i < 220000; i++) {
+        int s = rng() % S, width = n3 / S;
+        int u = s * width + rng() % width;
+        int v = rng() % 50 ? s * width + rng() % width : rng() % n3;
+        edges3.push_back({u, v});
+        shards3[s].push_back({u, v});
+    }
+    ShardExchange exchange;
+    cout << "Optimal Result 3: " << sol.makeConnectedOptimal(n3, edges3) << endl;
+    cout << "Sharded Result 3: " << sol.makeConnectedSharded(n3, shards3, &exchange) << endl;
+    cout << "  exchanged " << exchange.ghostBytes + exchange.summaryBytes << " bytes in " << exchange.mergeRounds
+         << " rounds, vs " << edges3.size() * 2 * sizeof(int) << " bytes of edges" << endl;
+
+    string graphFile = tempFilePath("prob_10_graph.bin");
+    writeGraphFile(graphFile, csrFromEdges(n2, edges2));
+    cout << "Mapped File Result 2: " << sol.makeConnectedFromFile(graphFile) << endl;
+    remove(graphFile.c_str());
 
     return 0;
 }
+#endif
@@ -4,37 +4,11 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <queue>
+#include "disjoint_set.h"
+#include "../common/flat_hash_map.h"
 
 using namespace std;
 
-// Disjoint Set Union (Union-Find) data structure implementation
-class DSU {
-    vector<int> parent, size;
-public:
-    DSU(int n) {
-        parent.resize(n);
-        size.resize(n, 1);
-        for (int i = 0; i < n; i++) parent[i] = i;  // Initially each node is its own parent
-    }
-
-    // Find with path compression
-    int find(int a) {
-        if (parent[a] == a) return a;
-        return parent[a] = find(parent[a]);
-    }
-
-    // Union by size, returns true if union happened, false if already in same set
-    bool unionSet(int a, int b) {
-        a = find(a);
-        b = find(b);
-        if (a == b) return false;
-        if (size[a] < size[b]) swap(a, b);
-        parent[b] = a;
-        size[a] += size[b];
-        return true;
-    }
-};
-
 class Solution {
 public:
     // -------- Brute Force (Graph + DFS) --------
@@ -78,20 +52,20 @@ public:
     // -------- Optimal (DSU) --------
     int removeStonesOptimal(vector<vector<int>>& stones) {
         int n = stones.size();
-        DSU dsu(20000); // Large enough size to accommodate offset nodes
+        DisjointSet dsu(20000); // Large enough size to accommodate offset nodes
 
         // Use offset to differentiate between row and column indices
         // Union stones by their rows and columns
         for (auto& stone : stones) {
             int row = stone[0];
             int col = stone[1] + 10000; // offset columns to avoid collision with rows
-            dsu.unionSet(row, col);
+            dsu.unionBySize(row, col);
         }
 
         unordered_set<int> uniqueParents;
         // Find unique connected components by checking distinct parents of rows
         for (auto& stone : stones) {
-            uniqueParents.insert(dsu.find(stone[0]));
+            uniqueParents.insert(dsu.findParent(stone[0]));
         }
 
         // Maximum stones removed = total stones - number of connected components
@@ -99,6 +73,55 @@ public:
     }
 };
 
+// -------- Coordinate-compressed DSU, fed in batches --------
+// Every distinct row and column becomes a DSU node the first time a stone
+// uses it, through two flat hash maps, so memory is O(distinct rows + cols)
+// whatever the coordinate range. Each stone unions its row node with its
+// column node; rows and columns that end up linked form one component of
+// stones. Components = nodes created - successful unions, kept as a running
+// count, so removable() is O(1) after any batch. Stones are assumed distinct.
+// Time Complexity: O(alpha(n)) expected per stone
+// Space Complexity: O(n) for n stones
+class StoneComponents {
+    FlatHashMap<int, int> rowNode, colNode;
+    DisjointSet dsu{0};
+    long long stones = 0;
+    int components = 0;
+
+    int nodeFor(FlatHashMap<int, int>& map, int coord) {
+        auto [slot, inserted] = map.tryEmplace(coord);
+        if (inserted) {
+            *slot = dsu.makeSet();
+            components++;
+        }
+        return *slot;
+    }
+
+public:
+    explicit StoneComponents(size_t expectedStones = 0) : rowNode(expectedStones), colNode(expectedStones) {}
+
+    void addStone(int row, int col) {
+        int r = nodeFor(rowNode, row);
+        int c = nodeFor(colNode, col);
+        if (dsu.unionBySize(r, c)) components--;
+        stones++;
+    }
+
+    // One shard of {row, col} placements.
+    void addBatch(const vector<vector<int>>& batch) {
+        for (auto& stone : batch) addStone(stone[0], stone[1]);
+    }
+
+    int numComponents() const { return components; }
+    long long removable() const { return stones - components; }
+};
+
+int removeStonesCompressed(vector<vector<int>>& stones) {
+    StoneComponents sc(stones.size());
+    sc.addBatch(stones);
+    return (int) sc.removable();
+}
+
 int main() {
     Solution sol;
 
@@ -113,6 +136,13 @@ int main() {
 
     cout << "Brute Force result: " << sol.removeStonesBruteForce(stones) << endl;
     cout << "Optimal DSU result: " << sol.removeStonesOptimal(stones) << endl;
+    cout << "Compressed DSU result: " << removeStonesCompressed(stones) << endl;
+
+    // The same placements arriving as two shards, with far-apart coordinates
+    StoneComponents streamed;
+    streamed.addBatch({{0, 0}, {0, 1000000000}, {1000000000, 0}});
+    streamed.addBatch({{1, 2}, {2, 1}, {2, 2}});
+    cout << "Streamed batches result: " << streamed.removable() << endl;
 
     return 0;
 }
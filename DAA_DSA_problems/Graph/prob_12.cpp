@@ -1,6 +1,8 @@
 #include <iostream>
 #include <vector>
 #include <stack>
+#include "csr_graph.h"
+#include "dfs_visitor.h"
 using namespace std;
 
 class Solution {
@@ -73,6 +75,53 @@ public:
 
         return result;
     }
+
+    // -------- Optimal on CSR: Iterative DFS over flat arrays ------------
+    // Same traversal order as optimalDFS; the graph is built once with
+    // csrFromEdges(n, edges, true) and can be reused across calls.
+    vector<int> optimalDFS(const CsrGraph& g) {
+        vector<char> visited(g.V, 0);
+        vector<int> result;
+        vector<int> st;
+        st.push_back(0);
+
+        while (!st.empty()) {
+            int node = st.back();
+            st.pop_back();
+
+            if (!visited[node]) {
+                visited[node] = 1;
+                result.push_back(node + 1); // +1 for 1-based labels
+
+                CsrGraph::Range nbrs = g.adj(node);
+                for (int i = nbrs.size() - 1; i >= 0; --i) {
+                    if (!visited[nbrs[i]]) {
+                        st.push_back(nbrs[i]);
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+    // -------- Visitor DFS: shared iterative traversal ------------
+    // Preorder collected by an onDiscover hook; the (node, cursor) stack of
+    // IterativeDfs gives the recursive order without recursion.
+    struct PreorderVisitor : DfsVisitor {
+        vector<int>& out;
+        explicit PreorderVisitor(vector<int>& out) : out(out) {}
+        void onDiscover(int u, int) { out.push_back(u + 1); } // +1 for 1-based labels
+    };
+
+    vector<int> visitorDFS(const CsrGraph& g) {
+        vector<int> result;
+        if (g.V == 0) return result;
+        PreorderVisitor vis(result);
+        IterativeDfs dfs(g.V);
+        dfs.visit(g, 0, vis);
+        return result;
+    }
 };
 
 int main() {
@@ -94,5 +143,15 @@ int main() {
     for (int node : dfsIter) cout << node << " ";
     cout << "\n";
 
+    vector<int> dfsCsr = sol.optimalDFS(csrFromEdges(n, edges, true));
+    cout << "DFS Iterative (CSR): ";
+    for (int node : dfsCsr) cout << node << " ";
+    cout << "\n";
+
+    vector<int> dfsVisitor = sol.visitorDFS(csrFromEdges(n, edges, true));
+    cout << "DFS Visitor: ";
+    for (int node : dfsVisitor) cout << node << " ";
+    cout << "\n";
+
     return 0;
 }
@@ -1,6 +1,11 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include "grid2d.h"
+#include "grid_kernels.h"
 
 using namespace std;
 
@@ -81,6 +86,81 @@ vector<vector<int>> floodFillOptimal(vector<vector<int>>& image, int sr, int sc,
     return image;
 }
 
+// Flood fill on a flat image with the shared BFS kernel. The border is set
+// to newColor, which differs from the start colour, so it is never entered.
+// Iterative, so large regions cannot overflow the stack.
+// Time Complexity: O(M * N)
+// Space Complexity: O(M * N) for the frontier in the worst case
+void floodFillFlat(Grid2D<int>& image, int sr, int sc, int newColor) {
+    int start = image.index(sr, sc);
+    int initialColor = image[start];
+    if (initialColor == newColor) return;
+
+    image.fillBorder(newColor);
+    image[start] = newColor;
+    gridMultiSourceBfs(image, {start}, [&](int, int to) {
+        if (image[to] != initialColor) return false;
+        image[to] = newColor;
+        return true;
+    });
+}
+
+struct FloodFillOptions {
+    bool eightConnected = false; // also spread through diagonal pixels
+    int tolerance = 0;           // fill pixels within this distance of the seed colour
+};
+
+// Scanline (span) flood fill. Each step grows a pixel into the maximal run
+// of matching pixels on its row, writes the run with one std::fill, and
+// pushes one seed per matching run on the rows above and below, so the
+// explicit span stack holds runs rather than pixels and memory is walked
+// row by row.
+// With a tolerance the new colour may itself still match, so filled pixels
+// are tracked in a separate bitmap (1 bit per pixel).
+// Time Complexity: O(M * N)
+// Space Complexity: O(M * N / 64) for the bitmap plus the span stack
+void floodFillScanline(Grid2D<int>& image, int sr, int sc, int newColor, FloodFillOptions opt = {}) {
+    const int rows = image.rows(), cols = image.cols();
+    const long long seedColor = image.at(sr, sc);
+    if (opt.tolerance == 0 && seedColor == newColor) return;
+
+    const int wordsPerRow = (cols + 63) / 64;
+    vector<uint64_t> filled((size_t)rows * wordsPerRow, 0);
+    auto isFilled = [&](int r, int c) {
+        return filled[(size_t)r * wordsPerRow + (c >> 6)] >> (c & 63) & 1;
+    };
+    auto matches = [&](int r, int c) {
+        return !isFilled(r, c) && llabs(image.at(r, c) - seedColor) <= opt.tolerance;
+    };
+
+    const int reach = opt.eightConnected ? 1 : 0;
+    vector<pair<int, int>> spans = {{sr, sc}};
+    while (!spans.empty()) {
+        auto [r, c] = spans.back();
+        spans.pop_back();
+        if (!matches(r, c)) continue;
+
+        int left = c, right = c;
+        while (left > 0 && matches(r, left - 1)) left--;
+        while (right + 1 < cols && matches(r, right + 1)) right++;
+
+        fill(&image.at(r, left), &image.at(r, right) + 1, newColor);
+        for (int x = left; x <= right; x++) filled[(size_t)r * wordsPerRow + (x >> 6)] |= 1ULL << (x & 63);
+
+        // Seed the start of every matching run that touches this span.
+        int from = max(0, left - reach), to = min(cols - 1, right + reach);
+        for (int nr : {r - 1, r + 1}) {
+            if (nr < 0 || nr >= rows) continue;
+            bool inRun = false;
+            for (int x = from; x <= to; x++) {
+                bool m = matches(nr, x);
+                if (m && !inRun) spans.push_back({nr, x});
+                inRun = m;
+            }
+        }
+    }
+}
+
 // Helper function to print the image
 void printImage(const vector<vector<int>>& image) {
     for (const auto& row : image) {
@@ -91,6 +171,23 @@ void printImage(const vector<vector<int>>& image) {
     }
 }
 
+
+// floodFillFlat as an instantiation of the compile-time grid kernel
+// (grid_kernels.h), 4- or 8-connected; the colour test is an inlined lambda.
+// Time Complexity: O(M * N)
+// Space Complexity: O(M * N) for the frontier in the worst case
+template <int Connectivity = 4>
+void floodFillKernel(Grid2D<int>& image, int sr, int sc, int newColor) {
+    int start = image.index(sr, sc);
+    int initialColor = image[start];
+    if (initialColor == newColor) return;
+
+    image.fillBorder(newColor);
+    image[start] = newColor;
+    gridFlood<Connectivity>(image, {start}, [initialColor](int color) { return color == initialColor; }, newColor);
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<vector<int>> image1 = {
         {1, 1, 1},
@@ -113,6 +210,25 @@ int main() {
     vector<vector<int>> resultOptimal = floodFillOptimal(image2, startRow1, startCol1, newColor1);
     cout << "\nResult after Optimal (DFS):" << endl;
     printImage(resultOptimal);
+
+    // Test flat grid BFS (image1 is untouched by the brute-force version)
+    Grid2D<int> flat = Grid2D<int>::fromNested(image1, 0);
+    floodFillFlat(flat, startRow1, startCol1, newColor1);
+    cout << "\nResult after Flat Grid BFS:" << endl;
+    printImage(flat.toNested());
+
+    // Same fill on the compile-time grid kernel
+    Grid2D<int> kernel = Grid2D<int>::fromNested(image1, 0);
+    floodFillKernel(kernel, startRow1, startCol1, newColor1);
+    cout << "\nResult after Grid Kernel:" << endl;
+    printImage(kernel.toNested());
+
+    // Test scanline fill, 8-connected with tolerance 1
+    Grid2D<int> scan = Grid2D<int>::fromNested(image1, 0);
+    floodFillScanline(scan, startRow1, startCol1, newColor1, {true, 1});
+    cout << "\nResult after Scanline (8-connected, tolerance 1):" << endl;
+    printImage(scan.toNested());
     
     return 0;
 }
+#endif
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include "streaming_cycle.h"
 
 using namespace std;
 
@@ -76,6 +77,7 @@ bool isCycleOptimal(int V, const vector<vector<int>>& adj) {
     return false;
 }
 
+#ifndef DAA_NO_MAIN
 int main() {
     // Example 1: Graph with a cycle (0-1-2-0)
     int V1 = 3;
@@ -95,5 +97,23 @@ int main() {
     cout << "Optimal (Adjacency List): " << (isCycleOptimal(V2, adj2) ? "Cycle detected." : "No cycle detected.") << endl;
     cout << "Brute-Force (Adjacency Matrix): " << (isCycleBruteForce(V2, adjMatrix2) ? "Cycle detected." : "No cycle detected.") << endl;
 
+    // Example 3: edges streamed one at a time, O(V) memory
+    vector<pair<int, int>> stream = {{0, 1}, {1, 2}, {2, 3}, {3, 1}, {3, 4}};
+    size_t pos = 0;
+    StreamingCycleDetector detector(5);
+    detector.consume([&](int& u, int& v) {
+        if (pos == stream.size()) return false;
+        tie(u, v) = stream[pos++];
+        return true;
+    });
+    cout << "\nExample 3 (streamed edges):" << endl;
+    if (detector.hasCycle()) {
+        cout << "Streaming (Union-Find): Cycle detected at edge " << detector.cycleEdge().first << "-"
+             << detector.cycleEdge().second << " after " << detector.edgesRead() << " edges." << endl;
+    } else {
+        cout << "Streaming (Union-Find): No cycle detected." << endl;
+    }
+
     return 0;
 }
+#endif
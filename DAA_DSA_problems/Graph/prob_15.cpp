@@ -1,6 +1,8 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include "streaming_cycle.h"
+#include "dfs_visitor.h"
 
 using namespace std;
 
@@ -47,6 +49,29 @@ bool hasCycleDFS(int node, int parent, const vector<vector<int>>& adjList, vecto
     return false;
 }
 
+// Iterative cycle check on the shared visitor DFS: a back edge that does not
+// lead to the node's own DFS parent closes a cycle. Covers every component
+// and cannot overflow the call stack on long paths.
+// Time Complexity: O(V + E)
+// Space Complexity: O(V)
+struct UndirectedCycleVisitor : DfsVisitor {
+    vector<int> parent;
+    bool found = false;
+
+    explicit UndirectedCycleVisitor(int V) : parent(V, -1) {}
+    void onDiscover(int u, int p) { parent[u] = p; }
+    void onBackEdge(int u, int v, int) {
+        if (v != parent[u]) found = true;
+    }
+    bool stop() const { return found; }
+};
+
+bool hasCycleIterative(const CsrGraph& g) {
+    UndirectedCycleVisitor vis(g.V);
+    depthFirstSearch(g, vis);
+    return vis.found;
+}
+
 int main() {
     // --- Example 1: Graph with a cycle (0-1-2-0)
     int numVertices1 = 3;
@@ -59,6 +84,7 @@ int main() {
     
     vector<bool> visited2(numVertices1, false);
     cout << "  Optimal (DFS on List): " << (hasCycleDFS(0, -1, adjList1, visited2) ? "Cycle detected." : "No cycle detected.") << endl;
+    cout << "  Iterative (Visitor DFS): " << (hasCycleIterative(csrFromAdjacency(adjList1)) ? "Cycle detected." : "No cycle detected.") << endl;
     
     // --- Example 2: Graph without a cycle (a tree structure)
     int numVertices2 = 4;
@@ -71,6 +97,16 @@ int main() {
     
     vector<bool> visited5(numVertices2, false);
     cout << "  Optimal (DFS on List): " << (hasCycleDFS(0, -1, adjList2, visited5) ? "Cycle detected." : "No cycle detected.") << endl;
+    cout << "  Iterative (Visitor DFS): " << (hasCycleIterative(csrFromAdjacency(adjList2)) ? "Cycle detected." : "No cycle detected.") << endl;
+
+    // Same graph streamed edge by edge (u < v keeps each undirected edge once)
+    StreamingCycleDetector detector(numVertices2);
+    for (int u = 0; u < numVertices2; ++u) {
+        for (int v : adjList2[u]) {
+            if (u < v) detector.addEdge(u, v);
+        }
+    }
+    cout << "  Streaming (Union-Find): " << (detector.hasCycle() ? "Cycle detected." : "No cycle detected.") << endl;
     
     return 0;
 }
@@ -1,6 +1,14 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "grid_kernels.h"
 
 using namespace std;
 
@@ -117,6 +125,193 @@ vector<vector<char>> fillOptimal(int n, int m, vector<vector<char>> mat) {
     return mat;
 }
 
+// Bit-packed board: bit c % 64 of word c / 64 of a row is set when cell c is 'O'.
+// Padding bits past the last column are always 0.
+struct BitBoard {
+    int rows = 0, cols = 0, words = 0;
+    vector<uint64_t> open;
+
+    BitBoard(int n, int m) : rows(n), cols(m), words((m + 63) / 64), open((size_t)n * words, 0) {}
+
+    uint64_t* row(int r) { return open.data() + (size_t)r * words; }
+    const uint64_t* row(int r) const { return open.data() + (size_t)r * words; }
+
+    void packRow(int r, const char* cells) {
+        uint64_t* out = row(r);
+        for (int c = 0; c < cols; ++c) {
+            if (cells[c] == 'O') out[c >> 6] |= 1ULL << (c & 63);
+        }
+    }
+};
+
+static inline uint64_t reverseBits(uint64_t x) {
+    x = __builtin_bswap64(x);
+    x = (x & 0x0F0F0F0F0F0F0F0FULL) << 4 | (x >> 4 & 0x0F0F0F0F0F0F0F0FULL);
+    x = (x & 0x3333333333333333ULL) << 2 | (x >> 2 & 0x3333333333333333ULL);
+    x = (x & 0x5555555555555555ULL) << 1 | (x >> 1 & 0x5555555555555555ULL);
+    return x;
+}
+
+// Grows every seed bit to the whole run of set bits of `open` that holds it,
+// in O(words) instead of one shift per cell. Seeds spread towards higher bits
+// through the carry of open + seeds (the carry ripples exactly to the end of
+// a run), and towards lower bits by the same addition on the bit-reversed row.
+// seeds must be a subset of open; up is scratch of at least `words` words.
+static void fillRuns(const uint64_t* open, uint64_t* seeds, int words, uint64_t* up) {
+    unsigned carry = 0;
+    for (int w = 0; w < words; ++w) {
+        unsigned __int128 t = (unsigned __int128)open[w] + seeds[w] + carry;
+        uint64_t sum = (uint64_t)t;
+        carry = (unsigned)(t >> 64);
+        up[w] = (((sum ^ open[w]) | seeds[w]) & open[w]);
+    }
+    carry = 0;
+    for (int w = words - 1; w >= 0; --w) {
+        uint64_t o = reverseBits(open[w]), s = reverseBits(seeds[w]);
+        unsigned __int128 t = (unsigned __int128)o + s + carry;
+        uint64_t sum = (uint64_t)t;
+        carry = (unsigned)(t >> 64);
+        seeds[w] = up[w] | reverseBits(((sum ^ o) | s) & o);
+    }
+}
+
+// Cells of open that are 4-connected to the board's border, as a bitmap in
+// the same layout. Seeds are the open border cells; rows are then swept top
+// to bottom and bottom to top, each row taking the reached cells of its
+// neighbour row and filling them out to whole runs, until a pair of sweeps
+// changes nothing. Every step is a word-wide AND/OR/add.
+// Time Complexity: O(N*M / 64) per sweep pair. Each pair follows a path
+// across any number of runs but only through one change of vertical
+// direction, so a winding corridor (bands of short up-and-down zigzags)
+// needs Theta(N*M) pairs, O((N*M)^2 / 64) in total. Open areas settle in
+// a few pairs
+// Space Complexity: O(N*M / 64)
+vector<uint64_t> borderReachable(const BitBoard& board) {
+    const int n = board.rows, m = board.cols, W = board.words;
+    vector<uint64_t> reach((size_t)n * W, 0);
+    if (n == 0 || m == 0) return reach;
+    auto R = [&](int r) { return reach.data() + (size_t)r * W; };
+
+    for (int w = 0; w < W; ++w) {
+        R(0)[w] = board.row(0)[w];
+        R(n - 1)[w] = board.row(n - 1)[w];
+    }
+    for (int r = 0; r < n; ++r) {
+        R(r)[0] |= board.row(r)[0] & 1ULL;
+        R(r)[(m - 1) >> 6] |= board.row(r)[(m - 1) >> 6] & (1ULL << ((m - 1) & 63));
+    }
+
+    vector<uint64_t> seed(W), scratch(W);
+    auto relaxRow = [&](int r, int from) {
+        const uint64_t* open = board.row(r);
+        bool grew = false;
+        for (int w = 0; w < W; ++w) seed[w] = R(r)[w] | (R(from)[w] & open[w]);
+        fillRuns(open, seed.data(), W, scratch.data());
+        for (int w = 0; w < W; ++w) {
+            grew |= seed[w] != R(r)[w];
+            R(r)[w] = seed[w];
+        }
+        return grew;
+    };
+
+    for (int r = 0; r < n; ++r) fillRuns(board.row(r), R(r), W, scratch.data());
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int r = 1; r < n; ++r) changed |= relaxRow(r, r - 1);
+        for (int r = n - 2; r >= 0; --r) changed |= relaxRow(r, r + 1);
+    }
+    return reach;
+}
+
+// In-place bit-packed version of fillOptimal: 'O's not reachable from the
+// border become 'X'. No copy of mat and no recursion.
+// Time Complexity: O(N*M) to pack and unpack, O(N*M / 64) per sweep pair
+// Space Complexity: O(N*M / 32) bits
+void fillBitPacked(vector<vector<char>>& mat) {
+    int n = mat.size(), m = n ? mat[0].size() : 0;
+    BitBoard board(n, m);
+    for (int r = 0; r < n; ++r) board.packRow(r, mat[r].data());
+    vector<uint64_t> reach = borderReachable(board);
+    for (int r = 0; r < n; ++r) {
+        const uint64_t* keep = reach.data() + (size_t)r * board.words;
+        for (int c = 0; c < m; ++c) {
+            if (mat[r][c] == 'O' && !(keep[c >> 6] >> (c & 63) & 1)) mat[r][c] = 'X';
+        }
+    }
+}
+
+// Same solver for a board stored in a file as n lines of m 'X'/'O' characters,
+// each ending in '\n'. The file is mapped one band of bandRows rows at a
+// time, both to pack it and to write the result back in place, so only the
+// 2 bits per cell of the packed board and its reach map stay resident; the
+// board itself may be larger than memory.
+// Time Complexity: O(N*M) sequential I/O plus the bit sweeps
+// Space Complexity: O(N*M / 32) bits plus one band mapping
+void fillMappedFile(const string& path, int n, int m, int bandRows = 4096) {
+    if (n < 0 || m < 0) throw invalid_argument("board dimensions must be non-negative");
+    if (bandRows <= 0) throw invalid_argument("bandRows must be positive");
+    int fd = open(path.c_str(), O_RDWR);
+    if (fd < 0) throw runtime_error("cannot open board file " + path);
+    // Closes fd on every exit, including throws from BitBoard or borderReachable.
+    struct FdCloser {
+        int fd;
+        ~FdCloser() { close(fd); }
+    } closer{fd};
+    const size_t lineBytes = (size_t)m + 1;
+    struct stat st;
+    if (fstat(fd, &st) != 0) throw runtime_error("cannot stat board file " + path);
+    // A band mapped past EOF faults with SIGBUS, so a short file is rejected here.
+    if ((unsigned long long)st.st_size < (unsigned long long)n * lineBytes) {
+        throw runtime_error("board file " + path + " is shorter than " + to_string(n) + " rows of " + to_string(m) + " cells");
+    }
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+
+    // Calls fn(r, rowChars) for every row, one mapped band at a time.
+    auto forEachBand = [&](bool write, auto&& fn) {
+        for (int r0 = 0; r0 < n; r0 += bandRows) {
+            int r1 = min(n, r0 + bandRows);
+            size_t begin = (size_t)r0 * lineBytes, end = (size_t)r1 * lineBytes;
+            size_t aligned = begin / page * page;
+            size_t length = end - aligned;
+            void* base = mmap(nullptr, length, write ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, aligned);
+            if (base == MAP_FAILED) throw runtime_error("cannot map board file " + path);
+            madvise(base, length, MADV_SEQUENTIAL);
+            char* band = static_cast<char*>(base) + (begin - aligned);
+            for (int r = r0; r < r1; ++r) fn(r, band + (r - r0) * lineBytes);
+            munmap(base, length);
+        }
+    };
+
+    BitBoard board(n, m);
+    forEachBand(false, [&](int r, char* cells) { board.packRow(r, cells); });
+    vector<uint64_t> reach = borderReachable(board);
+    forEachBand(true, [&](int r, char* cells) {
+        const uint64_t* keep = reach.data() + (size_t)r * board.words;
+        for (int c = 0; c < m; ++c) {
+            if (cells[c] == 'O' && !(keep[c >> 6] >> (c & 63) & 1)) cells[c] = 'X';
+        }
+    });
+}
+
+
+// fillOptimal as an instantiation of the compile-time grid kernel
+// (grid_kernels.h) on a board with an 'X' border: 'O's on the edge seed one
+// iterative flood that marks them '#', then one pass flips the rest.
+// In place, and no recursion.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N*M) for the frontier in the worst case
+void fillKernel(Grid2D<char>& board) {
+    vector<int> seeds = gridBoundarySeeds(board, CellEquals<'O'>(), '#');
+    gridFlood<4>(board, std::move(seeds), CellEquals<'O'>(), '#');
+    for (int r = 0; r < board.rows(); ++r) {
+        for (int i = board.index(r, 0), end = i + board.cols(); i < end; ++i) {
+            board[i] = board[i] == '#' ? 'O' : 'X';
+        }
+    }
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<vector<char>> mat{
         {'X', 'X', 'X', 'X'},
@@ -155,5 +350,26 @@ int main() {
         cout << "\n";
     }
 
+    // Compile-time grid kernel
+    Grid2D<char> kernel = Grid2D<char>::fromNested(mat, 'X');
+    fillKernel(kernel);
+    cout << "\nResult (Grid Kernel):\n";
+    for (const auto& row : kernel.toNested()) {
+        for (char c : row) cout << c << " ";
+        cout << "\n";
+    }
+
+    // Bit-packed, in place
+    vector<vector<char>> packed = mat;
+    fillBitPacked(packed);
+    cout << "\nResult (Bit-Packed):\n";
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < m; j++) {
+            cout << packed[i][j] << " ";
+        }
+        cout << "\n";
+    }
+
     return 0;
 }
+#endif
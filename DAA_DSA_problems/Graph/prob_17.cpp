@@ -1,6 +1,9 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <cstdint>
+#include "grid2d.h"
+#include "grid_kernels.h"
 using namespace std;
 
 class Solution {
@@ -57,6 +60,61 @@ public:
     }
 };
 
+// Same boundary-seeded BFS on a flat grid with a water (0) border. Reachable
+// land is marked 2 in place, so no separate visited grid is needed.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N + M) seeds plus the BFS frontier
+int numberOfEnclavesFlat(Grid2D<uint8_t> &grid) {
+    int n = grid.rows(), m = grid.cols();
+    vector<int> seeds;
+    auto seed = [&](int r, int c) {
+        int i = grid.index(r, c);
+        if (grid[i] == 1) {
+            grid[i] = 2;
+            seeds.push_back(i);
+        }
+    };
+    for (int j = 0; j < m; j++) {
+        seed(0, j);
+        seed(n - 1, j);
+    }
+    for (int i = 0; i < n; i++) {
+        seed(i, 0);
+        seed(i, m - 1);
+    }
+
+    gridMultiSourceBfs(grid, seeds, [&](int, int to) {
+        if (grid[to] != 1) return false;
+        grid[to] = 2;
+        return true;
+    });
+
+    int cnt = 0;
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < m; j++)
+            cnt += grid.at(i, j) == 1;
+    return cnt;
+}
+
+
+// numberOfEnclavesFlat as an instantiation of the compile-time grid kernel
+// (grid_kernels.h): land(cell) and mark pick the cell type, e.g.
+// CellEquals<1>() and 2 on a Grid2D<uint8_t>, or CellSet() and false on a
+// BitGrid2D, where reaching a land cell clears its bit.
+// Time Complexity: O(N*M)
+// Space Complexity: O(N*M) for the frontier in the worst case
+template <class Grid, class Land, class Mark>
+int numberOfEnclavesKernel(Grid &grid, Land land, Mark mark) {
+    vector<int> seeds = gridBoundarySeeds(grid, land, mark);
+    gridFlood<4>(grid, std::move(seeds), land, mark);
+    int cnt = 0;
+    for (int r = 0; r < grid.rows(); r++)
+        for (int i = grid.index(r, 0), end = i + grid.cols(); i < end; i++)
+            cnt += land(cellAt(grid, i));
+    return cnt;
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     vector<vector<int>> grid{
         {0, 0, 0, 0},
@@ -66,4 +124,13 @@ int main() {
         
     Solution obj;
     cout << obj.numberOfEnclaves(grid) << endl;  // Expected output = 3
+
+    Grid2D<uint8_t> flat = Grid2D<uint8_t>::fromNested(grid, 0);
+    cout << numberOfEnclavesFlat(flat) << endl;
+
+    Grid2D<uint8_t> bytes = Grid2D<uint8_t>::fromNested(grid, 0);
+    cout << numberOfEnclavesKernel(bytes, CellEquals<1>(), 2) << endl;
+    BitGrid2D bits = BitGrid2D::fromNested(grid, [](int cell) { return cell == 1; });
+    cout << numberOfEnclavesKernel(bits, CellSet(), false) << endl;
 }
+#endif
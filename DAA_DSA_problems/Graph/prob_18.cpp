@@ -2,6 +2,9 @@
 #include<queue>
 #include<vector>
 #include<unordered_set>
+#include <cstdint>
+#include <string>
+#include "wildcard_index.h"
 using namespace std;
  
 class Solution
@@ -54,7 +57,111 @@ public:
         return 0;
     }
 };
+
+// Bidirectional BFS over a WildcardIndex. The dictionary is indexed once and
+// every query runs on word ids: two searches grow from the start and the
+// target, always expanding the smaller frontier by one whole level, and stop
+// at the first level where they touch. Each bucket is expanded at most once
+// per side, so a query costs O(sum of L) even when buckets are large.
+// Per-query state is stamped with a generation number, so a query only pays
+// for the nodes it touches. Not safe to query from several threads at once.
+// Time Complexity: O(N * L^2) build, O(touched words * L) per query
+// Space Complexity: O(N * L)
+class BidirectionalLadder {
+    WildcardIndex index;
+    int n;
+
+    // side 0 grows from the start, side 1 from the target.
+    vector<int> dist[2];
+    vector<uint32_t> seen[2], bucketSeen[2];
+    uint32_t generation = 0;
+
+    void newGeneration() {
+        if (++generation == 0) {
+            for (int s = 0; s < 2; s++) {
+                fill(seen[s].begin(), seen[s].end(), 0);
+                fill(bucketSeen[s].begin(), bucketSeen[s].end(), 0);
+            }
+            generation = 1;
+        }
+    }
+
+    void visit(int side, int v, int d) {
+        seen[side][v] = generation;
+        dist[side][v] = d;
+    }
+
+public:
+    explicit BidirectionalLadder(const vector<string> &wordList)
+        : index(wordList), n(index.size())
+    {
+        // Node n stands for a start word that is not itself in the dictionary.
+        for (int s = 0; s < 2; s++)
+        {
+            dist[s].assign(n + 1, 0);
+            seen[s].assign(n + 1, 0);
+            bucketSeen[s].assign(index.numBuckets(), 0);
+        }
+    }
+
+    // Same contract as Solution::wordLadderLength: number of words in the
+    // shortest ladder, 0 if there is none.
+    int ladderLength(const string &startWord, const string &targetWord)
+    {
+        if (startWord == targetWord)
+            return 1;
+        int target = index.find(targetWord);
+        if (target < 0)
+            return 0;
+
+        newGeneration();
+        int start = index.find(startWord);
+        vector<int> startBuckets;
+        if (start < 0)
+        {
+            start = n;
+            startBuckets = index.bucketsOf(startWord);
+        }
+        const CsrGraph::Range startRange = {startBuckets.data(), startBuckets.data() + startBuckets.size()};
+        vector<int> frontier[2] = {{start}, {target}}, next;
+        visit(0, start, 0);
+        visit(1, target, 0);
+
+        while (!frontier[0].empty() && !frontier[1].empty())
+        {
+            int side = frontier[0].size() <= frontier[1].size() ? 0 : 1;
+            int other = 1 - side;
+            int best = INT32_MAX;
+            next.clear();
+            for (int u : frontier[side])
+            {
+                for (int b : u == n ? startRange : index.bucketsOf(u))
+                {
+                    if (bucketSeen[side][b] == generation)
+                        continue;
+                    bucketSeen[side][b] = generation;
+                    for (int v : index.members(b))
+                    {
+                        if (seen[other][v] == generation)
+                            best = min(best, dist[side][u] + 1 + dist[other][v]);
+                        if (seen[side][v] != generation)
+                        {
+                            visit(side, v, dist[side][u] + 1);
+                            next.push_back(v);
+                        }
+                    }
+                }
+            }
+            // best counts edges; the ladder length counts words.
+            if (best != INT32_MAX)
+                return best + 1;
+            frontier[side].swap(next);
+        }
+        return 0;
+    }
+};
  
+#ifndef DAA_NO_MAIN
 int main()
 {
  
@@ -67,5 +174,10 @@ int main()
  
     cout << ans;
     cout << endl;
+
+    BidirectionalLadder ladder(wordList);
+    cout << ladder.ladderLength(startWord, targetWord);
+    cout << endl;
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -3,6 +3,9 @@
 #include <unordered_set>
 #include<queue>
 #include <algorithm>
+#include <string>
+#include "wildcard_index.h"
+#include "../common/alloc_profile.h"
 using namespace std;
 
 class Solution
@@ -89,6 +92,191 @@ public:
     }
 };
 
+// Layered parent DAG of all shortest ladders, built with one BFS over word ids.
+//
+// Words and wildcard buckets (see WildcardIndex) are both DAG nodes: word v on
+// level d + 1 points at the level-d buckets it was reached through, and each
+// of those buckets at the level-d words that expanded it. Two words differing
+// in one position share exactly one bucket, so every word -> bucket -> word
+// route is one distinct ladder step. Parents are kept per bucket instead of
+// per word pair, so the DAG holds O(N * L) edges even when buckets are large.
+// No partial path is stored during the BFS; sequences are recovered by
+// walking parents back from the end word (see SequenceIterator).
+// Time Complexity: O(N * L^2) including the index build
+// Space Complexity: O(N * L)
+class ParentDag
+{
+    friend class SequenceIterator;
+
+    WildcardIndex index;
+    string beginWord;
+    int start = -1, end = -1; // start == index.size() if beginWord is not a dictionary word
+    vector<vector<int>> wordParents;   // word -> buckets one level up
+    vector<vector<int>> bucketParents; // bucket -> words on its level
+
+public:
+    ParentDag(const string &beginWord, const string &endWord, const vector<string> &wordList)
+        : index(wordList), beginWord(beginWord)
+    {
+        const int n = index.size();
+        start = index.find(beginWord);
+        vector<int> startBuckets;
+        if (start < 0)
+        {
+            start = n;
+            startBuckets = index.bucketsOf(beginWord);
+        }
+        if (beginWord == endWord)
+        {
+            end = start;
+            return;
+        }
+        int target = index.find(endWord);
+        if (target < 0)
+            return;
+
+        wordParents.assign(n + 1, {});
+        bucketParents.assign(index.numBuckets(), {});
+        vector<int> wordLevel(n + 1, -1), bucketLevel(index.numBuckets(), -1);
+        vector<int> level = {start}, buckets, next;
+        wordLevel[start] = 0;
+        for (int d = 0; !level.empty() && wordLevel[target] < 0; d++)
+        {
+            buckets.clear();
+            for (int u : level)
+            {
+                for (int b : u == n ? CsrGraph::Range{startBuckets.data(), startBuckets.data() + startBuckets.size()}
+                                    : index.bucketsOf(u))
+                {
+                    if (bucketLevel[b] < 0)
+                    {
+                        bucketLevel[b] = d;
+                        buckets.push_back(b);
+                    }
+                    if (bucketLevel[b] == d)
+                        bucketParents[b].push_back(u);
+                }
+            }
+            next.clear();
+            for (int b : buckets)
+            {
+                for (int v : index.members(b))
+                {
+                    if (wordLevel[v] < 0)
+                    {
+                        wordLevel[v] = d + 1;
+                        next.push_back(v);
+                    }
+                    if (wordLevel[v] == d + 1)
+                        wordParents[v].push_back(b);
+                }
+            }
+            level.swap(next);
+        }
+        if (wordLevel[target] >= 0)
+            end = target;
+    }
+
+    bool reachable() const { return end >= 0; }
+
+    const string &word(int node) const
+    {
+        return node == index.size() ? beginWord : index.word(node);
+    }
+};
+
+// Streams the shortest sequences of a ParentDag one at a time, holding only
+// the current path and one parent cursor per word on it.
+// Time Complexity: O(L) amortized DAG steps per sequence
+// Space Complexity: O(L) besides the DAG
+class SequenceIterator
+{
+    const ParentDag &dag;
+    vector<int> path;                 // end word first
+    vector<pair<int, int>> cursor;    // per path word: {bucket, word within bucket}
+    bool started = false;
+
+    int parentOf(int depth) const
+    {
+        int b = dag.wordParents[path[depth]][cursor[depth].first];
+        return dag.bucketParents[b][cursor[depth].second];
+    }
+
+    // Extends the path along the current cursors until it reaches start.
+    void descend()
+    {
+        while (path.back() != dag.start)
+        {
+            int u = parentOf((int)path.size() - 1);
+            path.push_back(u);
+            cursor.push_back({0, 0});
+        }
+    }
+
+    // Moves the deepest cursor that still has an untried parent one step on.
+    bool advance()
+    {
+        path.pop_back(); // start has no parents to try
+        cursor.pop_back();
+        while (!path.empty())
+        {
+            int v = path.back();
+            auto &c = cursor.back();
+            int b = dag.wordParents[v][c.first];
+            if (++c.second == (int)dag.bucketParents[b].size())
+            {
+                c.second = 0;
+                if (++c.first == (int)dag.wordParents[v].size())
+                {
+                    path.pop_back();
+                    cursor.pop_back();
+                    continue;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+public:
+    explicit SequenceIterator(const ParentDag &dag) : dag(dag) {}
+
+    // Writes the next sequence (begin word first) into seq; false when done.
+    bool next(vector<string> &seq)
+    {
+        if (!started)
+        {
+            started = true;
+            if (!dag.reachable())
+                return false;
+            path = {dag.end};
+            cursor = {{0, 0}};
+        }
+        else if (path.empty() || !advance())
+        {
+            return false;
+        }
+        descend();
+        seq.clear();
+        for (int i = (int)path.size() - 1; i >= 0; i--)
+            seq.push_back(dag.word(path[i]));
+        return true;
+    }
+};
+
+// Same answer as Solution::findSequences, via the parent DAG.
+vector<vector<string>> findSequencesDag(const string &beginWord, const string &endWord,
+                                        const vector<string> &wordList)
+{
+    ParentDag dag(beginWord, endWord, wordList);
+    SequenceIterator it(dag);
+    vector<vector<string>> ans;
+    vector<string> seq;
+    while (it.next(seq))
+        ans.push_back(seq);
+    return ans;
+}
+
 // A comparator function to sort the answer.
 bool comp(vector<string> a, vector<string> b)
 {
@@ -101,13 +289,18 @@ bool comp(vector<string> a, vector<string> b)
     return x < y;
 }
 
+#ifndef DAA_NO_MAIN
 int main()
 {
 
     vector<string> wordList = {"des", "der", "dfr", "dgt", "dfs"};
     string startWord = "der", targetWord = "dfs";
     Solution obj;
-    vector<vector<string>> ans = obj.findSequences(startWord, targetWord, wordList);
+    vector<vector<string>> ans;
+    {
+        DAA_ALLOC_SCOPE("findSequences");
+        ans = obj.findSequences(startWord, targetWord, wordList);
+    }
     
     // If no transformation sequence is possible.
     if (ans.size() == 0)
@@ -125,5 +318,18 @@ int main()
         }
     }
 
+    // Stream the same sequences from the parent DAG
+    DAA_ALLOC_SCOPE("findSequencesDag");
+    ParentDag dag(startWord, targetWord, wordList);
+    SequenceIterator it(dag);
+    vector<string> seq;
+    while (it.next(seq))
+    {
+        for (const string &w : seq)
+            cout << w << " ";
+        cout << endl;
+    }
+
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -1,6 +1,10 @@
 #include <iostream>
 #include <vector>
 #include<queue>
+#include "grid2d.h"
+#include "grid_kernels.h"
+#include "disjoint_set.h"
+#include "../common/parallel.h"
 using namespace std;
 
 class Solution {
@@ -56,6 +60,156 @@ class Solution {
     }
 };
 
+// Same count on a flat grid with a water ('0') border: each island is one
+// single-seed run of the shared BFS kernel with 8-connectivity, and visited
+// land is overwritten with '2' instead of being tracked in a vis grid.
+// Time Complexity: O(N*M)
+// Space Complexity: O(size of the largest island) for the frontier
+int numIslandsFlat(Grid2D<char> &grid) {
+    int cnt = 0;
+    for (int row = 0; row < grid.rows(); row++) {
+        for (int col = 0; col < grid.cols(); col++) {
+            int i = grid.index(row, col);
+            if (grid[i] != '1') continue;
+            cnt++;
+            grid[i] = '2';
+            gridMultiSourceBfs<8>(grid, {i}, [&](int, int to) {
+                if (grid[to] != '1') return false;
+                grid[to] = '2';
+                return true;
+            });
+        }
+    }
+    return cnt;
+}
+
+// Result of labelIslandsTiled: labels hold 0..count-1 on land, -1 on water
+// (and on the sentinel border).
+struct IslandLabels {
+    int count = 0;
+    Grid2D<int> labels;
+};
+
+// Tile-parallel connected-component labeling, 8-connected like numIslands.
+//
+// 1. Each tileSize x tileSize tile is labeled on its own by a BFS that stays
+//    inside the tile; tiles are handed to threads dynamically.
+// 2. Tile-local ids are shifted into one global range by a prefix sum over
+//    the per-tile counts.
+// 3. Only cells on the bottom row and right column of a tile can touch a
+//    neighbouring tile; their cross-tile neighbours are united in a
+//    lock-free union-find over the provisional labels, again in parallel.
+// 4. Every provisional label is mapped to its root's compact id, and the
+//    cells are relabeled in parallel.
+// The -1 sentinel border of the label grid removes the bounds checks from
+// step 3.
+// Time Complexity: O(N*M / threads) plus O(N*M / tileSize) border merges
+// Space Complexity: O(N*M) for the labels, O(provisional labels) for the union-find
+IslandLabels labelIslandsTiled(const Grid2D<char> &grid, int tileSize = 256, int threads = 0) {
+    const int n = grid.rows(), m = grid.cols();
+    IslandLabels out;
+    out.labels = Grid2D<int>(n, m, -1, -1);
+    Grid2D<int> &labels = out.labels;
+    if (n == 0 || m == 0) return out;
+
+    const int tileRows = (n + tileSize - 1) / tileSize, tileCols = (m + tileSize - 1) / tileSize;
+    const int tiles = tileRows * tileCols;
+    auto tileBounds = [&](int t, int &r0, int &r1, int &c0, int &c1) {
+        r0 = t / tileCols * tileSize;
+        c0 = t % tileCols * tileSize;
+        r1 = min(n, r0 + tileSize);
+        c1 = min(m, c0 + tileSize);
+    };
+
+    // 1. Label every tile independently.
+    vector<int> tileCount(tiles, 0);
+    parallelForDynamic(tiles, threads, [&](long long t, int) {
+        int r0, r1, c0, c1;
+        tileBounds((int)t, r0, r1, c0, c1);
+        vector<pair<int, int>> q;
+        int next = 0;
+        for (int row = r0; row < r1; row++) {
+            for (int col = c0; col < c1; col++) {
+                if (grid.at(row, col) != '1' || labels.at(row, col) != -1) continue;
+                labels.at(row, col) = next;
+                q.assign(1, {row, col});
+                for (size_t head = 0; head < q.size(); head++) {
+                    auto [r, c] = q[head];
+                    for (int nr = max(r0, r - 1); nr <= min(r1 - 1, r + 1); nr++) {
+                        for (int nc = max(c0, c - 1); nc <= min(c1 - 1, c + 1); nc++) {
+                            if (grid.at(nr, nc) == '1' && labels.at(nr, nc) == -1) {
+                                labels.at(nr, nc) = next;
+                                q.push_back({nr, nc});
+                            }
+                        }
+                    }
+                }
+                next++;
+            }
+        }
+        tileCount[t] = next;
+    });
+
+    // 2. Make the tile-local ids globally unique.
+    vector<int> base(tiles + 1, 0);
+    for (int t = 0; t < tiles; t++) base[t + 1] = base[t] + tileCount[t];
+    const int provisional = base[tiles];
+    parallelForDynamic(tiles, threads, [&](long long t, int) {
+        int r0, r1, c0, c1;
+        tileBounds((int)t, r0, r1, c0, c1);
+        for (int row = r0; row < r1; row++)
+            for (int col = c0; col < c1; col++)
+                if (labels.at(row, col) >= 0) labels.at(row, col) += base[t];
+    });
+
+    // 3. Merge labels across tile borders.
+    ConcurrentDisjointSet dsu(provisional);
+    parallelForDynamic(tiles, threads, [&](long long t, int) {
+        int r0, r1, c0, c1;
+        tileBounds((int)t, r0, r1, c0, c1);
+        auto link = [&](int r, int c) {
+            int a = labels.at(r, c);
+            if (a < 0) return;
+            for (int d = -1; d <= 1; d++) {
+                int below = labels.at(r + 1, c + d);
+                if (r + 1 == r1 && below >= 0) dsu.unite(a, below);
+                int right = labels.at(r + d, c + 1);
+                if (c + 1 == c1 && right >= 0) dsu.unite(a, right);
+            }
+        };
+        for (int col = c0; col < c1; col++) link(r1 - 1, col);
+        for (int row = r0; row < r1; row++) link(row, c1 - 1);
+    });
+
+    // 4. Compact the surviving roots into 0..count-1.
+    vector<int> compact(provisional, -1), rootId(provisional, -1);
+    for (int l = 0; l < provisional; l++) {
+        int root = dsu.findParent(l);
+        if (rootId[root] < 0) rootId[root] = out.count++;
+        compact[l] = rootId[root];
+    }
+    parallelChunks(n, threads, [&](long long rb, long long re, int) {
+        for (long long row = rb; row < re; row++) {
+            int *cell = &labels.at((int)row, 0);
+            for (int col = 0; col < m; col++)
+                if (cell[col] >= 0) cell[col] = compact[cell[col]];
+        }
+    });
+    return out;
+}
+
+
+// numIslandsFlat as an instantiation of the compile-time grid kernel
+// (grid_kernels.h), 8-connected: CellEquals<'1'>() and '2' on a Grid2D<char>,
+// or CellSet() and false on a BitGrid2D. Islands are consumed in place.
+// Time Complexity: O(N*M)
+// Space Complexity: O(size of the largest island) for the frontier
+template <class Grid, class Land, class Mark>
+int numIslandsKernel(Grid &grid, Land land, Mark mark) {
+    return gridCountComponents<8>(grid, land, mark);
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     // n: row, m: column
     vector<vector<char>> grid
@@ -67,6 +221,22 @@ int main() {
         
     Solution obj;
     cout << obj.numIslands(grid) << endl;
+
+    Grid2D<char> flat = Grid2D<char>::fromNested(grid, '0');
+    cout << numIslandsFlat(flat) << endl;
+
+    Grid2D<char> chars = Grid2D<char>::fromNested(grid, '0');
+    cout << numIslandsKernel(chars, CellEquals<'1'>(), '2') << endl;
+    BitGrid2D bits = BitGrid2D::fromNested(grid, [](char cell) { return cell == '1'; });
+    cout << numIslandsKernel(bits, CellSet(), false) << endl;
+
+    IslandLabels tiled = labelIslandsTiled(Grid2D<char>::fromNested(grid, '0'), 2);
+    cout << tiled.count << endl;
+    for (const auto &row : tiled.labels.toNested()) {
+        for (int label : row) cout << label << " ";
+        cout << endl;
+    }
         
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -1,4 +1,7 @@
 #include <bits/stdc++.h>
+#include "csr_graph.h"
+#include "parallel_kahn.h"
+#include "dfs_visitor.h"
 using namespace std;
 
 class Graph {
@@ -67,8 +70,57 @@ public:
         }
         return result;
     }
+
+    // Flat copy of the adjacency list for the CSR variant below.
+    CsrGraph toCsr() const {
+        return csrFromAdjacency(adj);
+    }
 };
 
+// ---------------- Optimal on CSR (Kahn's Algorithm) ----------------
+// The output array doubles as the FIFO queue: nodes are appended at tail and
+// consumed from head, so the order matches topoSortKahn exactly.
+// Time Complexity: O(V + E)
+// Space Complexity: O(V)
+vector<int> topoSortKahnCSR(const CsrGraph &g) {
+    vector<int> inDegree(g.V, 0);
+    for (int v : g.neighbors) inDegree[v]++;
+
+    vector<int> result(g.V);
+    int head = 0, tail = 0;
+    for (int i = 0; i < g.V; i++) {
+        if (inDegree[i] == 0) result[tail++] = i;
+    }
+
+    while (head < tail) {
+        int node = result[head++];
+        for (int nbr : g.adj(node)) {
+            if (--inDegree[nbr] == 0) result[tail++] = nbr;
+        }
+    }
+
+    result.resize(tail);
+    return result;
+}
+
+// ---------------- DFS on CSR via the shared visitor ----------------
+// Reverse finishing order, same as topoSortDFS, from an onFinish hook on the
+// iterative traversal (no recursion, no stack<int> copy-out).
+// Time Complexity: O(V + E)
+// Space Complexity: O(V)
+struct FinishOrderVisitor : DfsVisitor {
+    vector<int> order;
+    void onFinish(int u, int) { order.push_back(u); }
+};
+
+vector<int> topoSortDfsCSR(const CsrGraph &g) {
+    FinishOrderVisitor vis;
+    vis.order.reserve(g.V);
+    depthFirstSearch(g, vis);
+    reverse(vis.order.begin(), vis.order.end());
+    return vis.order;
+}
+
 int main() {
     int V = 6, E = 6;
     Graph g(V);
@@ -93,5 +145,26 @@ int main() {
     for (int x : res2) cout << x << " ";
     cout << endl;
 
+    // Optimal on CSR
+    vector<int> res3 = topoSortKahnCSR(g.toCsr());
+    cout << "Kahn's Topological Sort (CSR): ";
+    for (int x : res3) cout << x << " ";
+    cout << endl;
+
+    vector<int> res4 = topoSortDfsCSR(g.toCsr());
+    cout << "DFS Topological Sort (Visitor): ";
+    for (int x : res4) cout << x << " ";
+    cout << endl;
+
+    // Parallel Kahn: the order split into independent dependency levels
+    vector<vector<int>> levels = kahnWavefronts(g.toCsr());
+    cout << "Kahn's Wavefronts: ";
+    for (auto &level : levels) {
+        cout << "[ ";
+        for (int x : level) cout << x << " ";
+        cout << "] ";
+    }
+    cout << endl;
+
     return 0;
 }
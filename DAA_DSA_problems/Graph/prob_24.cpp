@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "incremental_schedule.h"
+#include "incremental_schedule_bench.h"
 using namespace std;
 
 // -------- Brute Force (DFS Cycle Detection) --------
@@ -61,15 +63,17 @@ vector<int> findOrderOptimal(int N, vector<pair<int,int>>& prerequisites) {
     return {}; // empty if cycle
 }
 
+#ifndef DAA_NO_MAIN
 // -------- Driver Code --------
-int main() {
+// Pass "bench" to also compare IncrementalSchedule with a rebuild per change.
+int main(int argc, char** argv) {
     int N = 4;
     vector<pair<int,int>> prerequisites1 = {{1,0},{2,1},{3,2}};
     vector<pair<int,int>> prerequisites2 = {{1,2},{3,4},{2,4},{4,1}};
     
     cout << "Brute Force (Cycle detection):\n";
     cout << (canFinishBruteForce(N, prerequisites1) ? "Yes" : "No") << endl;
-    cout << (canFinishBruteForce(N, prerequisites2) ? "Yes" : "No") << endl;
+    cout << (canFinishBruteForce(N + 1, prerequisites2) ? "Yes" : "No") << endl; // uses course 4
     
     cout << "\nOptimal (Topological Ordering):\n";
     vector<int> order = findOrderOptimal(N, prerequisites1);
@@ -79,6 +83,23 @@ int main() {
     } else {
         cout << "Impossible" << endl;
     }
+
+    cout << "\nIncremental (Dynamic Topological Order):\n";
+    IncrementalSchedule catalog(N);
+    for (auto& p : prerequisites1) catalog.addPrerequisite(p.first, p.second);
+    cout << (catalog.canFinish() ? "Yes" : "No") << endl;
+    catalog.addPrerequisite(0, 3); // 0 now needs 3: closes 0 -> 1 -> 2 -> 3 -> 0
+    cout << (catalog.canFinish() ? "Yes" : "No") << endl;
+    catalog.removePrerequisite(2, 1);
+    cout << (catalog.canFinish() ? "Yes" : "No") << ": ";
+    for (int x : catalog.order()) cout << x << " ";
+    cout << endl;
+
+    if (argc < 2 || string(argv[1]) != "bench") return 0;
+
+    cout << "\nBenchmark:\n";
+    benchmarkIncrementalSchedule(1000, 5000, findOrderOptimal);
     
     return 0;
 }
+#endif
@@ -1,4 +1,9 @@
 #include<bits/stdc++.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "csr_graph.h"
+#include "dfs_visitor.h"
 using namespace std;
 
 class Solution {
@@ -69,6 +74,127 @@ class Solution {
     }
 };
 
+// Preprocess once, query many sources.
+// The constructor finds a topological order with the shared iterative DFS
+// and renumbers the vertices by it, storing the graph as CSR in that order:
+// rank k is the k-th vertex of the order and all its out-edges go to larger
+// ranks. A query is then one front-to-back sweep over offsets, neighbors and
+// weights, starting at the source's rank (nothing earlier is reachable).
+// Unreachable vertices are never relaxed from, so negative weights are fine.
+// Time Complexity: O(V + E) preprocessing, O(V + E) per source
+// Space Complexity: O(V + E)
+class DagShortestPaths {
+  public:
+    static constexpr int LANES = 8;
+    static constexpr int INF = INT_MAX / 2;
+
+  private:
+    int V;
+    CsrGraph g;          // vertices renumbered by topological rank
+    vector<int> rankOf;  // original id -> rank
+    vector<int> vertexAt; // rank -> original id
+    vector<int> lanes;   // reused [rank][lane] distance rows
+
+    struct FinishOrder : DfsVisitor {
+      vector<int>& order;
+      explicit FinishOrder(vector<int>& order) : order(order) {}
+      void onFinish(int u, int) { order.push_back(u); }
+    };
+
+    // dst[l] = min(dst[l], src[l] + w) for every lane whose src is reachable.
+    static void relaxLanes(int* dst, const int* src, int w) {
+#ifdef __AVX2__
+      __m256i s = _mm256_loadu_si256((const __m256i*) src);
+      __m256i inf = _mm256_set1_epi32(INF);
+      __m256i cand = _mm256_add_epi32(s, _mm256_set1_epi32(w));
+      cand = _mm256_blendv_epi8(cand, inf, _mm256_cmpeq_epi32(s, inf));
+      __m256i d = _mm256_loadu_si256((const __m256i*) dst);
+      _mm256_storeu_si256((__m256i*) dst, _mm256_min_epi32(d, cand));
+#else
+      for (int l = 0; l < LANES; l++) {
+        if (src[l] != INF && src[l] + w < dst[l]) dst[l] = src[l] + w;
+      }
+#endif
+    }
+
+  public:
+    DagShortestPaths(int N, const vector<vector<int>>& edges) : V(N), rankOf(N) {
+      CsrGraph raw = csrFromEdges(N, edges);
+      vertexAt.reserve(N);
+      FinishOrder finish(vertexAt);
+      IterativeDfs dfs(N);
+      dfs.visitAll(raw, finish);
+      reverse(vertexAt.begin(), vertexAt.end());
+      for (int k = 0; k < N; k++) rankOf[vertexAt[k]] = k;
+
+      g.V = N;
+      g.offsets.assign(N + 1, 0);
+      g.neighbors.reserve(raw.numEdges());
+      g.weights.reserve(raw.numEdges());
+      for (int k = 0; k < N; k++) {
+        int u = vertexAt[k];
+        for (int e = raw.offsets[u]; e < raw.offsets[u + 1]; e++) {
+          g.neighbors.push_back(rankOf[raw.neighbors[e]]);
+          g.weights.push_back(raw.weights[e]);
+        }
+        g.offsets[k + 1] = (int) g.neighbors.size();
+      }
+    }
+
+    // Distances from src in original ids, -1 if unreachable.
+    vector<int> shortestFrom(int src) const {
+      vector<int> distRank(V, INF);
+      int start = rankOf[src];
+      distRank[start] = 0;
+      for (int k = start; k < V; k++) {
+        int d = distRank[k];
+        if (d == INF) continue;
+        for (int e = g.offsets[k]; e < g.offsets[k + 1]; e++) {
+          int v = g.neighbors[e];
+          if (d + g.weights[e] < distRank[v]) distRank[v] = d + g.weights[e];
+        }
+      }
+      vector<int> dist(V);
+      for (int k = 0; k < V; k++) dist[vertexAt[k]] = distRank[k] == INF ? -1 : distRank[k];
+      return dist;
+    }
+
+    // Up to LANES sources per sweep: row k holds the distance of rank k from
+    // each source of the group, so one edge relaxes all lanes with a single
+    // 8 x int32 add/min. The sweep starts at the lowest source rank.
+    vector<vector<int>> shortestFromMany(const vector<int>& sources) {
+      vector<vector<int>> res(sources.size(), vector<int>(V, -1));
+      lanes.resize((size_t) V * LANES);
+      for (size_t base = 0; base < sources.size(); base += LANES) {
+        int count = (int) min<size_t>(LANES, sources.size() - base);
+        fill(lanes.begin(), lanes.end(), INF);
+        int start = V;
+        for (int l = 0; l < count; l++) {
+          int r = rankOf[sources[base + l]];
+          lanes[(size_t) r * LANES + l] = 0;
+          start = min(start, r);
+        }
+        for (int k = start; k < V; k++) {
+          const int* row = &lanes[(size_t) k * LANES];
+          bool any = false;
+          for (int l = 0; l < LANES; l++) any |= row[l] != INF;
+          if (!any) continue;
+          for (int e = g.offsets[k]; e < g.offsets[k + 1]; e++) {
+            relaxLanes(&lanes[(size_t) g.neighbors[e] * LANES], row, g.weights[e]);
+          }
+        }
+        for (int k = 0; k < V; k++) {
+          int v = vertexAt[k];
+          for (int l = 0; l < count; l++) {
+            int d = lanes[(size_t) k * LANES + l];
+            if (d != INF) res[base + l][v] = d;
+          }
+        }
+      }
+      return res;
+    }
+};
+
 int main() {
 
   int N = 6, M = 7;
@@ -81,6 +207,21 @@ int main() {
 
     cout << ans[i] << " ";
   }
+  cout << endl;
+
+  DagShortestPaths dag(N, edges);
+  vector < int > cached = dag.shortestFrom(0);
+  cout << "Cached topo order: ";
+  for (int d: cached) cout << d << " ";
+  cout << endl;
+
+  vector < int > sources = {0, 1, 4, 5};
+  vector < vector < int >> many = dag.shortestFromMany(sources);
+  for (size_t q = 0; q < sources.size(); q++) {
+    cout << "From " << sources[q] << " (8-lane batch): ";
+    for (int d: many[q]) cout << d << " ";
+    cout << endl;
+  }
 
   return 0;
 
@@ -1,4 +1,8 @@
 #include<bits/stdc++.h>
+#include "csr_graph.h"
+#include "priority_queues.h"
+#include "../common/parallel.h"
+#include "../common/op_counters.h"
 using namespace std;
 
 class Solution
@@ -19,6 +23,7 @@ class Solution
         vector<int> dist(V, 1e9); 
         
         st.insert({0, S}); 
+        DAA_COUNT("dijkstra.heap_push");
 
         // Source initialised with dist=0
         dist[S] = 0;
@@ -30,23 +35,30 @@ class Solution
             int node = it.second; 
             int dis = it.first; 
             st.erase(it); 
+            DAA_COUNT("dijkstra.heap_pop");
             
             // Check for all adjacent nodes of the erased
             // element whether the prev dist is larger than current or not.
             for(auto it : adj[node]) {
                 int adjNode = it[0]; 
                 int edgW = it[1]; 
+                DAA_COUNT("dijkstra.edge_scan");
                 
                 if(dis + edgW < dist[adjNode]) {
                     // erase if it was visited previously at 
                     // a greater cost.
-                    if(dist[adjNode] != 1e9) 
+                    if(dist[adjNode] != 1e9) {
                         st.erase({dist[adjNode], adjNode}); 
+                        DAA_COUNT("dijkstra.heap_decrease");
+                    }
                         
                     // If current distance is smaller,
                     // push it into the queue
                     dist[adjNode] = dis + edgW; 
                     st.insert({dist[adjNode], adjNode}); 
+                    DAA_COUNT("dijkstra.relaxation");
+                    DAA_COUNT("dijkstra.heap_push");
+                    DAA_COUNT_MAX("dijkstra.heap_max", st.size());
                  }
             }
         }
@@ -56,6 +68,111 @@ class Solution
     }
 };
 
+// Query engine for many (source, target) queries against one static graph.
+// The graph is flattened into CSR once; each worker thread owns a Scratch
+// whose dist array is never cleared in full. Instead every entry carries the
+// generation it was written in, and bumping the generation invalidates the
+// whole array in O(1), so a query only pays for the vertices it touches.
+class ShortestPathEngine
+{
+    CsrGraph g;
+
+    struct Scratch {
+        vector<int> dist;
+        vector<uint32_t> stamp;
+        uint32_t generation = 0;
+        IndexedDaryHeap<4> heap;
+
+        explicit Scratch(int V) : dist(V), stamp(V, 0), heap(V) {}
+
+        void nextQuery() {
+            heap.clear();
+            if (++generation == 0) {
+                // Wrapped around: old stamps could alias, reset them once.
+                fill(stamp.begin(), stamp.end(), 0);
+                generation = 1;
+            }
+        }
+
+        int get(int v) const { return stamp[v] == generation ? dist[v] : (int)1e9; }
+        void set(int v, int d) { stamp[v] = generation; dist[v] = d; }
+    };
+
+    vector<unique_ptr<Scratch>> scratch;
+
+    Scratch &scratchFor(int thread) {
+        while ((int)scratch.size() <= thread) scratch.push_back(make_unique<Scratch>(g.V));
+        return *scratch[thread];
+    }
+
+    // Dijkstra from S; stops as soon as T is settled when T >= 0.
+    int run(Scratch &sc, int S, int T) {
+        sc.nextQuery();
+        sc.set(S, 0);
+        sc.heap.pushOrDecrease(S, 0);
+        while (!sc.heap.empty()) {
+            auto [dis, node] = sc.heap.popMin();
+            if (node == T) return dis;
+            CsrGraph::Range nbrs = g.adj(node), wts = g.adjWeights(node);
+            for (int i = 0; i < nbrs.size(); i++) {
+                int adjNode = nbrs[i];
+                int nd = dis + wts[i];
+                if (nd < sc.get(adjNode)) {
+                    sc.set(adjNode, nd);
+                    sc.heap.pushOrDecrease(adjNode, nd);
+                }
+            }
+        }
+        return T >= 0 ? sc.get(T) : 0;
+    }
+
+public:
+    // Loads the graph once from the same {node, weight} adjacency format
+    // Solution::dijkstra takes.
+    ShortestPathEngine(int V, vector<vector<int>> adj[])
+    {
+        CsrBuilder b(V);
+        for (int u = 0; u < V; u++) {
+            for (auto &e : adj[u]) b.addEdge(u, e[0], e[1]);
+        }
+        g = b.build();
+    }
+
+    explicit ShortestPathEngine(CsrGraph graph) : g(move(graph)) {}
+
+    // Distances to every vertex (1e9 if unreachable).
+    vector<int> distancesFrom(int S)
+    {
+        Scratch &sc = scratchFor(0);
+        run(sc, S, -1);
+        vector<int> dist(g.V);
+        for (int v = 0; v < g.V; v++) dist[v] = sc.get(v);
+        return dist;
+    }
+
+    // Shortest distance for each (source, target) pair, in input order.
+    // With earlyStop the search ends once the target is settled; otherwise
+    // the full tree from the source is computed.
+    vector<int> queryBatch(const vector<pair<int,int>> &queries, int threads = 0, bool earlyStop = true)
+    {
+        threads = min(resolveThreads(threads), max(1, (int)queries.size()));
+        for (int t = 0; t < threads; t++) scratchFor(t);
+
+        vector<int> answers(queries.size());
+        parallelForDynamic((long long)queries.size(), threads, [&](long long i, int t) {
+            Scratch &sc = *scratch[t];
+            int S = queries[i].first, T = queries[i].second;
+            if (earlyStop) {
+                answers[i] = run(sc, S, T);
+            } else {
+                run(sc, S, -1);
+                answers[i] = sc.get(T);
+            }
+        });
+        return answers;
+    }
+};
+
 int main()
 {
     // Driver code.
@@ -79,5 +196,14 @@ int main()
         cout << res[i] << " ";
     }
     cout << endl;
+
+    // Batched queries through the engine, answered in input order.
+    ShortestPathEngine engine(V, adj);
+    vector<pair<int,int>> queries{{2, 0}, {2, 1}, {0, 2}, {1, 1}};
+    vector<int> answers = engine.queryBatch(queries, 2);
+    for (size_t q = 0; q < queries.size(); q++)
+    {
+        cout << queries[q].first << "->" << queries[q].second << ": " << answers[q] << endl;
+    }
     return 0;
 }
\ No newline at end of file
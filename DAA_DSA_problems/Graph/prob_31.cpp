@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../common/parallel.h"
 using namespace std;
 
 class Solution
@@ -61,6 +62,138 @@ public:
     }
 };
 
+// One cheapest-flight query: at most k stops between src and dst.
+struct FareQuery
+{
+    int src, dst, k;
+};
+
+// Bounded Bellman-Ford for many CheapestFLight queries against one graph.
+//
+// Flights are stored once as a structure of arrays (from / to / price),
+// sorted by origin. A query with k stops needs k + 1 relaxation rounds, each
+// reading the previous round's distances and writing the next (two
+// ping-pong buffers), so a round never uses an edge twice.
+// Queries are grouped by source: every query with the same source shares one
+// run, answered after its own round count. Up to LANES sources are relaxed
+// side by side, with dist laid out as [node][lane], so each edge updates
+// LANES contiguous ints and the inner min loop vectorizes. A run stops early
+// once a round changes nothing. Groups run in parallel.
+// Time Complexity: O((max k + 1) * E) per group of LANES sources
+// Space Complexity: O(E + LANES * n) per worker
+class FareEngine
+{
+    static const int LANES = 8;
+    static constexpr int INF = 1e9;
+
+    int n;
+    vector<int> from, to, price;
+
+    // Relaxes one group of up to LANES sources; idsPerSource[l] lists the
+    // queries whose source is sources[l].
+    void runGroup(const vector<int> &sources, const vector<vector<int>> &idsPerSource,
+                  const vector<FareQuery> &queries, vector<int> &answers) const
+    {
+        const int lanes = (int)sources.size();
+        vector<int> cur((size_t)n * LANES, INF), next;
+        int rounds = 0;
+        for (int l = 0; l < lanes; l++)
+        {
+            cur[(size_t)sources[l] * LANES + l] = 0;
+            for (int q : idsPerSource[l])
+                rounds = max(rounds, queries[q].k + 1);
+        }
+        // pending[r] = {query, lane} pairs answered after round r
+        vector<vector<pair<int, int>>> pending(rounds + 1);
+        for (int l = 0; l < lanes; l++)
+            for (int q : idsPerSource[l])
+                pending[queries[q].k + 1].push_back({q, l});
+
+        auto answer = [&](const vector<pair<int, int>> &due, const vector<int> &dist) {
+            for (auto [q, l] : due)
+            {
+                int d = dist[(size_t)queries[q].dst * LANES + l];
+                answers[q] = d >= INF ? -1 : d;
+            }
+        };
+
+        const int E = (int)from.size();
+        for (int r = 1; r <= rounds; r++)
+        {
+            next = cur;
+            for (int e = 0; e < E; e++)
+            {
+                const int *src = &cur[(size_t)from[e] * LANES];
+                int *dstRow = &next[(size_t)to[e] * LANES];
+                const int w = price[e];
+                for (int l = 0; l < LANES; l++)
+                    dstRow[l] = min(dstRow[l], src[l] + w);
+            }
+            bool changed = next != cur;
+            cur.swap(next);
+            answer(pending[r], cur);
+            if (!changed)
+            {
+                // Converged: later rounds would give the same distances.
+                for (int later = r + 1; later <= rounds; later++)
+                    answer(pending[later], cur);
+                break;
+            }
+        }
+    }
+
+public:
+    // Prices must be non-negative and below 1e9.
+    FareEngine(int n, const vector<vector<int>> &flights) : n(n)
+    {
+        vector<int> order(flights.size());
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(),
+                    [&](int a, int b) { return flights[a][0] < flights[b][0]; });
+        for (int i : order)
+        {
+            from.push_back(flights[i][0]);
+            to.push_back(flights[i][1]);
+            price.push_back(flights[i][2]);
+        }
+    }
+
+    // Answers in query order, -1 where dst is unreachable within k stops.
+    vector<int> cheapestBatch(const vector<FareQuery> &queries, int threads = 0) const
+    {
+        vector<int> answers(queries.size(), -1);
+        map<int, vector<int>> bySource;
+        for (int q = 0; q < (int)queries.size(); q++)
+            bySource[queries[q].src].push_back(q);
+
+        // Pack distinct sources into groups of LANES.
+        vector<vector<int>> groupSources;
+        vector<vector<vector<int>>> groupIds;
+        for (auto &entry : bySource)
+        {
+            if (groupSources.empty() || (int)groupSources.back().size() == LANES)
+            {
+                groupSources.emplace_back();
+                groupIds.emplace_back();
+            }
+            groupSources.back().push_back(entry.first);
+            groupIds.back().push_back(move(entry.second));
+        }
+
+        // Each query belongs to one group, so workers write disjoint answers.
+        parallelForDynamic((long long)groupSources.size(), threads, [&](long long g, int) {
+            runGroup(groupSources[g], groupIds[g], queries, answers);
+        });
+        return answers;
+    }
+
+    int cheapest(int src, int dst, int K) const
+    {
+        return cheapestBatch({{src, dst, K}}, 1)[0];
+    }
+};
+
+#ifndef DAA_NO_MAIN
 int main()
 {
     // Driver Code.
@@ -76,5 +209,13 @@ int main()
     cout << ans;
     cout << endl;
 
+    // Same query through the batched Bellman-Ford engine
+    FareEngine engine(n, flights);
+    vector<int> fares = engine.cheapestBatch({{src, dst, K}, {src, dst, 2}, {1, 0, 1}});
+    for (int fare : fares)
+        cout << fare << " ";
+    cout << endl;
+
     return 0;
-}
\ No newline at end of file
+}
+#endif
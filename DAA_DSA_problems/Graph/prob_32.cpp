@@ -49,6 +49,61 @@ public:
     }
 };
 
+// Same BFS with the modulus as a parameter. Visited residues are one bit each
+// (12.5MB for mod = 10^8, against 400MB for an int dist array) and the search
+// runs level by level over flat frontier arrays: for each multiplier, the
+// products of the whole frontier are computed in one loop with no branches
+// or queue traffic, then filtered against the bitset in a second pass.
+// Returns 0 when start == end, -1 if end cannot be reached.
+// Time Complexity: O(mod * |arr|)
+// Space Complexity: O(mod / 8) bytes for the bitset plus the frontier
+int minimumMultiplicationsMod(const vector<int> &arr, int start, int end, int mod)
+{
+    // Residues in [0, mod), as for the multipliers: a negative start would
+    // otherwise index the bitset out of bounds
+    start = (start % mod + mod) % mod;
+    end = (end % mod + mod) % mod;
+    if (start == end)
+        return 0;
+
+    vector<uint64_t> visited(mod / 64 + 1, 0);
+    auto testAndSet = [&](uint32_t x) {
+        uint64_t bit = 1ULL << (x & 63);
+        bool seen = visited[x >> 6] & bit;
+        visited[x >> 6] |= bit;
+        return seen;
+    };
+
+    vector<uint64_t> multipliers;
+    for (int a : arr)
+        multipliers.push_back((uint64_t)((a % mod + mod) % mod));
+
+    vector<uint32_t> frontier = {(uint32_t)start}, next, products;
+    testAndSet(start);
+    for (int steps = 1; !frontier.empty(); steps++)
+    {
+        next.clear();
+        products.resize(frontier.size());
+        for (uint64_t a : multipliers)
+        {
+            const size_t count = frontier.size();
+            for (size_t i = 0; i < count; i++)
+                products[i] = (uint32_t)(a * frontier[i] % (uint64_t)mod);
+            for (size_t i = 0; i < count; i++)
+            {
+                if (!testAndSet(products[i]))
+                {
+                    if (products[i] == (uint32_t)end)
+                        return steps;
+                    next.push_back(products[i]);
+                }
+            }
+        }
+        frontier.swap(next);
+    }
+    return -1;
+}
+
 int main()
 {
     // Driver Code.
@@ -63,5 +118,8 @@ int main()
     cout << ans;
     cout << endl;
 
+    cout << minimumMultiplicationsMod(arr, start, end, 100000);
+    cout << endl;
+
     return 0;
 }
\ No newline at end of file
@@ -1,36 +1,11 @@
 #include <bits/stdc++.h>
+#include "disjoint_set.h"
+#include "csr_graph.h"
+#include "../common/parallel.h"
+#include "graph_file.h"
+#include "../common/temp_path.h"
 using namespace std;
 
-// 🔹 Disjoint Set (Union-Find) for Optimal Kruskal
-class DisjointSet {
-    vector<int> parent, rank;
-public:
-    DisjointSet(int n) {
-        parent.resize(n);
-        rank.resize(n, 0);
-        for (int i = 0; i < n; i++)
-            parent[i] = i;
-    }
-
-    int findParent(int u) {
-        if (u == parent[u]) return u;
-        return parent[u] = findParent(parent[u]); // Path compression
-    }
-
-    void unionByRank(int u, int v) {
-        int pu = findParent(u);
-        int pv = findParent(v);
-        if (pu == pv) return;
-
-        if (rank[pu] < rank[pv]) parent[pu] = pv;
-        else if (rank[pv] < rank[pu]) parent[pv] = pu;
-        else {
-            parent[pv] = pu;
-            rank[pu]++;
-        }
-    }
-};
-
 // 🔹 Brute Force Kruskal (using STL sort and cycle check)
 int kruskalBruteForce(int V, vector<vector<int>>& edges) {
     // Sort edges by weight
@@ -84,6 +59,167 @@ int kruskalOptimal(int V, vector<vector<int>>& edges) {
     return mstWeight;
 }
 
+// Converts {u, v, w} rows to the flat edge array the engines below read.
+vector<WeightedEdge> toWeightedEdges(const vector<vector<int>>& edges) {
+    vector<WeightedEdge> flat(edges.size());
+    for (size_t i = 0; i < edges.size(); i++) flat[i] = {edges[i][0], edges[i][1], edges[i][2]};
+    return flat;
+}
+
+// Root of u without path compression, so many threads can call it while no
+// union is running.
+int findRootReadOnly(const DisjointSet& ds, int u) {
+    while (ds.parent[u] != u) u = ds.parent[u];
+    return u;
+}
+
+// 🔹 Filter-Kruskal (partition by pivot, filter heavy edges before sorting)
+// Edges at or below a pivot weight are solved first; heavy edges that already
+// lie inside one component are then dropped (in parallel) before they are
+// ever sorted. On dense graphs most heavy edges never get sorted at all.
+// Edges are reordered in place in the caller's array.
+// Time Complexity: O(E + V log V log(E/V)) expected
+// Space Complexity: O(V) beyond the edge array
+const size_t FILTER_KRUSKAL_CUTOFF = 1 << 12;
+
+void filterKruskalRec(WeightedEdge* first, WeightedEdge* last, DisjointSet& ds, long long& mstWeight, int threads) {
+    size_t n = last - first;
+    if (n <= FILTER_KRUSKAL_CUTOFF) {
+        sort(first, last, [](const WeightedEdge& a, const WeightedEdge& b) { return a.w < b.w; });
+        for (WeightedEdge* e = first; e != last; ++e) {
+            if (ds.unionByRank(e->u, e->v)) mstWeight += e->w;
+        }
+        return;
+    }
+
+    // Median-of-three pivot; split <= pivot / > pivot.
+    int a = first[0].w, b = first[n / 2].w, c = last[-1].w;
+    int pivot = max(min(a, b), min(max(a, b), c));
+    WeightedEdge* mid = partition(first, last, [&](const WeightedEdge& e) { return e.w <= pivot; });
+    if (mid == last) {
+        // Every weight <= pivot (pivot is the maximum): split off the maximum.
+        mid = partition(first, last, [&](const WeightedEdge& e) { return e.w < pivot; });
+        if (mid == first) {
+            // All weights equal: any spanning forest of them is minimal.
+            for (WeightedEdge* e = first; e != last; ++e) {
+                if (ds.unionByRank(e->u, e->v)) mstWeight += e->w;
+            }
+            return;
+        }
+    }
+    filterKruskalRec(first, mid, ds, mstWeight, threads);
+
+    // Filter: keep heavy edges that still join two components. Each thread
+    // compacts its own chunk, then the chunks are packed together.
+    size_t heavy = last - mid;
+    int t = (int)min<size_t>(resolveThreads(threads), max<size_t>(1, heavy / FILTER_KRUSKAL_CUTOFF));
+    vector<size_t> kept(t, 0);
+    long long chunk = ((long long)heavy + t - 1) / t;
+    parallelChunks((long long)heavy, t, [&](long long lo, long long hi, int id) {
+        size_t out = lo;
+        for (long long i = lo; i < hi; i++) {
+            if (findRootReadOnly(ds, mid[i].u) != findRootReadOnly(ds, mid[i].v)) mid[out++] = mid[i];
+        }
+        kept[id] = out - lo;
+    });
+    WeightedEdge* out = mid;
+    for (int id = 0; id < t; id++) {
+        WeightedEdge* src = mid + id * chunk;
+        if (src != out) memmove(out, src, kept[id] * sizeof(WeightedEdge));
+        out += kept[id];
+    }
+    filterKruskalRec(mid, out, ds, mstWeight, threads);
+}
+
+long long filterKruskal(int V, vector<WeightedEdge>& edges, int threads = 0) {
+    DisjointSet ds(V);
+    long long mstWeight = 0;
+    filterKruskalRec(edges.data(), edges.data() + edges.size(), ds, mstWeight, threads);
+    return mstWeight;
+}
+
+// 🔹 Parallel Boruvka
+// Each round every component picks its cheapest outgoing edge. Edges are
+// scanned in parallel and the choice is an atomic min over the packed key
+// (weight, edge index); the index breaks ties, so the chosen edges never form
+// a cycle. Chosen edges are then merged, and the component labels are
+// refreshed in parallel. Components at least halve every round.
+// The edge array is only read.
+// Time Complexity: O(E log V) work, O((E / p) log V) time on p threads
+// Space Complexity: O(V)
+long long boruvkaParallel(int V, const vector<WeightedEdge>& edges, int threads = 0) {
+    const uint64_t NONE = UINT64_MAX;
+    auto packKey = [](const WeightedEdge& e, size_t index) {
+        // Flip the sign bit so negative weights order correctly as unsigned.
+        return (uint64_t)((uint32_t)e.w ^ 0x80000000u) << 32 | (uint64_t)index;
+    };
+
+    DisjointSet ds(V);
+    vector<int> comp(V);
+    for (int i = 0; i < V; i++) comp[i] = i;
+    vector<atomic<uint64_t>> cheapest(V);
+    long long mstWeight = 0;
+
+    while (true) {
+        parallelChunks(V, threads, [&](long long lo, long long hi, int) {
+            for (long long i = lo; i < hi; i++) cheapest[i].store(NONE, memory_order_relaxed);
+        });
+
+        parallelChunks((long long)edges.size(), threads, [&](long long lo, long long hi, int) {
+            for (long long i = lo; i < hi; i++) {
+                int cu = comp[edges[i].u], cv = comp[edges[i].v];
+                if (cu == cv) continue;
+                uint64_t key = packKey(edges[i], i);
+                for (int c : {cu, cv}) {
+                    uint64_t cur = cheapest[c].load(memory_order_relaxed);
+                    while (key < cur && !cheapest[c].compare_exchange_weak(cur, key, memory_order_relaxed)) {}
+                }
+            }
+        });
+
+        bool merged = false;
+        for (int c = 0; c < V; c++) {
+            uint64_t key = cheapest[c].load(memory_order_relaxed);
+            if (key == NONE) continue;
+            const WeightedEdge& e = edges[key & 0xffffffffu];
+            if (ds.unionByRank(e.u, e.v)) {
+                mstWeight += e.w;
+                merged = true;
+            }
+        }
+        if (!merged) break;
+
+        for (int i = 0; i < V; i++) ds.findParent(i); // flatten before the read-only pass
+        parallelChunks(V, threads, [&](long long lo, long long hi, int) {
+            for (long long i = lo; i < hi; i++) comp[i] = findRootReadOnly(ds, (int)i);
+        });
+    }
+    return mstWeight;
+}
+
+// 🔹 Kruskal from a mapped graph file
+// The weighted edge array is gathered straight from the mapped CSR arrays
+// (one linear pass, no text parsing) and handed to Filter-Kruskal.
+// Time Complexity: O(E log E)
+// Space Complexity: O(E) for the sortable edge copy
+long long kruskalMapped(const GraphView& g, int threads = 0) {
+    if (!g.weighted() && g.numEdges() > 0) throw runtime_error("kruskal needs a weighted graph file");
+    vector<WeightedEdge> edges;
+    edges.reserve(g.numEdges());
+    for (int u = 0; u < g.V; u++) {
+        for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+            edges.push_back({u, g.neighbors[e], g.weights[e]});
+        }
+    }
+    return filterKruskal(g.V, edges, threads);
+}
+
+long long kruskalFromFile(const string& path, int threads = 0) {
+    MappedGraphFile file(path);
+    return kruskalMapped(file.graph(), threads);
+}
+
+#ifndef DAA_NO_MAIN
 int main() {
     int V = 5;
     vector<vector<int>> edges = {
@@ -93,5 +229,15 @@ int main() {
     cout << "Brute Force MST Sum: " << kruskalBruteForce(V, edges) << endl;
     cout << "Optimal MST Sum: " << kruskalOptimal(V, edges) << endl;
 
+    vector<WeightedEdge> flat = toWeightedEdges(edges);
+    cout << "Filter-Kruskal MST Sum: " << filterKruskal(V, flat) << endl;
+    cout << "Parallel Boruvka MST Sum: " << boruvkaParallel(V, flat) << endl;
+
+    string graphFile = tempFilePath("prob_37_graph.bin");
+    writeGraphFile(graphFile, csrFromEdges(V, edges));
+    cout << "Mapped File MST Sum: " << kruskalFromFile(graphFile) << endl;
+    remove(graphFile.c_str());
+
     return 0;
 }
+#endif
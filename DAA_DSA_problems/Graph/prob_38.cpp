@@ -1,36 +1,8 @@
 #include <bits/stdc++.h>
+#include "disjoint_set.h"
+#include "../common/parallel.h"
 using namespace std;
 
-// 🔹 Disjoint Set (Union-Find)
-class DisjointSet {
-    vector<int> parent, rank;
-public:
-    DisjointSet(int n) {
-        parent.resize(n);
-        rank.resize(n, 0);
-        for (int i = 0; i < n; i++)
-            parent[i] = i;
-    }
-
-    int findParent(int u) {
-        if (parent[u] == u) return u;
-        return parent[u] = findParent(parent[u]);
-    }
-
-    void unionByRank(int u, int v) {
-        int pu = findParent(u);
-        int pv = findParent(v);
-        if (pu == pv) return;
-
-        if (rank[pu] < rank[pv]) parent[pu] = pv;
-        else if (rank[pv] < rank[pu]) parent[pv] = pu;
-        else {
-            parent[pv] = pu;
-            rank[pu]++;
-        }
-    }
-};
-
 // 🔹 Brute Force Approach
 vector<vector<string>> accountsMergeBruteForce(vector<vector<string>>& accounts) {
     int n = accounts.size();
@@ -107,6 +79,193 @@ vector<vector<string>> accountsMergeOptimal(vector<vector<string>>& accounts) {
     return res;
 }
 
+// 🔹 Interned-id pipeline (sharded string table + DSU over integer ids)
+// Every email is copied once into the byte arena of one of SHARDS shards,
+// picked by the top bits of its hash; each shard has its own open-addressing
+// index of ids, so shards intern in parallel without locks. After that the
+// whole merge runs on ints: the DSU over accounts, grouping by root with a
+// counting sort, and one sort of each group's ids by their arena bytes.
+// Time Complexity: O(L + n * alpha(n) + sum g log g), L = total email bytes
+// Space Complexity: O(L + number of emails)
+class EmailTable {
+public:
+    static const int SHARD_BITS = 6;
+    static const int SHARDS = 1 << SHARD_BITS;
+
+private:
+    struct Shard {
+        string arena;                 // all distinct emails, back to back
+        vector<uint32_t> offset, len; // local id -> arena slice
+        vector<int> owner;            // local id -> first account using it
+        vector<uint64_t> hashOf;      // local id -> full hash, for rehashing
+        vector<int> index;            // open addressing over local ids, -1 = empty
+        size_t mask = 0;
+
+        void rehash(size_t capacity) {
+            index.assign(capacity, -1);
+            mask = capacity - 1;
+            for (int id = 0; id < (int) hashOf.size(); id++) {
+                size_t s = hashOf[id] & mask;
+                while (index[s] != -1) s = (s + 1) & mask;
+                index[s] = id;
+            }
+        }
+
+        int intern(string_view email, uint64_t h, int account) {
+            if (index.empty()) rehash(16);
+            size_t s = h & mask;
+            while (index[s] != -1) {
+                int id = index[s];
+                if (hashOf[id] == h && len[id] == email.size() &&
+                    memcmp(arena.data() + offset[id], email.data(), email.size()) == 0) {
+                    return id;
+                }
+                s = (s + 1) & mask;
+            }
+            int id = (int) hashOf.size();
+            offset.push_back((uint32_t) arena.size());
+            len.push_back((uint32_t) email.size());
+            owner.push_back(account);
+            hashOf.push_back(h);
+            arena.append(email);
+            index[s] = id;
+            if (2 * hashOf.size() > index.size()) rehash(2 * index.size());
+            return id;
+        }
+    };
+
+    Shard shards[SHARDS];
+    int base[SHARDS + 1] = {};
+
+public:
+    // Interns every email of every account. slotId[k] is the global id of the
+    // k-th email in account order (accounts[i][1..] flattened).
+    vector<int> build(const vector<vector<string>> &accounts, int threads) {
+        const int n = accounts.size();
+        threads = resolveThreads(threads);
+        vector<long long> slotStart(n + 1, 0);
+        for (int i = 0; i < n; i++) slotStart[i + 1] = slotStart[i] + max<long long>(0, (long long) accounts[i].size() - 1);
+        const long long slots = slotStart[n];
+
+        // Pass 1: hash every email and count per (thread, shard).
+        vector<uint64_t> hashes(slots);
+        vector<long long> counts((size_t) threads * SHARDS, 0);
+        parallelChunks(n, threads, [&](long long b, long long e, int t) {
+            long long *cnt = &counts[(size_t) t * SHARDS];
+            for (long long i = b; i < e; i++) {
+                for (size_t j = 1; j < accounts[i].size(); j++) {
+                    uint64_t h = hash<string_view>()(accounts[i][j]);
+                    hashes[slotStart[i] + j - 1] = h;
+                    cnt[h >> (64 - SHARD_BITS)]++;
+                }
+            }
+        });
+
+        // Pass 2: scatter slots into per-shard lists. Threads own contiguous
+        // account ranges, so every list stays in account order.
+        vector<long long> shardStart(SHARDS + 1, 0), cursor((size_t) threads * SHARDS);
+        for (int s = 0; s < SHARDS; s++) {
+            long long at = shardStart[s];
+            for (int t = 0; t < threads; t++) {
+                cursor[(size_t) t * SHARDS + s] = at;
+                at += counts[(size_t) t * SHARDS + s];
+            }
+            shardStart[s + 1] = at;
+        }
+        vector<long long> bySlot(slots);
+        vector<int> slotAccount(slots);
+        parallelChunks(n, threads, [&](long long b, long long e, int t) {
+            long long *cur = &cursor[(size_t) t * SHARDS];
+            for (long long i = b; i < e; i++) {
+                for (long long k = slotStart[i]; k < slotStart[i + 1]; k++) {
+                    bySlot[cur[hashes[k] >> (64 - SHARD_BITS)]++] = k;
+                    slotAccount[k] = (int) i;
+                }
+            }
+        });
+
+        // Pass 3: each shard interns its own slots.
+        vector<int> slotId(slots);
+        parallelForDynamic(SHARDS, threads, [&](long long s, int) {
+            Shard &sh = shards[s];
+            for (long long p = shardStart[s]; p < shardStart[s + 1]; p++) {
+                long long k = bySlot[p];
+                int i = slotAccount[k];
+                const string &email = accounts[i][k - slotStart[i] + 1];
+                slotId[k] = sh.intern(email, hashes[k], i);
+            }
+        });
+
+        for (int s = 0; s < SHARDS; s++) base[s + 1] = base[s] + (int) shards[s].hashOf.size();
+        parallelChunks(slots, threads, [&](long long b, long long e, int) {
+            for (long long k = b; k < e; k++) slotId[k] += base[hashes[k] >> (64 - SHARD_BITS)];
+        });
+        return slotId;
+    }
+
+    int size() const { return base[SHARDS]; }
+
+    string_view email(int id) const {
+        int s = (int) (upper_bound(base, base + SHARDS + 1, id) - base) - 1;
+        const Shard &sh = shards[s];
+        int local = id - base[s];
+        return string_view(sh.arena.data() + sh.offset[local], sh.len[local]);
+    }
+
+    int owner(int id) const {
+        int s = (int) (upper_bound(base, base + SHARDS + 1, id) - base) - 1;
+        return shards[s].owner[id - base[s]];
+    }
+};
+
+vector<vector<string>> accountsMergeInterned(const vector<vector<string>> &accounts, int threads = 0) {
+    const int n = accounts.size();
+    auto table = make_unique<EmailTable>();
+    vector<int> slotId = table->build(accounts, threads);
+    const int ids = table->size();
+
+    vector<int> owner(ids);
+    vector<string_view> text(ids);
+    parallelChunks(ids, threads, [&](long long b, long long e, int) {
+        for (long long id = b; id < e; id++) {
+            owner[id] = table->owner((int) id);
+            text[id] = table->email((int) id);
+        }
+    });
+
+    DisjointSet ds(n);
+    size_t k = 0;
+    for (int i = 0; i < n; i++) {
+        for (size_t j = 1; j < accounts[i].size(); j++) ds.unionByRank(i, owner[slotId[k++]]);
+    }
+
+    // Counting sort of ids by root account, then sort each group by text.
+    vector<int> groupStart(n + 1, 0), root(ids);
+    for (int id = 0; id < ids; id++) {
+        root[id] = ds.findParent(owner[id]);
+        groupStart[root[id] + 1]++;
+    }
+    for (int i = 0; i < n; i++) groupStart[i + 1] += groupStart[i];
+    vector<int> grouped(ids), next(groupStart.begin(), groupStart.end() - 1);
+    for (int id = 0; id < ids; id++) grouped[next[root[id]]++] = id;
+
+    vector<int> roots;
+    for (int i = 0; i < n; i++) {
+        if (groupStart[i + 1] > groupStart[i]) roots.push_back(i);
+    }
+    vector<vector<string>> res(roots.size());
+    parallelForDynamic(roots.size(), threads, [&](long long g, int) {
+        int r = roots[g];
+        auto first = grouped.begin() + groupStart[r], last = grouped.begin() + groupStart[r + 1];
+        sort(first, last, [&](int a, int b) { return text[a] < text[b]; });
+        vector<string> &account = res[g];
+        account.reserve(1 + (last - first));
+        account.push_back(accounts[r][0]); // Name
+        for (auto it = first; it != last; ++it) account.emplace_back(text[*it]);
+    });
+    return res;
+}
+
 int main() {
     vector<vector<string>> accounts = {
         {"John","johnsmith@mail.com","john_newyork@mail.com"},
@@ -131,6 +290,14 @@ int main() {
         cout << "]\n";
     }
 
+    cout << "\nInterned Output:\n";
+    auto interned = accountsMergeInterned(accounts);
+    for (auto &acc : interned) {
+        cout << "[ ";
+        for (auto &s : acc) cout << s << " ";
+        cout << "]\n";
+    }
+
     return 0;
 }
 
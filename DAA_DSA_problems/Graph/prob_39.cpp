@@ -1,36 +1,7 @@
 #include <bits/stdc++.h>
+#include "disjoint_set.h"
 using namespace std;
 
-// 🔹 Disjoint Set for Optimal Solution
-class DisjointSet {
-    vector<int> parent, rank;
-public:
-    DisjointSet(int n) {
-        parent.resize(n);
-        rank.resize(n, 0);
-        for (int i = 0; i < n; i++)
-            parent[i] = i;
-    }
-
-    int findParent(int u) {
-        if (parent[u] == u) return u;
-        return parent[u] = findParent(parent[u]); // path compression
-    }
-
-    void unionByRank(int u, int v) {
-        int pu = findParent(u);
-        int pv = findParent(v);
-        if (pu == pv) return;
-
-        if (rank[pu] < rank[pv]) parent[pu] = pv;
-        else if (rank[pv] < rank[pu]) parent[pv] = pu;
-        else {
-            parent[pv] = pu;
-            rank[pu]++;
-        }
-    }
-};
-
 // 🔹 Brute Force Approach (DFS)
 int dfs(vector<vector<int>>& grid, int i, int j, vector<vector<bool>>& visited) {
     int n = grid.size(), m = grid[0].size();
@@ -103,6 +74,116 @@ vector<int> numIslandsOptimal(int n, int m, vector<pair<int,int>>& positions) {
     return res;
 }
 
+// 🔹 Streaming Approach: online island counter over a sparse tiled grid
+// Land arrives one cell at a time through addLand(r, c). The grid is split
+// into 64x64 tiles that are only allocated when their first land cell
+// arrives, so memory grows with occupied tiles instead of n*m. Each tile keeps
+// one bit per cell (a row per 64-bit word) plus the union-find slots of its
+// cells; a slot id is tileIndex * 4096 + cellInTile, so unions across tile
+// borders need no separate id table. An event in an already allocated tile
+// performs no allocation.
+// Time Complexity: amortized ~O(1) per event (O(alpha) union-find + <= 4 tile lookups)
+// Space Complexity: O(occupied tiles * 4096), about 9 bytes per tile cell
+class StreamingIslandCounter {
+    static const int TILE_BITS = 6;
+    static const int TILE = 1 << TILE_BITS; // 64 x 64 cells per tile
+    static const int TILE_CELLS = TILE * TILE;
+    static const int SLOT_BITS = 2 * TILE_BITS; // low bits of a slot = cell in tile
+    // 64-bit: tile index << SLOT_BITS passes INT_MAX at 2^19 tiles, which a
+    // sparse stream on a large grid reaches with as many events
+    using Slot = long long;
+
+    struct Tile {
+        uint64_t land[TILE] = {};   // land[row] bit col
+        Slot parent[TILE_CELLS];    // union-find parent slot (valid if land)
+        uint8_t rank[TILE_CELLS];
+    };
+
+    int n, m;
+    int tileCols;
+    int islands = 0;
+    vector<unique_ptr<Tile>> tiles;
+    unordered_map<long long, int> tileIndex; // tileRow * tileCols + tileCol -> index
+
+    int findTile(int tr, int tc) const {
+        auto it = tileIndex.find((long long)tr * tileCols + tc);
+        return it == tileIndex.end() ? -1 : it->second;
+    }
+
+    Slot& parentOf(Slot slot) { return tiles[slot >> SLOT_BITS]->parent[slot & (TILE_CELLS - 1)]; }
+    uint8_t& rankOf(Slot slot) { return tiles[slot >> SLOT_BITS]->rank[slot & (TILE_CELLS - 1)]; }
+
+    Slot findSlot(Slot slot) {
+        while (parentOf(slot) != slot) {
+            Slot& p = parentOf(slot);
+            p = parentOf(p);
+            slot = p;
+        }
+        return slot;
+    }
+
+    bool unite(Slot a, Slot b) {
+        a = findSlot(a);
+        b = findSlot(b);
+        if (a == b) return false;
+        if (rankOf(a) < rankOf(b)) swap(a, b);
+        parentOf(b) = a;
+        if (rankOf(a) == rankOf(b)) rankOf(a)++;
+        return true;
+    }
+
+    // Union-find slot of cell (r, c), or -1 if it is water.
+    Slot landSlot(int r, int c) const {
+        int t = findTile(r >> TILE_BITS, c >> TILE_BITS);
+        if (t < 0) return -1;
+        int lr = r & (TILE - 1), lc = c & (TILE - 1);
+        if (!(tiles[t]->land[lr] >> lc & 1)) return -1;
+        return ((Slot)t << SLOT_BITS) | (lr << TILE_BITS) | lc;
+    }
+
+public:
+    StreamingIslandCounter(int n, int m) : n(n), m(m), tileCols((m + TILE - 1) / TILE) {}
+
+    // Pre-sizes the tile table so that the first expectedTiles tile
+    // allocations do not rehash.
+    void reserveTiles(int expectedTiles) {
+        tiles.reserve(expectedTiles);
+        tileIndex.reserve(expectedTiles);
+    }
+
+    int count() const { return islands; }
+    size_t occupiedTiles() const { return tiles.size(); }
+
+    int addLand(int r, int c) {
+        int tr = r >> TILE_BITS, tc = c >> TILE_BITS;
+        int t = findTile(tr, tc);
+        if (t < 0) {
+            t = (int)tiles.size();
+            tiles.push_back(make_unique<Tile>());
+            tileIndex.emplace((long long)tr * tileCols + tc, t);
+        }
+        Tile& tile = *tiles[t];
+        int lr = r & (TILE - 1), lc = c & (TILE - 1);
+        if (tile.land[lr] >> lc & 1) return islands; // duplicate event
+
+        tile.land[lr] |= 1ULL << lc;
+        Slot slot = ((Slot)t << SLOT_BITS) | (lr << TILE_BITS) | lc;
+        tile.parent[slot & (TILE_CELLS - 1)] = slot;
+        tile.rank[slot & (TILE_CELLS - 1)] = 0;
+        islands++;
+
+        static const int dr[] = {-1, 0, 1, 0};
+        static const int dc[] = {0, 1, 0, -1};
+        for (int k = 0; k < 4; k++) {
+            int nr = r + dr[k], nc = c + dc[k];
+            if (nr < 0 || nr >= n || nc < 0 || nc >= m) continue;
+            Slot other = landSlot(nr, nc);
+            if (other >= 0 && unite(slot, other)) islands--;
+        }
+        return islands;
+    }
+};
+
 int main() {
     int n = 4, m = 5;
     vector<pair<int,int>> positions = {{1,1},{0,1},{3,3},{3,4}};
@@ -117,5 +198,18 @@ int main() {
     for (int x : optimal) cout << x << " ";
     cout << "\n";
 
+    cout << "Streaming Output: ";
+    StreamingIslandCounter counter(n, m);
+    for (auto &p : positions) cout << counter.addLand(p.first, p.second) << " ";
+    cout << "\n";
+
+    // A huge, mostly empty grid only pays for the tiles that see land.
+    StreamingIslandCounter sparse(1000000, 1000000);
+    sparse.addLand(0, 0);
+    sparse.addLand(0, 1);
+    sparse.addLand(999999, 999999);
+    cout << "Sparse 10^6 x 10^6 grid: " << sparse.count() << " islands in "
+         << sparse.occupiedTiles() << " tiles\n";
+
     return 0;
 }
@@ -1,57 +1,9 @@
 #include <bits/stdc++.h>
+#include "disjoint_set.h"
+#include "grid2d.h"
+#include "../common/parallel.h"
 using namespace std;
 
-// User function Template for C++
-class DisjointSet {
-
-public:
-    vector<int> rank, parent, size;
-    DisjointSet(int n) {
-        rank.resize(n + 1, 0);
-        parent.resize(n + 1);
-        size.resize(n + 1);
-        for (int i = 0; i <= n; i++) {
-            parent[i] = i;
-            size[i] = 1;
-        }
-    }
-
-    int findUPar(int node) {
-        if (node == parent[node])
-            return node;
-        return parent[node] = findUPar(parent[node]);
-    }
-
-    void unionByRank(int u, int v) {
-        int ulp_u = findUPar(u);
-        int ulp_v = findUPar(v);
-        if (ulp_u == ulp_v) return;
-        if (rank[ulp_u] < rank[ulp_v]) {
-            parent[ulp_u] = ulp_v;
-        }
-        else if (rank[ulp_v] < rank[ulp_u]) {
-            parent[ulp_v] = ulp_u;
-        }
-        else {
-            parent[ulp_v] = ulp_u;
-            rank[ulp_u]++;
-        }
-    }
-
-    void unionBySize(int u, int v) {
-        int ulp_u = findUPar(u);
-        int ulp_v = findUPar(v);
-        if (ulp_u == ulp_v) return;
-        if (size[ulp_u] < size[ulp_v]) {
-            parent[ulp_u] = ulp_v;
-            size[ulp_v] += size[ulp_u];
-        }
-        else {
-            parent[ulp_v] = ulp_u;
-            size[ulp_u] += size[ulp_v];
-        }
-    }
-};
 class Solution {
 private:
     bool isValid(int newr, int newc, int n) {
@@ -91,7 +43,7 @@ public:
                     int newc = col + dc[ind];
                     if (isValid(newr, newc, n)) {
                         if (grid[newr][newc] == 1) {
-                            components.insert(ds.findUPar(newr * n + newc));
+                            components.insert(ds.findParent(newr * n + newc));
                         }
                     }
                 }
@@ -103,8 +55,103 @@ public:
             }
         }
         for (int cellNo = 0; cellNo < n * n; cellNo++) {
-            mx = max(mx, ds.size[ds.findUPar(cellNo)]);
+            mx = max(mx, ds.size[ds.findParent(cellNo)]);
         }
         return mx;
     }
-};
\ No newline at end of file
+    // Flat, read-only-scoring variant.
+    // The grid and the union-find share one padded Grid2D<int>: 0 marks water
+    // and the sentinel border, a negative value -s marks a root of size s, a
+    // positive value is the parent index. Land is unioned with its up and left
+    // neighbours in one scan, then every land cell is pointed straight at its
+    // root, so scoring needs no find() and only reads the array; rows of zero
+    // cells are scored in parallel, each deduplicating its at most 4 roots in
+    // an inline array instead of a set.
+    // Time Complexity: O(n^2 * alpha(n^2)) build + O(n^2 / threads) scoring
+    // Space Complexity: O(n^2), one int per cell
+    int MaxConnectionFlat(const vector<vector<int>>& grid, int threads = 0) {
+        int n = grid.size();
+        if (n == 0) return 0;
+        Grid2D<int> label(n, n, 0);
+        auto find = [&](int x) {
+            while (label[x] > 0) {
+                if (label[label[x]] > 0) label[x] = label[label[x]];
+                x = label[x];
+            }
+            return x;
+        };
+        auto unite = [&](int a, int b) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return;
+            if (label[a] > label[b]) swap(a, b); // a is the larger component
+            label[a] += label[b];
+            label[b] = a;
+        };
+
+        const int stride = label.stride();
+        for (int row = 0; row < n; row++) {
+            for (int col = 0; col < n; col++) {
+                if (grid[row][col] == 0) continue;
+                int x = label.index(row, col);
+                label[x] = -1;
+                if (label[x - stride] != 0) unite(x, x - stride);
+                if (label[x - 1] != 0) unite(x, x - 1);
+            }
+        }
+        for (int row = 0; row < n; row++) {
+            for (int x = label.index(row, 0), end = x + n; x < end; x++) {
+                if (label[x] > 0) label[x] = find(x);
+            }
+        }
+
+        const array<int, 4> offsets = label.offsets4();
+        threads = resolveThreads(threads);
+        vector<int> best(threads, 0);
+        parallelChunks(n, threads, [&](long long rb, long long re, int t) {
+            int mx = 0;
+            for (int row = (int) rb; row < re; row++) {
+                for (int x = label.index(row, 0), end = x + n; x < end; x++) {
+                    int v = label[x];
+                    if (v < 0) {
+                        mx = max(mx, -v);
+                        continue;
+                    }
+                    if (v > 0) continue;
+                    int roots[4], k = 0, total = 1;
+                    for (int o : offsets) {
+                        int y = x + o;
+                        int w = label[y];
+                        if (w == 0) continue;
+                        int root = w < 0 ? y : w;
+                        bool seen = false;
+                        for (int i = 0; i < k; i++) seen |= roots[i] == root;
+                        if (seen) continue;
+                        roots[k++] = root;
+                        total -= label[root];
+                    }
+                    mx = max(mx, total);
+                }
+            }
+            best[t] = mx;
+        });
+        return *max_element(best.begin(), best.end());
+    }
+};
+
+int main() {
+    vector<vector<int>> grid = {
+        {1, 1, 0, 1, 1, 0},
+        {1, 1, 0, 1, 1, 0},
+        {1, 1, 0, 1, 1, 0},
+        {0, 0, 1, 0, 0, 0},
+        {0, 0, 1, 1, 1, 0},
+        {0, 0, 1, 1, 1, 0}
+    };
+
+    Solution obj;
+    cout << "Largest island after one flip: " << obj.MaxConnection(grid) << endl;
+    cout << "Largest island after one flip (flat, parallel): " << obj.MaxConnectionFlat(grid) << endl;
+
+    return 0;
+}
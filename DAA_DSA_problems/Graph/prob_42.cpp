@@ -1,6 +1,7 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include "csr_graph.h"
 using namespace std;
 
 int timer = 1;
@@ -58,6 +59,138 @@ vector<int> articulationPoints(int n, vector<int> adj[]) {
     return ans;
 }
 
+// Block-cut tree index, built once and queried many times.
+// Biconnected components (blocks) are found with one iterative DFS; the tree
+// then has a node per vertex (ids 0..n-1) and per block (ids n..), with an
+// edge between a vertex and every block containing it. Removing x separates
+// u from v exactly when x is a cut vertex on the tree path between them,
+// which binary-lifting LCA checks with depths alone.
+// Time Complexity: O((V + E) + V log V) build, O(log V) per query
+// Space Complexity: O(V log V)
+class BlockCutTree {
+    int n = 0;
+    vector<char> cut;
+    vector<int> depth, treeId;  // treeId = component of the block-cut forest
+    vector<vector<int>> up;     // up[k][x] = 2^k-th ancestor in the tree
+    int numBlocks = 0;
+
+    int lca(int a, int b) const {
+        if (depth[a] < depth[b]) swap(a, b);
+        int diff = depth[a] - depth[b];
+        for (int k = 0; diff; k++, diff >>= 1) {
+            if (diff & 1) a = up[k][a];
+        }
+        if (a == b) return a;
+        for (int k = (int)up.size() - 1; k >= 0; k--) {
+            if (up[k][a] != up[k][b]) {
+                a = up[k][a];
+                b = up[k][b];
+            }
+        }
+        return up[0][a];
+    }
+
+    int distance(int a, int b) const {
+        return depth[a] + depth[b] - 2 * depth[lca(a, b)];
+    }
+
+public:
+    BlockCutTree(int n, const vector<vector<int>> &edges) : n(n), cut(n, 0) {
+        CsrGraph g = csrFromEdges(n, edges, true);
+
+        // Iterative Hopcroft-Tarjan; blocks are popped off a vertex stack.
+        vector<int> tin(n, 0), low(n), parent(n, -1), cursor(n), children(n, 0);
+        vector<int> stk, frames;
+        vector<vector<int>> treeAdj(n);
+        int timer = 1;
+        for (int root = 0; root < n; root++) {
+            if (tin[root]) continue;
+            tin[root] = low[root] = timer++;
+            cursor[root] = g.offsets[root];
+            frames.push_back(root);
+            stk.push_back(root);
+            while (!frames.empty()) {
+                int node = frames.back();
+                if (cursor[node] < g.offsets[node + 1]) {
+                    int it = g.neighbors[cursor[node]++];
+                    if (!tin[it]) {
+                        parent[it] = node;
+                        children[node]++;
+                        tin[it] = low[it] = timer++;
+                        cursor[it] = g.offsets[it];
+                        frames.push_back(it);
+                        stk.push_back(it);
+                    } else if (it != parent[node]) {
+                        low[node] = min(low[node], tin[it]);
+                    }
+                    continue;
+                }
+                frames.pop_back();
+                int p = parent[node];
+                if (p < 0) continue;
+                low[p] = min(low[p], low[node]);
+                if (low[node] >= tin[p]) {
+                    // p separates the subtree of node: close one block.
+                    if (parent[p] != -1) cut[p] = 1;
+                    int block = n + numBlocks++;
+                    treeAdj.emplace_back();
+                    int w;
+                    do {
+                        w = stk.back();
+                        stk.pop_back();
+                        treeAdj[w].push_back(block);
+                        treeAdj[block].push_back(w);
+                    } while (w != node);
+                    treeAdj[p].push_back(block);
+                    treeAdj[block].push_back(p);
+                }
+            }
+            stk.clear();
+            if (children[root] > 1) cut[root] = 1;
+        }
+
+        // Depths and parents of the forest, then the lifting table.
+        int total = n + numBlocks;
+        depth.assign(total, -1);
+        treeId.assign(total, -1);
+        vector<int> par(total);
+        for (int r = 0; r < total; r++) {
+            if (depth[r] != -1) continue;
+            depth[r] = 0;
+            treeId[r] = r;
+            par[r] = r;
+            vector<int> queue{r};
+            for (size_t h = 0; h < queue.size(); h++) {
+                int x = queue[h];
+                for (int y : treeAdj[x]) {
+                    if (depth[y] != -1) continue;
+                    depth[y] = depth[x] + 1;
+                    treeId[y] = r;
+                    par[y] = x;
+                    queue.push_back(y);
+                }
+            }
+        }
+        int levels = 1;
+        while ((1 << levels) < total) levels++;
+        up.assign(levels, par);
+        for (int k = 1; k < levels; k++) {
+            for (int x = 0; x < total; x++) up[k][x] = up[k - 1][up[k - 1][x]];
+        }
+    }
+
+    bool isArticulation(int x) const { return cut[x]; }
+    bool connected(int u, int v) const { return treeId[u] == treeId[v]; }
+    int blocks() const { return numBlocks; }
+
+    // True iff u and v are connected and stop being connected once x (a
+    // third vertex) is removed. Endpoints themselves never count.
+    bool separates(int x, int u, int v) const {
+        if (x == u || x == v || !cut[x] || !connected(u, v) || !connected(u, x)) return false;
+        return distance(u, x) + distance(x, v) == distance(u, v);
+    }
+};
+
 int main() {
     int n = 5;
     vector<vector<int>> edges = {
@@ -77,6 +210,12 @@ int main() {
         cout << node << " ";
     }
     cout << endl;
+
+    BlockCutTree index(n, edges);
+    cout << "Blocks: " << index.blocks() << endl;
+    cout << "Removing 1 disconnects 0 from 3? " << (index.separates(1, 0, 3) ? "yes" : "no") << endl;
+    cout << "Removing 4 disconnects 0 from 3? " << (index.separates(4, 0, 3) ? "yes" : "no") << endl;
+    cout << "Removing 4 disconnects 2 from 3? " << (index.separates(4, 2, 3) ? "yes" : "no") << endl;
     return 0;
 }
 
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "disjoint_set.h"
+
+// Cycle detection for an undirected graph whose edges arrive one at a time
+// (prob_14, prob_15). Nothing but a union-find over the V vertices is kept:
+// an edge whose ends are already in one component closes a cycle, any other
+// edge merges two components. Each undirected edge is expected once; a
+// repeated edge or a self-loop counts as a cycle. Endpoints outside 0..V-1
+// throw runtime_error, since streamed ids come straight from the input.
+// Time Complexity: O(alpha(V)) amortized per edge
+// Space Complexity: O(V), independent of the number of edges
+class StreamingCycleDetector {
+    DisjointSet ds;
+    long long edgesSeen = 0;
+    long long cycleIndex = -1;
+    std::pair<int, int> closingEdge{-1, -1};
+
+public:
+    explicit StreamingCycleDetector(int V) : ds(V) {}
+
+    // Returns true once a cycle exists (this edge or an earlier one closed it).
+    bool addEdge(int u, int v) {
+        if (u < 0 || u >= ds.count() || v < 0 || v >= ds.count()) {
+            throw std::runtime_error("edge endpoint out of range");
+        }
+        long long index = edgesSeen++;
+        if (cycleIndex >= 0) return true;
+        if (!ds.unionByRank(u, v)) {
+            cycleIndex = index;
+            closingEdge = {u, v};
+        }
+        return cycleIndex >= 0;
+    }
+
+    // Pulls edges from next(u, v) until it returns false or a cycle is found.
+    template <class EdgeSource>
+    bool consume(EdgeSource next) {
+        int u, v;
+        while (cycleIndex < 0 && next(u, v)) addEdge(u, v);
+        return hasCycle();
+    }
+
+    bool hasCycle() const { return cycleIndex >= 0; }
+    long long edgesRead() const { return edgesSeen; }
+    // First edge that closed a cycle and its position in the stream, or
+    // {-1, -1} and -1 while the graph is a forest.
+    std::pair<int, int> cycleEdge() const { return closingEdge; }
+    long long cycleEdgeIndex() const { return cycleIndex; }
+};
+
+// Streams a binary edge file (flat int32 {u, v} pairs) through a detector,
+// chunkEdges edges per read, and stops reading at the first cycle.
+inline bool detectCycleInEdgeFile(const std::string& path, StreamingCycleDetector& detector,
+                                  std::size_t chunkEdges = 1 << 20) {
+    std::FILE* in = std::fopen(path.c_str(), "rb");
+    if (!in) throw std::runtime_error("cannot open edge file " + path);
+    std::vector<int32_t> buffer(2 * chunkEdges);
+    std::size_t got = 0, next = 0;
+    try {
+        detector.consume([&](int& u, int& v) {
+            if (next == got) {
+                got = std::fread(buffer.data(), 2 * sizeof(int32_t), chunkEdges, in);
+                next = 0;
+                if (got == 0) return false;
+            }
+            u = buffer[2 * next];
+            v = buffer[2 * next + 1];
+            next++;
+            return true;
+        });
+    } catch (...) {
+        std::fclose(in);
+        throw;
+    }
+    bool failed = std::ferror(in) != 0;
+    std::fclose(in);
+    if (failed) throw std::runtime_error("read error in edge file " + path);
+    return detector.hasCycle();
+}
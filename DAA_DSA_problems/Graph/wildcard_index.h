@@ -0,0 +1,87 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "csr_graph.h"
+
+// Wildcard-pattern index for word-ladder searches (prob_18, prob_19).
+//
+// Each word of length L belongs to L buckets, one per pattern obtained by
+// blanking one position ("hot" -> "*ot", "h*t", "ho*"). Two words are one
+// substitution apart exactly when they share a bucket, so a BFS walks
+// word -> bucket -> word over integer ids; strings are only hashed once per
+// pattern while the index is built.
+// Both word -> buckets and bucket -> words are stored CSR-style in flat arrays.
+// Time Complexity: O(sum of L^2) to build (L patterns of length L per word)
+// Space Complexity: O(sum of L) ids plus the pattern table
+class WildcardIndex {
+    std::vector<std::string> words;
+    std::unordered_map<std::string, int> idOfWord;
+    std::unordered_map<std::string, int> bucketOfPattern;
+    std::vector<int> wordOffsets, wordBuckets;     // word -> buckets
+    std::vector<int> bucketOffsets, bucketMembers; // bucket -> words
+
+    static CsrGraph::Range slice(const std::vector<int>& offsets, const std::vector<int>& data, int i) {
+        return {data.data() + offsets[i], data.data() + offsets[i + 1]};
+    }
+
+public:
+    // Duplicate words are kept once, with the id of their first occurrence.
+    explicit WildcardIndex(const std::vector<std::string>& wordList) {
+        for (const auto& w : wordList) {
+            if (idOfWord.emplace(w, static_cast<int>(words.size())).second) words.push_back(w);
+        }
+
+        wordOffsets.assign(1, 0);
+        for (const auto& w : words) {
+            std::string pattern = w;
+            for (std::size_t i = 0; i < w.size(); i++) {
+                pattern[i] = '*';
+                auto it = bucketOfPattern.emplace(pattern, static_cast<int>(bucketOfPattern.size())).first;
+                wordBuckets.push_back(it->second);
+                pattern[i] = w[i];
+            }
+            wordOffsets.push_back(static_cast<int>(wordBuckets.size()));
+        }
+
+        // Invert word -> buckets with a counting sort; members stay in id order.
+        const int buckets = static_cast<int>(bucketOfPattern.size());
+        bucketOffsets.assign(buckets + 1, 0);
+        for (int b : wordBuckets) bucketOffsets[b + 1]++;
+        for (int b = 0; b < buckets; b++) bucketOffsets[b + 1] += bucketOffsets[b];
+        bucketMembers.resize(wordBuckets.size());
+        std::vector<int> cursor(bucketOffsets.begin(), bucketOffsets.end() - 1);
+        for (int id = 0; id < size(); id++) {
+            for (int b : bucketsOf(id)) bucketMembers[cursor[b]++] = id;
+        }
+    }
+
+    int size() const { return static_cast<int>(words.size()); }
+    int numBuckets() const { return static_cast<int>(bucketOffsets.size()) - 1; }
+    const std::string& word(int id) const { return words[id]; }
+
+    // Id of w, or -1 if it is not in the dictionary.
+    int find(const std::string& w) const {
+        auto it = idOfWord.find(w);
+        return it == idOfWord.end() ? -1 : it->second;
+    }
+
+    CsrGraph::Range bucketsOf(int id) const { return slice(wordOffsets, wordBuckets, id); }
+    CsrGraph::Range members(int bucket) const { return slice(bucketOffsets, bucketMembers, bucket); }
+
+    // Buckets of a word that need not be in the dictionary (e.g. a ladder's
+    // start word); patterns no dictionary word has are left out.
+    std::vector<int> bucketsOf(const std::string& w) const {
+        std::vector<int> result;
+        std::string pattern = w;
+        for (std::size_t i = 0; i < w.size(); i++) {
+            pattern[i] = '*';
+            auto it = bucketOfPattern.find(pattern);
+            if (it != bucketOfPattern.end()) result.push_back(it->second);
+            pattern[i] = w[i];
+        }
+        return result;
+    }
+};
@@ -0,0 +1,240 @@
+#pragma once
+
+// Heap allocation profiler, compiled in with -DDAA_ALLOC_PROFILE.
+//
+//   DAA_ALLOC_SCOPE(name)     attributes this thread's allocations to tag
+//                             name until the end of the enclosing block
+//   DAA_ALLOC_ONLY(stmt)      stmt exists only in profiled builds
+//
+// The global operator new / delete (every form, aligned and nothrow
+// included) are replaced by versions that prefix each block with its size
+// and the tag that was current on the allocating thread. Per tag the
+// profiler keeps allocation and free counts, bytes requested, live bytes,
+// and the peak of live bytes; a free is charged to the tag that made the
+// allocation, whichever thread or scope frees it. Scopes nest, and a thread
+// starts untagged, so work a solution hands to worker threads counts as
+// "(untagged)" unless the workers open their own scope. At exit every tag is
+// written as one JSON object to the file named by $DAA_ALLOC_FILE or to
+// stderr, like the op counters (op_counters.h).
+//
+// The replacements are ordinary (non-inline) definitions, as the standard
+// requires, so a profiled program includes this header from one translation
+// unit only; every program in this repository is a single one. Without
+// DAA_ALLOC_PROFILE nothing is replaced and the macros expand to nothing.
+
+#ifdef DAA_ALLOC_PROFILE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string_view>
+
+namespace alloc_profile {
+
+constexpr int MAX_TAGS = 256;
+
+struct Snapshot {
+    long long allocs = 0, frees = 0, bytes = 0;
+    long long live = 0;     // bytes allocated under the tag and not yet freed
+    long long peakLive = 0; // highest live, above the live bytes at reset()
+};
+
+class Profiler {
+    struct Tag {
+        std::atomic<long long> allocs{0}, frees{0}, bytes{0}, live{0}, peakLive{0};
+        long long baseLive = 0;
+        char name[64] = {};
+    };
+    Tag tags[MAX_TAGS];
+    std::atomic<int> used{1}; // tag 0 is "(untagged)"
+    std::mutex lock;
+
+    static void dumpAtExit() { instance().dump(); }
+
+public:
+    Profiler() { std::strcpy(tags[0].name, "(untagged)"); }
+
+    // Built in static storage with placement new, so creating it never
+    // re-enters the replaced operator new; never destroyed, so frees during
+    // static destruction still find it.
+    static Profiler& instance() {
+        alignas(Profiler) static unsigned char storage[sizeof(Profiler)];
+        static Profiler* p = [] {
+            Profiler* created = new (storage) Profiler;
+            std::atexit(dumpAtExit);
+            return created;
+        }();
+        return *p;
+    }
+
+    // Id of the tag called name, created on first use. Names are truncated
+    // to 63 bytes; past MAX_TAGS tags everything goes to the last one.
+    int tagId(std::string_view name) {
+        if (name.size() > 63) name = name.substr(0, 63);
+        std::lock_guard<std::mutex> guard(lock);
+        int n = used.load(std::memory_order_relaxed);
+        for (int t = 0; t < n; t++)
+            if (name == tags[t].name) return t;
+        if (n == MAX_TAGS) return MAX_TAGS - 1;
+        std::memcpy(tags[n].name, name.data(), name.size());
+        used.store(n + 1, std::memory_order_relaxed);
+        return n;
+    }
+
+    void onAlloc(int tag, std::size_t n) {
+        Tag& t = tags[tag];
+        t.allocs.fetch_add(1, std::memory_order_relaxed);
+        t.bytes.fetch_add(static_cast<long long>(n), std::memory_order_relaxed);
+        long long live = t.live.fetch_add(static_cast<long long>(n), std::memory_order_relaxed) + static_cast<long long>(n);
+        long long peak = t.peakLive.load(std::memory_order_relaxed);
+        while (live > peak && !t.peakLive.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    void onFree(int tag, std::size_t n) {
+        Tag& t = tags[tag];
+        t.frees.fetch_add(1, std::memory_order_relaxed);
+        t.live.fetch_sub(static_cast<long long>(n), std::memory_order_relaxed);
+    }
+
+    // Starts a new measurement window for tag: counts back to zero and the
+    // peak measured from the bytes live now.
+    void reset(int tag) {
+        Tag& t = tags[tag];
+        t.allocs.store(0, std::memory_order_relaxed);
+        t.frees.store(0, std::memory_order_relaxed);
+        t.bytes.store(0, std::memory_order_relaxed);
+        t.baseLive = t.live.load(std::memory_order_relaxed);
+        t.peakLive.store(t.baseLive, std::memory_order_relaxed);
+    }
+
+    Snapshot snapshot(int tag) const {
+        const Tag& t = tags[tag];
+        Snapshot s;
+        s.allocs = t.allocs.load(std::memory_order_relaxed);
+        s.frees = t.frees.load(std::memory_order_relaxed);
+        s.bytes = t.bytes.load(std::memory_order_relaxed);
+        s.live = t.live.load(std::memory_order_relaxed);
+        s.peakLive = t.peakLive.load(std::memory_order_relaxed) - t.baseLive;
+        return s;
+    }
+
+    void dump() {
+        const char* path = std::getenv("DAA_ALLOC_FILE");
+        std::FILE* out = path && *path ? std::fopen(path, "w") : nullptr;
+        if (!out) out = stderr;
+        std::fputc('{', out);
+        int n = used.load(std::memory_order_relaxed);
+        for (int t = 0; t < n; t++) {
+            Snapshot s = snapshot(t);
+            std::fprintf(out, "%s\n  \"%s\": {\"allocs\": %lld, \"frees\": %lld, \"bytes\": %lld, \"peak_live\": %lld, \"live\": %lld}",
+                         t ? "," : "", tags[t].name, s.allocs, s.frees, s.bytes, s.peakLive, s.live);
+        }
+        std::fputs("\n}\n", out);
+        if (out != stderr) std::fclose(out);
+    }
+};
+
+inline thread_local int currentTag = 0;
+
+class Scope {
+    int previous;
+
+public:
+    explicit Scope(int tag) : previous(currentTag) { currentTag = tag; }
+    explicit Scope(std::string_view name) : Scope(Profiler::instance().tagId(name)) {}
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    ~Scope() { currentTag = previous; }
+};
+
+// Sits right before every block handed out; offset is the distance back to
+// what malloc returned.
+struct BlockHeader {
+    uint64_t size;
+    uint32_t tag;
+    uint32_t offset;
+};
+static_assert(sizeof(BlockHeader) == 16, "the header fills the first 16 aligned bytes");
+
+inline void* allocate(std::size_t n, std::size_t align, bool nothrow) {
+    if (align < 16) align = 16;
+    for (;;) {
+        void* base = nullptr;
+        std::size_t total = n + align;
+        if (total >= n) {
+            if (align == 16) base = std::malloc(total);
+            else base = std::aligned_alloc(align, (total + align - 1) / align * align);
+        }
+        if (base) {
+            unsigned char* user = static_cast<unsigned char*>(base) + align;
+            int tag = currentTag;
+            BlockHeader* h = reinterpret_cast<BlockHeader*>(user) - 1;
+            *h = {n, static_cast<uint32_t>(tag), static_cast<uint32_t>(align)};
+            Profiler::instance().onAlloc(tag, n);
+            return user;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            if (nothrow) return nullptr;
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+inline void release(void* p) noexcept {
+    if (!p) return;
+    BlockHeader* h = static_cast<BlockHeader*>(p) - 1;
+    Profiler::instance().onFree(static_cast<int>(h->tag), h->size);
+    std::free(static_cast<unsigned char*>(p) - h->offset);
+}
+
+} // namespace alloc_profile
+
+void* operator new(std::size_t n) { return alloc_profile::allocate(n, 16, false); }
+void* operator new[](std::size_t n) { return alloc_profile::allocate(n, 16, false); }
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept { return alloc_profile::allocate(n, 16, true); }
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept { return alloc_profile::allocate(n, 16, true); }
+void* operator new(std::size_t n, std::align_val_t a) { return alloc_profile::allocate(n, static_cast<std::size_t>(a), false); }
+void* operator new[](std::size_t n, std::align_val_t a) { return alloc_profile::allocate(n, static_cast<std::size_t>(a), false); }
+void* operator new(std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept {
+    return alloc_profile::allocate(n, static_cast<std::size_t>(a), true);
+}
+void* operator new[](std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept {
+    return alloc_profile::allocate(n, static_cast<std::size_t>(a), true);
+}
+
+void operator delete(void* p) noexcept { alloc_profile::release(p); }
+void operator delete[](void* p) noexcept { alloc_profile::release(p); }
+void operator delete(void* p, std::size_t) noexcept { alloc_profile::release(p); }
+void operator delete[](void* p, std::size_t) noexcept { alloc_profile::release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { alloc_profile::release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { alloc_profile::release(p); }
+void operator delete(void* p, std::align_val_t) noexcept { alloc_profile::release(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { alloc_profile::release(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { alloc_profile::release(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { alloc_profile::release(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { alloc_profile::release(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { alloc_profile::release(p); }
+
+#define DAA_ALLOC_CONCAT2(a, b) a##b
+#define DAA_ALLOC_CONCAT(a, b) DAA_ALLOC_CONCAT2(a, b)
+#define DAA_ALLOC_SCOPE(name) \
+    alloc_profile::Scope DAA_ALLOC_CONCAT(daaAllocScope, __LINE__)([]() -> int { \
+        static int id = alloc_profile::Profiler::instance().tagId(name); \
+        return id; \
+    }())
+#define DAA_ALLOC_ONLY(...) __VA_ARGS__
+
+#else
+
+#define DAA_ALLOC_SCOPE(name) ((void)0)
+#define DAA_ALLOC_ONLY(...)
+
+#endif
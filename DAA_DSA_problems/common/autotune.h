@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Engine dispatch from cheap input features, with the decision thresholds
+// read from a tuning profile instead of fixed in the code.
+//
+// A solution with several engines gives its Auto mode a few named
+// thresholds and compares them against features of the input:
+//   static const TunedValue bitsPerElement("consecutive.bitmap_bits_per_element", 32);
+//   InputFeatures f = sampleFeatures(nums);
+//   if (f.range() < bitsPerElement * f.n) ... bitmap ... else ... radix sort ...
+// InputFeatures (n, value range, sign mix, density) come from about a
+// thousand evenly spaced samples; GraphFeatures from one pass over the
+// adjacency lists. Each threshold has a built-in default, which a profile
+// overrides. The profile is a text file of "name value" lines ('#' starts
+// a comment), written by driver/calibrate.cpp from benchmarks on the target
+// machine, and loaded once, at the first threshold lookup, from the file
+// named by $DAA_TUNE_FILE; without it the defaults hold. A TunedValue reads
+// its value when it is constructed, so later changes to the profile affect
+// only thresholds not yet used.
+
+class TuningProfile {
+    mutable std::mutex lock;
+    std::map<std::string, double> values;
+    std::map<std::string, double> defaults; // every threshold looked up so far
+    std::string source;
+
+public:
+    // The profile of $DAA_TUNE_FILE. A file that cannot be read or parsed
+    // is reported on stderr once and leaves every default in place.
+    static TuningProfile& global() {
+        static TuningProfile* p = [] {
+            auto* created = new TuningProfile;
+            const char* path = std::getenv("DAA_TUNE_FILE");
+            if (path && *path) {
+                try {
+                    created->load(path);
+                } catch (const std::runtime_error& e) {
+                    std::fprintf(stderr, "%s; using the default thresholds\n", e.what());
+                }
+            }
+            return created;
+        }();
+        return *p;
+    }
+
+    // Replaces the values with those of path. Throws runtime_error naming
+    // the file and line when it cannot be read or a line is malformed.
+    void load(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) throw std::runtime_error("cannot read tuning profile " + path);
+        std::map<std::string, double> parsed;
+        std::string line;
+        for (int number = 1; std::getline(in, line); number++) {
+            line = line.substr(0, line.find('#'));
+            std::istringstream fields(line);
+            std::string name, extra;
+            double value;
+            if (!(fields >> name)) continue;
+            if (!(fields >> value) || (fields >> extra))
+                throw std::runtime_error(path + ":" + std::to_string(number) + ": expected \"name value\"");
+            parsed[name] = value;
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        values.swap(parsed);
+        source = path;
+    }
+
+    // Writes every value, calibrated or set, one per line, after a comment
+    // header.
+    void save(const std::string& path, const std::string& header = "") const {
+        std::ofstream out(path);
+        if (!out) throw std::runtime_error("cannot write tuning profile " + path);
+        out.precision(10);
+        std::lock_guard<std::mutex> guard(lock);
+        if (!header.empty()) out << "# " << header << "\n";
+        for (const auto& [name, value] : values) out << name << " " << value << "\n";
+        if (!out) throw std::runtime_error("cannot write tuning profile " + path);
+    }
+
+    void set(const std::string& name, double value) {
+        std::lock_guard<std::mutex> guard(lock);
+        values[name] = value;
+    }
+
+    // The profile's value for name, or fallback if it has none.
+    double get(const std::string& name, double fallback) {
+        std::lock_guard<std::mutex> guard(lock);
+        defaults.emplace(name, fallback);
+        auto found = values.find(name);
+        return found == values.end() ? fallback : found->second;
+    }
+
+    // Thresholds looked up so far, with their defaults.
+    std::map<std::string, double> declared() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return defaults;
+    }
+
+    // The file the values came from, empty for the defaults.
+    std::string loadedFrom() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return source;
+    }
+};
+
+// One named threshold, meant as a function-local static at its call site.
+class TunedValue {
+    double resolved;
+
+public:
+    TunedValue(const char* name, double fallback) : resolved(TuningProfile::global().get(name, fallback)) {}
+    operator double() const { return resolved; }
+};
+
+// Features of an int array. With fewer samples than elements the range is
+// that of the sample, widened by the expected shortfall of evenly spaced
+// samples (about 2 / samples of the range), and the sign mix is the
+// sample's; pass samples >= n for exact values.
+struct InputFeatures {
+    long long n = 0;
+    long long minValue = 0, maxValue = 0;
+    bool negatives = false, nonNegatives = false;
+    bool exact = false;
+
+    long long range() const { return n ? maxValue - minValue + 1 : 0; }
+    // Elements per distinct value the range could hold.
+    double density() const { return n ? (double)n / (double)range() : 0.0; }
+    // Bits of the widest value; 32 once any value is negative.
+    int bitWidth() const {
+        if (negatives) return 32;
+        uint64_t top = (uint64_t)std::max(0LL, maxValue);
+        return top ? 64 - __builtin_clzll(top) : 0;
+    }
+};
+
+// Time Complexity: O(min(n, samples))
+// Space Complexity: O(1)
+inline InputFeatures sampleFeatures(const std::vector<int>& v, std::size_t samples = 1024) {
+    InputFeatures f;
+    f.n = (long long)v.size();
+    if (v.empty()) return f;
+    f.exact = samples >= v.size();
+    std::size_t count = std::min(samples, v.size()), stride = v.size() / count;
+    f.minValue = f.maxValue = v[0];
+    for (std::size_t i = 0; i < count; i++) {
+        int x = v[i * stride];
+        f.minValue = std::min<long long>(f.minValue, x);
+        f.maxValue = std::max<long long>(f.maxValue, x);
+        (x < 0 ? f.negatives : f.nonNegatives) = true;
+    }
+    if (!f.exact) {
+        long long widen = (f.maxValue - f.minValue) / (long long)count;
+        f.minValue = std::max<long long>(INT32_MIN, f.minValue - widen);
+        f.maxValue = std::min<long long>(INT32_MAX, f.maxValue + widen);
+    }
+    return f;
+}
+
+// Features of a weighted adjacency list ({neighbor, weight} pairs).
+struct GraphFeatures {
+    int V = 0;
+    long long E = 0;
+    long long maxWeight = 0;
+    bool negativeWeights = false;
+
+    double averageDegree() const { return V ? (double)E / V : 0.0; }
+};
+
+// Time Complexity: O(V + E)
+// Space Complexity: O(1)
+template <class Adjacency>
+GraphFeatures graphFeatures(const Adjacency& adj) {
+    GraphFeatures f;
+    f.V = (int)adj.size();
+    for (const auto& list : adj) {
+        f.E += (long long)list.size();
+        for (const auto& edge : list) {
+            f.maxWeight = std::max<long long>(f.maxWeight, edge.second);
+            f.negativeWeights |= edge.second < 0;
+        }
+    }
+    return f;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include <sys/resource.h>
+
+// Timing and peak-memory helpers shared by the benchmark programs.
+//
+// Peak memory is the kernel's resident-set high-water mark (VmHWM). Writing
+// "5" to /proc/self/clear_refs resets that mark to the current RSS, so each
+// measured run reports its own peak rather than the process-wide maximum.
+// Kernels (and sandboxes) that ignore the reset leave the mark monotone, and
+// without /proc the process-wide ru_maxrss is reported instead.
+
+inline double elapsedMs(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+}
+
+inline void resetPeakMemory() {
+    if (std::FILE* f = std::fopen("/proc/self/clear_refs", "w")) {
+        std::fputs("5", f);
+        std::fclose(f);
+    }
+}
+
+// Resident-set high-water mark in KiB.
+inline long peakMemoryKb() {
+    if (std::FILE* f = std::fopen("/proc/self/status", "r")) {
+        char line[256];
+        long kb = -1;
+        while (std::fgets(line, sizeof line, f)) {
+            if (std::strncmp(line, "VmHWM:", 6) == 0) {
+                kb = std::strtol(line + 6, nullptr, 10);
+                break;
+            }
+        }
+        std::fclose(f);
+        if (kb >= 0) return kb;
+    }
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+struct Measurement {
+    double ms = 0;
+    long peakKb = 0;
+};
+
+// Runs fn once, storing its return value in result, and reports wall time
+// and the peak resident memory reached while it ran.
+template <class Result, class Fn>
+Measurement measure(Result& result, Fn&& fn) {
+    resetPeakMemory();
+    auto start = std::chrono::steady_clock::now();
+    result = fn();
+    Measurement m;
+    m.ms = elapsedMs(start);
+    m.peakKb = peakMemoryKb();
+    return m;
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Text I/O for the mains that read large integer inputs, as a drop-in for
+// cin / cout: "FastInput in; in >> n;" and "FastOutput out; out << x << '\n';".
+//
+// FastInput maps its file (or stdin, when stdin is a regular file) and
+// parses in place, so the input is never copied; a pipe is read into one
+// buffer instead. An integer of up to 15 digits is converted in a fixed
+// number of steps, without a loop over its digits: one 16-byte load, a
+// compare that finds where the digits end, a shuffle that right-aligns them,
+// and three multiply-add steps that combine 2, 4 and 8 digits at a time. The
+// last 16 bytes of the input, and longer numbers, go through the scalar
+// loop. Unlike cin, a malformed or missing number throws runtime_error, and
+// values that do not fit the target type are rejected rather than clamped.
+//
+// FastOutput formats into a 64 KiB buffer and hands it to stdio in one
+// fwrite when full, so it may be mixed with printf and cout (synced with
+// stdio by default) and the output stays in order. There is no endl: write
+// '\n', and flush() when interleaving with another writer.
+
+namespace fast_io_detail {
+
+inline bool isSpace(char c) { return static_cast<unsigned char>(c) <= ' '; }
+inline bool isDigit(char c) { return static_cast<unsigned char>(c - '0') < 10; }
+
+#if defined(__AVX2__)
+// Number of leading digits among the 16 bytes at p.
+inline int digitRun16(const char* p) {
+    __m128i d = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi8('0'));
+    __m128i bad = _mm_or_si128(_mm_cmpgt_epi8(d, _mm_set1_epi8(9)), _mm_cmpgt_epi8(_mm_setzero_si128(), d));
+    return __builtin_ctz(static_cast<unsigned>(_mm_movemask_epi8(bad)) | 0x10000u);
+}
+
+// Value of the len (1..16) digits at p; all 16 bytes at p must be readable.
+inline uint64_t digitsValue16(const char* p, int len) {
+    __m128i d = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi8('0'));
+    // Byte i takes digit i - (16 - len); negative shuffle indices give zeros
+    __m128i shift = _mm_add_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                 _mm_set1_epi8(static_cast<char>(len - 16)));
+    d = _mm_shuffle_epi8(d, shift);
+    __m128i pairs = _mm_maddubs_epi16(d, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    quads = _mm_packus_epi32(quads, quads); // every 4-digit group is <= 9999
+    __m128i octs = _mm_madd_epi16(quads, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+    uint64_t hi = static_cast<uint32_t>(_mm_cvtsi128_si32(octs));
+    uint64_t lo = static_cast<uint32_t>(_mm_extract_epi32(octs, 1));
+    return hi * 100000000ULL + lo;
+}
+#endif
+
+} // namespace fast_io_detail
+
+class FastInput {
+    const char* p = nullptr;
+    const char* end = nullptr;
+    void* mapped = MAP_FAILED;
+    std::size_t mappedLength = 0;
+    std::vector<char> copy; // pipes and terminals
+
+    void load(int fd, const std::string& name) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            mappedLength = static_cast<std::size_t>(st.st_size);
+            mapped = mmap(nullptr, mappedLength, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                madvise(mapped, mappedLength, MADV_SEQUENTIAL);
+                p = static_cast<const char*>(mapped);
+                end = p + mappedLength;
+                return;
+            }
+        }
+        std::size_t used = 0;
+        copy.resize(1 << 16);
+        for (;;) {
+            if (used == copy.size()) copy.resize(copy.size() * 2);
+            ssize_t got = ::read(fd, copy.data() + used, copy.size() - used);
+            if (got < 0) throw std::runtime_error("FastInput: cannot read " + name);
+            if (got == 0) break;
+            used += static_cast<std::size_t>(got);
+        }
+        p = copy.data();
+        end = p + used;
+    }
+
+    [[noreturn]] void fail(const char* what) const {
+        throw std::runtime_error(std::string("FastInput: ") + what);
+    }
+
+    // Digits at p as an unsigned magnitude; at least one must be present.
+    uint64_t magnitude() {
+#if defined(__AVX2__)
+        if (end - p >= 16) {
+            int len = fast_io_detail::digitRun16(p);
+            if (len == 0) fail("expected an integer");
+            if (len < 16) {
+                uint64_t v = fast_io_detail::digitsValue16(p, len);
+                p += len;
+                return v;
+            }
+        }
+#endif
+        if (p == end || !fast_io_detail::isDigit(*p)) fail("expected an integer");
+        uint64_t v = 0;
+        for (; p < end && fast_io_detail::isDigit(*p); p++) {
+            unsigned digit = static_cast<unsigned>(*p - '0');
+            if (v > (std::numeric_limits<uint64_t>::max() - digit) / 10) fail("integer does not fit in 64 bits");
+            v = v * 10 + digit;
+        }
+        return v;
+    }
+
+public:
+    // Reads stdin.
+    FastInput() { load(0, "stdin"); }
+
+    explicit FastInput(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("FastInput: cannot open " + path);
+        try {
+            load(fd, path);
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+    }
+
+    FastInput(const FastInput&) = delete;
+    FastInput& operator=(const FastInput&) = delete;
+    ~FastInput() {
+        if (mapped != MAP_FAILED) munmap(mapped, mappedLength);
+    }
+
+    // The unread rest of the input.
+    std::string_view rest() const { return std::string_view(p, static_cast<std::size_t>(end - p)); }
+
+    bool atEnd() {
+        while (p < end && fast_io_detail::isSpace(*p)) p++;
+        return p == end;
+    }
+
+    template <class T>
+    T read() {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "FastInput reads integers");
+        if (atEnd()) fail("unexpected end of input");
+        bool negative = *p == '-';
+        if (negative || *p == '+') p++;
+        uint64_t m = magnitude();
+        if (p < end && !fast_io_detail::isSpace(*p)) fail("expected an integer");
+        using U = std::make_unsigned_t<T>;
+        if (negative) {
+            if (m == 0) return T(0);
+            if (std::is_unsigned_v<T> || m - 1 > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+                fail("integer out of range");
+            return static_cast<T>(-static_cast<T>(m - 1) - 1);
+        }
+        if (m > static_cast<uint64_t>(static_cast<U>(std::numeric_limits<T>::max()))) fail("integer out of range");
+        return static_cast<T>(m);
+    }
+
+    // Fills out[0 .. n).
+    template <class T>
+    void read(T* out, std::size_t n) {
+        for (std::size_t i = 0; i < n; i++) out[i] = read<T>();
+    }
+
+    template <class T>
+    std::vector<T> readVector(std::size_t n) {
+        std::vector<T> v(n);
+        read(v.data(), n);
+        return v;
+    }
+
+    template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+    FastInput& operator>>(T& v) {
+        v = read<T>();
+        return *this;
+    }
+
+    FastInput& operator>>(std::string& word) {
+        if (atEnd()) fail("unexpected end of input");
+        const char* start = p;
+        while (p < end && !fast_io_detail::isSpace(*p)) p++;
+        word.assign(start, p);
+        return *this;
+    }
+};
+
+class FastOutput {
+    std::FILE* target;
+    std::vector<char> buffer;
+    std::size_t used = 0;
+
+    char* room(std::size_t bytes) {
+        if (buffer.size() - used < bytes) flush();
+        if (buffer.size() < bytes) buffer.resize(bytes);
+        return buffer.data() + used;
+    }
+
+public:
+    explicit FastOutput(std::FILE* to = stdout, std::size_t capacity = 1 << 16)
+        : target(to), buffer(capacity < 64 ? 64 : capacity) {}
+
+    FastOutput(const FastOutput&) = delete;
+    FastOutput& operator=(const FastOutput&) = delete;
+    ~FastOutput() {
+        try {
+            flush();
+        } catch (const std::runtime_error&) {
+            // Nowhere left to report it; an explicit flush() throws
+        }
+    }
+
+    void flush() {
+        if (used && std::fwrite(buffer.data(), 1, used, target) != used) {
+            used = 0;
+            throw std::runtime_error("FastOutput: write failed");
+        }
+        used = 0;
+        std::fflush(target);
+    }
+
+    template <class T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char>, int> = 0>
+    FastOutput& operator<<(T v) {
+        char* at = room(24);
+        if constexpr (std::is_same_v<T, bool>) {
+            *at = v ? '1' : '0';
+            used++;
+        } else {
+            used = static_cast<std::size_t>(std::to_chars(at, at + 24, v).ptr - buffer.data());
+        }
+        return *this;
+    }
+
+    FastOutput& operator<<(char c) {
+        *room(1) = c;
+        used++;
+        return *this;
+    }
+
+    FastOutput& operator<<(std::string_view s) {
+        std::memcpy(room(s.size()), s.data(), s.size());
+        used += s.size();
+        return *this;
+    }
+
+    FastOutput& operator<<(const char* s) { return *this << std::string_view(s); }
+    FastOutput& operator<<(const std::string& s) { return *this << std::string_view(s); }
+
+    // values separated by sep, for the "print every element" loops.
+    template <class Range>
+    FastOutput& writeAll(const Range& values, char sep = ' ') {
+        bool first = true;
+        for (const auto& v : values) {
+            if (!first) *this << sep;
+            first = false;
+            *this << v;
+        }
+        return *this;
+    }
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Open-addressing hash map with linear probing, for the solutions that key a
+// map by integers (prefix sums, coordinates, ids).
+//
+// Keys, values and a one-byte occupancy flag live in three flat arrays, so a
+// lookup is one hash and a short forward scan instead of a bucket pointer
+// chase, and reserve(n) does one allocation for the whole run. The table is
+// kept at most half full. There is no erase; clear() resets in O(capacity).
+//
+// Integral keys are scrambled with the splitmix64 finalizer, because
+// consecutive prefix sums or coordinates would otherwise fill neighbouring
+// slots and turn probes into long runs.
+inline uint64_t flatHashMix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+template <class Key>
+struct FlatHash {
+    uint64_t operator()(const Key& k) const {
+        if constexpr (std::is_integral_v<Key> || std::is_enum_v<Key>) {
+            return flatHashMix(static_cast<uint64_t>(k));
+        } else {
+            return flatHashMix(std::hash<Key>()(k));
+        }
+    }
+};
+
+// Time Complexity: O(1) expected per operation
+// Space Complexity: O(capacity), capacity = next power of two >= 2 * size
+template <class Key, class Value, class Hash = FlatHash<Key>>
+class FlatHashMap {
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    std::vector<uint8_t> used;
+    std::size_t mask = 0;
+    std::size_t count = 0;
+    Hash hasher;
+
+    std::size_t slotOf(const Key& k) const {
+        std::size_t s = static_cast<std::size_t>(hasher(k)) & mask;
+        while (used[s] && !(keys[s] == k)) s = (s + 1) & mask;
+        return s;
+    }
+
+    void rehash(std::size_t capacity) {
+        std::vector<Key> oldKeys(capacity);
+        std::vector<Value> oldValues(capacity);
+        std::vector<uint8_t> oldUsed(capacity, 0);
+        oldKeys.swap(keys);
+        oldValues.swap(values);
+        oldUsed.swap(used);
+        mask = capacity - 1;
+        for (std::size_t i = 0; i < oldUsed.size(); i++) {
+            if (!oldUsed[i]) continue;
+            std::size_t s = slotOf(oldKeys[i]);
+            used[s] = 1;
+            keys[s] = std::move(oldKeys[i]);
+            values[s] = std::move(oldValues[i]);
+        }
+    }
+
+public:
+    explicit FlatHashMap(std::size_t expected = 0) { reserve(expected); }
+
+    // Makes room for n keys without further rehashing.
+    void reserve(std::size_t n) {
+        std::size_t capacity = 16;
+        while (capacity < 2 * n) capacity <<= 1;
+        if (capacity > used.size()) rehash(capacity);
+    }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    void clear() {
+        std::fill(used.begin(), used.end(), 0);
+        count = 0;
+    }
+
+    Value* find(const Key& k) {
+        std::size_t s = slotOf(k);
+        return used[s] ? &values[s] : nullptr;
+    }
+
+    const Value* find(const Key& k) const {
+        std::size_t s = slotOf(k);
+        return used[s] ? &values[s] : nullptr;
+    }
+
+    bool contains(const Key& k) const { return find(k) != nullptr; }
+
+    // Inserts {k, v} if k is absent. Returns the stored value and whether it
+    // was inserted; the pointer stays valid until the next insertion.
+    std::pair<Value*, bool> tryEmplace(const Key& k, const Value& v = Value()) {
+        std::size_t s = slotOf(k);
+        if (used[s]) return {&values[s], false};
+        if (2 * (count + 1) > used.size()) {
+            rehash(2 * used.size());
+            s = slotOf(k);
+        }
+        used[s] = 1;
+        keys[s] = k;
+        values[s] = v;
+        count++;
+        return {&values[s], true};
+    }
+
+    Value& operator[](const Key& k) { return *tryEmplace(k).first; }
+
+    // Calls fn(key, value) for every entry, in slot order.
+    template <class Fn>
+    void forEach(Fn fn) const {
+        for (std::size_t i = 0; i < used.size(); i++) {
+            if (used[i]) fn(keys[i], values[i]);
+        }
+    }
+};
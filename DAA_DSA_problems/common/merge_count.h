@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "parallel.h"
+
+// Merge-sort pair counting shared by the inversion (Array/prob_37) and
+// reverse-pair (Array/prob_38) problems.
+//
+// mergeSortCount(a, pred) sorts a ascending and returns the number of index
+// pairs i < j with pred(a[i], a[j]). pred must be monotone: if pred(x, y)
+// holds it also holds for any larger x and any smaller y. Then, for a left
+// run and a right run that are each sorted, the right-hand partners of every
+// left element form a prefix of the right run whose length only grows along
+// the left run, and the cross pairs are counted with one two-pointer pass.
+// NaNs are not ordered and must not appear in floating-point input.
+//
+// One scratch buffer of n elements is allocated up front. Every thread
+// first sorts and counts one contiguous chunk; ceil(log2 threads) rounds
+// then combine neighbouring runs, ping-ponging between a and the scratch
+// buffer. In a round, both the cross count (split over the left run) and the
+// merge (split along its merge path) are cut into pieces of about 64K
+// elements, so all threads share even the final merge.
+
+// x > c * y + d without overflow: integers widen to __int128 (exact for
+// 64-bit inputs and coefficients), floating point compares directly. c must
+// be non-negative for the predicate to be monotone.
+template <class T>
+struct ScaledGreater {
+    T c, d;
+
+    ScaledGreater(T scale = 1, T offset = 0) : c(scale), d(offset) {
+        if (c < 0) throw std::invalid_argument("ScaledGreater: negative scale breaks monotonicity");
+    }
+
+    bool operator()(const T& x, const T& y) const {
+        if constexpr (std::is_integral_v<T>) {
+            return static_cast<__int128>(x) > static_cast<__int128>(c) * y + d;
+        } else {
+            return x > c * y + d;
+        }
+    }
+};
+
+namespace merge_count_detail {
+
+// Pairs (x in L, y in R) with pred(x, y); L and R sorted ascending.
+template <class T, class Pred>
+long long crossCount(const T* L, std::size_t nl, const T* R, std::size_t nr, const Pred& pred) {
+    if (nl == 0 || nr == 0 || !pred(L[nl - 1], R[0])) return 0;
+    long long cnt = 0;
+    std::size_t p = 0;
+    for (std::size_t i = 0; i < nl; i++) {
+        while (p < nr && pred(L[i], R[p])) p++;
+        cnt += p;
+    }
+    return cnt;
+}
+
+// Sorts a[lo, hi) through tmp[lo, hi) and returns its pair count. Ranges of
+// at most 16 elements count their pairs directly and are insertion sorted.
+template <class T, class Pred>
+long long sortCountRange(T* a, T* tmp, std::size_t lo, std::size_t hi, const Pred& pred) {
+    long long cnt = 0;
+    if (hi - lo <= 16) {
+        for (std::size_t i = lo; i < hi; i++) {
+            for (std::size_t j = i + 1; j < hi; j++) cnt += pred(a[i], a[j]);
+        }
+        for (std::size_t i = lo + 1; i < hi; i++) {
+            T x = a[i];
+            std::size_t j = i;
+            for (; j > lo && x < a[j - 1]; j--) a[j] = a[j - 1];
+            a[j] = x;
+        }
+        return cnt;
+    }
+    std::size_t mid = lo + (hi - lo) / 2;
+    cnt += sortCountRange(a, tmp, lo, mid, pred);
+    cnt += sortCountRange(a, tmp, mid, hi, pred);
+    cnt += crossCount(a + lo, mid - lo, a + mid, hi - mid, pred);
+    if (!(a[mid] < a[mid - 1])) return cnt; // halves already in order
+    std::merge(a + lo, a + mid, a + mid, a + hi, tmp + lo);
+    std::copy(tmp + lo, tmp + hi, a + lo);
+    return cnt;
+}
+
+// How many of the first d outputs of the stable merge of L[0, nl) and
+// R[0, nr) come from L (equal keys take L first).
+template <class T>
+std::size_t mergePathSplit(const T* L, std::size_t nl, const T* R, std::size_t nr, std::size_t d) {
+    std::size_t lo = d > nr ? d - nr : 0, hi = std::min(d, nl);
+    while (lo < hi) {
+        std::size_t i = lo + (hi - lo) / 2;
+        if (!(R[d - i - 1] < L[i])) lo = i + 1;
+        else hi = i;
+    }
+    return lo;
+}
+
+} // namespace merge_count_detail
+
+// Time Complexity: O(n log n / threads + log n * log threads)
+// Space Complexity: O(n)
+template <class T, class Pred>
+long long mergeSortCount(std::vector<T>& a, const Pred& pred, int threads = 0) {
+    using namespace merge_count_detail;
+    std::size_t n = a.size();
+    threads = n < (1 << 16) ? 1 : resolveThreads(threads);
+    std::vector<T> scratch(n);
+    if (threads == 1) return sortCountRange(a.data(), scratch.data(), 0, n, pred);
+
+    std::vector<std::size_t> bound(threads + 1);
+    for (int t = 0; t <= threads; t++) bound[t] = n * t / threads;
+    std::vector<long long> partial(threads, 0);
+    parallelForDynamic(threads, threads, [&](long long t, int) {
+        partial[t] = sortCountRange(a.data(), scratch.data(), bound[t], bound[t + 1], pred);
+    });
+    long long cnt = std::accumulate(partial.begin(), partial.end(), 0LL);
+
+    const std::size_t PIECE = 1 << 16;
+    T* src = a.data();
+    T* dst = scratch.data();
+    while (bound.size() > 2) {
+        // Counting pieces cover left-run slots [from, to); merge pieces
+        // cover output diagonals [from, to) of the merged pair.
+        struct Piece {
+            bool counting;
+            std::size_t lo, mid, hi, from, to;
+        };
+        std::vector<Piece> pieces;
+        std::vector<std::size_t> next;
+        for (std::size_t r = 0; r + 1 < bound.size(); r += 2) {
+            next.push_back(bound[r]);
+            std::size_t lo = bound[r], mid = bound[r + 1], hi = r + 2 < bound.size() ? bound[r + 2] : mid;
+            if (hi > mid) {
+                for (std::size_t i = 0; i < mid - lo; i += PIECE) {
+                    pieces.push_back({true, lo, mid, hi, i, std::min(mid - lo, i + PIECE)});
+                }
+            }
+            for (std::size_t d = 0; d < hi - lo; d += PIECE) {
+                pieces.push_back({false, lo, mid, hi, d, std::min(hi - lo, d + PIECE)});
+            }
+        }
+        next.push_back(n);
+
+        std::vector<long long> pieceCount(pieces.size(), 0);
+        parallelForDynamic(static_cast<long long>(pieces.size()), threads, [&](long long p, int) {
+            const Piece& pc = pieces[p];
+            const T* L = src + pc.lo;
+            const T* R = src + pc.mid;
+            std::size_t nl = pc.mid - pc.lo, nr = pc.hi - pc.mid;
+            if (pc.counting) {
+                // Partners of L[from] by binary search, then the usual sweep.
+                std::size_t q = std::partition_point(R, R + nr, [&](const T& y) { return pred(L[pc.from], y); }) - R;
+                long long c = 0;
+                for (std::size_t i = pc.from; i < pc.to; i++) {
+                    while (q < nr && pred(L[i], R[q])) q++;
+                    c += q;
+                }
+                pieceCount[p] = c;
+                return;
+            }
+            std::size_t i = mergePathSplit(L, nl, R, nr, pc.from), j = pc.from - i;
+            for (std::size_t d = pc.from; d < pc.to; d++) {
+                dst[pc.lo + d] = j == nr || (i < nl && !(R[j] < L[i])) ? L[i++] : R[j++];
+            }
+        });
+        cnt += std::accumulate(pieceCount.begin(), pieceCount.end(), 0LL);
+        std::swap(src, dst);
+        bound = std::move(next);
+    }
+    if (src != a.data()) std::copy(src, src + n, a.data());
+    return cnt;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+// Hot-path operation counters, compiled in with -DDAA_OP_COUNTERS.
+//
+//   DAA_COUNT(name)              adds 1 to counter name
+//   DAA_COUNT_ADD(name, n)       adds n
+//   DAA_COUNT_MAX(name, value)   keeps the largest value seen (high-water mark)
+//   DAA_COUNTERS_ONLY(stmt)      stmt exists only in instrumented builds, for
+//                                locals that feed the macros above
+//
+// Names are string literals such as "dijkstra.relaxations"; sites that use the
+// same name share one counter. Each site resolves its counter once (a
+// function-local static), after which an update is one relaxed atomic, so
+// instrumented code stays usable from several threads. At exit every counter
+// is written as one flat JSON object, sorted by name, to the file named by
+// $DAA_COUNTERS_FILE or to stderr so program output on stdout is unchanged.
+//
+// Without DAA_OP_COUNTERS every macro expands to nothing and its arguments are
+// not evaluated, so the instrumented loops compile to the same code as before.
+
+#ifdef DAA_OP_COUNTERS
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace op_counters {
+
+struct Counter {
+    std::atomic<long long> value{0};
+
+    void add(long long n) { value.fetch_add(n, std::memory_order_relaxed); }
+
+    void max(long long v) {
+        long long cur = value.load(std::memory_order_relaxed);
+        while (v > cur && !value.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {
+        }
+    }
+};
+
+class Registry {
+    std::mutex lock;
+    std::map<std::string, Counter> counters; // node-based: references stay valid
+
+    static void dumpAtExit() { instance().dump(); }
+
+public:
+    // Leaked on purpose so counters outlive every static destructor that
+    // might still update them.
+    static Registry& instance() {
+        static Registry* r = [] {
+            Registry* created = new Registry;
+            std::atexit(dumpAtExit);
+            return created;
+        }();
+        return *r;
+    }
+
+    Counter& get(const char* name) {
+        std::lock_guard<std::mutex> guard(lock);
+        return counters[name];
+    }
+
+    void dump() {
+        std::lock_guard<std::mutex> guard(lock);
+        const char* path = std::getenv("DAA_COUNTERS_FILE");
+        std::FILE* out = path && *path ? std::fopen(path, "w") : nullptr;
+        if (!out) out = stderr;
+        std::fputc('{', out);
+        bool first = true;
+        for (auto& [name, c] : counters) {
+            std::fprintf(out, "%s\n  \"%s\": %lld", first ? "" : ",", name.c_str(),
+                         c.value.load(std::memory_order_relaxed));
+            first = false;
+        }
+        std::fputs(first ? "}\n" : "\n}\n", out);
+        if (out != stderr) std::fclose(out);
+    }
+};
+
+} // namespace op_counters
+
+#define DAA_COUNTER_REF(name) \
+    ([]() -> op_counters::Counter& { \
+        static op_counters::Counter& c = op_counters::Registry::instance().get(name); \
+        return c; \
+    }())
+#define DAA_COUNT(name) DAA_COUNTER_REF(name).add(1)
+#define DAA_COUNT_ADD(name, n) DAA_COUNTER_REF(name).add(static_cast<long long>(n))
+#define DAA_COUNT_MAX(name, value) DAA_COUNTER_REF(name).max(static_cast<long long>(value))
+#define DAA_COUNTERS_ONLY(...) __VA_ARGS__
+
+#else
+
+#define DAA_COUNT(name) ((void)0)
+#define DAA_COUNT_ADD(name, n) ((void)0)
+#define DAA_COUNT_MAX(name, value) ((void)0)
+#define DAA_COUNTERS_ONLY(...)
+
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Minimal fork-join helpers shared by the parallel variants of the solutions.
+// Every call spawns its worker threads and joins them before returning, so
+// callers never have to manage thread lifetimes.
+
+// Number of worker threads to use when the caller passes threads <= 0.
+inline int hardwareThreads() {
+    unsigned n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : static_cast<int>(n);
+}
+
+inline int resolveThreads(int threads) {
+    return threads > 0 ? threads : hardwareThreads();
+}
+
+// Splits [0, n) into one contiguous chunk per thread and calls
+// fn(begin, end, threadId) on each. Thread 0 runs on the calling thread.
+template <class Fn>
+void parallelChunks(long long n, int threads, Fn fn) {
+    threads = resolveThreads(threads);
+    if (n <= 0) return;
+    if (threads > n) threads = static_cast<int>(n);
+    if (threads == 1) {
+        fn(0LL, n, 0);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    long long chunk = (n + threads - 1) / threads;
+    for (int t = 1; t < threads; t++) {
+        long long begin = t * chunk;
+        long long end = std::min(n, begin + chunk);
+        pool.emplace_back([=, &fn] { if (begin < end) fn(begin, end, t); });
+    }
+    fn(0LL, std::min(n, chunk), 0);
+    for (auto& th : pool) th.join();
+}
+
+// Hands out the indices [0, n) one at a time through a shared counter, for
+// work items of uneven cost. Calls fn(index, threadId).
+template <class Fn>
+void parallelForDynamic(long long n, int threads, Fn fn) {
+    threads = resolveThreads(threads);
+    if (n <= 0) return;
+    if (threads > n) threads = static_cast<int>(n);
+
+    std::atomic<long long> nextIndex(0);
+    auto worker = [&](int t) {
+        for (long long i = nextIndex.fetch_add(1); i < n; i = nextIndex.fetch_add(1)) {
+            fn(i, t);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (int t = 1; t < threads; t++) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto& th : pool) th.join();
+}
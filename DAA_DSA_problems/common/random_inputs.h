@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// Seeded random arrays and grids for the differential checks and
+// benchmarks; Graph/graph_generators.h has the graph families. Every
+// generator is deterministic in its arguments, so a failing input can be
+// replayed from its size and seed.
+
+enum class ValueDistribution {
+    Uniform,     // every value in [lo, hi] equally likely
+    Skewed,      // most values near lo, a long tail towards hi
+    FewDistinct, // at most 16 distinct values, many repeats
+    Sorted,      // uniform, ascending
+    Reversed,    // uniform, descending
+};
+
+// Time Complexity: O(n) (O(n log n) for Sorted and Reversed)
+// Space Complexity: O(n)
+inline std::vector<int> randomArray(std::size_t n, int lo, int hi, uint64_t seed,
+                                    ValueDistribution dist = ValueDistribution::Uniform) {
+    if (lo > hi) throw std::invalid_argument("randomArray: lo > hi");
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> uniform(lo, hi);
+    std::vector<int> v(n);
+    switch (dist) {
+    case ValueDistribution::Skewed: {
+        std::uniform_real_distribution<double> u(0.0, 1.0);
+        double span = static_cast<double>(hi) - lo + 1;
+        for (int& x : v) {
+            double t = u(rng);
+            x = static_cast<int>(std::min<double>(hi, std::floor(lo + span * t * t * t)));
+        }
+        break;
+    }
+    case ValueDistribution::FewDistinct: {
+        int pool[16];
+        for (int& p : pool) p = uniform(rng);
+        for (int& x : v) x = pool[rng() % 16];
+        break;
+    }
+    default:
+        for (int& x : v) x = uniform(rng);
+        break;
+    }
+    if (dist == ValueDistribution::Sorted) std::sort(v.begin(), v.end());
+    if (dist == ValueDistribution::Reversed) std::sort(v.rbegin(), v.rend());
+    return v;
+}
+
+// rows x cols cells uniform in [lo, hi].
+inline std::vector<std::vector<int>> randomGrid(std::size_t rows, std::size_t cols, int lo, int hi, uint64_t seed) {
+    std::vector<std::vector<int>> grid(rows);
+    for (std::size_t r = 0; r < rows; r++) grid[r] = randomArray(cols, lo, hi, seed + r * 0x9E3779B97F4A7C15ULL);
+    return grid;
+}
+
+// Rows 1 .. rows of a number triangle, row r holding r + 1 values.
+inline std::vector<std::vector<int>> randomTriangle(std::size_t rows, int lo, int hi, uint64_t seed) {
+    std::vector<std::vector<int>> t(rows);
+    for (std::size_t r = 0; r < rows; r++) t[r] = randomArray(r + 1, lo, hi, seed + r * 0x9E3779B97F4A7C15ULL);
+    return t;
+}
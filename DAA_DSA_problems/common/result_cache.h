@@ -0,0 +1,400 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "op_counters.h"
+
+// Content-addressed cache for answers and intermediate results.
+//
+// A key is a 128-bit hash of everything the result depends on: a tag naming
+// what it is ("problem:variant" for an answer, e.g. "graph.topo_order" for an
+// intermediate), the input, and the parameters, fed to a Hasher128 with
+// length prefixes so concatenations cannot collide. Values are byte strings;
+// intermediates are vectors of trivially copyable values (cachedVector).
+// With 128 bits an accidental collision is out of reach, but the hash is not
+// keyed: do not share a cache with untrusted inputs.
+//
+// Two tiers. Memory: least recently used entries are evicted once their
+// bytes pass the budget. Disk (optional): one memory-mapped file holding an
+// open-addressing slot table and an append-only data area; when either
+// fills, the file is cleared and starts over. Every slot carries a checksum
+// of its bytes, so an entry torn by a crash reads as a miss. A disk hit is
+// copied into the memory tier. The file is locked (flock) for as long as it
+// is open, so only one process uses it at a time.
+// Counters (common/op_counters.h): result_cache.memory_hits, .disk_hits,
+// .misses, .stores, .evictions, .disk_resets.
+
+struct Hash128 {
+    uint64_t lo = 0, hi = 0;
+
+    bool operator==(const Hash128& o) const { return lo == o.lo && hi == o.hi; }
+    bool operator!=(const Hash128& o) const { return !(*this == o); }
+};
+
+struct Hash128Hash {
+    std::size_t operator()(const Hash128& h) const { return static_cast<std::size_t>(h.lo ^ h.hi); }
+};
+
+// Incremental 128-bit hash: the MurmurHash3 x64_128 block function and
+// finalizer over a stream of fields, about 3 GB/s. The tail block is zero
+// padded, and the total length goes into the finalizer.
+class Hasher128 {
+    static constexpr uint64_t C1 = 0x87c37b91114253d5ULL, C2 = 0x4cf5ad432745937fULL;
+
+    uint64_t h1, h2;
+    uint64_t total = 0;
+    unsigned char tail[16];
+    std::size_t fill = 0;
+
+    static uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    static uint64_t fmix(uint64_t k) {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    static void block(uint64_t& h1, uint64_t& h2, const unsigned char* p) {
+        uint64_t k1, k2;
+        std::memcpy(&k1, p, 8);
+        std::memcpy(&k2, p + 8, 8);
+        k1 *= C1;
+        k1 = rotl(k1, 31);
+        k1 *= C2;
+        h1 ^= k1;
+        h1 = rotl(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+        k2 *= C2;
+        k2 = rotl(k2, 33);
+        k2 *= C1;
+        h2 ^= k2;
+        h2 = rotl(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+public:
+    explicit Hasher128(uint64_t seed = 0) : h1(seed), h2(seed) {}
+
+    Hasher128& bytes(const void* data, std::size_t n) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        total += n;
+        if (fill) {
+            std::size_t take = std::min(n, 16 - fill);
+            std::memcpy(tail + fill, p, take);
+            fill += take;
+            p += take;
+            n -= take;
+            if (fill < 16) return *this;
+            block(h1, h2, tail);
+            fill = 0;
+        }
+        for (; n >= 16; p += 16, n -= 16) block(h1, h2, p);
+        std::memcpy(tail, p, n);
+        fill = n;
+        return *this;
+    }
+
+    template <class T>
+    Hasher128& value(const T& v) {
+        static_assert(std::is_trivially_copyable_v<T>, "Hasher128::value needs a trivially copyable type");
+        return bytes(&v, sizeof v);
+    }
+
+    Hasher128& text(std::string_view s) {
+        value(static_cast<uint64_t>(s.size()));
+        return bytes(s.data(), s.size());
+    }
+
+    template <class T>
+    Hasher128& values(const std::vector<T>& v) {
+        static_assert(std::is_trivially_copyable_v<T>, "Hasher128::values needs a trivially copyable type");
+        value(static_cast<uint64_t>(v.size()));
+        return bytes(v.data(), v.size() * sizeof(T));
+    }
+
+    Hash128 digest() const {
+        uint64_t a = h1, b = h2;
+        if (fill) {
+            unsigned char last[16] = {};
+            std::memcpy(last, tail, fill);
+            block(a, b, last);
+        }
+        a ^= total;
+        b ^= total;
+        a += b;
+        b += a;
+        a = fmix(a);
+        b = fmix(b);
+        a += b;
+        b += a;
+        return {a, b};
+    }
+};
+
+// The disk tier: a fixed-size file, mapped shared, laid out as
+//   Header | Slot[slots] | data ...
+// slots is a power of two; a slot is free while its offset is 0.
+class MappedCacheFile {
+    struct Header {
+        char magic[8];
+        uint64_t fileBytes, slots, used, dataBegin, dataEnd, resets;
+    };
+    struct Slot {
+        uint64_t keyLo, keyHi, offset;
+        uint32_t length, check;
+    };
+    static constexpr char MAGIC[8] = {'D', 'A', 'A', 'C', 'A', 'C', 'H', '1'};
+
+    std::string path;
+    int fd = -1;
+    unsigned char* base = nullptr;
+    std::size_t bytes = 0;
+
+    Header& header() const { return *reinterpret_cast<Header*>(base); }
+    Slot* slots() const { return reinterpret_cast<Slot*>(base + sizeof(Header)); }
+
+    static uint32_t checksum(const void* data, std::size_t n) {
+        return static_cast<uint32_t>(Hasher128(0x5eed).bytes(data, n).digest().lo);
+    }
+
+    // Slot holding key, or the free slot where it would go.
+    Slot* probe(const Hash128& key) const {
+        uint64_t mask = header().slots - 1;
+        for (uint64_t i = key.lo & mask;; i = (i + 1) & mask) {
+            Slot& s = slots()[i];
+            if (s.offset == 0 || (s.keyLo == key.lo && s.keyHi == key.hi)) return &s;
+        }
+    }
+
+    void reset() {
+        Header& h = header();
+        std::memset(slots(), 0, h.slots * sizeof(Slot));
+        h.used = 0;
+        h.dataEnd = h.dataBegin;
+        h.resets++;
+        DAA_COUNT("result_cache.disk_resets");
+    }
+
+    void fail(const std::string& what) {
+        std::string message = path + ": " + what;
+        close();
+        throw std::runtime_error(message);
+    }
+
+    void close() {
+        if (base) munmap(base, bytes);
+        if (fd >= 0) ::close(fd); // drops the flock too
+        base = nullptr;
+        fd = -1;
+    }
+
+public:
+    // Opens path, creating it with newBytes if it does not exist. Throws
+    // runtime_error if it cannot be created or mapped, is not a cache file,
+    // or is in use by another process.
+    MappedCacheFile(const std::string& path, std::size_t newBytes) : path(path) {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) fail("cannot open result cache");
+        if (flock(fd, LOCK_EX | LOCK_NB) != 0) fail("result cache is in use by another process");
+        struct stat st;
+        if (fstat(fd, &st) != 0) fail("cannot stat result cache");
+        bool fresh = st.st_size == 0;
+        if (fresh) {
+            if (newBytes < (std::size_t(1) << 20)) fail("result cache file must be at least 1 MiB");
+            if (ftruncate(fd, static_cast<off_t>(newBytes)) != 0) fail("cannot size result cache");
+            bytes = newBytes;
+        } else {
+            bytes = static_cast<std::size_t>(st.st_size);
+        }
+        void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) fail("cannot map result cache");
+        base = static_cast<unsigned char*>(p);
+
+        if (fresh) {
+            uint64_t slotCount = 64;
+            while (slotCount * 2 <= bytes / 4096) slotCount *= 2;
+            Header& h = header();
+            std::memcpy(h.magic, MAGIC, sizeof MAGIC);
+            h.fileBytes = bytes;
+            h.slots = slotCount;
+            h.used = 0;
+            h.dataBegin = (sizeof(Header) + slotCount * sizeof(Slot) + 63) / 64 * 64;
+            h.dataEnd = h.dataBegin;
+            h.resets = 0;
+            return;
+        }
+        const Header& h = header();
+        bool valid = bytes >= sizeof(Header) && std::memcmp(h.magic, MAGIC, sizeof MAGIC) == 0 &&
+                     h.fileBytes == bytes && h.slots >= 64 && (h.slots & (h.slots - 1)) == 0 &&
+                     h.dataBegin >= sizeof(Header) + h.slots * sizeof(Slot) && h.dataBegin <= h.dataEnd &&
+                     h.dataEnd <= bytes && h.used < h.slots;
+        if (!valid) fail("not a result cache file (delete it to start a new one)");
+    }
+
+    MappedCacheFile(const MappedCacheFile&) = delete;
+    MappedCacheFile& operator=(const MappedCacheFile&) = delete;
+    ~MappedCacheFile() { close(); }
+
+    bool find(const Hash128& key, std::string& out) const {
+        const Slot& s = *probe(key);
+        if (s.offset == 0 || s.offset < header().dataBegin || s.offset + s.length > bytes) return false;
+        if (checksum(base + s.offset, s.length) != s.check) return false;
+        out.assign(reinterpret_cast<const char*>(base + s.offset), s.length);
+        return true;
+    }
+
+    // False if the value is too large for the file.
+    bool store(const Hash128& key, std::string_view value) {
+        Header& h = header();
+        if (value.size() > bytes - h.dataBegin || value.size() > UINT32_MAX) return false;
+        Slot* s = probe(key);
+        bool added = s->offset == 0;
+        if (h.dataEnd + value.size() > bytes || (added && 2 * (h.used + 1) > h.slots)) {
+            reset();
+            s = probe(key);
+            added = true;
+        }
+        uint64_t offset = h.dataEnd;
+        std::memcpy(base + offset, value.data(), value.size());
+        h.dataEnd = offset + value.size();
+        // Bytes before the slot that points at them; the checksum catches a
+        // slot written only in part
+        s->length = static_cast<uint32_t>(value.size());
+        s->check = checksum(value.data(), value.size());
+        s->keyLo = key.lo;
+        s->keyHi = key.hi;
+        s->offset = offset;
+        if (added) h.used++;
+        return true;
+    }
+};
+
+class ResultCache {
+public:
+    struct Options {
+        std::size_t memoryBytes = std::size_t(64) << 20;
+        std::string diskPath;                              // empty: no disk tier
+        std::size_t diskBytes = std::size_t(256) << 20;    // size of a new disk file
+    };
+    using Value = std::shared_ptr<const std::string>;
+
+private:
+    struct Entry {
+        Hash128 key;
+        Value value;
+    };
+    // Bookkeeping per memory entry, charged against the budget
+    static constexpr std::size_t ENTRY_OVERHEAD = 96;
+
+    std::mutex lock;
+    std::list<Entry> recent; // most recently used first
+    std::unordered_map<Hash128, std::list<Entry>::iterator, Hash128Hash> index;
+    std::size_t budget, used = 0;
+    std::unique_ptr<MappedCacheFile> disk;
+
+    static ResultCache*& installed() {
+        static ResultCache* cache = nullptr;
+        return cache;
+    }
+
+    void remember(const Hash128& key, Value value) {
+        std::size_t size = value->size() + ENTRY_OVERHEAD;
+        if (size > budget) return;
+        auto found = index.find(key);
+        if (found != index.end()) {
+            used -= found->second->value->size() + ENTRY_OVERHEAD;
+            recent.erase(found->second);
+            index.erase(found);
+        }
+        recent.push_front({key, std::move(value)});
+        index[key] = recent.begin();
+        used += size;
+        while (used > budget) {
+            const Entry& last = recent.back();
+            used -= last.value->size() + ENTRY_OVERHEAD;
+            index.erase(last.key);
+            recent.pop_back();
+            DAA_COUNT("result_cache.evictions");
+        }
+    }
+
+public:
+    // Throws runtime_error if the disk file cannot be used.
+    explicit ResultCache(const Options& options) : budget(options.memoryBytes) {
+        if (!options.diskPath.empty()) disk = std::make_unique<MappedCacheFile>(options.diskPath, options.diskBytes);
+    }
+
+    // The cache the solutions consult for intermediates (nullptr: none).
+    static ResultCache* shared() { return installed(); }
+    // Installs cache as shared(); the caller keeps ownership. Not to be
+    // called while solutions run.
+    static void install(ResultCache* cache) { installed() = cache; }
+
+    // nullptr on a miss.
+    Value find(const Hash128& key) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto found = index.find(key);
+        if (found != index.end()) {
+            recent.splice(recent.begin(), recent, found->second);
+            DAA_COUNT("result_cache.memory_hits");
+            return found->second->value;
+        }
+        std::string bytes;
+        if (disk && disk->find(key, bytes)) {
+            Value value = std::make_shared<const std::string>(std::move(bytes));
+            remember(key, value);
+            DAA_COUNT("result_cache.disk_hits");
+            return value;
+        }
+        DAA_COUNT("result_cache.misses");
+        return nullptr;
+    }
+
+    void store(const Hash128& key, std::string bytes) {
+        std::lock_guard<std::mutex> guard(lock);
+        DAA_COUNT("result_cache.stores");
+        if (disk) disk->store(key, bytes);
+        remember(key, std::make_shared<const std::string>(std::move(bytes)));
+    }
+};
+
+// An intermediate result through the shared cache: the cached vector under
+// key if there is one, else compute(), stored for next time. Without a
+// shared cache it is just compute().
+template <class T, class Compute>
+std::vector<T> cachedVector(const Hash128& key, Compute compute) {
+    static_assert(std::is_trivially_copyable_v<T>, "cachedVector needs a trivially copyable type");
+    ResultCache* cache = ResultCache::shared();
+    if (!cache) return compute();
+    if (ResultCache::Value hit = cache->find(key); hit && hit->size() % sizeof(T) == 0) {
+        std::vector<T> v(hit->size() / sizeof(T));
+        if (!v.empty()) std::memcpy(v.data(), hit->data(), hit->size());
+        return v;
+    }
+    std::vector<T> v = compute();
+    cache->store(key, std::string(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T)));
+    return v;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+// Stream-compaction primitive shared by the Array/ SIMD kernels.
+//
+// compressStore8(dst, v, mask) writes the 32-bit lanes of v whose bit is set
+// in mask (bit i = lane i) to dst in lane order and returns how many it
+// wrote. With AVX-512VL this is a masked vpcompressd, which touches exactly
+// that many slots. Otherwise the lanes are packed with one permutation from
+// a 256-entry table and all 8 lanes are stored, so dst[0..8) must be
+// writable; callers compacting in place keep dst at or behind the lanes they
+// have already loaded, which makes the extra lanes harmless.
+
+namespace simd_compress_detail {
+struct CompressTable {
+    uint64_t idx[256]; // mask -> surviving lane indices, one byte each
+    CompressTable() {
+        for (int mask = 0; mask < 256; mask++) {
+            uint64_t packed = 0;
+            int k = 0;
+            for (int lane = 0; lane < 8; lane++) {
+                if (mask >> lane & 1) packed |= static_cast<uint64_t>(lane) << (8 * k++);
+            }
+            idx[mask] = packed;
+        }
+    }
+};
+inline const CompressTable compressTable;
+} // namespace simd_compress_detail
+
+inline int compressStore8(void* dst, __m256i v, unsigned mask) {
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+    _mm256_mask_compressstoreu_epi32(dst, static_cast<__mmask8>(mask), v);
+#else
+    uint64_t idx = simd_compress_detail::compressTable.idx[mask & 0xFF];
+    __m256i perm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(idx)));
+    _mm256_storeu_si256(static_cast<__m256i*>(dst), _mm256_permutevar8x32_epi32(v, perm));
+#endif
+    return __builtin_popcount(mask & 0xFF);
+}
+
+// Lane mask (bit i = lane i) of a compare result.
+inline unsigned laneMask8(__m256i cmp) {
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(cmp)));
+}
+
+#endif
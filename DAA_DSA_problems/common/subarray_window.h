@@ -0,0 +1,43 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Helpers shared by the longest-subarray-with-sum-K solutions
+// (Array/Prob_19.cpp, Array/prob_20.cpp): a sign scan and the two-pointer
+// window that replaces prefix-sum hashing when no element is negative.
+
+// Sign information for the dispatcher: Detect scans the input first.
+enum class SignHint { Detect, NonNegative, Mixed };
+
+// True if any element is negative. ORs blocks of 1024 values together (the
+// sign bit survives an OR), so the loop vectorizes and exits at the first
+// block that holds a negative.
+// Time Complexity: O(n)
+// Space Complexity: O(1)
+inline bool hasNegative(const int* data, std::size_t n) {
+    for (std::size_t i = 0; i < n; i += 1024) {
+        std::size_t end = std::min(n, i + 1024);
+        int acc = 0;
+        for (std::size_t j = i; j < end; j++) acc |= data[j];
+        if (acc < 0) return true;
+    }
+    return false;
+}
+
+// Two-pointer window, valid only when no element is negative: extending the
+// window never lowers its sum, so it only has to shrink while sum > k.
+// Time Complexity: O(n)
+// Space Complexity: O(1)
+inline int longestSubarrayNonNegative(const std::vector<int>& nums, long long k) {
+    long long sum = 0;
+    std::size_t left = 0, best = 0;
+    for (std::size_t right = 0; right < nums.size(); right++) {
+        sum += nums[right];
+        while (sum > k && left <= right) sum -= nums[left++];
+        std::size_t len = right + 1 - left;
+        best = sum == k && len > best ? len : best;
+    }
+    return (int)best;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+#include <unistd.h>
+
+// Path for a scratch file in the system temp directory ($TMPDIR, else /tmp),
+// tagged with the process id so concurrent runs do not collide. The demo
+// mains write their binary graph files here instead of the working
+// directory, and remove them when done.
+inline std::string tempFilePath(const std::string& name) {
+    std::filesystem::path dir = std::filesystem::temp_directory_path();
+    return (dir / (std::to_string(::getpid()) + "_" + name)).string();
+}
@@ -0,0 +1,214 @@
+#include <bits/stdc++.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Shared headers first: the problem files below are pulled into their own
+// namespaces, and #pragma once would otherwise hide these from all but the
+// first namespace that includes them.
+#include "../common/autotune.h"
+#include "../common/bench.h"
+#include "../common/flat_hash_map.h"
+#include "../common/op_counters.h"
+#include "../common/parallel.h"
+#include "../common/random_inputs.h"
+#include "../Graph/csr_graph.h"
+#include "../Graph/priority_queues.h"
+
+#define DAA_NO_MAIN
+namespace arr14 {
+#include "../Array/prob_14.cpp"
+}
+namespace arr35 {
+#include "../Array/prob_35.cpp"
+}
+namespace g06 {
+#include "../Graph/prob_06.cpp"
+}
+#undef DAA_NO_MAIN
+
+using namespace std;
+
+// Calibrates the engine-dispatch thresholds of common/autotune.h on this
+// machine and writes them as a tuning profile.
+//
+// Each decision point is swept along the feature it decides on, timing
+// every engine on the same random input at every point; the threshold is
+// where the engine that wins at the low end stops winning (the geometric
+// midpoint between the last point it won and the first it lost, or the
+// point itself for integer thresholds). Times are the best of a few runs.
+//   consecutive.bitmap_bits_per_element  range / n     bitmap vs radix sort (Array/prob_14)
+//   xor_count.direct_max_bits            value bits    count array vs hash map (Array/prob_35)
+//   apsp.floyd_warshall_work_ratio       V^2 / E log V blocked Floyd-Warshall vs Dijkstra pool (Graph/prob_06)
+//   dijkstra.radix_max_weight            max weight    radix heap vs the best other heap (Graph/prob_06)
+//   dijkstra.indexed_min_degree          E / V         lazy heap vs indexed 4-ary heap (Graph/prob_06)
+// Run the solutions with DAA_TUNE_FILE pointing at the output to use it.
+//   calibrate [quick] [--threads=N] [--out=FILE]   (default daa_tuning.profile)
+// "quick" uses small inputs, for a fast and rough profile.
+
+static bool quickMode = false;
+static int benchThreads = 0;
+
+// Best wall time of reps runs of fn, in ms.
+template <class Fn>
+static double bestMs(Fn fn, int reps = 3) {
+    double best = 1e300;
+    for (int r = 0; r < reps; r++) {
+        long long sink = 0;
+        best = min(best, measure(sink, [&] { return (long long)fn(); }).ms);
+    }
+    return best;
+}
+
+struct SweepPoint {
+    double x;
+    double lowMs;  // engine expected to win at small x
+    double highMs; // engine expected to win at large x
+};
+
+// Threshold between the two engines: the x where the low-side engine stops
+// winning. beyond is returned when it wins at every point, below when it
+// wins at none; integral thresholds take the last winning x itself.
+static double crossover(vector<SweepPoint> points, double below, double beyond, bool integral = false) {
+    sort(points.begin(), points.end(), [](const SweepPoint& a, const SweepPoint& b) { return a.x < b.x; });
+    size_t first = 0;
+    while (first < points.size() && points[first].lowMs <= points[first].highMs) first++;
+    if (first == points.size()) return beyond;
+    if (first == 0) return below;
+    if (integral) return points[first - 1].x;
+    return sqrt(points[first - 1].x * points[first].x);
+}
+
+static void printPoint(const char* decision, const SweepPoint& p, const char* low, const char* high) {
+    printf("%-26s x=%-12.4g %-10s %9.3f ms  %-10s %9.3f ms  %s\n", decision, p.x, low, p.lowMs, high, p.highMs,
+           p.lowMs <= p.highMs ? low : high);
+    fflush(stdout);
+}
+
+static double calibrateConsecutive() {
+    size_t n = quickMode ? 1 << 16 : 1 << 20;
+    vector<SweepPoint> points;
+    for (long long ratio = 1; ratio <= 1024; ratio *= 2) {
+        vector<int> nums = randomArray(n, 0, (int)(ratio * (long long)n - 1), 1400 + ratio);
+        SweepPoint p{(double)ratio, 0, 0};
+        p.lowMs = bestMs([&] { return arr14::longestConsecutive(nums, arr14::ConsecutiveEngine::Bitmap); });
+        p.highMs = bestMs([&] { return arr14::longestConsecutive(nums, arr14::ConsecutiveEngine::RadixSort); });
+        printPoint("consecutive", p, "bitmap", "radix");
+        points.push_back(p);
+    }
+    return crossover(points, 1, 1024);
+}
+
+static double calibrateXorCount() {
+    size_t n = quickMode ? 1 << 16 : 1 << 20;
+    vector<SweepPoint> points;
+    for (int bits = 8; bits <= 26; bits++) {
+        vector<int> nums = randomArray(n, 0, (1 << bits) - 1, 3500 + bits);
+        SweepPoint p{(double)bits, 0, 0};
+        p.lowMs = bestMs([&] { return arr35::countSubarraysXorDirect(nums, 5, arr35::observedBitWidth(nums)); });
+        p.highMs = bestMs([&] { return arr35::countSubarraysXor(nums, 5); });
+        printPoint("xor_count", p, "direct", "hash");
+        points.push_back(p);
+    }
+    return crossover(points, 0, 26, true);
+}
+
+// Undirected graph with about V * degree adjacency entries and weights in
+// [1, maxWeight].
+static vector<vector<pair<int, int>>> randomWeightedGraph(int V, double degree, int maxWeight, uint64_t seed) {
+    mt19937_64 rng(seed);
+    vector<vector<pair<int, int>>> adj(V);
+    long long pairs = (long long)(V * degree / 2);
+    for (long long i = 0; i < pairs; i++) {
+        int u = (int)(rng() % V), v = (int)(rng() % V), w = 1 + (int)(rng() % maxWeight);
+        adj[u].push_back({v, w});
+        adj[v].push_back({u, w});
+    }
+    return adj;
+}
+
+static double calibrateAllPairs() {
+    int V = quickMode ? 128 : 384;
+    vector<SweepPoint> points;
+    for (double degree = 1.0 / 16; degree < V; degree *= 2) {
+        auto adj = randomWeightedGraph(V, degree, 1000, 600 + (uint64_t)(degree * 16));
+        long long E = 0;
+        for (auto& list : adj) E += (long long)list.size();
+        double heapWork = (double)E * max(1.0, log2((double)V));
+        SweepPoint p{(double)V * V / heapWork, 0, 0};
+        auto run = [&](g06::ApspEngine engine) {
+            return (long long)g06::allPairsShortestPaths(V, adj, engine, benchThreads).dist[V - 1];
+        };
+        p.lowMs = bestMs([&] { return run(g06::ApspEngine::BlockedFloydWarshall); }, 2);
+        p.highMs = bestMs([&] { return run(g06::ApspEngine::DijkstraPool); }, 2);
+        printPoint("apsp", p, "floyd", "pool");
+        points.push_back(p);
+    }
+    // Floyd-Warshall wins at the dense, low-ratio end
+    return crossover(points, 0, 1e9);
+}
+
+static double calibrateDijkstraWeights() {
+    int V = quickMode ? 1 << 14 : 1 << 17;
+    vector<SweepPoint> points;
+    for (int shift = 4; shift <= 26; shift += 2) {
+        auto adj = randomWeightedGraph(V, 8, 1 << shift, 700 + shift);
+        auto run = [&](g06::DijkstraEngine engine) { return (long long)g06::shortestPaths(V, adj, 0, engine)[V - 1]; };
+        SweepPoint p{(double)(1 << shift), 0, 0};
+        p.lowMs = bestMs([&] { return run(g06::DijkstraEngine::IndexedRadixHeap); });
+        p.highMs = min(bestMs([&] { return run(g06::DijkstraEngine::LazyHeap); }),
+                       bestMs([&] { return run(g06::DijkstraEngine::IndexedDaryHeap); }));
+        printPoint("dijkstra_weight", p, "radix", "other");
+        points.push_back(p);
+    }
+    return crossover(points, 0, INT_MAX);
+}
+
+static double calibrateDijkstraDegree() {
+    int V = quickMode ? 1 << 14 : 1 << 17;
+    vector<SweepPoint> points;
+    for (int degree = 2; degree <= 64; degree *= 2) {
+        auto adj = randomWeightedGraph(V, degree, 1 << 26, 800 + degree);
+        auto run = [&](g06::DijkstraEngine engine) { return (long long)g06::shortestPaths(V, adj, 0, engine)[V - 1]; };
+        SweepPoint p{(double)degree, 0, 0};
+        p.lowMs = bestMs([&] { return run(g06::DijkstraEngine::LazyHeap); });
+        p.highMs = bestMs([&] { return run(g06::DijkstraEngine::IndexedDaryHeap); });
+        printPoint("dijkstra_degree", p, "lazy", "indexed");
+        points.push_back(p);
+    }
+    return crossover(points, 0, 1e9);
+}
+
+int main(int argc, char** argv) {
+    string out = "daa_tuning.profile";
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "quick") {
+            quickMode = true;
+        } else if (arg.rfind("--threads=", 0) == 0) {
+            benchThreads = stoi(arg.substr(10));
+        } else if (arg.rfind("--out=", 0) == 0) {
+            out = arg.substr(6);
+        } else {
+            fprintf(stderr, "usage: %s [quick] [--threads=N] [--out=FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    TuningProfile profile;
+    profile.set("consecutive.bitmap_bits_per_element", calibrateConsecutive());
+    profile.set("xor_count.direct_max_bits", calibrateXorCount());
+    profile.set("apsp.floyd_warshall_work_ratio", calibrateAllPairs());
+    profile.set("dijkstra.radix_max_weight", calibrateDijkstraWeights());
+    profile.set("dijkstra.indexed_min_degree", calibrateDijkstraDegree());
+
+    try {
+        profile.save(out, string("calibrated") + (quickMode ? " (quick)" : "") + " by driver/calibrate.cpp with " +
+                              to_string(resolveThreads(benchThreads)) + " thread(s)");
+    } catch (const runtime_error& e) {
+        fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    printf("\nwrote %s; run with DAA_TUNE_FILE=%s\n", out.c_str(), out.c_str());
+    return 0;
+}
@@ -0,0 +1,678 @@
+#include <bits/stdc++.h>
+
+#include "kernels.h"
+#include "../common/bench.h"
+#include "../common/random_inputs.h"
+#include "../Graph/graph_generators.h"
+
+using namespace std;
+
+// Differential checker over every kernel the driver registers.
+//
+// For each problem a generator writes a random case, in the driver's input
+// format, at each size of a sweep, and every variant of the problem solves
+// that same text. At small sizes the brute force runs and every other
+// variant must agree with it; past a variant's size limit it drops out, so
+// the large sizes check the optimal solution against the faster engines
+// (heaps, bitsets, SIMD, wavefront). Problems with several valid answers
+// (two_sum, course_order) have their answers validated against the input
+// and compared by outcome. Each run is timed on its own, input parsing
+// excluded, and reported with its throughput. Output is CSV on stdout:
+//   problem,size,round,variant,status,time_ms,mitems_per_s
+// status is ok, mismatch, invalid or error; a failing run also prints its
+// seed and answers to stderr, and the exit code is 1 if any run failed.
+//   diff_check [quick|full] [rounds=<r>] [seed] [problem-prefix ...]
+// By default every sweep stops after its fourth size, which keeps the run
+// to about a second as a regression gate; "quick" stops after the third
+// (brute-force sizes only) and "full" runs the whole sweep, up to 10^6
+// items (tens of seconds). Items are elements, cells, or V + E. Built with -DDAA_ALLOC_PROFILE each row also has
+//   allocs,alloc_kb,peak_live_kb
+// for that run alone: heap allocations, KiB requested, and the most KiB it
+// held at once (common/alloc_profile.h).
+
+struct GeneratedCase {
+    string text;
+    long long items = 0;
+    // Maps an answer to what every variant must agree on; "invalid..."
+    // marks a wrong answer. Unset: the answer itself.
+    function<string(const string&)> normalize;
+};
+
+struct ProblemCheck {
+    string problem;
+    vector<long long> sizes;
+    map<string, long long> maxSize; // variants that only run up to a size
+    function<GeneratedCase(long long size, uint64_t seed)> make;
+};
+
+static void appendArray(string& text, const vector<int>& a) {
+    appendInt(text, (long long)a.size());
+    text += ' ';
+    appendInts(text, a);
+}
+
+// "V E [S]" and the edges, undirected rows {u, v} or {u, v, w}.
+template <class Rows>
+static GeneratedCase graphCase(int V, const Rows& rows, int source = -1) {
+    GeneratedCase c;
+    appendInt(c.text, V);
+    c.text += ' ';
+    appendInt(c.text, (long long)rows.size());
+    if (source >= 0) {
+        c.text += ' ';
+        appendInt(c.text, source);
+    }
+    c.text += '\n';
+    for (const auto& r : rows) {
+        if constexpr (is_same_v<decay_t<decltype(r)>, pair<int, int>>) {
+            appendInts(c.text, vector<int>{r.first, r.second});
+        } else {
+            appendInts(c.text, r);
+        }
+        c.text += '\n';
+    }
+    c.items = V + (long long)rows.size();
+    return c;
+}
+
+static vector<long long> parseInts(const string& s) {
+    vector<long long> v;
+    istringstream in(s);
+    for (long long x; in >> x;) v.push_back(x);
+    return v;
+}
+
+static ValueDistribution distributionFor(uint64_t seed) { return ValueDistribution(seed % 5); }
+
+static vector<ProblemCheck> arrayChecks() {
+    vector<ProblemCheck> checks;
+    checks.push_back({"array/two_sum", {8, 64, 500, 100000, 1000000}, {{"brute", 500}}, [](long long n, uint64_t seed) {
+        auto a = make_shared<vector<int>>(randomArray(n, -1000000, 1000000, seed, distributionFor(seed)));
+        mt19937_64 rng(seed);
+        long long target = (long long)(rng() % 2000001) - 1000000;
+        if (n >= 2 && rng() % 4) { // usually plant a pair
+            size_t i = rng() % n, j = (i + 1 + rng() % (n - 1)) % n;
+            target = (long long)(*a)[i] + (*a)[j];
+        }
+        GeneratedCase c;
+        appendInt(c.text, n);
+        c.text += ' ';
+        appendInt(c.text, target);
+        c.text += ' ';
+        appendInts(c.text, *a);
+        c.items = n;
+        c.normalize = [a, target](const string& answer) -> string {
+            vector<long long> ij = parseInts(answer);
+            if (ij.size() != 2) return "invalid answer";
+            if (ij[0] == -1 && ij[1] == -1) return "none";
+            long long n = (long long)a->size();
+            bool ok = ij[0] >= 0 && ij[0] < ij[1] && ij[1] < n && (long long)(*a)[ij[0]] + (*a)[ij[1]] == target;
+            return ok ? "pair" : "invalid pair";
+        };
+        return c;
+    }});
+    checks.push_back({"array/longest_consecutive", {10, 100, 1000, 100000, 1000000}, {{"brute", 1000}},
+                      [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendArray(c.text, randomArray(n, 0, (int)(2 * n), seed, distributionFor(seed)));
+        c.items = n;
+        return c;
+    }});
+    checks.push_back({"array/subarray_sum_k", {10, 100, 1000, 100000, 1000000}, {{"brute", 1000}},
+                      [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendInt(c.text, n);
+        c.text += ' ';
+        appendInt(c.text, (long long)(seed % 13)); // small k: the int counts stay exact
+        c.text += ' ';
+        appendInts(c.text, randomArray(n, -2, 6, seed));
+        c.items = n;
+        return c;
+    }});
+    // Few distinct values: many triplets, many duplicates to skip
+    auto threeSumCase = [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendArray(c.text, randomArray(n, -50, 50, seed, distributionFor(seed)));
+        c.items = n;
+        return c;
+    };
+    checks.push_back({"array/three_sum", {6, 40, 150, 3000, 20000}, {{"brute", 150}}, threeSumCase});
+    checks.push_back({"array/three_sum_count", {6, 40, 150, 3000, 20000}, {{"brute", 150}}, threeSumCase});
+    checks.push_back({"array/zero_sum_subarray", {10, 100, 1000, 100000, 1000000}, {{"brute", 1000}},
+                      [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendArray(c.text, randomArray(n, -5, 5, seed, distributionFor(seed)));
+        c.items = n;
+        return c;
+    }});
+    // Non-negative prices, so the int differences cannot overflow
+    checks.push_back({"array/stock_profit", {8, 64, 1000, 100000, 1000000}, {{"brute", 1000}},
+                      [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendArray(c.text, randomArray(n, 0, 1000000000, seed, distributionFor(seed)));
+        c.items = n;
+        return c;
+    }});
+    checks.push_back({"array/missing_number", {8, 64, 1000, 40000, 1000000}, {{"brute", 1000}, {"sum", 40000}},
+                      [](long long n, uint64_t seed) {
+        vector<int> a(n + 1);
+        iota(a.begin(), a.end(), 1);
+        shuffle(a.begin(), a.end(), mt19937_64(seed));
+        a.pop_back();
+        GeneratedCase c;
+        appendArray(c.text, a);
+        c.items = n;
+        return c;
+    }});
+    // 1 or 2 absent values (the closed forms), a few scattered ones, or
+    // long absent stretches (whole buckets and re-split passes)
+    checks.push_back({"array/missing_numbers", {8, 64, 1000, 100000, 1000000}, {}, [](long long N, uint64_t seed) {
+        mt19937_64 rng(seed);
+        vector<char> absent(N + 1, 0);
+        long long k = seed % 4 == 0 ? 1 : seed % 4 == 1 ? 2 : seed % 4 == 2 ? 1 + N / 100 : 0;
+        for (long long i = 0; i < k; i++) absent[1 + rng() % N] = 1;
+        if (seed % 4 == 3) {
+            for (int g = 0; g < 4; g++) {
+                long long lo = 1 + rng() % N, len = 1 + rng() % max(1LL, N / 8);
+                for (long long v = lo; v <= min(N, lo + len - 1); v++) absent[v] = 1;
+            }
+        }
+        vector<int> a;
+        for (long long v = 1; v <= N; v++) {
+            if (!absent[v]) a.push_back((int)v);
+        }
+        shuffle(a.begin(), a.end(), rng);
+        GeneratedCase c;
+        appendInt(c.text, (long long)a.size());
+        c.text += ' ';
+        appendInt(c.text, N);
+        c.text += ' ';
+        appendInts(c.text, a);
+        c.items = N;
+        return c;
+    }});
+    // Sorted input with value ranges from n / 16 (long runs of copies) to
+    // 10^9 (almost no copies), so the vector loops see every mix of kept lanes
+    checks.push_back({"array/remove_duplicates", {8, 64, 1000, 100000, 1000000}, {}, [](long long n, uint64_t seed) {
+        int hi = seed % 3 == 0 ? (int)max(1LL, n / 16) : seed % 3 == 1 ? (int)n : 1000000000;
+        vector<int> a = randomArray(n, -hi, hi, seed);
+        sort(a.begin(), a.end());
+        GeneratedCase c;
+        appendArray(c.text, a);
+        c.items = n;
+        return c;
+    }});
+    // 2 to 6 runs cut at random points, so some are empty or tiny next to
+    // the rest; FewDistinct seeds put long runs of ties across the runs. The
+    // fourth size is past 2^18, where the threaded merges take over, and the
+    // last is past the 2^20-slot rounds of mergeArraysParallel.
+    checks.push_back({"array/merge_sorted", {8, 64, 1000, 300000, 3000000}, {}, [](long long n, uint64_t seed) {
+        vector<int> a = randomArray(n, -1000000000, 1000000000, seed, distributionFor(seed));
+        mt19937_64 rng(seed);
+        size_t k = 2 + rng() % 5;
+        vector<size_t> cuts = {0, (size_t)n};
+        for (size_t r = 1; r < k; r++) cuts.push_back(rng() % (n + 1));
+        sort(cuts.begin(), cuts.end());
+        GeneratedCase c;
+        appendInt(c.text, (long long)k);
+        for (size_t r = 0; r < k; r++) {
+            c.text += '\n';
+            appendArray(c.text, vector<int>(a.begin() + cuts[r], a.begin() + cuts[r + 1]));
+        }
+        c.items = n;
+        return c;
+    }});
+    // |a_i| < 2^30, so the int brute force and merge sort can form 2 * a_j;
+    // they also count in int, hence the 50000 limit on optimal
+    auto pairCountCase = [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendArray(c.text, randomArray(n, -(1 << 30) + 1, (1 << 30) - 1, seed, distributionFor(seed)));
+        c.items = n;
+        return c;
+    };
+    checks.push_back({"array/inversions", {8, 64, 1000, 50000, 1000000}, {{"brute", 1000}, {"optimal", 50000}},
+                      pairCountCase});
+    checks.push_back({"array/reverse_pairs", {8, 64, 1000, 50000, 1000000}, {{"brute", 1000}, {"optimal", 50000}},
+                      pairCountCase});
+    return checks;
+}
+
+// One extra random edge that is not already present; may close a cycle.
+static void addExtraEdge(int V, EdgeList& edges, uint64_t seed) {
+    if (V < 3) return;
+    set<pair<int, int>> present(edges.begin(), edges.end());
+    mt19937_64 rng(seed);
+    for (int tries = 0; tries < 64; tries++) {
+        int u = (int)(rng() % V), v = (int)(rng() % V);
+        if (u == v) continue;
+        if (u > v) swap(u, v);
+        if (present.count({u, v})) continue;
+        edges.push_back({u, v});
+        return;
+    }
+}
+
+static vector<ProblemCheck> graphChecks() {
+    vector<ProblemCheck> checks;
+    checks.push_back({"graph/provinces", {5, 20, 100, 1000, 2000}, {{"brute", 1000}}, [](long long n, uint64_t seed) {
+        EdgeList edges = randomForestEdges((int)n, 1 + (int)(seed % n), seed);
+        vector<vector<int>> m = toAdjacencyMatrix((int)n, edges, true);
+        GeneratedCase c;
+        appendInt(c.text, n);
+        c.text += '\n';
+        for (long long i = 0; i < n; i++) {
+            m[i][i] = 1;
+            appendInts(c.text, m[i]);
+            c.text += '\n';
+        }
+        c.items = n * n;
+        return c;
+    }});
+    checks.push_back({"graph/bipartite", {8, 50, 300, 2000, 20000}, {{"brute", 2000}}, [](long long V, uint64_t seed) {
+        EdgeList edges = randomBipartiteEdges((int)V, 3, seed);
+        if (seed & 1) addExtraEdge((int)V, edges, seed);
+        return graphCase((int)V, edges);
+    }});
+    checks.push_back({"graph/cycle", {8, 50, 300, 100000, 1000000}, {{"brute", 300}}, [](long long V, uint64_t seed) {
+        EdgeList edges = randomForestEdges((int)V, 1 + (int)(seed % 4), seed);
+        if (seed & 1) addExtraEdge((int)V, edges, seed);
+        return graphCase((int)V, edges);
+    }});
+    checks.push_back({"graph/make_connected", {8, 50, 1000, 100000, 1000000}, {{"brute", 1000}},
+                      [](long long V, uint64_t seed) {
+        return graphCase((int)V, erdosRenyiEdges((int)V, 0.5 + (double)(seed % 6) / 2, seed));
+    }});
+    checks.push_back({"graph/dijkstra", {10, 100, 2000, 100000, 1000000}, {{"brute", 2000}},
+                      [](long long V, uint64_t seed) {
+        auto rows = withRandomWeights(erdosRenyiEdges((int)V, 4, seed), 100, seed ^ 1);
+        return graphCase((int)V, rows, (int)(seed % V));
+    }});
+    // Directed flights over a sparse random graph, K anywhere from 0 to
+    // past the longest useful route
+    checks.push_back({"graph/cheapest_flight", {6, 50, 500, 5000, 50000}, {{"brute", 500}},
+                      [](long long V, uint64_t seed) {
+        mt19937_64 rng(seed);
+        auto rows = withRandomWeights(erdosRenyiEdges((int)V, 3, seed), 10000, seed ^ 1);
+        for (auto& r : rows)
+            if (rng() & 1) swap(r[0], r[1]);
+        GeneratedCase c;
+        appendInts(c.text, vector<long long>{V, (long long)rows.size(), (long long)(rng() % V), (long long)(rng() % V),
+                                             (long long)(rng() % min<long long>(V + 2, 64))});
+        c.text += '\n';
+        for (const auto& r : rows) {
+            appendInts(c.text, r);
+            c.text += '\n';
+        }
+        c.items = V + (long long)rows.size();
+        return c;
+    }});
+    checks.push_back({"graph/mst", {10, 100, 2000, 100000, 1000000}, {{"brute", 2000}}, [](long long V, uint64_t seed) {
+        return graphCase((int)V, withRandomWeights(erdosRenyiEdges((int)V, 4, seed), 1000, seed ^ 1));
+    }});
+    // N distinct words over a 3-letter (two-letter words, smallest size),
+    // 4-letter (short sweeps) or 6-letter alphabet, so most words have
+    // neighbours and the shortest ladders branch.
+    checks.push_back({"graph/word_ladder", {6, 30, 60, 400, 1200}, {{"brute", 400}}, [](long long N, uint64_t seed) {
+        mt19937_64 rng(seed);
+        int length = N <= 6 ? 2 : N <= 60 ? 3 : 4, letters = N <= 6 ? 3 : N <= 60 ? 4 : 6;
+        set<string> pool;
+        while ((long long)pool.size() < N) {
+            string w(length, 'a');
+            for (char& ch : w) ch = (char)('a' + rng() % letters);
+            pool.insert(w);
+        }
+        vector<string> words(pool.begin(), pool.end());
+        shuffle(words.begin(), words.end(), rng);
+        GeneratedCase c;
+        c.text = words[0] + ' ' + words[1] + ' ';
+        appendInt(c.text, N - 1);
+        for (size_t i = 1; i < words.size(); i++) c.text += ' ' + words[i];
+        c.items = N * length;
+        return c;
+    }});
+    // 64 queries per dictionary; about a fifth of the words asked for are
+    // random, so some miss it (an unknown start still gets a ladder).
+    checks.push_back({"graph/ladder_length", {6, 30, 60, 400, 1200, 10000}, {{"brute", 1200}},
+                      [](long long N, uint64_t seed) {
+        mt19937_64 rng(seed);
+        int length = N <= 60 ? 3 : N <= 1200 ? 4 : 5, letters = N <= 60 ? 4 : N <= 1200 ? 6 : 8;
+        auto randomWord = [&] {
+            string w(length, 'a');
+            for (char& ch : w) ch = (char)('a' + rng() % letters);
+            return w;
+        };
+        set<string> pool;
+        while ((long long)pool.size() < N) pool.insert(randomWord());
+        vector<string> words(pool.begin(), pool.end());
+        shuffle(words.begin(), words.end(), rng);
+        GeneratedCase c;
+        appendInt(c.text, N);
+        for (const string& w : words) c.text += ' ' + w;
+        const int q = 64;
+        c.text += ' ';
+        appendInt(c.text, q);
+        for (int i = 0; i < 2 * q; i++) c.text += ' ' + (rng() % 5 ? words[rng() % N] : randomWord());
+        c.items = N * length;
+        return c;
+    }});
+    // Pairs "a b" (a needs b) from DAG edges b -> a, sometimes plus one
+    // random pair that may close a cycle.
+    auto prerequisites = [](long long N, uint64_t seed) {
+        EdgeList dag = randomDagEdges((int)N, 2, seed);
+        for (auto& e : dag) swap(e.first, e.second);
+        if (seed & 1) addExtraEdge((int)N, dag, seed);
+        return graphCase((int)N, dag);
+    };
+    checks.push_back({"graph/can_finish", {8, 50, 2000, 100000, 1000000}, {{"brute", 2000}}, prerequisites});
+    checks.push_back({"graph/course_order", {8, 50, 2000, 100000, 1000000}, {}, [=](long long N, uint64_t seed) {
+        GeneratedCase c = prerequisites(N, seed);
+        vector<long long> tokens = parseInts(c.text);
+        auto pairs = make_shared<vector<pair<int, int>>>();
+        for (size_t i = 2; i + 1 < tokens.size(); i += 2) pairs->push_back({(int)tokens[i], (int)tokens[i + 1]});
+        c.normalize = [pairs, N](const string& answer) -> string {
+            if (answer == "impossible") return answer;
+            vector<long long> order = parseInts(answer);
+            vector<long long> position(N, -1);
+            if ((long long)order.size() != N) return "invalid order length";
+            for (long long i = 0; i < N; i++) {
+                if (order[i] < 0 || order[i] >= N || position[order[i]] >= 0) return "invalid order";
+                position[order[i]] = i;
+            }
+            for (auto [a, b] : *pairs)
+                if (position[b] > position[a]) return "invalid order";
+            return "order";
+        };
+        return c;
+    }});
+    return checks;
+}
+
+static vector<ProblemCheck> dpChecks() {
+    vector<ProblemCheck> checks;
+    checks.push_back({"dp/stairs", {5, 20, 30, 90, 100000, 1000000000}, {{"brute", 30}},
+                      [](long long n, uint64_t) {
+        GeneratedCase c;
+        appendInt(c.text, n);
+        c.items = n;
+        return c;
+    }});
+    checks.push_back({"dp/frog", {5, 15, 25, 100000, 2000000}, {{"brute", 25}}, [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendArray(c.text, randomArray(n, 0, 1000, seed, distributionFor(seed)));
+        c.items = n;
+        return c;
+    }});
+    // The memo version recurses once per stone
+    checks.push_back({"dp/frog_k", {5, 100, 1000, 10000, 1000000}, {{"memo", 10000}}, [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendInt(c.text, n);
+        c.text += ' ';
+        appendInt(c.text, 1 + (long long)(seed % 50));
+        c.text += ' ';
+        appendInts(c.text, randomArray(n, 0, 1000, seed));
+        c.items = n;
+        return c;
+    }});
+    checks.push_back({"dp/grid_min_cost", {2, 6, 10, 300, 1500}, {{"brute", 10}}, [](long long side, uint64_t seed) {
+        GeneratedCase c;
+        appendInt(c.text, side);
+        c.text += ' ';
+        appendInt(c.text, side);
+        c.text += '\n';
+        for (auto& row : randomGrid(side, side, 0, 9, seed)) {
+            appendInts(c.text, row);
+            c.text += '\n';
+        }
+        c.items = side * side;
+        return c;
+    }});
+    checks.push_back({"dp/triangle", {3, 12, 18, 500, 2000}, {{"brute", 18}}, [](long long rows, uint64_t seed) {
+        GeneratedCase c;
+        appendInt(c.text, rows);
+        c.text += '\n';
+        for (auto& row : randomTriangle(rows, -100, 100, seed)) {
+            appendInts(c.text, row);
+            c.text += '\n';
+        }
+        c.items = rows * (rows + 1) / 2;
+        return c;
+    }});
+    // Widths from 1 up to the row count, so the one- and two-column edge
+    // cases of the half table come up at every size
+    checks.push_back({"dp/chocolates", {3, 8, 20, 100, 400}, {{"memo", 100}, {"tabulation", 100}},
+                      [](long long n, uint64_t seed) {
+        long long m = 1 + (long long)(seed % n);
+        GeneratedCase c;
+        appendInt(c.text, n);
+        c.text += ' ';
+        appendInt(c.text, m);
+        c.text += '\n';
+        for (auto& row : randomGrid(n, m, 0, 50, seed)) {
+            appendInts(c.text, row);
+            c.text += '\n';
+        }
+        c.items = n * m;
+        return c;
+    }});
+    checks.push_back({"dp/min_partition", {5, 12, 18, 1000, 3000, 20000}, {{"brute", 18}, {"optimal", 3000}},
+                      [](long long n, uint64_t seed) {
+        GeneratedCase c;
+        appendArray(c.text, randomArray(n, 0, 100, seed, distributionFor(seed)));
+        c.items = n;
+        return c;
+    }});
+    // Small values and n: every exact count fits the int table
+    auto subsetCase = [](int maxValue) {
+        return [maxValue](long long n, uint64_t seed) {
+            vector<int> a = randomArray(n, 0, maxValue, seed);
+            long long sum = accumulate(a.begin(), a.end(), 0LL);
+            GeneratedCase c;
+            appendInt(c.text, n);
+            c.text += ' ';
+            appendInt(c.text, (long long)(seed % (sum + 1)));
+            c.text += ' ';
+            appendInts(c.text, a);
+            c.items = n;
+            return c;
+        };
+    };
+    checks.push_back({"dp/subset_count", {5, 12, 18}, {}, subsetCase(5)});
+    // At most 2^24 subsets, so the exact int counts stay below the modulus
+    checks.push_back({"dp/subset_count_positive", {5, 12, 18, 24}, {}, [](long long n, uint64_t seed) {
+        vector<int> a = randomArray(n, 1, 5, seed);
+        long long sum = accumulate(a.begin(), a.end(), 0LL);
+        GeneratedCase c;
+        appendInt(c.text, n);
+        c.text += ' ';
+        appendInt(c.text, (long long)(seed % (sum + 1)));
+        c.text += ' ';
+        appendInts(c.text, a);
+        c.items = n;
+        return c;
+    }});
+    // rolling keeps exact int counts: at most 2^24 splits
+    checks.push_back({"dp/count_partitions", {4, 12, 24, 2000, 8000}, {{"rolling", 24}}, [](long long n, uint64_t seed) {
+        vector<int> a = randomArray(n, 0, 9, seed, distributionFor(seed));
+        long long sum = accumulate(a.begin(), a.end(), 0LL);
+        GeneratedCase c;
+        appendInt(c.text, n);
+        c.text += ' ';
+        appendInt(c.text, (long long)(seed % (sum / 4 + 1)) * 2 + sum % 2); // usually reachable parity
+        c.text += ' ';
+        appendInts(c.text, a);
+        c.items = n;
+        return c;
+    }});
+    // Patterns are cut from random texts: runs become '*' and letters '?'.
+    // Texts re-expand a pattern's unmutated shape, but half the patterns get
+    // one literal changed afterwards, and a quarter of the texts are random,
+    // so matches and failures both come up often. Drawing from a pool of 64
+    // patterns gives the cache hits; texts up to 80 bytes also run the
+    // 32-window AVX2 search.
+    checks.push_back({"dp/wildcard", {10, 100, 1000, 10000, 100000}, {{"memo", 10000}},
+                      [](long long q, uint64_t seed) {
+        mt19937_64 rng(seed);
+        auto randomText = [&] {
+            string t(1 + rng() % 80, 'a');
+            for (char& ch : t) ch = (char)('a' + rng() % 3);
+            return t;
+        };
+        vector<pair<string, string>> pool; // {pattern, shape its texts follow}
+        for (int i = 0; i < 64; i++) {
+            string t = randomText(), shape;
+            for (size_t j = 0; j < t.size(); j++) {
+                uint64_t r = rng() % 10;
+                if (r == 0) {
+                    shape += '*';
+                    j += rng() % 4; // swallow up to 3 more letters
+                } else {
+                    shape += r == 1 ? '?' : t[j];
+                }
+            }
+            string p = shape;
+            size_t at = rng() % p.size();
+            if ((rng() & 1) && p[at] != '*' && p[at] != '?') p[at] = (char)('a' + (p[at] - 'a' + 1) % 3);
+            pool.push_back({p, shape});
+        }
+        GeneratedCase c;
+        appendInt(c.text, q);
+        for (long long i = 0; i < q; i++) {
+            const auto& [p, shape] = pool[rng() % pool.size()];
+            string t;
+            if (rng() % 4) {
+                for (char ch : shape) {
+                    if (ch == '*') {
+                        for (uint64_t k = rng() % 5; k > 0; k--) t += (char)('a' + rng() % 3);
+                    } else {
+                        t += ch == '?' ? (char)('a' + rng() % 3) : ch;
+                    }
+                }
+            }
+            if (t.empty()) t = randomText();
+            c.text += ' ' + p + ' ' + t;
+            c.items += (long long)(p.size() + t.size());
+        }
+        return c;
+    }});
+    checks.push_back({"dp/subset_sum", {5, 12, 18, 1000, 10000, 100000},
+                      {{"brute", 18}, {"memo", 1000}, {"tabulation", 1000}}, subsetCase(50)});
+    return checks;
+}
+
+#ifdef DAA_ALLOC_PROFILE
+#define DAA_ALLOC_PROFILE_COLUMNS ",allocs,alloc_kb,peak_live_kb"
+#else
+#define DAA_ALLOC_PROFILE_COLUMNS ""
+#endif
+
+static uint64_t checkSeed = 12345;
+static int rounds = 1;
+static size_t sweepSizes = 4; // 0: the whole sweep
+static int failures = 0;
+
+static string clip(const string& s) { return s.size() <= 120 ? s : s.substr(0, 120) + "..."; }
+
+// Brute force first, then optimal: the first variant to run is the reference.
+static vector<const ProblemKernel*> variantsOf(const ProblemRegistry& registry, const string& problem) {
+    vector<const ProblemKernel*> out;
+    for (const ProblemKernel* k : registry.all())
+        if (k->problem == problem) out.push_back(k);
+    auto priority = [](const string& v) { return v == "brute" ? 0 : v == "optimal" ? 1 : 2; };
+    stable_sort(out.begin(), out.end(), [&](auto* a, auto* b) { return priority(a->variant) < priority(b->variant); });
+    return out;
+}
+
+static void runCheck(const ProblemRegistry& registry, const ProblemCheck& check) {
+    vector<const ProblemKernel*> variants = variantsOf(registry, check.problem);
+    if (variants.empty()) throw logic_error("no kernels registered for " + check.problem);
+    vector<long long> sizes = check.sizes;
+    if (sweepSizes && sizes.size() > sweepSizes) sizes.resize(sweepSizes);
+    for (long long size : sizes) {
+        for (int round = 0; round < rounds; round++) {
+            uint64_t seed = checkSeed ^ hash<string>()(check.problem) ^ (uint64_t)size * 0x9E3779B97F4A7C15ULL ^
+                            (uint64_t)round * 0xC2B2AE3D27D4EB4FULL;
+            GeneratedCase c = check.make(size, seed);
+            bool haveReference = false;
+            string reference, referenceVariant;
+            for (const ProblemKernel* k : variants) {
+                auto limit = check.maxSize.find(k->variant);
+                if (limit != check.maxSize.end() && size > limit->second) continue;
+
+                TokenReader in(c.text);
+                CaseTask task = k->parse(in);
+                if (!in.atEnd()) throw logic_error(check.problem + ": generator left unread input");
+                string answer, status = "ok";
+#ifdef DAA_ALLOC_PROFILE
+                alloc_profile::Profiler& profiler = alloc_profile::Profiler::instance();
+                int tag = profiler.tagId(check.problem + ":" + k->variant);
+                profiler.reset(tag);
+#endif
+                auto start = chrono::steady_clock::now();
+                {
+                    DAA_ALLOC_ONLY(alloc_profile::Scope scope(tag);)
+                    try {
+                        task(answer);
+                    } catch (const exception& e) {
+                        status = "error";
+                        answer = e.what();
+                    }
+                }
+                double ms = elapsedMs(start);
+
+                string key = c.normalize && status == "ok" ? c.normalize(answer) : answer;
+                if (status == "ok" && key.rfind("invalid", 0) == 0) {
+                    status = "invalid";
+                } else if (status == "ok" && !haveReference) {
+                    haveReference = true;
+                    reference = key;
+                    referenceVariant = k->variant;
+                } else if (status == "ok" && key != reference) {
+                    status = "mismatch";
+                }
+                if (status != "ok") {
+                    failures++;
+                    fprintf(stderr, "%s size %lld seed %llu: %s gave \"%s\" (%s), %s gave \"%s\"\n",
+                            check.problem.c_str(), size, (unsigned long long)seed, k->variant.c_str(),
+                            clip(answer).c_str(), status.c_str(), referenceVariant.c_str(), clip(reference).c_str());
+                }
+                printf("%s,%lld,%d,%s,%s,%.3f,%.2f", check.problem.c_str(), size, round, k->variant.c_str(),
+                       status.c_str(), ms, ms > 0 ? c.items / (ms * 1000.0) : 0.0);
+#ifdef DAA_ALLOC_PROFILE
+                alloc_profile::Snapshot used = profiler.snapshot(tag);
+                printf(",%lld,%.1f,%.1f", used.allocs, used.bytes / 1024.0, used.peakLive / 1024.0);
+#endif
+                printf("\n");
+                fflush(stdout);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    vector<string> prefixes;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "quick") sweepSizes = 3;
+        else if (arg == "full") sweepSizes = 0;
+        else if (arg.rfind("rounds=", 0) == 0) rounds = max(1, stoi(arg.substr(7)));
+        else if (!arg.empty() && isdigit((unsigned char)arg[0])) checkSeed = stoull(arg);
+        else prefixes.push_back(arg);
+    }
+
+    ProblemRegistry registry;
+    registerAllProblems(registry);
+    vector<ProblemCheck> checks;
+    for (auto group : {arrayChecks(), graphChecks(), dpChecks()})
+        for (auto& check : group) checks.push_back(move(check));
+
+    printf("problem,size,round,variant,status,time_ms,mitems_per_s%s\n",
+           DAA_ALLOC_PROFILE_COLUMNS);
+    for (const ProblemCheck& check : checks) {
+        bool selected = prefixes.empty();
+        for (const string& p : prefixes) selected |= check.problem.rfind(p, 0) == 0;
+        if (selected) runCheck(registry, check);
+    }
+
+    if (failures) fprintf(stderr, "%d runs failed\n", failures);
+    return failures ? 1 : 0;
+}
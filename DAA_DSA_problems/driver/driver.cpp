@@ -0,0 +1,143 @@
+#include <bits/stdc++.h>
+
+#include "kernels.h"
+
+using namespace std;
+
+// One binary for many problems: a batch of test cases, each naming the
+// problem it belongs to, is read once, solved on a thread pool, and answered
+// in input order, one line per case.
+//
+// A case is a header token "problem" or "problem:variant" followed by that
+// problem's input (see --list for every kernel and its format), e.g.
+//   dp/frog 4 10 20 30 10
+//   graph/dijkstra:brute 3 2 0  0 1 4  1 2 1
+// Tokens are whitespace separated, so cases may span or share lines, and
+// '#' starts a comment. Every case is parsed before any is solved; a parse
+// error stops the run, naming its line. A case that fails while solving
+// prints "error: <reason>" in its place and the others still run. The exit
+// code is 1 if anything failed.
+//   driver [--threads=N] [--cache-mb=N] [--cache-file=PATH] [--cache-file-mb=N] [--list] [input-file]
+// (stdin if no file)
+// Answers are cached (common/result_cache.h) under a hash of the case's
+// "problem:variant" and input tokens, so a repeated case is a lookup, and
+// kernels cache intermediates that outlive a parameter (the topological
+// order of a catalog, the subset-sum table of a multiset, the fares by stop
+// count of a route) for the cases that differ only in it. --cache-mb sizes
+// the in-memory tier (default 64, 0 turns caching off); --cache-file adds a
+// memory-mapped tier that persists across runs, created with
+// --cache-file-mb MiB (default 256). Failed cases are not cached.
+// Kernels that also have a parallel variant run it with one thread: the
+// parallelism here is across cases. Built with -DDAA_ALLOC_PROFILE, each case
+// allocates under its kernel's "problem:variant" tag, so the exit report
+// (common/alloc_profile.h) sums allocations and peak live bytes per kernel.
+
+struct Case {
+    const ProblemKernel* kernel;
+    CaseTask task;
+    Hash128 key;
+};
+
+// Content address of a case: its kernel and the tokens of its input, so
+// spacing, line breaks and comments do not matter.
+static Hash128 caseKey(const ProblemKernel& kernel, const char* first, const char* last) {
+    Hasher128 h;
+    h.text(kernel.problem).text(kernel.variant);
+    TokenReader tokens(first, last);
+    while (!tokens.atEnd()) h.text(tokens.word());
+    return h.digest();
+}
+
+int main(int argc, char** argv) {
+    ProblemRegistry registry;
+    registerAllProblems(registry);
+
+    int threads = 0;
+    string inputFile;
+    ResultCache::Options cacheOptions;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--list") {
+            for (const ProblemKernel* k : registry.all())
+                printf("%s:%s\t%s\n", k->problem.c_str(), k->variant.c_str(), k->format.c_str());
+            return 0;
+        } else if (arg.rfind("--threads=", 0) == 0) {
+            threads = stoi(arg.substr(10));
+        } else if (arg.rfind("--cache-mb=", 0) == 0) {
+            cacheOptions.memoryBytes = stoull(arg.substr(11)) << 20;
+        } else if (arg.rfind("--cache-file=", 0) == 0) {
+            cacheOptions.diskPath = arg.substr(13);
+        } else if (arg.rfind("--cache-file-mb=", 0) == 0) {
+            cacheOptions.diskBytes = stoull(arg.substr(16)) << 20;
+        } else if (!arg.empty() && arg[0] == '-') {
+            fprintf(stderr,
+                    "usage: %s [--threads=N] [--cache-mb=N] [--cache-file=PATH] [--cache-file-mb=N] [--list] [input-file]\n",
+                    argv[0]);
+            return 1;
+        } else {
+            inputFile = arg;
+        }
+    }
+
+    // Mapped, not copied: the batch is tokenized in place
+    unique_ptr<FastInput> input;
+    try {
+        input = inputFile.empty() ? make_unique<FastInput>() : make_unique<FastInput>(inputFile);
+    } catch (const runtime_error& e) {
+        fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    unique_ptr<ResultCache> cache;
+    if (cacheOptions.memoryBytes > 0 || !cacheOptions.diskPath.empty()) {
+        try {
+            cache = make_unique<ResultCache>(cacheOptions);
+        } catch (const runtime_error& e) {
+            fprintf(stderr, "%s\n", e.what());
+            return 1;
+        }
+        ResultCache::install(cache.get());
+    }
+
+    vector<Case> cases;
+    try {
+        TokenReader in(input->rest());
+        while (!in.atEnd()) {
+            string_view spec = in.word();
+            const ProblemKernel* kernel = registry.find(spec);
+            if (!kernel) in.fail("unknown problem \"" + string(spec) + "\" (see --list)");
+            const char* start = in.position();
+            CaseTask task = kernel->parse(in);
+            cases.push_back({kernel, move(task), cache ? caseKey(*kernel, start, in.position()) : Hash128{}});
+        }
+    } catch (const exception& e) {
+        fprintf(stderr, "case %zu: %s\n", cases.size() + 1, e.what());
+        return 1;
+    }
+
+    vector<string> answers(cases.size());
+    atomic<int> failures(0);
+    parallelForDynamic((long long)cases.size(), threads, [&](long long i, int) {
+        DAA_ALLOC_ONLY(alloc_profile::Scope scope(cases[i].kernel->problem + ":" + cases[i].kernel->variant);)
+        try {
+            if (ResultCache::Value hit = cache ? cache->find(cases[i].key) : nullptr) {
+                answers[i] = *hit;
+            } else {
+                cases[i].task(answers[i]);
+                if (cache) cache->store(cases[i].key, answers[i]);
+            }
+        } catch (const exception& e) {
+            answers[i] = string("error: ") + e.what();
+            failures++;
+        }
+        cases[i].task = nullptr; // drop the case's input as soon as it is answered
+    });
+
+    {
+        FastOutput out;
+        for (const string& a : answers) out << a << '\n';
+    }
+    if (failures) fprintf(stderr, "%d of %zu cases failed\n", failures.load(), cases.size());
+    ResultCache::install(nullptr);
+    return failures ? 1 : 0;
+}
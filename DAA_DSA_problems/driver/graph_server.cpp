@@ -0,0 +1,404 @@
+#include <bits/stdc++.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+
+#include "graph_service.h"
+
+using namespace std;
+
+// Serves shortest-path, fare, ordering and bridge queries over graph files
+// (graph_convert.cpp output) from one process, so each graph is loaded once
+// and every client shares it.
+//   graph_server [--port=P] [--threads=N] [--max-pending=N] [--deadline-ms=D] name=graph.bin ...
+// Listens on 127.0.0.1 (port 7411 by default). Clients send one request per
+// line, as described by parseQuery in graph_service.h, plus "<id> stats";
+// every request is answered with one line, "<id> ok <payload>",
+// "<id> error <reason>", "<id> timeout" or "<id> busy". Answers on one
+// connection may come out of order, which is what the ids are for.
+//
+// A single thread runs the event loop (epoll over the listening socket, the
+// clients, an eventfd the workers signal, and a signalfd for SIGINT /
+// SIGTERM); the solutions run on QueryService's workers. Every request has a
+// deadline, its own or --deadline-ms (default 2000): the loop keeps them in
+// a min-heap that bounds each epoll_wait, answers "timeout" the moment one
+// passes, and discards the answer if it arrives later. When one connection
+// has too many requests outstanding or too much unsent output, the loop
+// stops reading from it until it catches up, so a slow reader throttles only
+// itself; when the service is full, requests get "busy" at once.
+
+static const size_t MAX_LINE = 1 << 20;
+static const size_t MAX_OUTPUT = 1 << 20;
+static const int MAX_OUTSTANDING = 64;
+
+struct Connection {
+    int fd;
+    string in, out;
+    int outstanding = 0;
+    bool reading = true;
+    bool closing = false; // close once out is flushed
+    uint32_t events = 0;
+};
+
+// A request handed to the service and not yet answered.
+struct Ticket {
+    uint64_t connId;
+    string requestId;
+    ServiceClock::time_point deadline;
+};
+
+class GraphServer {
+    int epollFd = -1, listenFd = -1, wakeFd = -1, signalFd = -1;
+    int defaultDeadlineMs;
+    unique_ptr<QueryService> service;
+    unordered_map<uint64_t, Connection> connections; // by connection id
+    unordered_map<uint64_t, Ticket> tickets;
+    priority_queue<pair<ServiceClock::time_point, uint64_t>, vector<pair<ServiceClock::time_point, uint64_t>>,
+                   greater<>> deadlines;
+    uint64_t nextConnection = 1, nextTicket = 1;
+    long long timedOut = 0;
+
+    // epoll user data: connection ids start at 1, the fixed fds are tagged
+    static constexpr uint64_t LISTEN_TAG = 0, WAKE_TAG = ~0ull, SIGNAL_TAG = ~0ull - 1;
+
+    static void check(bool ok, const char* what) {
+        if (!ok) throw runtime_error(string(what) + ": " + strerror(errno));
+    }
+
+    void watch(int fd, uint32_t events, uint64_t tag, int op = EPOLL_CTL_ADD) {
+        epoll_event ev{};
+        ev.events = events;
+        ev.data.u64 = tag;
+        check(epoll_ctl(epollFd, op, fd, &ev) == 0, "epoll_ctl");
+    }
+
+    // Reads while under the per-connection limits, writes while output is
+    // pending.
+    void updateInterest(uint64_t id, Connection& c) {
+        c.reading = !c.closing && c.outstanding < MAX_OUTSTANDING && c.out.size() < MAX_OUTPUT;
+        uint32_t events = (c.reading ? (uint32_t)EPOLLIN : 0u) | (c.out.empty() ? 0u : (uint32_t)EPOLLOUT);
+        if (events != c.events) {
+            watch(c.fd, events, id, EPOLL_CTL_MOD);
+            c.events = events;
+        }
+    }
+
+    void reply(uint64_t id, const string& requestId, const string& text) {
+        auto found = connections.find(id);
+        if (found == connections.end()) return;
+        found->second.out += requestId + ' ' + text + '\n';
+    }
+
+    void closeConnection(uint64_t id) {
+        auto found = connections.find(id);
+        if (found == connections.end()) return;
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, found->second.fd, nullptr);
+        close(found->second.fd);
+        connections.erase(found);
+        // Its tickets stay until answered or expired and are then dropped
+    }
+
+    string statsLine() const {
+        ServiceStats s = service->stats();
+        return "ok requests=" + to_string(s.requests) + " coalesced=" + to_string(s.coalesced) +
+               " busy=" + to_string(s.rejected) + " computations=" + to_string(s.computations) +
+               " skipped=" + to_string(s.skipped) + " timeouts=" + to_string(timedOut) +
+               " outstanding=" + to_string(tickets.size()) + " connections=" + to_string(connections.size());
+    }
+
+    void handleLine(uint64_t id, Connection& c, const string& line) {
+        if (line.find_first_not_of(" \t\r") == string::npos) return;
+        istringstream head(line);
+        string requestId, op;
+        head >> requestId >> op;
+        if (op == "stats") {
+            reply(id, requestId, statsLine());
+            return;
+        }
+        try {
+            Query q = parseQuery(line);
+            auto deadline = ServiceClock::now() + chrono::milliseconds(q.deadlineMs >= 0 ? q.deadlineMs : defaultDeadlineMs);
+            uint64_t ticket = nextTicket++;
+            if (service->submit(ticket, q, deadline) == QueryService::Admission::Busy) {
+                reply(id, requestId, "busy");
+                return;
+            }
+            tickets[ticket] = {id, requestId, deadline};
+            deadlines.push({deadline, ticket});
+            c.outstanding++;
+        } catch (const invalid_argument& e) {
+            reply(id, requestId, string("error ") + e.what());
+        }
+    }
+
+    // Handles buffered lines until the connection has MAX_OUTSTANDING
+    // requests in flight; the rest wait for answers to come back.
+    void processLines(uint64_t id, Connection& c) {
+        size_t start = 0;
+        for (size_t nl; c.outstanding < MAX_OUTSTANDING && (nl = c.in.find('\n', start)) != string::npos; start = nl + 1)
+            handleLine(id, c, c.in.substr(start, nl - start));
+        c.in.erase(0, start);
+    }
+
+    void onReadable(uint64_t id) {
+        Connection& c = connections.at(id);
+        char buf[65536];
+        for (;;) {
+            ssize_t n = read(c.fd, buf, sizeof buf);
+            if (n > 0) {
+                c.in.append(buf, n);
+                if (n < (ssize_t)sizeof buf) break;
+            } else if (n == 0) {
+                c.closing = true; // answer what was sent before the hangup
+                break;
+            } else {
+                if (errno == EINTR) continue;
+                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    closeConnection(id);
+                    return;
+                }
+                break;
+            }
+        }
+        processLines(id, c);
+        if (c.in.size() > MAX_LINE && c.in.find('\n') == string::npos) {
+            c.out += "- error line too long\n";
+            c.in.clear();
+            c.closing = true;
+        }
+        flush(id);
+    }
+
+    // Writes what the socket takes; closes a connection that is done.
+    void flush(uint64_t id) {
+        auto found = connections.find(id);
+        if (found == connections.end()) return;
+        Connection& c = found->second;
+        size_t sent = 0;
+        while (sent < c.out.size()) {
+            ssize_t n = write(c.fd, c.out.data() + sent, c.out.size() - sent);
+            if (n > 0) {
+                sent += n;
+            } else if (n < 0 && errno == EINTR) {
+                continue;
+            } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            } else {
+                closeConnection(id);
+                return;
+            }
+        }
+        c.out.erase(0, sent);
+        if (c.closing && c.out.empty() && c.outstanding == 0 && c.in.find('\n') == string::npos) {
+            closeConnection(id);
+            return;
+        }
+        updateInterest(id, c);
+    }
+
+    // Takes a ticket out of the books; its connection, if still open, has one
+    // request fewer outstanding.
+    bool settle(uint64_t ticket, Ticket& out) {
+        auto found = tickets.find(ticket);
+        if (found == tickets.end()) return false;
+        out = move(found->second);
+        tickets.erase(found);
+        auto conn = connections.find(out.connId);
+        if (conn != connections.end()) conn->second.outstanding--;
+        return true;
+    }
+
+    // After answers went out: lines held back by the outstanding limit get
+    // their turn, then the output is written.
+    void resume(const set<uint64_t>& touched) {
+        for (uint64_t id : touched) {
+            auto found = connections.find(id);
+            if (found == connections.end()) continue;
+            processLines(id, found->second);
+            flush(id);
+        }
+    }
+
+    void onCompletions() {
+        uint64_t count;
+        while (read(wakeFd, &count, sizeof count) < 0 && errno == EINTR) {
+        }
+        set<uint64_t> touched;
+        for (Completion& done : service->drain()) {
+            Ticket t;
+            if (!settle(done.ticket, t)) continue; // already answered "timeout"
+            reply(t.connId, t.requestId, done.status + ' ' + done.payload);
+            touched.insert(t.connId);
+        }
+        resume(touched);
+    }
+
+    // Answers every request past its deadline; returns the epoll_wait timeout
+    // until the next one (-1 if none).
+    int expireDeadlines() {
+        auto now = ServiceClock::now();
+        set<uint64_t> touched;
+        while (!deadlines.empty()) {
+            auto [when, ticket] = deadlines.top();
+            if (!tickets.count(ticket)) {
+                deadlines.pop(); // answered in time
+                continue;
+            }
+            if (when > now) {
+                auto wait = chrono::duration_cast<chrono::milliseconds>(when - now).count() + 1;
+                resume(touched);
+                return (int)min<long long>(wait, INT_MAX);
+            }
+            deadlines.pop();
+            Ticket t;
+            settle(ticket, t);
+            timedOut++;
+            reply(t.connId, t.requestId, "timeout");
+            touched.insert(t.connId);
+        }
+        resume(touched);
+        return -1;
+    }
+
+    void accepted() {
+        for (;;) {
+            int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) {
+                if (errno == EINTR) continue;
+                return; // EAGAIN, or out of descriptors: try on the next event
+            }
+            uint64_t id = nextConnection++;
+            Connection& c = connections[id];
+            c.fd = fd;
+            c.events = EPOLLIN;
+            watch(fd, EPOLLIN, id);
+        }
+    }
+
+public:
+    GraphServer(map<string, shared_ptr<ServedGraph>> graphs, int port, int threads, size_t maxPending, int deadlineMs)
+        : defaultDeadlineMs(deadlineMs) {
+        // Blocked before the workers start, so they inherit the mask and the
+        // signals reach only the signalfd
+        sigset_t mask;
+        sigemptyset(&mask);
+        sigaddset(&mask, SIGINT);
+        sigaddset(&mask, SIGTERM);
+        check(pthread_sigmask(SIG_BLOCK, &mask, nullptr) == 0, "pthread_sigmask");
+        signalFd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+        check(signalFd >= 0, "signalfd");
+        signal(SIGPIPE, SIG_IGN);
+
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+        check(epollFd >= 0, "epoll_create1");
+        wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        check(wakeFd >= 0, "eventfd");
+        int notifyFd = wakeFd;
+        service = make_unique<QueryService>(move(graphs), threads, maxPending, [notifyFd] {
+            uint64_t one = 1;
+            while (write(notifyFd, &one, sizeof one) < 0 && errno == EINTR) {
+            }
+        });
+
+
+        listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        check(listenFd >= 0, "socket");
+        int on = 1;
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof on);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        check(bind(listenFd, (sockaddr*)&addr, sizeof addr) == 0, "bind");
+        check(listen(listenFd, 128) == 0, "listen");
+        socklen_t len = sizeof addr;
+        getsockname(listenFd, (sockaddr*)&addr, &len);
+        printf("listening on 127.0.0.1:%d\n", ntohs(addr.sin_port));
+        fflush(stdout);
+
+        watch(listenFd, EPOLLIN, LISTEN_TAG);
+        watch(wakeFd, EPOLLIN, WAKE_TAG);
+        watch(signalFd, EPOLLIN, SIGNAL_TAG);
+    }
+
+    ~GraphServer() {
+        service.reset(); // joins the workers before their eventfd goes away
+        for (auto& [id, c] : connections) close(c.fd);
+        for (int fd : {listenFd, wakeFd, signalFd, epollFd})
+            if (fd >= 0) close(fd);
+    }
+
+    // Runs until SIGINT or SIGTERM.
+    void run() {
+        epoll_event events[64];
+        for (;;) {
+            int timeout = expireDeadlines();
+            int n = epoll_wait(epollFd, events, 64, timeout);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                check(false, "epoll_wait");
+            }
+            for (int i = 0; i < n; i++) {
+                uint64_t tag = events[i].data.u64;
+                if (tag == LISTEN_TAG) {
+                    accepted();
+                } else if (tag == WAKE_TAG) {
+                    onCompletions();
+                } else if (tag == SIGNAL_TAG) {
+                    signalfd_siginfo info;
+                    while (read(signalFd, &info, sizeof info) < 0 && errno == EINTR) {
+                    }
+                    printf("shutting down: %s\n", statsLine().c_str() + 3);
+                    return;
+                } else if (connections.count(tag)) {
+                    if (events[i].events & (EPOLLERR | EPOLLHUP) && !(events[i].events & EPOLLIN)) {
+                        closeConnection(tag);
+                        continue;
+                    }
+                    if (events[i].events & EPOLLIN) onReadable(tag);
+                    if (events[i].events & EPOLLOUT) flush(tag);
+                }
+            }
+        }
+    }
+};
+
+int main(int argc, char** argv) {
+    int port = 7411, threads = 0, deadlineMs = 2000;
+    size_t maxPending = 256;
+    map<string, shared_ptr<ServedGraph>> graphs;
+    try {
+        for (int i = 1; i < argc; i++) {
+            string arg = argv[i];
+            size_t eq = arg.find('=');
+            if (arg.rfind("--port=", 0) == 0) {
+                port = stoi(arg.substr(7));
+            } else if (arg.rfind("--threads=", 0) == 0) {
+                threads = stoi(arg.substr(10));
+            } else if (arg.rfind("--max-pending=", 0) == 0) {
+                maxPending = stoul(arg.substr(14));
+            } else if (arg.rfind("--deadline-ms=", 0) == 0) {
+                deadlineMs = stoi(arg.substr(14));
+            } else if (arg[0] != '-' && eq != string::npos && eq > 0) {
+                graphs[arg.substr(0, eq)] = make_shared<ServedGraph>(arg.substr(eq + 1));
+            } else {
+                fprintf(stderr,
+                        "usage: %s [--port=P] [--threads=N] [--max-pending=N] [--deadline-ms=D] name=graph.bin ...\n",
+                        argv[0]);
+                return 1;
+            }
+        }
+        if (graphs.empty()) throw invalid_argument("no graphs to serve");
+        for (auto& [name, g] : graphs) printf("%s: %d vertices, %d edges\n", name.c_str(), g->vertices(), g->view().E);
+        GraphServer server(move(graphs), port, threads, maxPending, deadlineMs);
+        server.run();
+    } catch (const exception& e) {
+        fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
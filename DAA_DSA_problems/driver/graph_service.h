@@ -0,0 +1,409 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Query engine behind graph_server.cpp: loaded graphs, a worker pool, and
+// the admission, coalescing and deadline rules. It knows nothing about
+// sockets; the event loop submits queries and collects completions.
+
+// Shared headers first: the problem files below are pulled into their own
+// namespaces, and #pragma once would otherwise hide these from all but the
+// first namespace that includes them.
+#include "../common/parallel.h"
+#include "../common/op_counters.h"
+#include "../common/autotune.h"
+#include "../common/fast_io.h"
+#include "../Graph/csr_graph.h"
+#include "../Graph/priority_queues.h"
+#include "../Graph/graph_file.h"
+
+#define DAA_NO_MAIN
+namespace g06 {
+#include "../Graph/prob_06.cpp"
+}
+namespace g25 {
+#include "../Graph/Prob_25.cpp"
+}
+namespace g31 {
+#include "../Graph/prob_31.cpp"
+}
+namespace g41 {
+#include "../Graph/prob_41.cpp"
+}
+#undef DAA_NO_MAIN
+
+using namespace std;
+
+using ServiceClock = chrono::steady_clock;
+
+// One graph file, mapped read-only: the CSR arrays are the page cache's
+// copy, shared with every other process serving the same file. The inputs
+// each solution needs (adjacency lists, the fare engine, prerequisite and
+// connection lists) are derived from the mapping on first use, once, and
+// never change after, so workers read them without locks. Unweighted files
+// count every edge as weight 1.
+class ServedGraph {
+    MappedGraphFile file;
+    once_flag adjacencyOnce, faresOnce, pairsOnce;
+    vector<vector<pair<int, int>>> adjacency;
+    unique_ptr<g31::FareEngine> fareEngine;
+    vector<vector<int>> prerequisites, connections;
+
+    int weightAt(int e) const { return file.graph().weighted() ? file.graph().weights[e] : 1; }
+
+    void buildPairs() {
+        const GraphView& g = file.graph();
+        prerequisites.reserve(g.E);
+        connections.reserve(g.E);
+        for (int u = 0; u < g.V; u++) {
+            for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                prerequisites.push_back({g.neighbors[e], u}); // edge u -> v: v needs u
+                connections.push_back({u, g.neighbors[e]});
+            }
+        }
+    }
+
+public:
+    explicit ServedGraph(const string& path) : file(path) {}
+
+    const GraphView& view() const { return file.graph(); }
+    int vertices() const { return file.graph().V; }
+
+    const vector<vector<pair<int, int>>>& weightedAdjacency() {
+        call_once(adjacencyOnce, [this] {
+            const GraphView& g = file.graph();
+            adjacency.resize(g.V);
+            for (int u = 0; u < g.V; u++) {
+                adjacency[u].reserve(g.degree(u));
+                for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) adjacency[u].push_back({g.neighbors[e], weightAt(e)});
+            }
+        });
+        return adjacency;
+    }
+
+    const g31::FareEngine& fares() {
+        call_once(faresOnce, [this] {
+            const GraphView& g = file.graph();
+            vector<vector<int>> flights;
+            flights.reserve(g.E);
+            for (int u = 0; u < g.V; u++)
+                for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) flights.push_back({u, g.neighbors[e], weightAt(e)});
+            fareEngine = make_unique<g31::FareEngine>(g.V, flights);
+        });
+        return *fareEngine;
+    }
+
+    // {v, u} for every edge u -> v, in Prob_25's {task, prerequisite} form.
+    const vector<vector<int>>& prerequisitePairs() {
+        call_once(pairsOnce, [this] { buildPairs(); });
+        return prerequisites;
+    }
+
+    // Every stored edge as an undirected connection, for prob_41.
+    const vector<vector<int>>& connectionPairs() {
+        call_once(pairsOnce, [this] { buildPairs(); });
+        return connections;
+    }
+};
+
+enum class QueryKind { Dijkstra, Cheapest, Order, Bridges };
+
+// One request line:
+//   <id> dijkstra <graph> <source> [target]   distances (prob_06 dijkstraOptimal)
+//   <id> cheapest <graph> <src> <dst> <k>      fare with at most k stops (prob_31)
+//   <id> order <graph>                         topological order (Prob_25 findOrder)
+//   <id> bridges <graph>                       critical connections (prob_41)
+// Any of them may end in "deadline=<ms>".
+struct Query {
+    string id;
+    QueryKind kind = QueryKind::Dijkstra;
+    string graph;
+    int source = -1, target = -1, k = 0;
+    int deadlineMs = -1; // -1: the server default
+};
+
+// Throws invalid_argument naming what is wrong with the line.
+inline Query parseQuery(const string& line) {
+    istringstream in(line);
+    vector<string> tokens;
+    for (string t; in >> t;) tokens.push_back(t);
+    Query q;
+    if (!tokens.empty() && tokens.back().rfind("deadline=", 0) == 0) {
+        string ms = tokens.back().substr(9);
+        if (ms.empty() || ms.size() > 9 || ms.find_first_not_of("0123456789") != string::npos)
+            throw invalid_argument("bad deadline");
+        q.deadlineMs = stoi(ms);
+        tokens.pop_back();
+    }
+    if (tokens.size() < 3) throw invalid_argument("expected: <id> <op> <graph> [args]");
+    q.id = tokens[0];
+    q.graph = tokens[2];
+    auto vertex = [&](size_t i) {
+        const string& t = tokens[i];
+        if (t.empty() || t.size() > 10 || t.find_first_not_of("0123456789") != string::npos)
+            throw invalid_argument("bad number \"" + t + "\"");
+        long long v = stoll(t);
+        if (v > INT_MAX) throw invalid_argument("bad number \"" + t + "\"");
+        return (int)v;
+    };
+    const string& op = tokens[1];
+    size_t args = tokens.size() - 3;
+    if (op == "dijkstra" && (args == 1 || args == 2)) {
+        q.kind = QueryKind::Dijkstra;
+        q.source = vertex(3);
+        if (args == 2) q.target = vertex(4);
+    } else if (op == "cheapest" && args == 3) {
+        q.kind = QueryKind::Cheapest;
+        q.source = vertex(3);
+        q.target = vertex(4);
+        q.k = vertex(5);
+    } else if (op == "order" && args == 0) {
+        q.kind = QueryKind::Order;
+    } else if (op == "bridges" && args == 0) {
+        q.kind = QueryKind::Bridges;
+    } else {
+        throw invalid_argument("unknown request \"" + op + "\" or wrong argument count");
+    }
+    return q;
+}
+
+// Result of one request, keyed by the ticket it was submitted with.
+struct Completion {
+    uint64_t ticket;
+    string status; // "ok" or "error"
+    string payload;
+};
+
+struct ServiceStats {
+    long long requests = 0;     // admitted
+    long long coalesced = 0;    // joined a computation already queued or running
+    long long rejected = 0;     // turned away as busy
+    long long computations = 0; // solutions actually run
+    long long skipped = 0;      // queued computations dropped: every waiter had timed out
+};
+
+// Fixed worker pool over a FIFO of computations.
+//
+// A computation is keyed by (kind, graph, source); a request whose key is
+// already queued or running joins it as one more waiter instead of adding
+// work, and all waiters get their answers from the one run (a fare batch
+// takes new waiters only until it starts, since FareEngine answers a fixed
+// query list). Admission is bounded: with maxPending computations queued or
+// running, a request that cannot join one is rejected, so a burst is turned
+// away immediately instead of queueing behind work that will miss its
+// deadline. Deadlines are the caller's to enforce on the clock; workers
+// also drop waiters already past theirs, skip a computation nobody waits
+// for, and never report a late answer. A running solution is not
+// interrupted.
+// Completions are collected with drain(); notify() is called, from a worker
+// thread, whenever new ones are ready.
+class QueryService {
+    struct Waiter {
+        uint64_t ticket;
+        int target, k;
+        ServiceClock::time_point deadline;
+    };
+    struct Job {
+        string key;
+        QueryKind kind;
+        shared_ptr<ServedGraph> graph;
+        int source;
+        vector<Waiter> waiters;
+    };
+
+    map<string, shared_ptr<ServedGraph>> graphs;
+    size_t maxPending;
+    function<void()> notify;
+
+    mutable mutex lock;
+    condition_variable hasWork;
+    deque<shared_ptr<Job>> queue;
+    unordered_map<string, shared_ptr<Job>> joinable;
+    size_t pending = 0; // queued or running computations
+    vector<Completion> done;
+    ServiceStats counters;
+    bool stopping = false;
+    vector<thread> workers;
+
+    static string formatInts(const vector<int>& v) {
+        string s;
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) s += ' ';
+            s += to_string(v[i]);
+        }
+        return s;
+    }
+
+    // Runs job's solution; answer(w) then gives each waiter's payload.
+    function<string(const Waiter&)> compute(Job& job, const vector<Waiter>& batch) {
+        ServedGraph& g = *job.graph;
+        switch (job.kind) {
+        case QueryKind::Dijkstra: {
+            auto dist = make_shared<vector<int>>(g06::dijkstraOptimal(g.vertices(), g.weightedAdjacency(), job.source));
+            for (int& d : *dist)
+                if (d == INT_MAX) d = -1;
+            auto all = make_shared<string>();
+            return [dist, all](const Waiter& w) {
+                if (w.target >= 0) return to_string((*dist)[w.target]);
+                if (all->empty()) *all = formatInts(*dist);
+                return *all;
+            };
+        }
+        case QueryKind::Cheapest: {
+            vector<g31::FareQuery> queries;
+            for (const Waiter& w : batch) queries.push_back({job.source, w.target, w.k});
+            vector<int> fares = g.fares().cheapestBatch(queries, 1);
+            auto byTicket = make_shared<unordered_map<uint64_t, int>>();
+            for (size_t i = 0; i < batch.size(); i++) (*byTicket)[batch[i].ticket] = fares[i];
+            return [byTicket](const Waiter& w) { return to_string(byTicket->at(w.ticket)); };
+        }
+        case QueryKind::Order: {
+            vector<int> order = g25::OptimalSolution().findOrder(g.vertices(), g.prerequisitePairs());
+            string s = order.empty() && g.vertices() > 0 ? "impossible" : formatInts(order);
+            return [s](const Waiter&) { return s; };
+        }
+        case QueryKind::Bridges: {
+            vector<vector<int>> bridges = g41::BridgeFinder().criticalConnections(g.vertices(), g.connectionPairs());
+            string s = bridges.empty() ? "none" : "";
+            for (size_t i = 0; i < bridges.size(); i++) {
+                if (i) s += ", ";
+                s += to_string(bridges[i][0]) + ' ' + to_string(bridges[i][1]);
+            }
+            return [s](const Waiter&) { return s; };
+        }
+        }
+        throw logic_error("unhandled query kind");
+    }
+
+    static void dropExpired(vector<Waiter>& waiters, ServiceClock::time_point now) {
+        waiters.erase(remove_if(waiters.begin(), waiters.end(), [&](const Waiter& w) { return w.deadline < now; }),
+                      waiters.end());
+    }
+
+    void workerLoop() {
+        for (;;) {
+            shared_ptr<Job> job;
+            vector<Waiter> batch;
+            {
+                unique_lock<mutex> guard(lock);
+                hasWork.wait(guard, [&] { return stopping || !queue.empty(); });
+                if (stopping) return;
+                job = move(queue.front());
+                queue.pop_front();
+                dropExpired(job->waiters, ServiceClock::now());
+                if (job->waiters.empty()) {
+                    if (joinable.count(job->key) && joinable[job->key] == job) joinable.erase(job->key);
+                    pending--;
+                    counters.skipped++;
+                    continue;
+                }
+                if (job->kind == QueryKind::Cheapest) {
+                    joinable.erase(job->key);
+                    batch = job->waiters;
+                }
+                counters.computations++;
+            }
+
+            function<string(const Waiter&)> answer;
+            string error;
+            try {
+                answer = compute(*job, batch);
+            } catch (const exception& e) {
+                error = e.what();
+            }
+
+            vector<Waiter> waiters;
+            {
+                lock_guard<mutex> guard(lock);
+                if (joinable.count(job->key) && joinable[job->key] == job) joinable.erase(job->key);
+                waiters = move(job->waiters);
+                pending--;
+            }
+            dropExpired(waiters, ServiceClock::now());
+            vector<Completion> out;
+            for (const Waiter& w : waiters) {
+                if (!error.empty()) out.push_back({w.ticket, "error", error});
+                else out.push_back({w.ticket, "ok", answer(w)});
+            }
+            if (out.empty()) continue;
+            {
+                lock_guard<mutex> guard(lock);
+                for (Completion& c : out) done.push_back(move(c));
+            }
+            notify();
+        }
+    }
+
+public:
+    QueryService(map<string, shared_ptr<ServedGraph>> graphs, int threads, size_t maxPending, function<void()> notify)
+        : graphs(move(graphs)), maxPending(max<size_t>(1, maxPending)), notify(move(notify)) {
+        threads = resolveThreads(threads);
+        for (int t = 0; t < threads; t++) workers.emplace_back([this] { workerLoop(); });
+    }
+
+    QueryService(const QueryService&) = delete;
+    QueryService& operator=(const QueryService&) = delete;
+
+    // Waits for the solutions already running; queued ones are dropped.
+    ~QueryService() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        hasWork.notify_all();
+        for (thread& t : workers) t.join();
+    }
+
+    enum class Admission { Queued, Coalesced, Busy };
+
+    // Throws invalid_argument for an unknown graph or vertex.
+    Admission submit(uint64_t ticket, const Query& q, ServiceClock::time_point deadline) {
+        auto found = graphs.find(q.graph);
+        if (found == graphs.end()) throw invalid_argument("unknown graph \"" + q.graph + "\"");
+        int V = found->second->vertices();
+        if (q.source >= V || q.target >= V) throw invalid_argument("vertex out of range");
+
+        string key = to_string((int)q.kind) + ' ' + q.graph;
+        if (q.kind == QueryKind::Dijkstra || q.kind == QueryKind::Cheapest) key += ' ' + to_string(q.source);
+        Waiter w{ticket, q.target, q.k, deadline};
+
+        lock_guard<mutex> guard(lock);
+        auto open = joinable.find(key);
+        if (open != joinable.end()) {
+            open->second->waiters.push_back(w);
+            counters.requests++;
+            counters.coalesced++;
+            return Admission::Coalesced;
+        }
+        if (pending >= maxPending) {
+            counters.rejected++;
+            return Admission::Busy;
+        }
+        auto job = make_shared<Job>(Job{key, q.kind, found->second, q.source, {w}});
+        joinable[key] = job;
+        queue.push_back(job);
+        pending++;
+        counters.requests++;
+        hasWork.notify_one();
+        return Admission::Queued;
+    }
+
+    vector<Completion> drain() {
+        lock_guard<mutex> guard(lock);
+        vector<Completion> out;
+        out.swap(done);
+        return out;
+    }
+
+    ServiceStats stats() const {
+        lock_guard<mutex> guard(lock);
+        return counters;
+    }
+};
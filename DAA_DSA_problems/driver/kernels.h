@@ -0,0 +1,889 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// The problem kernels the driver (driver.cpp) and the differential checker
+// (diff_check.cpp) run: every registered problem file, pulled into its own
+// namespace, and the registrations that adapt each variant to case input.
+
+// Shared headers first: the problem files below are pulled into their own
+// namespaces, and #pragma once would otherwise hide these from all but the
+// first namespace that includes them.
+#include "../common/parallel.h"
+#include "../common/flat_hash_map.h"
+#include "../common/op_counters.h"
+#include "../common/autotune.h"
+#include "../common/fast_io.h"
+#include "../common/alloc_profile.h"
+#include "../common/result_cache.h"
+#include "../common/merge_count.h"
+#include "../common/temp_path.h"
+#include "../Graph/csr_graph.h"
+#include "../Graph/bit_matrix.h"
+#include "../Graph/disjoint_set.h"
+#include "../Graph/graph_file.h"
+#include "../Graph/incremental_schedule.h"
+#include "../Graph/incremental_schedule_bench.h"
+#include "../Graph/priority_queues.h"
+#include "../Graph/streaming_cycle.h"
+#include "../Graph/wildcard_index.h"
+#include "../Dynammic Programming/dp_table.h"
+#include "../Dynammic Programming/subset_bitset.h"
+#include "../Dynammic Programming/subset_count.h"
+#include "../Dynammic Programming/wavefront_dp.h"
+#include "problem_registry.h"
+
+#define DAA_NO_MAIN
+namespace arr04 {
+#include "../Array/prob_04.cpp"
+}
+namespace arr08 {
+#include "../Array/prob_08.cpp"
+}
+namespace arr12 {
+#include "../Array/prob_12.cpp"
+}
+namespace arr14 {
+#include "../Array/prob_14.cpp"
+}
+namespace arr15 {
+#include "../Array/prob_15.cpp"
+}
+namespace arr21 {
+#include "../Array/prob_21.cpp"
+}
+namespace arr30 {
+#include "../Array/prob_30.cpp"
+}
+namespace arr31 {
+#include "../Array/prob_31.cpp"
+}
+namespace arr33 {
+#include "../Array/prob_33.cpp"
+}
+namespace arr37 {
+#include "../Array/prob_37.cpp"
+}
+namespace arr38 {
+#include "../Array/prob_38.cpp"
+}
+namespace g02 {
+#include "../Graph/prob_02.cpp"
+}
+namespace g05 {
+#include "../Graph/prob_05.cpp"
+}
+namespace g06 {
+#include "../Graph/prob_06.cpp"
+}
+namespace g10 {
+#include "../Graph/prob_10.cpp"
+}
+namespace g14 {
+#include "../Graph/prob_14.cpp"
+}
+namespace g18 {
+#include "../Graph/prob_18.cpp"
+}
+namespace g19 {
+#include "../Graph/prob_19.cpp"
+}
+namespace g24 {
+#include "../Graph/prob_24.cpp"
+}
+namespace g31 {
+#include "../Graph/prob_31.cpp"
+}
+namespace g37 {
+#include "../Graph/prob_37.cpp"
+}
+namespace dp01 {
+#include "../Dynammic Programming/prob_01.cpp"
+}
+namespace dp02 {
+#include "../Dynammic Programming/prob_02.cpp"
+}
+namespace dp03 {
+#include "../Dynammic Programming/prob_03.cpp"
+}
+namespace dp09 {
+#include "../Dynammic Programming/prob_09.cpp"
+}
+namespace dp10 {
+#include "../Dynammic Programming/prob_10.cpp"
+}
+namespace dp13 {
+#include "../Dynammic Programming/prob_13.cpp"
+}
+namespace dp14 {
+#include "../Dynammic Programming/prob_14.cpp"
+}
+namespace dp15 {
+#include "../Dynammic Programming/prob_15.cpp"
+}
+namespace dp16 {
+#include "../Dynammic Programming/prob_16.cpp"
+}
+namespace dp17 {
+#include "../Dynammic Programming/prob_17.cpp"
+}
+namespace dp18 {
+#include "../Dynammic Programming/prob_18.cpp"
+}
+namespace dp19 {
+#include "../Dynammic Programming/prob_19.cpp"
+}
+#undef DAA_NO_MAIN
+
+using namespace std;
+
+// Registers one kernel per variant of a problem. read(in) parses a case
+// into an Input, which every variant solves through solve(input, out).
+template <class Input, class Read>
+void addProblem(ProblemRegistry& reg, const string& problem, const string& format, Read read,
+                       vector<pair<string, function<void(Input&, string&)>>> variants) {
+    for (auto& [variant, solve] : variants) {
+        reg.add({problem, variant, format, [read, solve = solve](TokenReader& in) -> CaseTask {
+                     auto input = make_shared<Input>(read(in));
+                     return [input, solve](string& out) { solve(*input, out); };
+                 }});
+    }
+}
+
+inline vector<int> readArray(TokenReader& in) {
+    size_t n = in.count();
+    return in.ints(n);
+}
+
+struct ArrayWithTarget {
+    vector<int> a;
+    long long target;
+};
+
+// "n target a_1 .. a_n"
+inline ArrayWithTarget readArrayWithTarget(TokenReader& in) {
+    size_t n = in.count();
+    int target = in.int32();
+    return {in.ints(n), target};
+}
+
+struct SortedRuns {
+    vector<vector<int>> runs;
+};
+
+// "k" then k runs "n_i a_1 .. a_{n_i}"; each run is sorted as it is read.
+inline SortedRuns readSortedRuns(TokenReader& in) {
+    SortedRuns s;
+    s.runs.resize(in.count());
+    for (auto& run : s.runs) {
+        run = in.ints(in.count());
+        sort(run.begin(), run.end());
+    }
+    return s;
+}
+
+struct GraphInput {
+    int V = 0;
+    int source = 0;
+    vector<vector<int>> edges; // {u, v} or {u, v, w}
+};
+
+// "V E" then E edges "u v" (or "u v w"), vertices in [0, V).
+inline GraphInput readGraph(TokenReader& in, bool weighted, bool withSource = false) {
+    GraphInput g;
+    g.V = (int)in.integer(1, INT32_MAX);
+    size_t E = in.count(weighted ? 3 : 2);
+    if (withSource) g.source = (int)in.integer(0, g.V - 1);
+    g.edges.resize(E);
+    for (auto& e : g.edges) {
+        int u = (int)in.integer(0, g.V - 1), v = (int)in.integer(0, g.V - 1);
+        e = {u, v};
+        if (weighted) e.push_back((int)in.integer(0, INT32_MAX));
+    }
+    return g;
+}
+
+inline vector<vector<int>> adjacencyList(const GraphInput& g) {
+    vector<vector<int>> adj(g.V);
+    for (auto& e : g.edges) {
+        adj[e[0]].push_back(e[1]);
+        if (e[0] != e[1]) adj[e[1]].push_back(e[0]);
+    }
+    return adj;
+}
+
+inline vector<vector<int>> adjacencyMatrix(const GraphInput& g) {
+    vector<vector<int>> m(g.V, vector<int>(g.V, 0));
+    for (auto& e : g.edges) m[e[0]][e[1]] = m[e[1]][e[0]] = 1;
+    return m;
+}
+
+inline void appendBool(string& out, bool b) { out += b ? "true" : "false"; }
+
+inline void registerArrayProblems(ProblemRegistry& reg) {
+    addProblem<ArrayWithTarget>(reg, "array/two_sum", "n target a_1..a_n -> i j (-1 -1 if no pair)",
+        readArrayWithTarget, {
+            {"brute", [](ArrayWithTarget& c, string& out) {
+                 vector<int> r = arr21::twoSumBruteForce(c.a, (int)c.target);
+                 appendInts(out, r.empty() ? vector<int>{-1, -1} : r);
+             }},
+            {"optimal", [](ArrayWithTarget& c, string& out) {
+                 vector<int> r = arr21::twoSumOptimal(c.a, (int)c.target);
+                 appendInts(out, r.empty() ? vector<int>{-1, -1} : r);
+             }},
+            {"indexed", [](ArrayWithTarget& c, string& out) {
+                 auto [i, j] = arr21::TwoSumIndex(c.a).query(c.target);
+                 appendInts(out, vector<int>{i, j});
+             }},
+        });
+
+    addProblem<vector<int>>(reg, "array/longest_consecutive", "n a_1..a_n -> length of the longest run of consecutive values",
+        readArray, {
+            {"brute", [](vector<int>& a, string& out) { appendInt(out, arr14::longestConsecutiveBrute(a)); }},
+            {"optimal", [](vector<int>& a, string& out) { appendInt(out, arr14::longestConsecutiveOptimal(a)); }},
+            {"auto", [](vector<int>& a, string& out) { appendInt(out, arr14::longestConsecutive(a)); }},
+        });
+
+    addProblem<ArrayWithTarget>(reg, "array/subarray_sum_k", "n k a_1..a_n -> number of subarrays summing to k",
+        readArrayWithTarget, {
+            {"brute", [](ArrayWithTarget& c, string& out) { appendInt(out, arr15::countSubarraysBrute(c.a, (int)c.target)); }},
+            {"optimal", [](ArrayWithTarget& c, string& out) { appendInt(out, arr15::countSubarraysOptimal(c.a, (int)c.target)); }},
+            {"parallel", [](ArrayWithTarget& c, string& out) { appendInt(out, arr15::countSubarraysParallel(c.a, c.target, 1)); }},
+        });
+
+    auto appendTriplets = [](string& out, const auto& triplets) {
+        if (triplets.empty()) out += "none";
+        for (size_t i = 0; i < triplets.size(); i++) {
+            if (i) out += ", ";
+            appendInts(out, triplets[i]);
+        }
+    };
+    addProblem<vector<int>>(reg, "array/three_sum", "n a_1..a_n -> distinct triplets summing to 0, ascending (\"none\" if none)",
+        readArray, {
+            {"brute", [=](vector<int>& a, string& out) { appendTriplets(out, arr30::threeSumBruteForce(a)); }},
+            {"optimal", [=](vector<int>& a, string& out) { appendTriplets(out, arr30::threeSumOptimal(a)); }},
+            {"parallel", [=](vector<int>& a, string& out) { appendTriplets(out, arr30::threeSumParallel(a, 1)); }},
+        });
+    addProblem<vector<int>>(reg, "array/three_sum_count", "n a_1..a_n -> number of distinct triplets summing to 0",
+        readArray, {
+            {"brute", [](vector<int>& a, string& out) { appendInt(out, (long long)arr30::threeSumBruteForce(a).size()); }},
+            {"optimal", [](vector<int>& a, string& out) { appendInt(out, (long long)arr30::threeSumOptimal(a).size()); }},
+            {"count", [](vector<int>& a, string& out) { appendInt(out, arr30::threeSumCountParallel(a, 1)); }},
+        });
+
+    addProblem<vector<int>>(reg, "array/zero_sum_subarray", "n a_1..a_n -> length of the longest subarray summing to 0",
+        readArray, {
+            {"brute", [](vector<int>& a, string& out) { appendInt(out, arr31::largestSubarraySumZeroBruteForce(a)); }},
+            {"optimal", [](vector<int>& a, string& out) { appendInt(out, arr31::largestSubarraySumZeroOptimal(a)); }},
+        });
+
+    // range builds its index on the first half and appends the rest, so the
+    // appends and capacity doublings are covered before the query
+    addProblem<vector<int>>(reg, "array/stock_profit", "n p_1..p_n -> best profit of one buy and a later sell (0 if none)",
+        readArray, {
+            {"brute", [](vector<int>& a, string& out) { appendInt(out, arr12::maxProfitBruteForce(a)); }},
+            {"optimal", [](vector<int>& a, string& out) { appendInt(out, arr12::maxProfit(a)); }},
+            {"online", [](vector<int>& a, string& out) {
+                 arr12::OnlineProfitTracker tracker;
+                 for (int p : a) tracker.push(p);
+                 appendInt(out, tracker.bestProfit());
+             }},
+            {"range", [](vector<int>& a, string& out) {
+                 if (a.empty()) {
+                     appendInt(out, 0);
+                     return;
+                 }
+                 size_t half = a.size() / 2;
+                 arr12::RangeProfitIndex index(vector<int>(a.begin(), a.begin() + half));
+                 for (size_t i = half; i < a.size(); i++) index.append(a[i]);
+                 appendInt(out, index.query(0, a.size() - 1));
+             }},
+        });
+
+    // The values are 1..n+1 with one absent. sum adds in int: n <= 46000.
+    addProblem<vector<int>>(reg, "array/missing_number", "n a_1..a_n (1..n+1 with one value absent) -> the absent value",
+        readArray, {
+            {"brute", [](vector<int>& a, string& out) { appendInt(out, arr08::missingNumberBruteForce(a, (int)a.size() + 1)); }},
+            {"sum", [](vector<int>& a, string& out) { appendInt(out, arr08::missingNumberSum(a, (int)a.size() + 1)); }},
+            {"optimal", [](vector<int>& a, string& out) { appendInt(out, arr08::missingNumber(a, (int)a.size() + 1)); }},
+            {"streamed", [](vector<int>& a, string& out) { appendInt(out, arr08::missingNumberSimd(a, (int)a.size() + 1)); }},
+        });
+    // Distinct values from 1..N with any number absent. streamed_16 allows
+    // 16 buckets per pass, so dense gaps take several rewound passes.
+    addProblem<ArrayWithTarget>(reg, "array/missing_numbers", "n N a_1..a_n (distinct, in 1..N) -> every absent value, ascending",
+        readArrayWithTarget, {
+            {"mark", [](ArrayWithTarget& in, string& out) {
+                 vector<char> seen(in.target + 1, 0);
+                 for (int v : in.a) seen[v] = 1;
+                 vector<long long> missing;
+                 for (long long v = 1; v <= in.target; v++) {
+                     if (!seen[v]) missing.push_back(v);
+                 }
+                 appendInts(out, missing);
+             }},
+            {"streamed", [](ArrayWithTarget& in, string& out) {
+                 arr08::ArrayIntSource src(in.a);
+                 appendInts(out, arr08::missingNumbersStreamed(src, in.target));
+             }},
+            {"streamed_16", [](ArrayWithTarget& in, string& out) {
+                 arr08::ArrayIntSource src(in.a);
+                 appendInts(out, arr08::missingNumbersStreamed(src, in.target, 16));
+             }},
+        });
+
+    // Each variant compacts its own parsed copy in place; the answer is the
+    // count followed by the surviving prefix. simd_int64 runs the 64-bit lanes
+    // on a widened copy.
+    auto appendUnique = [](string& out, const auto& a, size_t k) {
+        appendInt(out, (long long)k);
+        for (size_t i = 0; i < k; i++) {
+            out += ' ';
+            appendInt(out, (long long)a[i]);
+        }
+    };
+    addProblem<vector<int>>(reg, "array/remove_duplicates", "n a_1..a_n (ascending) -> k and the k distinct values",
+        readArray, {
+            {"brute", [=](vector<int>& a, string& out) {
+                 appendUnique(out, a, a.empty() ? 0 : arr04::removeDuplicatesBruteForce(a.data(), (int)a.size()));
+             }},
+            {"optimal", [=](vector<int>& a, string& out) {
+                 appendUnique(out, a, a.empty() ? 0 : arr04::removeDuplicates(a.data(), (int)a.size()));
+             }},
+            {"simd", [=](vector<int>& a, string& out) { appendUnique(out, a, arr04::removeDuplicatesSimd(a.data(), a.size())); }},
+            {"simd_int64", [=](vector<int>& a, string& out) {
+                 vector<int64_t> wide(a.begin(), a.end());
+                 appendUnique(out, wide, arr04::removeDuplicatesSimd(wide.data(), wide.size()));
+             }},
+        });
+
+    // optimal and parallel fold the two-array merge over the runs, so the
+    // last merge covers every element. parallel and k_way run on 4 threads:
+    // with one thread both fall back to the sequential merge, and their
+    // merge-path and rank-cut code would never run.
+    addProblem<SortedRuns>(reg, "array/merge_sorted", "k then k runs n_i a_1..a_{n_i} -> all values in ascending order",
+        readSortedRuns, {
+            {"sort", [](SortedRuns& s, string& out) {
+                 vector<int> all;
+                 for (auto& run : s.runs) all.insert(all.end(), run.begin(), run.end());
+                 sort(all.begin(), all.end());
+                 appendInts(out, all);
+             }},
+            {"optimal", [](SortedRuns& s, string& out) {
+                 vector<int> merged;
+                 for (auto& run : s.runs) {
+                     int m = (int)merged.size();
+                     merged.resize(m + run.size());
+                     arr33::mergeArrays(merged, m, run, (int)run.size());
+                 }
+                 appendInts(out, merged);
+             }},
+            {"parallel", [](SortedRuns& s, string& out) {
+                 vector<int> merged;
+                 for (auto& run : s.runs) {
+                     int m = (int)merged.size();
+                     merged.resize(m + run.size());
+                     arr33::mergeArraysParallel(merged, m, run, (int)run.size(), 4);
+                 }
+                 appendInts(out, merged);
+             }},
+            {"k_way", [](SortedRuns& s, string& out) { appendInts(out, arr33::kWayMerge(s.runs, 4)); }},
+        });
+
+    // The brute force and the recursive merge sort count in int: n <= 65536.
+    // The other variants count in 64 bits.
+    addProblem<vector<int>>(reg, "array/inversions", "n a_1..a_n -> number of pairs i < j with a_i > a_j",
+        readArray, {
+            {"brute", [](vector<int>& a, string& out) { appendInt(out, arr37::numberOfInversionsBruteForce(a, (int)a.size())); }},
+            {"optimal", [](vector<int>& a, string& out) { appendInt(out, arr37::numberOfInversions(a, (int)a.size())); }},
+            {"fenwick", [](vector<int>& a, string& out) { appendInt(out, arr37::numberOfInversionsFenwick(a)); }},
+            {"parallel", [](vector<int>& a, string& out) { appendInt(out, arr37::numberOfInversionsParallel(a, 1)); }},
+        });
+    // parallel_int64 and parallel_double run the same engine on widened
+    // copies, so the __int128 and floating-point comparisons are checked too.
+    addProblem<vector<int>>(reg, "array/reverse_pairs", "n a_1..a_n -> number of pairs i < j with a_i > 2 * a_j",
+        readArray, {
+            {"brute", [](vector<int>& a, string& out) { appendInt(out, arr38::teamBruteForce(a, (int)a.size())); }},
+            {"optimal", [](vector<int>& a, string& out) { appendInt(out, arr38::team(a, (int)a.size())); }},
+            {"parallel", [](vector<int>& a, string& out) { appendInt(out, arr38::teamParallel(a, 1)); }},
+            {"parallel_int64", [](vector<int>& a, string& out) {
+                 vector<int64_t> wide(a.begin(), a.end());
+                 appendInt(out, arr38::countSignificantPairs<int64_t>(wide, 2, 0, 1));
+             }},
+            {"parallel_double", [](vector<int>& a, string& out) {
+                 vector<double> wide(a.begin(), a.end());
+                 appendInt(out, arr38::countSignificantPairs<double>(wide, 2, 0, 1));
+             }},
+        });
+}
+
+inline void registerGraphProblems(ProblemRegistry& reg) {
+    addProblem<vector<vector<int>>>(reg, "graph/provinces", "n then the n x n 0/1 adjacency matrix -> number of provinces",
+        [](TokenReader& in) {
+            size_t n = in.count();
+            vector<vector<int>> m(n);
+            for (auto& row : m) row = in.ints(n);
+            return m;
+        }, {
+            {"brute", [](vector<vector<int>>& m, string& out) { appendInt(out, g02::countProvincesBruteForce(m)); }},
+            {"optimal", [](vector<vector<int>>& m, string& out) { appendInt(out, g02::countProvincesOptimal(m)); }},
+            {"bitset", [](vector<vector<int>>& m, string& out) { appendInt(out, g02::countProvincesBitset(m)); }},
+        });
+
+    auto undirected = [](TokenReader& in) { return readGraph(in, false); };
+    addProblem<GraphInput>(reg, "graph/bipartite", "V E then E undirected edges u v -> true/false",
+        undirected, {
+            {"brute", [](GraphInput& g, string& out) { appendBool(out, g05::isBipartiteBruteForce(g.V, adjacencyMatrix(g))); }},
+            {"optimal", [](GraphInput& g, string& out) { appendBool(out, g05::isBipartiteOptimal(g.V, adjacencyList(g))); }},
+        });
+
+    addProblem<GraphInput>(reg, "graph/cycle", "V E then E undirected edges u v -> true/false (has a cycle)",
+        undirected, {
+            {"brute", [](GraphInput& g, string& out) { appendBool(out, g14::isCycleBruteForce(g.V, adjacencyMatrix(g))); }},
+            {"optimal", [](GraphInput& g, string& out) { appendBool(out, g14::isCycleOptimal(g.V, adjacencyList(g))); }},
+        });
+
+    addProblem<GraphInput>(reg, "graph/make_connected", "n E then E cables u v -> operations to connect all, or -1",
+        undirected, {
+            {"brute", [](GraphInput& g, string& out) { appendInt(out, g10::Solution().makeConnectedBruteForce(g.V, g.edges)); }},
+            {"optimal", [](GraphInput& g, string& out) { appendInt(out, g10::Solution().makeConnectedOptimal(g.V, g.edges)); }},
+        });
+
+    using Dijkstra = vector<int> (*)(int, const vector<vector<pair<int, int>>>&, int);
+    auto dijkstra = [](Dijkstra run) {
+        return [run](GraphInput& g, string& out) {
+            vector<vector<pair<int, int>>> adj(g.V);
+            for (auto& e : g.edges) {
+                adj[e[0]].push_back({e[1], e[2]});
+                adj[e[1]].push_back({e[0], e[2]});
+            }
+            vector<int> dist = run(g.V, adj, g.source);
+            for (int& d : dist)
+                if (d == numeric_limits<int>::max()) d = -1;
+            appendInts(out, dist);
+        };
+    };
+    addProblem<GraphInput>(reg, "graph/dijkstra",
+        "V E S then E undirected edges u v w (w >= 0) -> distance from S to every vertex, -1 if unreachable",
+        [](TokenReader& in) { return readGraph(in, true, true); }, {
+            {"brute", dijkstra(g06::dijkstraBruteForce)},
+            {"optimal", dijkstra(g06::dijkstraOptimal)},
+            {"set", dijkstra(g06::dijkstraSet)},
+            {"dary_heap", dijkstra(g06::dijkstraIndexed<IndexedDaryHeap<4>>)},
+            {"radix_heap", dijkstra(g06::dijkstraIndexed<IndexedRadixHeap>)},
+        });
+
+    struct Flights {
+        int n = 0, src = 0, dst = 0, k = 0;
+        vector<vector<int>> flights; // {from, to, price}
+    };
+    addProblem<Flights>(reg, "graph/cheapest_flight",
+        "n E src dst K then E directed flights u v price (price <= 10000) -> cheapest fare with at most K stops, or -1",
+        [](TokenReader& in) {
+            Flights c;
+            c.n = (int)in.integer(1, INT32_MAX);
+            size_t E = in.count(3);
+            c.src = (int)in.integer(0, c.n - 1);
+            c.dst = (int)in.integer(0, c.n - 1);
+            c.k = (int)in.integer(0, INT32_MAX);
+            c.flights.resize(E);
+            for (auto& f : c.flights) {
+                int u = (int)in.integer(0, c.n - 1), v = (int)in.integer(0, c.n - 1);
+                f = {u, v, (int)in.integer(0, 10000)};
+            }
+            return c;
+        }, {
+            {"brute", [](Flights& c, string& out) { appendInt(out, g31::Solution().CheapestFLight(c.n, c.flights, c.src, c.dst, c.k)); }},
+            {"optimal", [](Flights& c, string& out) {
+                 // More than n - 2 stops cannot beat the cheapest simple path
+                 int stops = max(0, min(c.k, c.n - 2));
+                 // fares[s] = cheapest with at most s stops; cached per route so
+                 // a later query with a smaller K is a lookup
+                 Hasher128 key;
+                 key.text("graph.cheapest_flight.fares").value(c.n).value(c.src).value(c.dst);
+                 for (const auto& f : c.flights) key.values(f);
+                 auto faresUpTo = [&](int maxStops) {
+                     vector<g31::FareQuery> queries;
+                     for (int s = 0; s <= maxStops; s++) queries.push_back({c.src, c.dst, s});
+                     return g31::FareEngine(c.n, c.flights).cheapestBatch(queries, 1);
+                 };
+                 vector<int> fares = cachedVector<int>(key.digest(), [&] { return faresUpTo(stops); });
+                 if ((int)fares.size() <= stops) {
+                     fares = faresUpTo(stops);
+                     if (ResultCache* cache = ResultCache::shared())
+                         cache->store(key.digest(), string((const char*)fares.data(), fares.size() * sizeof(int)));
+                 }
+                 appendInt(out, fares[stops]);
+             }},
+        });
+
+    auto weighted = [](TokenReader& in) { return readGraph(in, true); };
+    addProblem<GraphInput>(reg, "graph/mst", "V E then E undirected edges u v w -> minimum spanning forest weight",
+        weighted, {
+            {"brute", [](GraphInput& g, string& out) { appendInt(out, g37::kruskalBruteForce(g.V, g.edges)); }},
+            {"optimal", [](GraphInput& g, string& out) { appendInt(out, g37::kruskalOptimal(g.V, g.edges)); }},
+            {"filter", [](GraphInput& g, string& out) {
+                 vector<WeightedEdge> edges = g37::toWeightedEdges(g.edges);
+                 appendInt(out, g37::filterKruskal(g.V, edges, 1));
+             }},
+        });
+
+    struct WordLadder {
+        string begin, end;
+        vector<string> words;
+    };
+    auto appendLadders = [](string& out, vector<vector<string>> ladders) {
+        if (ladders.empty()) out += "-1";
+        sort(ladders.begin(), ladders.end());
+        for (size_t i = 0; i < ladders.size(); i++) {
+            if (i) out += " | ";
+            for (size_t j = 0; j < ladders[i].size(); j++) {
+                if (j) out += ' ';
+                out += ladders[i][j];
+            }
+        }
+    };
+    addProblem<WordLadder>(reg, "graph/word_ladder",
+        "begin end N w_1..w_N (lowercase) -> every shortest ladder, sorted, separated by \" | \" (-1 if none)",
+        [](TokenReader& in) {
+            WordLadder c;
+            c.begin = string(in.word());
+            c.end = string(in.word());
+            size_t n = in.count();
+            c.words.resize(n);
+            for (string& w : c.words) w = string(in.word());
+            return c;
+        }, {
+            {"brute", [=](WordLadder& c, string& out) {
+                 appendLadders(out, g19::Solution().findSequences(c.begin, c.end, c.words));
+             }},
+            {"optimal", [=](WordLadder& c, string& out) { appendLadders(out, g19::findSequencesDag(c.begin, c.end, c.words)); }},
+        });
+
+    // One dictionary, many queries: optimal indexes it once and reuses its
+    // generation-stamped search state across the queries
+    struct LadderQueries {
+        vector<string> words;
+        vector<pair<string, string>> queries;
+    };
+    addProblem<LadderQueries>(reg, "graph/ladder_length",
+        "N w_1..w_N (lowercase) then q begin/end word pairs -> words in each shortest ladder (0 if none)",
+        [](TokenReader& in) {
+            LadderQueries c;
+            c.words.resize(in.count());
+            for (string& w : c.words) w = string(in.word());
+            c.queries.resize(in.count(2));
+            for (auto& [begin, end] : c.queries) {
+                begin = string(in.word());
+                end = string(in.word());
+            }
+            return c;
+        }, {
+            {"brute", [](LadderQueries& c, string& out) {
+                 vector<int> lengths;
+                 for (auto& [begin, end] : c.queries) lengths.push_back(g18::Solution().wordLadderLength(begin, end, c.words));
+                 appendInts(out, lengths);
+             }},
+            {"optimal", [](LadderQueries& c, string& out) {
+                 g18::BidirectionalLadder ladder(c.words);
+                 vector<int> lengths;
+                 for (auto& [begin, end] : c.queries) lengths.push_back(ladder.ladderLength(begin, end));
+                 appendInts(out, lengths);
+             }},
+        });
+
+    // Pairs "a b": course a needs course b first
+    auto prerequisites = [](TokenReader& in) {
+        GraphInput g = readGraph(in, false);
+        vector<pair<int, int>> pairs;
+        pairs.reserve(g.edges.size());
+        for (auto& e : g.edges) pairs.push_back({e[0], e[1]});
+        return make_pair(g.V, pairs);
+    };
+    using Courses = pair<int, vector<pair<int, int>>>;
+    // The same catalog's topological order answers both problems
+    auto topoOrder = [](Courses& c) {
+        Hasher128 key;
+        key.text("graph.topo_order").value(c.first).value((uint64_t)c.second.size());
+        for (auto [a, b] : c.second) key.value(a).value(b);
+        return cachedVector<int>(key.digest(), [&] { return g24::findOrderOptimal(c.first, c.second); });
+    };
+    addProblem<Courses>(reg, "graph/can_finish", "N P then P pairs a b (a needs b) -> true/false",
+        prerequisites, {
+            {"brute", [](Courses& c, string& out) { appendBool(out, g24::canFinishBruteForce(c.first, c.second)); }},
+            {"optimal", [=](Courses& c, string& out) { appendBool(out, !topoOrder(c).empty()); }},
+        });
+    addProblem<Courses>(reg, "graph/course_order", "N P then P pairs a b (a needs b) -> an order, or \"impossible\"",
+        prerequisites, {
+            {"optimal", [=](Courses& c, string& out) {
+                 vector<int> order = topoOrder(c);
+                 if (order.empty() && c.first > 0) out += "impossible";
+                 else appendInts(out, order);
+             }},
+        });
+}
+
+// prob_09 and prob_10 keep their input in globals for the brute force and
+// table versions; those kernels take turns on them.
+inline mutex dp09Globals, dp10Globals;
+
+inline void registerDpProblems(ProblemRegistry& reg) {
+    const long long MOD = 1000000007;
+    // The exact count fits a long long up to n = 91; past that optimal
+    // switches to the modular fast doubling. brute is exponential.
+    const long long STAIRS_EXACT_MAX = 90, STAIRS_BRUTE_MAX = 40;
+    addProblem<long long>(reg, "dp/stairs", "n -> ways to climb n stairs by 1 or 2, mod 1e9+7 (brute: n <= 40)",
+        [](TokenReader& in) { return in.integer(0, INT32_MAX); }, {
+            {"brute", [=](long long& n, string& out) {
+                 if (n > STAIRS_BRUTE_MAX)
+                     throw invalid_argument("brute force takes exponential time; n must be <= " + to_string(STAIRS_BRUTE_MAX));
+                 appendInt(out, dp01::waysBruteForce((int)n) % MOD);
+             }},
+            {"optimal", [=](long long& n, string& out) {
+                 if (n > STAIRS_EXACT_MAX) appendInt(out, (long long)dp01::waysMod(n, MOD));
+                 else appendInt(out, dp01::waysOptimal((int)n) % MOD);
+             }},
+            {"fast_doubling", [=](long long& n, string& out) { appendInt(out, (long long)dp01::waysMod(n, MOD)); }},
+        });
+
+    auto heights = [](TokenReader& in) {
+        vector<int> h = readArray(in);
+        if (h.empty()) in.fail("need at least one stone");
+        return h;
+    };
+    addProblem<vector<int>>(reg, "dp/frog", "n h_1..h_n -> minimum energy to jump from the first stone to the last",
+        heights, {
+            {"brute", [](vector<int>& h, string& out) { appendInt(out, dp02::frogBrute((int)h.size() - 1, h)); }},
+            {"optimal", [](vector<int>& h, string& out) { appendInt(out, dp02::frogOptimal(h)); }},
+            {"streaming", [](vector<int>& h, string& out) { appendInt(out, dp02::frogStreamCost(h.begin(), h.end())); }},
+        });
+
+    using FrogK = pair<int, vector<int>>;
+    addProblem<FrogK>(reg, "dp/frog_k", "n k h_1..h_n -> minimum energy with jumps of up to k stones",
+        [](TokenReader& in) {
+            size_t n = in.count();
+            int k = (int)in.integer(1, INT32_MAX);
+            if (n == 0) in.fail("need at least one stone");
+            return FrogK(k, in.ints(n));
+        }, {
+            {"memo", [](FrogK& c, string& out) { appendInt(out, dp03::solve((int)c.second.size(), c.second, c.first)); }},
+            {"optimal", [](FrogK& c, string& out) { appendInt(out, dp03::solveBottomUp(c.second, c.first)); }},
+        });
+
+    auto readGrid = [](TokenReader& in) {
+        size_t n = in.count(), m = in.count();
+        if (n == 0 || m == 0) in.fail("empty grid");
+        vector<vector<int>> grid(n);
+        for (auto& row : grid) row = in.ints(m);
+        return grid;
+    };
+    using Grid = vector<vector<int>>;
+    addProblem<Grid>(reg, "dp/grid_min_cost", "n m then the n x m grid -> cheapest right/down path sum",
+        readGrid, {
+            {"brute", [](Grid& g, string& out) {
+                 lock_guard<mutex> lock(dp09Globals);
+                 dp09::grid = g;
+                 dp09::n = (int)g.size(), dp09::m = (int)g[0].size();
+                 appendInt(out, dp09::minCostBrute(0, 0));
+             }},
+            {"table", [](Grid& g, string& out) {
+                 lock_guard<mutex> lock(dp09Globals);
+                 dp09::grid = g;
+                 dp09::n = (int)g.size(), dp09::m = (int)g[0].size();
+                 appendInt(out, dp09::minCostDP());
+             }},
+            {"optimal", [](Grid& g, string& out) { appendInt(out, dp09::minCostWavefront(FlatGrid<int>::fromNested(g), 1)); }},
+        });
+
+    addProblem<Grid>(reg, "dp/triangle", "n then rows 1..n of the triangle -> minimum top-to-bottom path sum",
+        [](TokenReader& in) {
+            size_t n = in.count();
+            if (n == 0) in.fail("empty triangle");
+            Grid t(n);
+            for (size_t r = 0; r < n; r++) t[r] = in.ints(r + 1);
+            return t;
+        }, {
+            {"brute", [](Grid& t, string& out) {
+                 lock_guard<mutex> lock(dp10Globals);
+                 dp10::triangle = t;
+                 dp10::n = (int)t.size();
+                 appendInt(out, dp10::minPathBrute(0, 0));
+             }},
+            {"rolling", [](Grid& t, string& out) {
+                 lock_guard<mutex> lock(dp10Globals);
+                 dp10::triangle = t;
+                 dp10::n = (int)t.size();
+                 appendInt(out, dp10::minPathDP());
+             }},
+            {"optimal", [](Grid& t, string& out) { appendInt(out, dp10::minPathPacked(dp10::PackedTriangle::fromNested(t))); }},
+        });
+
+    addProblem<Grid>(reg, "dp/chocolates",
+        "n m then the n x m grid (cells >= 0) -> most chocolates two friends collect from (0, 0) and (0, m-1) down to row n-1",
+        readGrid, {
+            {"memo", [](Grid& g, string& out) {
+                 appendInt(out, dp13::MemoSolution().maximumChocolates((int)g.size(), (int)g[0].size(), g));
+             }},
+            {"tabulation", [](Grid& g, string& out) {
+                 appendInt(out, dp13::TabulationSolution().maximumChocolates((int)g.size(), (int)g[0].size(), g));
+             }},
+            {"optimal", [](Grid& g, string& out) {
+                 appendInt(out, dp13::RollingSolution().maximumChocolates((int)g.size(), (int)g[0].size(), g, 1));
+             }},
+        });
+
+    addProblem<vector<int>>(reg, "dp/min_partition", "n a_1..a_n (a_i >= 0) -> minimum difference of a two-way split",
+        readArray, {
+            {"brute", [](vector<int>& a, string& out) { appendInt(out, dp15::bruteForce(a)); }},
+            {"optimal", [](vector<int>& a, string& out) { appendInt(out, dp15::optimalDP(a)); }},
+            {"bitset", [](vector<int>& a, string& out) { appendInt(out, dp15::optimalDPBitset(a)); }},
+        });
+
+    auto sumTarget = [](TokenReader& in) {
+        ArrayWithTarget c = readArrayWithTarget(in);
+        if (c.target < 0) in.fail("target must be non-negative");
+        return c;
+    };
+    addProblem<ArrayWithTarget>(reg, "dp/subset_count",
+        "n K a_1..a_n (a_i >= 0) -> subsets summing to K (all_targets: mod 1e9+7)",
+        sumTarget, {
+            {"brute", [](ArrayWithTarget& c, string& out) { appendInt(out, dp16::bruteForce(c.a, (int)c.target)); }},
+            {"optimal", [](ArrayWithTarget& c, string& out) { appendInt(out, dp16::optimalDP(c.a, (int)c.target)); }},
+            {"all_targets", [](ArrayWithTarget& c, string& out) {
+                 appendInt(out, dp16::allTargetCounts(c.a, (int)c.target)[c.target]);
+             }},
+        });
+
+    // prob_17's memo and tabulation stop at target 0 and so miss subsets
+    // that add zeros; only AllTargetsSolution counts those, hence a_i >= 1
+    addProblem<ArrayWithTarget>(reg, "dp/subset_count_positive",
+        "n K a_1..a_n (n >= 1, a_i >= 1) -> subsets summing to K, mod 1e9+7 (memo, tabulation: exact int)",
+        [=](TokenReader& in) {
+            ArrayWithTarget c = sumTarget(in);
+            if (c.a.empty()) in.fail("need at least one element");
+            for (int x : c.a)
+                if (x < 1) in.fail("elements must be positive");
+            return c;
+        }, {
+            {"memo", [](ArrayWithTarget& c, string& out) { appendInt(out, dp17::MemoSolution().countSubsets(c.a, (int)c.target)); }},
+            {"tabulation", [](ArrayWithTarget& c, string& out) {
+                 appendInt(out, dp17::TabulationSolution().countSubsets(c.a, (int)c.target));
+             }},
+            {"optimal", [](ArrayWithTarget& c, string& out) {
+                 appendInt(out, dp17::AllTargetsSolution().countAll(c.a, (int)c.target)[c.target]);
+             }},
+        });
+
+    // prob_14's solvers index a[0]: the empty set only reaches K = 0
+    auto subsetSumToK = [](auto solver, ArrayWithTarget& c) {
+        return c.a.empty() ? c.target == 0 : solver.subsetSumToK((int)c.a.size(), (int)c.target, c.a);
+    };
+    addProblem<ArrayWithTarget>(reg, "dp/subset_sum", "n K a_1..a_n (a_i >= 0) -> true/false (some subset sums to K)",
+        sumTarget, {
+            {"brute", [](ArrayWithTarget& c, string& out) { appendBool(out, dp16::bruteForce(c.a, (int)c.target) > 0); }},
+            {"memo", [=](ArrayWithTarget& c, string& out) { appendBool(out, subsetSumToK(dp14::MemoSolution(), c)); }},
+            {"tabulation", [=](ArrayWithTarget& c, string& out) {
+                 appendBool(out, subsetSumToK(dp14::TabulationSolution(), c));
+             }},
+            {"bitset", [=](ArrayWithTarget& c, string& out) { appendBool(out, subsetSumToK(dp14::BitsetSolution(), c)); }},
+            {"optimal", [](ArrayWithTarget& c, string& out) {
+                 // With a cache, a table over every sum of the multiset is
+                 // kept, so the same elements with another K are a lookup.
+                 // Building it costs total / K times a direct run, so it is
+                 // only built when K is a large share of the total; smaller
+                 // K use a table already cached, else run up to K alone.
+                 const long long TABLE_MAX_SUM = 1LL << 26, TABLE_MAX_RATIO = 4;
+                 long long total = 0;
+                 bool negative = false;
+                 for (int x : c.a) {
+                     total += x;
+                     negative |= x < 0;
+                 }
+                 ResultCache* cache = ResultCache::shared();
+                 if (!cache || negative || total > TABLE_MAX_SUM) {
+                     appendBool(out, reachableSums(c.a, c.target).test(c.target));
+                     return;
+                 }
+                 if (c.target > total) {
+                     appendBool(out, false);
+                     return;
+                 }
+                 vector<int> sorted = c.a;
+                 sort(sorted.begin(), sorted.end());
+                 Hasher128 key;
+                 key.text("dp.subset_sum.table").values(sorted);
+                 size_t words = (size_t)(total + 64) / 64;
+                 if (ResultCache::Value hit = cache->find(key.digest()); hit && hit->size() == words * sizeof(uint64_t)) {
+                     vector<uint64_t> table(words);
+                     memcpy(table.data(), hit->data(), hit->size());
+                     appendBool(out, SumBitset(total, move(table)).test(c.target));
+                 } else if (c.target * TABLE_MAX_RATIO >= total) {
+                     SumBitset table = reachableSums(sorted, total);
+                     cache->store(key.digest(), string((const char*)table.data().data(), words * sizeof(uint64_t)));
+                     appendBool(out, table.test(c.target));
+                 } else {
+                     appendBool(out, reachableSums(c.a, c.target).test(c.target));
+                 }
+             }},
+        });
+
+    addProblem<ArrayWithTarget>(reg, "dp/count_partitions",
+        "n d a_1..a_n (n >= 1, a_i >= 0, d >= 0) -> two-way splits whose sums differ by d, mod 1e9+7 "
+        "(rolling: the exact count must fit an int)",
+        [](TokenReader& in) {
+            ArrayWithTarget c = readArrayWithTarget(in);
+            if (c.a.empty()) in.fail("need at least one element");
+            if (c.target < 0) in.fail("d must be non-negative");
+            for (int x : c.a)
+                if (x < 0) in.fail("elements must be non-negative");
+            return c;
+        }, {
+            {"rolling", [=](ArrayWithTarget& c, string& out) {
+                 appendInt(out, dp18::Solution().countPartitions(c.a, (int)c.target) % MOD);
+             }},
+            {"optimal", [](ArrayWithTarget& c, string& out) {
+                 appendInt(out, dp18::Solution().countPartitionsMany(c.a, {c.target})[0]);
+             }},
+        });
+
+    // Many pairs per case, so optimal's pattern cache sees repeated patterns
+    using PatternTexts = vector<pair<string, string>>;
+    auto matchAll = [](PatternTexts& pairs, string& out, auto&& match) {
+        for (auto& [pattern, text] : pairs) out += match(pattern, text) ? '1' : '0';
+    };
+    addProblem<PatternTexts>(reg, "dp/wildcard",
+        "q then q pattern/text word pairs ('?' any one character, '*' any run) -> one 1/0 per pair",
+        [](TokenReader& in) {
+            PatternTexts pairs(in.count(2));
+            for (auto& [pattern, text] : pairs) {
+                pattern = string(in.word());
+                text = string(in.word());
+            }
+            return pairs;
+        }, {
+            {"memo", [=](PatternTexts& pairs, string& out) {
+                 dp19::MemoSolution sol;
+                 matchAll(pairs, out, [&](string& p, string& t) { return sol.wildcardMatching(p, t); });
+             }},
+            {"tabulation", [=](PatternTexts& pairs, string& out) {
+                 dp19::TabulationSolution sol;
+                 matchAll(pairs, out, [&](string& p, string& t) { return sol.wildcardMatching(p, t); });
+             }},
+            {"optimal", [=](PatternTexts& pairs, string& out) {
+                 dp19::CompiledSolution sol;
+                 matchAll(pairs, out, [&](string& p, string& t) { return sol.wildcardMatching(p, t); });
+             }},
+        });
+}
+
+inline void registerAllProblems(ProblemRegistry& reg) {
+    registerArrayProblems(reg);
+    registerGraphProblems(reg);
+    registerDpProblems(reg);
+}
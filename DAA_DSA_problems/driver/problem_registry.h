@@ -0,0 +1,164 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Name -> kernel registry and the token reader used by the multi-problem
+// driver (driver.cpp).
+//
+// A kernel is one variant of one problem, e.g. "graph/dijkstra" with variant
+// "optimal". Its parse function reads one test case from the batch and
+// returns the task that solves it; the driver parses every case up front on
+// one thread, then runs the tasks on a thread pool, so a task must only use
+// what it captured. A task appends its answer to out, without the trailing
+// newline. Every problem registers a variant called "optimal", which is what
+// a case header without ":variant" runs.
+
+// Whitespace-separated tokens over an in-memory batch. A '#' at the start of
+// a token comments out the rest of its line. Errors throw runtime_error
+// naming the line, since a bad token leaves the rest of the batch unreadable.
+class TokenReader {
+    const char* begin;
+    const char* p;
+    const char* end;
+
+    void skipBlanks() {
+        while (p < end) {
+            if (*p == '#') {
+                while (p < end && *p != '\n') p++;
+            } else if (*p == ' ' || *p == '\n' || *p == '\t' || *p == '\r') {
+                p++;
+            } else {
+                return;
+            }
+        }
+    }
+
+    std::string_view token(const char* what) {
+        skipBlanks();
+        if (p == end) fail(std::string("expected ") + what + ", found end of input");
+        const char* start = p;
+        while (p < end && *p != ' ' && *p != '\n' && *p != '\t' && *p != '\r') p++;
+        return std::string_view(start, static_cast<std::size_t>(p - start));
+    }
+
+public:
+    TokenReader(const char* first, const char* last) : begin(first), p(first), end(last) {}
+    explicit TokenReader(std::string_view text) : TokenReader(text.data(), text.data() + text.size()) {}
+
+    bool atEnd() {
+        skipBlanks();
+        return p == end;
+    }
+
+    // Next unread character: the tokens between two positions are what a
+    // parse consumed (the driver hashes them into the case's cache key).
+    const char* position() const { return p; }
+
+    // 1-based line of the next unread character.
+    std::size_t line() const {
+        std::size_t n = 1;
+        for (const char* q = begin; q < p; q++) n += *q == '\n';
+        return n;
+    }
+
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::runtime_error("line " + std::to_string(line()) + ": " + message);
+    }
+
+    std::string_view word() { return token("a word"); }
+
+    long long integer() {
+        std::string_view t = token("an integer");
+        long long v = 0;
+        const char* first = t.data() + (t.size() > 1 && t[0] == '+');
+        auto [last, ec] = std::from_chars(first, t.data() + t.size(), v);
+        if (ec != std::errc() || last != t.data() + t.size()) fail("expected an integer, found \"" + std::string(t) + "\"");
+        return v;
+    }
+
+    // An integer in [lo, hi].
+    long long integer(long long lo, long long hi) {
+        long long v = integer();
+        if (v < lo || v > hi)
+            fail(std::to_string(v) + " out of range [" + std::to_string(lo) + ", " + std::to_string(hi) + "]");
+        return v;
+    }
+
+    int int32() { return static_cast<int>(integer(INT32_MIN, INT32_MAX)); }
+
+    // A token count, bounded by what the rest of the input could hold (one
+    // character and a separator per token), so a corrupt count fails here
+    // instead of in a huge allocation.
+    std::size_t count(std::size_t tokensEach = 1) {
+        long long room = static_cast<long long>((end - p) / 2 + 1);
+        return static_cast<std::size_t>(integer(0, room / static_cast<long long>(tokensEach ? tokensEach : 1)));
+    }
+
+    std::vector<int> ints(std::size_t n) {
+        std::vector<int> v(n);
+        for (int& x : v) x = int32();
+        return v;
+    }
+};
+
+using CaseTask = std::function<void(std::string& out)>;
+
+struct ProblemKernel {
+    std::string problem; // "graph/dijkstra"
+    std::string variant; // "optimal", "brute", ...
+    std::string format;  // one-line description of the case input and answer
+    std::function<CaseTask(TokenReader&)> parse;
+};
+
+class ProblemRegistry {
+    std::map<std::string, ProblemKernel, std::less<>> kernels; // "problem:variant"
+
+public:
+    void add(ProblemKernel kernel) {
+        std::string key = kernel.problem + ":" + kernel.variant;
+        if (!kernels.emplace(key, std::move(kernel)).second)
+            throw std::logic_error("ProblemRegistry: " + key + " registered twice");
+    }
+
+    // spec is "problem" (the optimal variant) or "problem:variant"; nullptr
+    // if nothing matches.
+    const ProblemKernel* find(std::string_view spec) const {
+        std::string key(spec);
+        if (spec.find(':') == std::string_view::npos) key += ":optimal";
+        auto it = kernels.find(key);
+        return it == kernels.end() ? nullptr : &it->second;
+    }
+
+    // Every kernel, ordered by problem then variant.
+    std::vector<const ProblemKernel*> all() const {
+        std::vector<const ProblemKernel*> out;
+        for (const auto& [key, kernel] : kernels) out.push_back(&kernel);
+        return out;
+    }
+};
+
+// Output helpers for tasks.
+inline void appendInt(std::string& out, long long v) {
+    char buf[24];
+    auto [last, ec] = std::to_chars(buf, buf + sizeof buf, v);
+    (void)ec;
+    out.append(buf, last);
+}
+
+template <class Range>
+void appendInts(std::string& out, const Range& values) {
+    bool first = true;
+    for (const auto& v : values) {
+        if (!first) out += ' ';
+        first = false;
+        appendInt(out, static_cast<long long>(v));
+    }
+}